@@ -0,0 +1,80 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#pragma once
+
+#include <AT/Types.h>
+
+#if AT_COMPILER_MSVC
+    #include <intrin.h>
+#endif // AT_COMPILER_MSVC
+
+namespace AT {
+
+// NOTE: The value must not be zero, as the result would be undefined.
+NODISCARD ALWAYS_INLINE u32 count_trailing_zeroes(u64 value)
+{
+#if AT_COMPILER_MSVC
+    unsigned long bit_index;
+    _BitScanForward64(&bit_index, value);
+    return static_cast<u32>(bit_index);
+#else
+    return static_cast<u32>(__builtin_ctzll(value));
+#endif // AT_COMPILER_MSVC
+}
+
+// NOTE: The value must not be zero, as the result would be undefined.
+NODISCARD ALWAYS_INLINE u32 count_leading_zeroes(u64 value)
+{
+#if AT_COMPILER_MSVC
+    unsigned long bit_index;
+    _BitScanReverse64(&bit_index, value);
+    return 63 - static_cast<u32>(bit_index);
+#else
+    return static_cast<u32>(__builtin_clzll(value));
+#endif // AT_COMPILER_MSVC
+}
+
+NODISCARD ALWAYS_INLINE u32 population_count(u64 value)
+{
+#if AT_COMPILER_MSVC
+    return static_cast<u32>(__popcnt64(value));
+#else
+    return static_cast<u32>(__builtin_popcountll(value));
+#endif // AT_COMPILER_MSVC
+}
+
+NODISCARD ALWAYS_INLINE constexpr u64 rotate_left(u64 value, u32 shift)
+{
+    shift &= 63;
+    return (shift == 0) ? value : ((value << shift) | (value >> (64 - shift)));
+}
+
+NODISCARD ALWAYS_INLINE constexpr u64 rotate_right(u64 value, u32 shift)
+{
+    shift &= 63;
+    return (shift == 0) ? value : ((value >> shift) | (value << (64 - shift)));
+}
+
+NODISCARD ALWAYS_INLINE constexpr bool is_power_of_two(u64 value)
+{
+    return (value != 0) && ((value & (value - 1)) == 0);
+}
+
+// NOTE: The alignment must be a power of two.
+NODISCARD ALWAYS_INLINE constexpr u64 align_up(u64 value, u64 alignment)
+{
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+} // namespace AT
+
+using AT::align_up;
+using AT::count_leading_zeroes;
+using AT::count_trailing_zeroes;
+using AT::is_power_of_two;
+using AT::population_count;
+using AT::rotate_left;
+using AT::rotate_right;
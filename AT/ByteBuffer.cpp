@@ -41,7 +41,10 @@ ByteBuffer::~ByteBuffer()
 ByteBuffer::ByteBuffer(ByteBuffer&& other) noexcept
     : m_bytes(other.m_bytes)
     , m_byte_count(other.m_byte_count)
-{}
+{
+    other.m_bytes = nullptr;
+    other.m_byte_count = 0;
+}
 
 ByteBuffer& ByteBuffer::operator=(ByteBuffer&& other) noexcept
 {
@@ -52,6 +55,8 @@ ByteBuffer& ByteBuffer::operator=(ByteBuffer&& other) noexcept
     free();
     m_bytes = other.m_bytes;
     m_byte_count = other.m_byte_count;
+    other.m_bytes = nullptr;
+    other.m_byte_count = 0;
     return *this;
 }
 
@@ -0,0 +1,168 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#pragma once
+
+#include <AT/Assertions.h>
+#include <AT/New.h>
+#include <AT/Types.h>
+
+namespace AT {
+
+// First-in, first-out queue stored in a ring buffer. Enqueuing and dequeuing elements never
+// allocate memory, unless the queue is full and the ring buffer must grow.
+template<typename T>
+class CircularQueue {
+    AT_MAKE_NONCOPYABLE(CircularQueue);
+
+public:
+    static constexpr usize growth_factor_numerator = 3;
+    static constexpr usize growth_factor_denominator = 2;
+    static constexpr usize minimum_capacity = 8;
+    static_assert(growth_factor_numerator > growth_factor_denominator);
+
+public:
+    ALWAYS_INLINE CircularQueue()
+        : m_elements(nullptr)
+        , m_capacity(0)
+        , m_head_index(0)
+        , m_count(0)
+    {}
+
+    ALWAYS_INLINE CircularQueue(CircularQueue&& other) noexcept
+        : m_elements(other.m_elements)
+        , m_capacity(other.m_capacity)
+        , m_head_index(other.m_head_index)
+        , m_count(other.m_count)
+    {
+        other.m_elements = nullptr;
+        other.m_capacity = 0;
+        other.m_head_index = 0;
+        other.m_count = 0;
+    }
+
+    ALWAYS_INLINE ~CircularQueue() { clear_and_shrink(); }
+
+    ALWAYS_INLINE CircularQueue& operator=(CircularQueue&& other) noexcept
+    {
+        // Handle self-assignment case.
+        if (this == &other)
+            return *this;
+
+        clear_and_shrink();
+
+        m_elements = other.m_elements;
+        m_capacity = other.m_capacity;
+        m_head_index = other.m_head_index;
+        m_count = other.m_count;
+
+        other.m_elements = nullptr;
+        other.m_capacity = 0;
+        other.m_head_index = 0;
+        other.m_count = 0;
+
+        return *this;
+    }
+
+public:
+    NODISCARD ALWAYS_INLINE usize capacity() const { return m_capacity; }
+    NODISCARD ALWAYS_INLINE usize count() const { return m_count; }
+
+    NODISCARD ALWAYS_INLINE bool is_empty() const { return (m_count == 0); }
+    NODISCARD ALWAYS_INLINE bool has_elements() const { return (m_count > 0); }
+
+    NODISCARD ALWAYS_INLINE T& front()
+    {
+        VERIFY(has_elements());
+        return m_elements[m_head_index];
+    }
+
+    NODISCARD ALWAYS_INLINE const T& front() const
+    {
+        VERIFY(has_elements());
+        return m_elements[m_head_index];
+    }
+
+public:
+    ALWAYS_INLINE void enqueue(const T& element)
+    {
+        expand_elements_block_if_required(m_count + 1);
+        new (m_elements + wrap_index(m_head_index + m_count)) T(element);
+        ++m_count;
+    }
+
+    ALWAYS_INLINE void enqueue(T&& element)
+    {
+        expand_elements_block_if_required(m_count + 1);
+        new (m_elements + wrap_index(m_head_index + m_count)) T(move(element));
+        ++m_count;
+    }
+
+    NODISCARD ALWAYS_INLINE T dequeue()
+    {
+        VERIFY(has_elements());
+        T element = move(m_elements[m_head_index]);
+        m_elements[m_head_index].~T();
+
+        m_head_index = wrap_index(m_head_index + 1);
+        --m_count;
+        return element;
+    }
+
+public:
+    ALWAYS_INLINE void clear()
+    {
+        for (usize index = 0; index < m_count; ++index)
+            m_elements[wrap_index(m_head_index + index)].~T();
+        m_head_index = 0;
+        m_count = 0;
+    }
+
+    ALWAYS_INLINE void clear_and_shrink()
+    {
+        clear();
+        ::operator delete(m_elements);
+        m_elements = nullptr;
+        m_capacity = 0;
+    }
+
+private:
+    NODISCARD ALWAYS_INLINE usize wrap_index(usize index) const { return (index < m_capacity) ? index : (index - m_capacity); }
+
+    ALWAYS_INLINE void expand_elements_block_if_required(usize required_capacity)
+    {
+        if (m_capacity >= required_capacity)
+            return;
+
+        usize new_capacity = (m_capacity * growth_factor_numerator) / growth_factor_denominator;
+        if (new_capacity < required_capacity)
+            new_capacity = required_capacity;
+        if (new_capacity < minimum_capacity)
+            new_capacity = minimum_capacity;
+
+        // NOTE: The elements are moved in queue order, so the head of the queue always ends up at index zero.
+        T* new_elements = static_cast<T*>(::operator new(new_capacity * sizeof(T)));
+        for (usize index = 0; index < m_count; ++index) {
+            T& element = m_elements[wrap_index(m_head_index + index)];
+            new (new_elements + index) T(move(element));
+            element.~T();
+        }
+
+        ::operator delete(m_elements);
+        m_elements = new_elements;
+        m_capacity = new_capacity;
+        m_head_index = 0;
+    }
+
+private:
+    T* m_elements;
+    usize m_capacity;
+    usize m_head_index;
+    usize m_count;
+};
+
+} // namespace AT
+
+using AT::CircularQueue;
@@ -18,6 +18,21 @@
     #define AT_PLATFORM_WINDOWS 0
 #endif // _WIN32
 
+#ifdef __linux__
+    #define AT_PLATFORM_LINUX 1
+#else
+    #define AT_PLATFORM_LINUX 0
+#endif // __linux__
+
+#if defined(__x86_64__) || defined(_M_X64)
+    #define AT_ARCH_X86_64 1
+#else
+    #define AT_ARCH_X86_64 0
+#endif // defined(__x86_64__) || defined(_M_X64)
+
+// NOTE: SSE2 is part of the baseline x86-64 instruction set, so it can be used unconditionally.
+#define AT_SIMD_SSE2 AT_ARCH_X86_64
+
 #if defined(__clang__)
     #define AT_COMPILER_CLANG 1
     #define AT_COMPILER_MSVC  0
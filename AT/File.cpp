@@ -0,0 +1,287 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#include <AT/File.h>
+#include <AT/String.h>
+
+#if AT_PLATFORM_WINDOWS
+    #define WIN32_LEAN_AND_MEAN
+    #define NOMINMAX
+    #include <Windows.h>
+#else
+    #include <errno.h>
+    #include <fcntl.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif // AT_PLATFORM_WINDOWS
+
+namespace AT {
+
+Optional<File> File::open(StringView filepath, FileOpenMode open_mode)
+{
+    // NOTE: The native APIs require a null-terminated path.
+    const String null_terminated_filepath = String(filepath);
+    File file;
+
+#if AT_PLATFORM_WINDOWS
+    DWORD desired_access = 0;
+    DWORD creation_disposition = 0;
+    switch (open_mode) {
+        case FileOpenMode::Read:
+            desired_access = GENERIC_READ;
+            creation_disposition = OPEN_EXISTING;
+            break;
+        case FileOpenMode::Write:
+            desired_access = GENERIC_WRITE;
+            creation_disposition = CREATE_ALWAYS;
+            break;
+        case FileOpenMode::Append:
+            desired_access = FILE_APPEND_DATA;
+            creation_disposition = OPEN_ALWAYS;
+            break;
+    }
+
+    const HANDLE native_handle =
+        CreateFileA(null_terminated_filepath.characters(), desired_access, FILE_SHARE_READ, nullptr, creation_disposition, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (native_handle == INVALID_HANDLE_VALUE)
+        return {};
+    file.m_native_handle = native_handle;
+    file.m_is_appending = (open_mode == FileOpenMode::Append);
+#else
+    int open_flags = O_CLOEXEC;
+    switch (open_mode) {
+        case FileOpenMode::Read: open_flags |= O_RDONLY; break;
+        case FileOpenMode::Write: open_flags |= O_WRONLY | O_CREAT | O_TRUNC; break;
+        case FileOpenMode::Append: open_flags |= O_WRONLY | O_CREAT | O_APPEND; break;
+    }
+
+    const int file_descriptor = ::open(null_terminated_filepath.characters(), open_flags, 0644);
+    if (file_descriptor < 0)
+        return {};
+    file.m_file_descriptor = file_descriptor;
+#endif // AT_PLATFORM_WINDOWS
+
+    return move(file);
+}
+
+Optional<ByteBuffer> File::read_entire_file(StringView filepath)
+{
+    Optional<File> file = File::open(filepath, FileOpenMode::Read);
+    if (!file.has_value())
+        return {};
+
+    const Optional<u64> file_byte_count = file->byte_count();
+    if (!file_byte_count.has_value())
+        return {};
+
+    ByteBuffer file_contents = ByteBuffer::from_initial_byte_count(file_byte_count.value());
+    usize read_byte_count = 0;
+    while (read_byte_count < file_contents.byte_count()) {
+        const Optional<usize> result = file->read(file_contents.byte_span().slice(read_byte_count));
+        if (!result.has_value() || result.value() == 0)
+            return {};
+        read_byte_count += result.value();
+    }
+
+    return move(file_contents);
+}
+
+File::File()
+#if AT_PLATFORM_WINDOWS
+    : m_native_handle(INVALID_HANDLE_VALUE)
+#else
+    : m_file_descriptor(-1)
+#endif // AT_PLATFORM_WINDOWS
+{}
+
+File::~File()
+{
+    close();
+}
+
+File::File(File&& other) noexcept
+#if AT_PLATFORM_WINDOWS
+    : m_native_handle(other.m_native_handle)
+    , m_file_position(other.m_file_position)
+    , m_is_appending(other.m_is_appending)
+{
+    other.m_native_handle = INVALID_HANDLE_VALUE;
+}
+#else
+    : m_file_descriptor(other.m_file_descriptor)
+{
+    other.m_file_descriptor = -1;
+}
+#endif // AT_PLATFORM_WINDOWS
+
+File& File::operator=(File&& other) noexcept
+{
+    // Handle self-assignment case.
+    if (this == &other)
+        return *this;
+
+    close();
+#if AT_PLATFORM_WINDOWS
+    m_native_handle = other.m_native_handle;
+    m_file_position = other.m_file_position;
+    m_is_appending = other.m_is_appending;
+    other.m_native_handle = INVALID_HANDLE_VALUE;
+#else
+    m_file_descriptor = other.m_file_descriptor;
+    other.m_file_descriptor = -1;
+#endif // AT_PLATFORM_WINDOWS
+    return *this;
+}
+
+bool File::is_open() const
+{
+#if AT_PLATFORM_WINDOWS
+    return (m_native_handle != INVALID_HANDLE_VALUE);
+#else
+    return (m_file_descriptor >= 0);
+#endif // AT_PLATFORM_WINDOWS
+}
+
+Optional<u64> File::byte_count() const
+{
+    VERIFY(is_open());
+
+#if AT_PLATFORM_WINDOWS
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(m_native_handle, &file_size))
+        return {};
+    return static_cast<u64>(file_size.QuadPart);
+#else
+    struct stat file_status = {};
+    if (fstat(m_file_descriptor, &file_status) != 0)
+        return {};
+    return static_cast<u64>(file_status.st_size);
+#endif // AT_PLATFORM_WINDOWS
+}
+
+Optional<usize> File::read(WriteonlyByteSpan destination)
+{
+    VERIFY(is_open());
+
+#if AT_PLATFORM_WINDOWS
+    const Optional<usize> read_byte_count = read_at(destination, m_file_position);
+    if (read_byte_count.has_value())
+        m_file_position += read_byte_count.value();
+    return read_byte_count;
+#else
+    ssize_t result;
+    do {
+        result = ::read(m_file_descriptor, destination.elements(), destination.count());
+    } while (result < 0 && errno == EINTR);
+
+    if (result < 0)
+        return {};
+    return static_cast<usize>(result);
+#endif // AT_PLATFORM_WINDOWS
+}
+
+Optional<usize> File::read_at(WriteonlyByteSpan destination, u64 file_offset) const
+{
+    VERIFY(is_open());
+
+#if AT_PLATFORM_WINDOWS
+    // NOTE: The read moves the file pointer of the handle, but the position of the file is tracked separately and
+    //       no other operation uses the file pointer, so the position is left unchanged.
+    OVERLAPPED overlapped = {};
+    overlapped.Offset = static_cast<DWORD>(file_offset & 0xFFFFFFFF);
+    overlapped.OffsetHigh = static_cast<DWORD>(file_offset >> 32);
+
+    // NOTE: A single call can't read more than 4GiB on Windows.
+    const DWORD byte_count_to_read = (destination.count() > 0xFFFFFFFF) ? 0xFFFFFFFF : static_cast<DWORD>(destination.count());
+    DWORD read_byte_count = 0;
+    if (!ReadFile(m_native_handle, destination.elements(), byte_count_to_read, &read_byte_count, &overlapped)) {
+        if (GetLastError() == ERROR_HANDLE_EOF)
+            return 0;
+        return {};
+    }
+    return static_cast<usize>(read_byte_count);
+#else
+    ssize_t result;
+    do {
+        result = ::pread(m_file_descriptor, destination.elements(), destination.count(), static_cast<off_t>(file_offset));
+    } while (result < 0 && errno == EINTR);
+
+    if (result < 0)
+        return {};
+    return static_cast<usize>(result);
+#endif // AT_PLATFORM_WINDOWS
+}
+
+bool File::write(ReadonlyByteSpan source)
+{
+    VERIFY(is_open());
+    usize written_byte_count = 0;
+
+    while (written_byte_count < source.count()) {
+        const usize remaining_byte_count = source.count() - written_byte_count;
+
+#if AT_PLATFORM_WINDOWS
+        // NOTE: An offset with all bits set writes at the end of the file.
+        OVERLAPPED overlapped = {};
+        overlapped.Offset = m_is_appending ? 0xFFFFFFFF : static_cast<DWORD>(m_file_position & 0xFFFFFFFF);
+        overlapped.OffsetHigh = m_is_appending ? 0xFFFFFFFF : static_cast<DWORD>(m_file_position >> 32);
+
+        const DWORD byte_count_to_write = (remaining_byte_count > 0xFFFFFFFF) ? 0xFFFFFFFF : static_cast<DWORD>(remaining_byte_count);
+        DWORD result = 0;
+        if (!WriteFile(m_native_handle, source.elements() + written_byte_count, byte_count_to_write, &result, &overlapped))
+            return false;
+        m_file_position += result;
+#else
+        const ssize_t result = ::write(m_file_descriptor, source.elements() + written_byte_count, remaining_byte_count);
+        if (result < 0) {
+            if (errno == EINTR)
+                continue;
+            return false;
+        }
+#endif // AT_PLATFORM_WINDOWS
+
+        written_byte_count += static_cast<usize>(result);
+    }
+
+    return true;
+}
+
+bool File::seek(u64 file_offset)
+{
+    VERIFY(is_open());
+
+#if AT_PLATFORM_WINDOWS
+    m_file_position = file_offset;
+    return true;
+#else
+    return (lseek(m_file_descriptor, static_cast<off_t>(file_offset), SEEK_SET) >= 0);
+#endif // AT_PLATFORM_WINDOWS
+}
+
+void File::close()
+{
+    if (!is_open())
+        return;
+
+#if AT_PLATFORM_WINDOWS
+    CloseHandle(m_native_handle);
+    m_native_handle = INVALID_HANDLE_VALUE;
+#else
+    ::close(m_file_descriptor);
+    m_file_descriptor = -1;
+#endif // AT_PLATFORM_WINDOWS
+}
+
+Optional<usize> FileInputStream::read_some(WriteonlyByteSpan destination)
+{
+    return m_file.read(destination);
+}
+
+bool FileOutputStream::write(ReadonlyByteSpan source)
+{
+    return m_file.write(source);
+}
+
+} // namespace AT
@@ -0,0 +1,114 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#pragma once
+
+#include <AT/API.h>
+#include <AT/ByteBuffer.h>
+#include <AT/Optional.h>
+#include <AT/Span.h>
+#include <AT/Stream.h>
+#include <AT/StringView.h>
+#include <AT/Types.h>
+
+namespace AT {
+
+enum class FileOpenMode : u8 {
+    // Opens an existing file for reading.
+    Read,
+    // Creates the file if it doesn't exist and truncates it otherwise.
+    Write,
+    // Creates the file if it doesn't exist, and all writes are appended to its end.
+    Append,
+};
+
+// Thin, unbuffered wrapper around a native file handle. Every operation maps directly to a system call,
+// so small reads and writes should go through a BufferedReader or a BufferedWriter instead.
+class File {
+    AT_MAKE_NONCOPYABLE(File);
+
+public:
+    NODISCARD AT_API static Optional<File> open(StringView filepath, FileOpenMode open_mode);
+
+    // Reads the entire contents of the file in a single allocation.
+    NODISCARD AT_API static Optional<ByteBuffer> read_entire_file(StringView filepath);
+
+public:
+    AT_API File();
+    AT_API ~File();
+
+    AT_API File(File&& other) noexcept;
+    AT_API File& operator=(File&& other) noexcept;
+
+public:
+    NODISCARD AT_API bool is_open() const;
+
+    NODISCARD AT_API Optional<u64> byte_count() const;
+
+    // Reads at most the size of the destination span from the current file position.
+    // Returns the number of bytes read, which is zero when the end of the file is reached.
+    NODISCARD AT_API Optional<usize> read(WriteonlyByteSpan destination);
+
+    // Reads at most the size of the destination span from the given offset, without changing the file position.
+    // This function can be called concurrently from multiple threads.
+    NODISCARD AT_API Optional<usize> read_at(WriteonlyByteSpan destination, u64 file_offset) const;
+
+    // Writes the entire source span at the current file position. Returns whether all the bytes were written.
+    NODISCARD AT_API bool write(ReadonlyByteSpan source);
+
+    NODISCARD AT_API bool seek(u64 file_offset);
+
+    AT_API void close();
+
+#if !AT_PLATFORM_WINDOWS
+    NODISCARD ALWAYS_INLINE int file_descriptor() const { return m_file_descriptor; }
+#endif // !AT_PLATFORM_WINDOWS
+
+private:
+#if AT_PLATFORM_WINDOWS
+    void* m_native_handle;
+    // NOTE: Positional reads move the file pointer of a synchronous handle on Windows, so the position of the file
+    //       is tracked here and every read and write passes it explicitly.
+    u64 m_file_position { 0 };
+    bool m_is_appending { false };
+#else
+    int m_file_descriptor;
+#endif // AT_PLATFORM_WINDOWS
+};
+
+// Adapts a file to the input stream interface, so it can be read through a BufferedReader.
+// The file must outlive the stream.
+class FileInputStream final : public InputStream {
+public:
+    ALWAYS_INLINE explicit FileInputStream(File& file)
+        : m_file(file)
+    {}
+
+    NODISCARD AT_API virtual Optional<usize> read_some(WriteonlyByteSpan destination) override;
+
+private:
+    File& m_file;
+};
+
+// Adapts a file to the output stream interface, so it can be written through a BufferedWriter.
+// The file must outlive the stream.
+class FileOutputStream final : public OutputStream {
+public:
+    ALWAYS_INLINE explicit FileOutputStream(File& file)
+        : m_file(file)
+    {}
+
+    NODISCARD AT_API virtual bool write(ReadonlyByteSpan source) override;
+
+private:
+    File& m_file;
+};
+
+} // namespace AT
+
+using AT::File;
+using AT::FileInputStream;
+using AT::FileOpenMode;
+using AT::FileOutputStream;
@@ -80,11 +80,18 @@ void FormatStream::push_floating_point_number(f64 value)
     else
         fractional_part = static_cast<u64>((whole_part - value) * fractional_multiplier);
 
+    push_codepoint('.');
+
+    // NOTE: The leading zeros of the fractional part are significant, but formatting it as an integer drops them.
+    if (fractional_part != 0) {
+        for (u64 digit_multiplier = fractional_multiplier / 10; digit_multiplier > fractional_part; digit_multiplier /= 10)
+            push_codepoint('0');
+    }
+
     // NOTE: Remove the redundant fractional digits that are zero anyway.
     while (fractional_part >= 10 && fractional_part % 10 == 0)
         fractional_part /= 10;
 
-    push_codepoint('.');
     push_signed_integer(fractional_part);
 }
 
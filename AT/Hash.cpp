@@ -0,0 +1,182 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#include <AT/Hash.h>
+#include <AT/MemoryOperations.h>
+
+#if AT_SIMD_SSE2
+    #include <emmintrin.h>
+#endif // AT_SIMD_SSE2
+
+namespace AT {
+
+#if AT_SIMD_SSE2
+// Each 128-bit register holds two of the accumulators, so a stripe is processed with four registers.
+struct VectorHashStripeOperations {
+    ALWAYS_INLINE static void accumulate(u64* accumulators, const u8* input, const u8* secret)
+    {
+        for (usize register_index = 0; register_index < Implementation::hash_accumulator_count / 2; ++register_index) {
+            __m128i* accumulator_register = reinterpret_cast<__m128i*>(accumulators) + register_index;
+            const __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input) + register_index);
+            const __m128i key = _mm_loadu_si128(reinterpret_cast<const __m128i*>(secret) + register_index);
+            const __m128i keyed_data = _mm_xor_si128(data, key);
+
+            // NOTE: Multiply the low and the high 32-bit halves of each keyed 64-bit lane.
+            const __m128i keyed_data_high = _mm_shuffle_epi32(keyed_data, _MM_SHUFFLE(0, 3, 0, 1));
+            const __m128i product = _mm_mul_epu32(keyed_data, keyed_data_high);
+
+            // NOTE: Each accumulator also receives the data of the neighbouring lane.
+            const __m128i swapped_data = _mm_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2));
+            const __m128i sum = _mm_add_epi64(_mm_loadu_si128(accumulator_register), swapped_data);
+            _mm_storeu_si128(accumulator_register, _mm_add_epi64(product, sum));
+        }
+    }
+
+    ALWAYS_INLINE static void scramble(u64* accumulators, const u8* secret)
+    {
+        const __m128i prime = _mm_set1_epi32(static_cast<int>(Implementation::hash_prime32_1));
+
+        for (usize register_index = 0; register_index < Implementation::hash_accumulator_count / 2; ++register_index) {
+            __m128i* accumulator_register = reinterpret_cast<__m128i*>(accumulators) + register_index;
+            __m128i accumulator = _mm_loadu_si128(accumulator_register);
+            accumulator = _mm_xor_si128(accumulator, _mm_srli_epi64(accumulator, 47));
+            accumulator = _mm_xor_si128(accumulator, _mm_loadu_si128(reinterpret_cast<const __m128i*>(secret) + register_index));
+
+            // NOTE: SSE2 has no 64-bit multiplication, so the product is assembled from two 32-bit multiplications.
+            const __m128i accumulator_high = _mm_shuffle_epi32(accumulator, _MM_SHUFFLE(0, 3, 0, 1));
+            const __m128i product_low = _mm_mul_epu32(accumulator, prime);
+            const __m128i product_high = _mm_mul_epu32(accumulator_high, prime);
+            _mm_storeu_si128(accumulator_register, _mm_add_epi64(product_low, _mm_slli_epi64(product_high, 32)));
+        }
+    }
+};
+#else
+using VectorHashStripeOperations = Implementation::ScalarHashStripeOperations;
+#endif // AT_SIMD_SSE2
+
+u64 hash_bytes(ReadonlyByteSpan bytes, u64 seed)
+{
+    if (bytes.count() <= Implementation::hash_short_input_max_byte_count)
+        return Implementation::hash_short(bytes.elements(), bytes.count(), seed);
+
+    u64 accumulators[Implementation::hash_accumulator_count];
+    Implementation::hash_initialize_accumulators(accumulators, seed);
+    Implementation::hash_accumulate_long<VectorHashStripeOperations>(accumulators, bytes.elements(), bytes.count());
+    return Implementation::hash_finalize_long(accumulators, bytes.count());
+}
+
+Hash128 hash_bytes_128(ReadonlyByteSpan bytes, u64 seed)
+{
+    if (bytes.count() <= Implementation::hash_short_input_max_byte_count) {
+        Hash128 hash;
+        hash.low = Implementation::hash_short(bytes.elements(), bytes.count(), seed);
+        hash.high = Implementation::hash_short(bytes.elements(), bytes.count(), seed ^ Implementation::hash_high_half_seed_mask);
+        return hash;
+    }
+
+    u64 accumulators[Implementation::hash_accumulator_count];
+    Implementation::hash_initialize_accumulators(accumulators, seed);
+    Implementation::hash_accumulate_long<VectorHashStripeOperations>(accumulators, bytes.elements(), bytes.count());
+    return Implementation::hash_finalize_long_128(accumulators, bytes.count());
+}
+
+Hasher::Hasher(u64 seed)
+    : m_seed(seed)
+{
+    Implementation::hash_initialize_accumulators(m_accumulators, m_seed);
+}
+
+void Hasher::update(ReadonlyByteSpan bytes)
+{
+    m_total_byte_count += bytes.count();
+
+    usize offset = 0;
+    while (offset < bytes.count()) {
+        // NOTE: A full buffer is only processed once more input arrives, because the one-shot functions never
+        //       process the end of the input as a full block.
+        if (m_buffered_byte_count == Implementation::hash_block_byte_count) {
+            process_block(m_buffer);
+            m_buffered_byte_count = 0;
+        }
+
+        // NOTE: Process the blocks directly from the input when possible, instead of copying them to the buffer.
+        if (m_buffered_byte_count == 0) {
+            while (bytes.count() - offset > Implementation::hash_block_byte_count) {
+                process_block(bytes.elements() + offset);
+                offset += Implementation::hash_block_byte_count;
+            }
+        }
+
+        usize copy_byte_count = Implementation::hash_block_byte_count - m_buffered_byte_count;
+        if (copy_byte_count > bytes.count() - offset)
+            copy_byte_count = bytes.count() - offset;
+
+        copy_memory(m_buffer + m_buffered_byte_count, bytes.elements() + offset, copy_byte_count);
+        m_buffered_byte_count += copy_byte_count;
+        offset += copy_byte_count;
+    }
+}
+
+u64 Hasher::finalize() const
+{
+    // NOTE: Short inputs never leave the buffer.
+    if (m_total_byte_count <= Implementation::hash_short_input_max_byte_count)
+        return Implementation::hash_short(m_buffer, m_buffered_byte_count, m_seed);
+
+    u64 accumulators[Implementation::hash_accumulator_count];
+    accumulate_tail(accumulators);
+    return Implementation::hash_finalize_long(accumulators, m_total_byte_count);
+}
+
+Hash128 Hasher::finalize_128() const
+{
+    if (m_total_byte_count <= Implementation::hash_short_input_max_byte_count) {
+        Hash128 hash;
+        hash.low = Implementation::hash_short(m_buffer, m_buffered_byte_count, m_seed);
+        hash.high = Implementation::hash_short(m_buffer, m_buffered_byte_count, m_seed ^ Implementation::hash_high_half_seed_mask);
+        return hash;
+    }
+
+    u64 accumulators[Implementation::hash_accumulator_count];
+    accumulate_tail(accumulators);
+    return Implementation::hash_finalize_long_128(accumulators, m_total_byte_count);
+}
+
+void Hasher::reset()
+{
+    Implementation::hash_initialize_accumulators(m_accumulators, m_seed);
+    m_total_byte_count = 0;
+    m_buffered_byte_count = 0;
+}
+
+void Hasher::process_block(ReadonlyBytes block)
+{
+    Implementation::hash_accumulate_stripes<VectorHashStripeOperations>(m_accumulators, block, Implementation::hash_stripes_per_block);
+    Implementation::hash_scramble_accumulators<VectorHashStripeOperations>(m_accumulators);
+    const usize last_stripe_offset = Implementation::hash_block_byte_count - Implementation::hash_stripe_byte_count;
+    copy_memory(m_previous_stripe, block + last_stripe_offset, Implementation::hash_stripe_byte_count);
+}
+
+void Hasher::accumulate_tail(u64* accumulators) const
+{
+    copy_memory(accumulators, m_accumulators, sizeof(m_accumulators));
+
+    const usize tail_stripe_count = (m_buffered_byte_count - 1) / Implementation::hash_stripe_byte_count;
+    Implementation::hash_accumulate_stripes<VectorHashStripeOperations>(accumulators, m_buffer, tail_stripe_count);
+
+    if (m_buffered_byte_count >= Implementation::hash_stripe_byte_count) {
+        Implementation::hash_accumulate_last_stripe<VectorHashStripeOperations>(accumulators, m_buffer + m_buffered_byte_count - Implementation::hash_stripe_byte_count);
+        return;
+    }
+
+    // NOTE: The last stripe starts in the previously processed block.
+    u8 last_stripe[Implementation::hash_stripe_byte_count];
+    const usize previous_byte_count = Implementation::hash_stripe_byte_count - m_buffered_byte_count;
+    copy_memory(last_stripe, m_previous_stripe + Implementation::hash_stripe_byte_count - previous_byte_count, previous_byte_count);
+    copy_memory(last_stripe + previous_byte_count, m_buffer, m_buffered_byte_count);
+    Implementation::hash_accumulate_last_stripe<VectorHashStripeOperations>(accumulators, last_stripe);
+}
+
+} // namespace AT
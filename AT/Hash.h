@@ -0,0 +1,450 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#pragma once
+
+#include <AT/BitOperations.h>
+#include <AT/Span.h>
+#include <AT/StringView.h>
+#include <AT/Types.h>
+
+namespace AT {
+
+//
+// Fast non-cryptographic hash functions, in the same family as XXH3 and wyhash. Short inputs are mixed with a
+// handful of 64-bit multiplications. Long inputs are consumed in stripes of 64 bytes by eight independent
+// accumulators, which map directly onto SIMD registers, and the accumulators are scrambled after each block.
+//
+// The result only depends on the bytes and the seed. The one-shot functions, the streaming hasher and the
+// compile-time evaluation all produce the same value for the same input. The low half of the 128-bit hash is
+// always equal to the 64-bit hash.
+//
+// NOTE: These functions must never be used where resistance against malicious inputs is required.
+//
+
+struct Hash128 {
+    u64 low;
+    u64 high;
+
+    NODISCARD ALWAYS_INLINE constexpr bool operator==(const Hash128& other) const { return (low == other.low) && (high == other.high); }
+    NODISCARD ALWAYS_INLINE constexpr bool operator!=(const Hash128& other) const { return (low != other.low) || (high != other.high); }
+};
+
+namespace Implementation {
+
+inline constexpr u64 hash_prime32_1 = 0x9E3779B1;
+inline constexpr u64 hash_prime32_2 = 0x85EBCA77;
+inline constexpr u64 hash_prime32_3 = 0xC2B2AE3D;
+inline constexpr u64 hash_prime64_1 = 0x9E3779B185EBCA87;
+inline constexpr u64 hash_prime64_2 = 0xC2B2AE3D27D4EB4F;
+inline constexpr u64 hash_prime64_3 = 0x165667B19E3779F9;
+inline constexpr u64 hash_prime64_4 = 0x85EBCA77C2B2AE63;
+inline constexpr u64 hash_prime64_5 = 0x27D4EB2F165667C5;
+
+inline constexpr usize hash_secret_byte_count = 192;
+inline constexpr usize hash_stripe_byte_count = 64;
+inline constexpr usize hash_accumulator_count = 8;
+inline constexpr usize hash_stripes_per_block = (hash_secret_byte_count - hash_stripe_byte_count) / 8;
+inline constexpr usize hash_block_byte_count = hash_stripes_per_block * hash_stripe_byte_count;
+
+// NOTE: Inputs up to this size are hashed without the accumulators.
+inline constexpr usize hash_short_input_max_byte_count = 240;
+
+// NOTE: The seed of the high half of the 128-bit hash of short inputs is derived from the user seed.
+inline constexpr u64 hash_high_half_seed_mask = 0x6A09E667F3BCC908;
+
+struct HashSecret {
+    u8 bytes[hash_secret_byte_count];
+};
+
+// The secret is a block of pseudo-random bytes that are mixed with the input. It is generated at compile time with
+// SplitMix64, instead of being spelled out as a table.
+NODISCARD constexpr HashSecret make_hash_secret()
+{
+    HashSecret secret = {};
+    u64 state = 0x243F6A8885A308D3;
+    for (usize word_index = 0; word_index < hash_secret_byte_count / 8; ++word_index) {
+        state += 0x9E3779B97F4A7C15;
+        u64 word = state;
+        word = (word ^ (word >> 30)) * 0xBF58476D1CE4E5B9;
+        word = (word ^ (word >> 27)) * 0x94D049BB133111EB;
+        word ^= word >> 31;
+
+        for (usize byte_index = 0; byte_index < 8; ++byte_index)
+            secret.bytes[8 * word_index + byte_index] = static_cast<u8>(word >> (8 * byte_index));
+    }
+    return secret;
+}
+
+inline constexpr HashSecret hash_secret = make_hash_secret();
+
+// NOTE: The values are assembled byte by byte, so they can be read at compile time from string literals. The
+//       compilers recognize the pattern and emit a single unaligned load.
+template<typename ByteType>
+NODISCARD ALWAYS_INLINE constexpr u32 hash_read_u32(const ByteType* bytes)
+{
+    return static_cast<u32>(static_cast<u8>(bytes[0])) | (static_cast<u32>(static_cast<u8>(bytes[1])) << 8) |
+           (static_cast<u32>(static_cast<u8>(bytes[2])) << 16) | (static_cast<u32>(static_cast<u8>(bytes[3])) << 24);
+}
+
+template<typename ByteType>
+NODISCARD ALWAYS_INLINE constexpr u64 hash_read_u64(const ByteType* bytes)
+{
+    return static_cast<u64>(hash_read_u32(bytes)) | (static_cast<u64>(hash_read_u32(bytes + 4)) << 32);
+}
+
+// Computes the full 128-bit product of the two values and folds it back into 64 bits.
+NODISCARD ALWAYS_INLINE constexpr u64 hash_multiply_fold(u64 lhs, u64 rhs)
+{
+#if AT_COMPILER_MSVC
+    if (!__builtin_is_constant_evaluated()) {
+        u64 product_high;
+        const u64 product_low = _umul128(lhs, rhs, &product_high);
+        return product_low ^ product_high;
+    }
+
+    const u64 lhs_low = lhs & 0xFFFFFFFF;
+    const u64 lhs_high = lhs >> 32;
+    const u64 rhs_low = rhs & 0xFFFFFFFF;
+    const u64 rhs_high = rhs >> 32;
+
+    const u64 low_low = lhs_low * rhs_low;
+    const u64 high_low = lhs_high * rhs_low;
+    const u64 low_high = lhs_low * rhs_high;
+    const u64 high_high = lhs_high * rhs_high;
+
+    const u64 cross = (low_low >> 32) + (high_low & 0xFFFFFFFF) + low_high;
+    const u64 product_high = (high_low >> 32) + (cross >> 32) + high_high;
+    const u64 product_low = (cross << 32) | (low_low & 0xFFFFFFFF);
+    return product_low ^ product_high;
+#else
+    const __uint128_t product = static_cast<__uint128_t>(lhs) * rhs;
+    return static_cast<u64>(product) ^ static_cast<u64>(product >> 64);
+#endif // AT_COMPILER_MSVC
+}
+
+NODISCARD ALWAYS_INLINE constexpr u64 hash_avalanche(u64 hash)
+{
+    hash ^= hash >> 37;
+    hash *= 0x165667919E3779F9;
+    hash ^= hash >> 32;
+    return hash;
+}
+
+template<typename ByteType>
+NODISCARD ALWAYS_INLINE constexpr u64 hash_mix_16_bytes(const ByteType* input, const u8* secret, u64 seed)
+{
+    const u64 input_low = hash_read_u64(input);
+    const u64 input_high = hash_read_u64(input + 8);
+    return hash_multiply_fold(input_low ^ (hash_read_u64(secret) + seed), input_high ^ (hash_read_u64(secret + 8) - seed));
+}
+
+template<typename ByteType>
+NODISCARD constexpr u64 hash_short(const ByteType* input, usize byte_count, u64 seed)
+{
+    const u8* secret = hash_secret.bytes;
+
+    if (byte_count == 0) {
+        u64 hash = seed ^ (hash_read_u64(secret + 56) ^ hash_read_u64(secret + 64));
+        hash ^= hash >> 33;
+        hash *= hash_prime64_2;
+        hash ^= hash >> 29;
+        hash *= hash_prime64_3;
+        hash ^= hash >> 32;
+        return hash;
+    }
+
+    if (byte_count <= 3) {
+        const u32 first = static_cast<u8>(input[0]);
+        const u32 middle = static_cast<u8>(input[byte_count >> 1]);
+        const u32 last = static_cast<u8>(input[byte_count - 1]);
+        const u32 combined = (first << 16) | (middle << 24) | last | (static_cast<u32>(byte_count) << 8);
+
+        const u64 bitflip = (hash_read_u32(secret) ^ hash_read_u32(secret + 4)) + seed;
+        u64 hash = static_cast<u64>(combined) ^ bitflip;
+        hash ^= hash >> 33;
+        hash *= hash_prime64_2;
+        hash ^= hash >> 29;
+        hash *= hash_prime64_3;
+        hash ^= hash >> 32;
+        return hash;
+    }
+
+    if (byte_count <= 8) {
+        const u64 input_low = hash_read_u32(input);
+        const u64 input_high = hash_read_u32(input + byte_count - 4);
+        const u64 bitflip = (hash_read_u64(secret + 8) ^ hash_read_u64(secret + 16)) - seed;
+
+        u64 hash = (input_high + (input_low << 32)) ^ bitflip;
+        hash ^= rotate_left(hash, 49) ^ rotate_left(hash, 24);
+        hash *= 0x9FB21C651E98DF25;
+        hash ^= (hash >> 35) + byte_count;
+        hash *= 0x9FB21C651E98DF25;
+        hash ^= hash >> 28;
+        return hash;
+    }
+
+    if (byte_count <= 16) {
+        const u64 input_low = hash_read_u64(input) ^ ((hash_read_u64(secret + 24) ^ hash_read_u64(secret + 32)) + seed);
+        const u64 input_high = hash_read_u64(input + byte_count - 8) ^ ((hash_read_u64(secret + 40) ^ hash_read_u64(secret + 48)) - seed);
+        const u64 hash = byte_count + rotate_left(input_low, 32) + input_high + hash_multiply_fold(input_low, input_high);
+        return hash_avalanche(hash);
+    }
+
+    u64 hash = byte_count * hash_prime64_1;
+    if (byte_count <= 128) {
+        // NOTE: Pairs of 16-byte chunks are taken from both ends of the input, which covers all of it.
+        if (byte_count > 32) {
+            if (byte_count > 64) {
+                if (byte_count > 96) {
+                    hash += hash_mix_16_bytes(input + 48, secret + 96, seed);
+                    hash += hash_mix_16_bytes(input + byte_count - 64, secret + 112, seed);
+                }
+                hash += hash_mix_16_bytes(input + 32, secret + 64, seed);
+                hash += hash_mix_16_bytes(input + byte_count - 48, secret + 80, seed);
+            }
+            hash += hash_mix_16_bytes(input + 16, secret + 32, seed);
+            hash += hash_mix_16_bytes(input + byte_count - 32, secret + 48, seed);
+        }
+        hash += hash_mix_16_bytes(input, secret, seed);
+        hash += hash_mix_16_bytes(input + byte_count - 16, secret + 16, seed);
+        return hash_avalanche(hash);
+    }
+
+    const usize round_count = byte_count / 16;
+    for (usize round_index = 0; round_index < 8; ++round_index)
+        hash += hash_mix_16_bytes(input + 16 * round_index, secret + 16 * round_index, seed);
+    hash = hash_avalanche(hash);
+
+    for (usize round_index = 8; round_index < round_count; ++round_index)
+        hash += hash_mix_16_bytes(input + 16 * round_index, secret + 16 * (round_index - 8) + 3, seed);
+    hash += hash_mix_16_bytes(input + byte_count - 16, secret + hash_secret_byte_count - 17, seed);
+    return hash_avalanche(hash);
+}
+
+// Portable implementation of the stripe operations, which is also used when hashing at compile time.
+struct ScalarHashStripeOperations {
+    template<typename ByteType>
+    ALWAYS_INLINE static constexpr void accumulate(u64* accumulators, const ByteType* input, const u8* secret)
+    {
+        for (usize lane_index = 0; lane_index < hash_accumulator_count; ++lane_index) {
+            const u64 data = hash_read_u64(input + 8 * lane_index);
+            const u64 keyed_data = data ^ hash_read_u64(secret + 8 * lane_index);
+            accumulators[lane_index ^ 1] += data;
+            accumulators[lane_index] += (keyed_data & 0xFFFFFFFF) * (keyed_data >> 32);
+        }
+    }
+
+    ALWAYS_INLINE static constexpr void scramble(u64* accumulators, const u8* secret)
+    {
+        for (usize lane_index = 0; lane_index < hash_accumulator_count; ++lane_index) {
+            u64 accumulator = accumulators[lane_index];
+            accumulator ^= accumulator >> 47;
+            accumulator ^= hash_read_u64(secret + 8 * lane_index);
+            accumulators[lane_index] = accumulator * hash_prime32_1;
+        }
+    }
+};
+
+ALWAYS_INLINE constexpr void hash_initialize_accumulators(u64* accumulators, u64 seed)
+{
+    accumulators[0] = hash_prime32_3 + seed;
+    accumulators[1] = hash_prime64_1 - seed;
+    accumulators[2] = hash_prime64_2 + seed;
+    accumulators[3] = hash_prime64_3 - seed;
+    accumulators[4] = hash_prime64_4 + seed;
+    accumulators[5] = hash_prime32_2 - seed;
+    accumulators[6] = hash_prime64_5 + seed;
+    accumulators[7] = hash_prime32_1 - seed;
+}
+
+template<typename StripeOperations, typename ByteType>
+ALWAYS_INLINE constexpr void hash_accumulate_stripes(u64* accumulators, const ByteType* input, usize stripe_count)
+{
+    for (usize stripe_index = 0; stripe_index < stripe_count; ++stripe_index)
+        StripeOperations::accumulate(accumulators, input + stripe_index * hash_stripe_byte_count, hash_secret.bytes + 8 * stripe_index);
+}
+
+template<typename StripeOperations>
+ALWAYS_INLINE constexpr void hash_scramble_accumulators(u64* accumulators)
+{
+    StripeOperations::scramble(accumulators, hash_secret.bytes + hash_secret_byte_count - hash_stripe_byte_count);
+}
+
+template<typename StripeOperations, typename ByteType>
+ALWAYS_INLINE constexpr void hash_accumulate_last_stripe(u64* accumulators, const ByteType* last_stripe)
+{
+    StripeOperations::accumulate(accumulators, last_stripe, hash_secret.bytes + hash_secret_byte_count - hash_stripe_byte_count - 7);
+}
+
+// NOTE: The input must be longer than `hash_short_input_max_byte_count` bytes.
+template<typename StripeOperations, typename ByteType>
+constexpr void hash_accumulate_long(u64* accumulators, const ByteType* input, usize byte_count)
+{
+    // NOTE: The last block is never processed as a full block, so that the tail always contains at least one byte.
+    const usize block_count = (byte_count - 1) / hash_block_byte_count;
+    for (usize block_index = 0; block_index < block_count; ++block_index) {
+        hash_accumulate_stripes<StripeOperations>(accumulators, input + block_index * hash_block_byte_count, hash_stripes_per_block);
+        hash_scramble_accumulators<StripeOperations>(accumulators);
+    }
+
+    const usize tail_offset = block_count * hash_block_byte_count;
+    const usize tail_stripe_count = (byte_count - tail_offset - 1) / hash_stripe_byte_count;
+    hash_accumulate_stripes<StripeOperations>(accumulators, input + tail_offset, tail_stripe_count);
+
+    // NOTE: The last stripe overlaps with the previous ones, if the input size isn't a multiple of the stripe size.
+    hash_accumulate_last_stripe<StripeOperations>(accumulators, input + byte_count - hash_stripe_byte_count);
+}
+
+NODISCARD ALWAYS_INLINE constexpr u64 hash_merge_accumulators(const u64* accumulators, const u8* secret, u64 start)
+{
+    u64 hash = start;
+    for (usize pair_index = 0; pair_index < hash_accumulator_count / 2; ++pair_index) {
+        hash += hash_multiply_fold(
+            accumulators[2 * pair_index] ^ hash_read_u64(secret + 16 * pair_index),
+            accumulators[2 * pair_index + 1] ^ hash_read_u64(secret + 16 * pair_index + 8)
+        );
+    }
+    return hash_avalanche(hash);
+}
+
+NODISCARD ALWAYS_INLINE constexpr u64 hash_finalize_long(const u64* accumulators, u64 byte_count)
+{
+    return hash_merge_accumulators(accumulators, hash_secret.bytes + 11, byte_count * hash_prime64_1);
+}
+
+NODISCARD ALWAYS_INLINE constexpr Hash128 hash_finalize_long_128(const u64* accumulators, u64 byte_count)
+{
+    Hash128 hash = {};
+    hash.low = hash_finalize_long(accumulators, byte_count);
+    hash.high = hash_merge_accumulators(
+        accumulators,
+        hash_secret.bytes + hash_secret_byte_count - hash_stripe_byte_count - 11,
+        ~(byte_count * hash_prime64_2)
+    );
+    return hash;
+}
+
+template<typename ByteType>
+NODISCARD constexpr u64 hash_scalar(const ByteType* input, usize byte_count, u64 seed)
+{
+    if (byte_count <= hash_short_input_max_byte_count)
+        return hash_short(input, byte_count, seed);
+
+    u64 accumulators[hash_accumulator_count] = {};
+    hash_initialize_accumulators(accumulators, seed);
+    hash_accumulate_long<ScalarHashStripeOperations>(accumulators, input, byte_count);
+    return hash_finalize_long(accumulators, byte_count);
+}
+
+template<typename ByteType>
+NODISCARD constexpr Hash128 hash_scalar_128(const ByteType* input, usize byte_count, u64 seed)
+{
+    if (byte_count <= hash_short_input_max_byte_count) {
+        Hash128 hash = {};
+        hash.low = hash_short(input, byte_count, seed);
+        hash.high = hash_short(input, byte_count, seed ^ hash_high_half_seed_mask);
+        return hash;
+    }
+
+    u64 accumulators[hash_accumulator_count] = {};
+    hash_initialize_accumulators(accumulators, seed);
+    hash_accumulate_long<ScalarHashStripeOperations>(accumulators, input, byte_count);
+    return hash_finalize_long_128(accumulators, byte_count);
+}
+
+} // namespace Implementation
+
+// Hashes the bytes, using SIMD instructions to process long inputs when they are available.
+NODISCARD AT_API u64 hash_bytes(ReadonlyByteSpan bytes, u64 seed = 0);
+
+// Computes a 128-bit hash of the bytes, which is wide enough to be used as the identity of the content (for example,
+// as the key of a cache), as long as the inputs are not chosen adversarially.
+NODISCARD AT_API Hash128 hash_bytes_128(ReadonlyByteSpan bytes, u64 seed = 0);
+
+// NOTE: When evaluated at compile time the string is hashed with the portable implementation, which produces the
+//       same value as the runtime one. This allows string keys to be hashed at compile time, as in:
+//       `constexpr u64 key = hash_string("button"sv);`
+NODISCARD ALWAYS_INLINE constexpr u64 hash_string(StringView string, u64 seed = 0)
+{
+    if (__builtin_is_constant_evaluated())
+        return Implementation::hash_scalar(string.characters(), string.byte_count(), seed);
+    return hash_bytes(string.byte_span(), seed);
+}
+
+NODISCARD ALWAYS_INLINE constexpr Hash128 hash_string_128(StringView string, u64 seed = 0)
+{
+    if (__builtin_is_constant_evaluated())
+        return Implementation::hash_scalar_128(string.characters(), string.byte_count(), seed);
+    return hash_bytes_128(string.byte_span(), seed);
+}
+
+// Mixes all the bits of an integer, which is useful for hashing integer keys and for combining hashes.
+NODISCARD ALWAYS_INLINE constexpr u64 hash_integer(u64 value)
+{
+    value ^= value >> 27;
+    value *= 0x3C79AC492BA7B653;
+    value ^= value >> 33;
+    value *= 0x1C69B3F74AC4AE35;
+    value ^= value >> 27;
+    return value;
+}
+
+NODISCARD ALWAYS_INLINE constexpr u64 hash_combine(u64 hash, u64 other_hash)
+{
+    return hash_integer(hash ^ (other_hash + 0x9E3779B97F4A7C15 + (hash << 6) + (hash >> 2)));
+}
+
+// Streaming interface, for inputs that are not available as a single contiguous span. Feeding the input in pieces
+// of any size produces the same hash as the one-shot functions.
+class Hasher {
+public:
+    AT_API explicit Hasher(u64 seed = 0);
+
+public:
+    AT_API void update(ReadonlyByteSpan bytes);
+
+    ALWAYS_INLINE void update(StringView string) { update(string.byte_span()); }
+
+    template<typename T>
+    ALWAYS_INLINE void update_value(const T& value)
+    {
+        static_assert(__is_trivially_copyable(T), "Only trivially copyable types can be hashed by value");
+        update(ReadonlyByteSpan(reinterpret_cast<ReadonlyBytes>(&value), sizeof(T)));
+    }
+
+    NODISCARD AT_API u64 finalize() const;
+    NODISCARD AT_API Hash128 finalize_128() const;
+
+    // Discards all the input, but keeps the seed.
+    AT_API void reset();
+
+private:
+    void process_block(ReadonlyBytes block);
+
+    // Accumulates the buffered tail into the given accumulators, as the one-shot functions do with the end of the input.
+    void accumulate_tail(u64* accumulators) const;
+
+private:
+    u64 m_accumulators[Implementation::hash_accumulator_count];
+    u64 m_seed;
+    u64 m_total_byte_count { 0 };
+    usize m_buffered_byte_count { 0 };
+
+    // NOTE: The last stripe of the input can overlap with the last processed block, so the end of the block is kept.
+    u8 m_previous_stripe[Implementation::hash_stripe_byte_count];
+    u8 m_buffer[Implementation::hash_block_byte_count];
+};
+
+} // namespace AT
+
+using AT::Hash128;
+using AT::hash_bytes;
+using AT::hash_bytes_128;
+using AT::hash_combine;
+using AT::Hasher;
+using AT::hash_integer;
+using AT::hash_string;
+using AT::hash_string_128;
@@ -0,0 +1,236 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#pragma once
+
+#include <AT/Assertions.h>
+#include <AT/New.h>
+#include <AT/Span.h>
+#include <AT/Types.h>
+
+namespace AT {
+
+// Vector that stores its first `C` elements inside of the object, so that containers which usually hold only a
+// few elements never allocate memory. Once the inline storage is full, the elements are moved to the heap and the
+// container behaves like a regular vector.
+template<typename T, usize C>
+requires (C > 0)
+class InlineVector {
+public:
+    static constexpr usize inline_capacity = C;
+    static constexpr usize growth_factor_numerator = 3;
+    static constexpr usize growth_factor_denominator = 2;
+    static_assert(growth_factor_numerator > growth_factor_denominator);
+
+public:
+    ALWAYS_INLINE InlineVector()
+        : m_elements(inline_elements())
+        , m_capacity(C)
+        , m_count(0)
+    {}
+
+    ALWAYS_INLINE InlineVector(const InlineVector& other)
+        : InlineVector()
+    {
+        expand_elements_block_if_required(other.m_count);
+        copy_elements(m_elements, other.m_elements, other.m_count);
+        m_count = other.m_count;
+    }
+
+    ALWAYS_INLINE InlineVector(InlineVector&& other) noexcept
+        : InlineVector()
+    {
+        steal_elements(other);
+    }
+
+    ALWAYS_INLINE ~InlineVector() { clear_and_shrink(); }
+
+    ALWAYS_INLINE InlineVector& operator=(const InlineVector& other)
+    {
+        // Handle self-assignment case.
+        if (this == &other)
+            return *this;
+
+        clear();
+        expand_elements_block_if_required(other.m_count);
+        copy_elements(m_elements, other.m_elements, other.m_count);
+        m_count = other.m_count;
+        return *this;
+    }
+
+    ALWAYS_INLINE InlineVector& operator=(InlineVector&& other) noexcept
+    {
+        // Handle self-assignment case.
+        if (this == &other)
+            return *this;
+
+        clear_and_shrink();
+        steal_elements(other);
+        return *this;
+    }
+
+public:
+    NODISCARD ALWAYS_INLINE T* elements() { return m_elements; }
+    NODISCARD ALWAYS_INLINE const T* elements() const { return m_elements; }
+    NODISCARD ALWAYS_INLINE usize capacity() const { return m_capacity; }
+    NODISCARD ALWAYS_INLINE usize count() const { return m_count; }
+
+    NODISCARD ALWAYS_INLINE bool is_empty() const { return (m_count == 0); }
+    NODISCARD ALWAYS_INLINE bool has_elements() const { return (m_count > 0); }
+    NODISCARD ALWAYS_INLINE bool is_inline() const { return (m_elements == inline_elements()); }
+
+    NODISCARD ALWAYS_INLINE Span<T> span() { return Span<T>(m_elements, m_count); }
+    NODISCARD ALWAYS_INLINE Span<const T> span() const { return Span<const T>(m_elements, m_count); }
+
+public:
+    NODISCARD ALWAYS_INLINE T& at(usize index)
+    {
+        VERIFY(index < m_count);
+        return m_elements[index];
+    }
+
+    NODISCARD ALWAYS_INLINE const T& at(usize index) const
+    {
+        VERIFY(index < m_count);
+        return m_elements[index];
+    }
+
+    NODISCARD ALWAYS_INLINE T& operator[](usize index) { return m_elements[index]; }
+    NODISCARD ALWAYS_INLINE const T& operator[](usize index) const { return m_elements[index]; }
+
+public:
+    template<typename... Args>
+    ALWAYS_INLINE void emplace(Args&&... args)
+    {
+        expand_elements_block_if_required(m_count + 1);
+        new (m_elements + m_count) T(forward<Args>(args)...);
+        ++m_count;
+    }
+
+    ALWAYS_INLINE void add(const T& element)
+    {
+        expand_elements_block_if_required(m_count + 1);
+        new (m_elements + m_count) T(element);
+        ++m_count;
+    }
+
+    ALWAYS_INLINE void add(T&& element)
+    {
+        expand_elements_block_if_required(m_count + 1);
+        new (m_elements + m_count) T(move(element));
+        ++m_count;
+    }
+
+public:
+    ALWAYS_INLINE void remove_last()
+    {
+        VERIFY(m_count > 0);
+        m_elements[--m_count].~T();
+    }
+
+    ALWAYS_INLINE void remove_last(usize remove_count)
+    {
+        VERIFY(m_count >= remove_count);
+        for (usize remove_index = m_count - remove_count; remove_index < m_count; ++remove_index)
+            m_elements[remove_index].~T();
+        m_count -= remove_count;
+    }
+
+    ALWAYS_INLINE void clear()
+    {
+        for (usize index = 0; index < m_count; ++index)
+            m_elements[index].~T();
+        m_count = 0;
+    }
+
+    // NOTE: Releases the heap memory, if any, and returns to the inline storage.
+    ALWAYS_INLINE void clear_and_shrink()
+    {
+        clear();
+        if (!is_inline()) {
+            free_memory(m_elements);
+            m_elements = inline_elements();
+            m_capacity = C;
+        }
+    }
+
+private:
+    NODISCARD ALWAYS_INLINE T* inline_elements() { return reinterpret_cast<T*>(m_inline_buffer); }
+    NODISCARD ALWAYS_INLINE const T* inline_elements() const { return reinterpret_cast<const T*>(m_inline_buffer); }
+
+    NODISCARD ALWAYS_INLINE static T* allocate_memory(usize in_count)
+    {
+        const usize allocation_size = in_count * sizeof(T);
+        void* memory_block = ::operator new(allocation_size);
+        return static_cast<T*>(memory_block);
+    }
+
+    ALWAYS_INLINE static void free_memory(T* in_elements) { ::operator delete(in_elements); }
+
+    ALWAYS_INLINE static void copy_elements(T* destination_elements, const T* source_elements, usize in_count)
+    {
+        for (usize index = 0; index < in_count; ++index)
+            new (destination_elements + index) T(source_elements[index]);
+    }
+
+    ALWAYS_INLINE static void move_elements(T* destination_elements, T* source_elements, usize in_count)
+    {
+        for (usize index = 0; index < in_count; ++index) {
+            new (destination_elements + index) T(move(source_elements[index]));
+            source_elements[index].~T();
+        }
+    }
+
+    // NOTE: This vector must be empty and use its inline storage. Heap blocks are taken over, while inline elements
+    //       have to be moved one by one.
+    ALWAYS_INLINE void steal_elements(InlineVector& other)
+    {
+        if (other.is_inline()) {
+            move_elements(m_elements, other.m_elements, other.m_count);
+        }
+        else {
+            m_elements = other.m_elements;
+            m_capacity = other.m_capacity;
+            other.m_elements = other.inline_elements();
+            other.m_capacity = C;
+        }
+
+        m_count = other.m_count;
+        other.m_count = 0;
+    }
+
+    ALWAYS_INLINE void expand_elements_block(usize new_capacity)
+    {
+        VERIFY(new_capacity > m_capacity);
+        T* new_elements = allocate_memory(new_capacity);
+        move_elements(new_elements, m_elements, m_count);
+        if (!is_inline())
+            free_memory(m_elements);
+        m_elements = new_elements;
+        m_capacity = new_capacity;
+    }
+
+    ALWAYS_INLINE void expand_elements_block_if_required(usize required_capacity)
+    {
+        if (m_capacity >= required_capacity)
+            return;
+
+        usize new_capacity = (m_count * growth_factor_numerator) / growth_factor_denominator;
+        if (new_capacity < required_capacity)
+            new_capacity = required_capacity;
+
+        expand_elements_block(new_capacity);
+    }
+
+private:
+    T* m_elements;
+    usize m_capacity;
+    usize m_count;
+    alignas(T) u8 m_inline_buffer[C * sizeof(T)];
+};
+
+} // namespace AT
+
+using AT::InlineVector;
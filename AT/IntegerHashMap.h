@@ -0,0 +1,182 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#pragma once
+
+#include <AT/Assertions.h>
+#include <AT/Hash.h>
+#include <AT/NumericLimits.h>
+#include <AT/Types.h>
+#include <AT/Vector.h>
+
+namespace AT {
+
+// Hash map whose keys are integers or 128-bit hashes, stored in an open-addressed table with linear probing.
+// The keys and the values are stored inline in the slots, so a lookup usually touches a single cache line.
+//
+// NOTE: The values should be small and trivially copyable, such as the indices of entries stored elsewhere,
+//       because they are moved around when the table grows or when a key is removed.
+template<typename K, typename V>
+class IntegerHashMap {
+    AT_MAKE_NONCOPYABLE(IntegerHashMap);
+
+public:
+    static constexpr usize minimum_slot_count = 64;
+
+public:
+    ALWAYS_INLINE IntegerHashMap() = default;
+    ALWAYS_INLINE explicit IntegerHashMap(usize initial_slot_count)
+        : m_minimum_slot_count(initial_slot_count)
+    {
+        VERIFY(initial_slot_count > 0 && (initial_slot_count & (initial_slot_count - 1)) == 0);
+    }
+
+    ALWAYS_INLINE IntegerHashMap(IntegerHashMap&& other) noexcept = default;
+    ALWAYS_INLINE IntegerHashMap& operator=(IntegerHashMap&& other) noexcept = default;
+
+public:
+    NODISCARD ALWAYS_INLINE usize count() const { return m_count; }
+    NODISCARD ALWAYS_INLINE bool is_empty() const { return (m_count == 0); }
+
+    NODISCARD ALWAYS_INLINE bool contains(const K& key) const { return find_slot_index(key) != invalid_slot_index; }
+
+    // Returns a null pointer if the map doesn't contain the key.
+    NODISCARD ALWAYS_INLINE V* find(const K& key)
+    {
+        const usize slot_index = find_slot_index(key);
+        if (slot_index == invalid_slot_index)
+            return nullptr;
+        return &m_slots[slot_index].value;
+    }
+
+    NODISCARD ALWAYS_INLINE const V* find(const K& key) const
+    {
+        const usize slot_index = find_slot_index(key);
+        if (slot_index == invalid_slot_index)
+            return nullptr;
+        return &m_slots[slot_index].value;
+    }
+
+    // Inserts the key, or replaces its value if the map already contains it.
+    void set(const K& key, const V& value)
+    {
+        const usize existing_slot_index = find_slot_index(key);
+        if (existing_slot_index != invalid_slot_index) {
+            m_slots[existing_slot_index].value = value;
+            return;
+        }
+
+        // NOTE: Keep the load factor of the table below one half, so the probe sequences remain short.
+        if (2 * (m_count + 1) > m_slots.count())
+            grow();
+
+        insert_into_free_slot(key, value);
+        ++m_count;
+    }
+
+    // Returns false if the map doesn't contain the key.
+    bool remove(const K& key)
+    {
+        usize slot_index = find_slot_index(key);
+        if (slot_index == invalid_slot_index)
+            return false;
+
+        // NOTE: Shift the following slots of the probe sequence back into the freed slot, instead of leaving a
+        //       tombstone behind, so that lookups never have to skip over removed keys.
+        const usize slot_mask = m_slots.count() - 1;
+        usize next_slot_index = slot_index;
+        while (true) {
+            next_slot_index = (next_slot_index + 1) & slot_mask;
+            if (!m_slots[next_slot_index].is_used)
+                break;
+
+            const usize next_home_slot_index = home_slot(m_slots[next_slot_index].key, slot_mask);
+            const bool is_between = (slot_index <= next_slot_index) ? (slot_index < next_home_slot_index && next_home_slot_index <= next_slot_index)
+                                                                    : (slot_index < next_home_slot_index || next_home_slot_index <= next_slot_index);
+            if (is_between)
+                continue;
+
+            m_slots[slot_index] = m_slots[next_slot_index];
+            slot_index = next_slot_index;
+        }
+        m_slots[slot_index].is_used = false;
+
+        --m_count;
+        return true;
+    }
+
+    // Removes all the keys and releases the memory of the table.
+    ALWAYS_INLINE void clear()
+    {
+        m_slots.clear_and_shrink();
+        m_count = 0;
+    }
+
+private:
+    static constexpr usize invalid_slot_index = NumericLimits<usize>::max();
+
+    struct Slot {
+        K key {};
+        V value {};
+        bool is_used { false };
+    };
+
+private:
+    NODISCARD ALWAYS_INLINE static u64 hash_key(u64 key) { return hash_integer(key); }
+    // NOTE: The 128-bit hashes are already uniformly distributed, so their low half is used as is.
+    NODISCARD ALWAYS_INLINE static u64 hash_key(const Hash128& key) { return key.low; }
+
+    NODISCARD ALWAYS_INLINE static usize home_slot(const K& key, usize slot_mask) { return static_cast<usize>(hash_key(key)) & slot_mask; }
+
+    NODISCARD usize find_slot_index(const K& key) const
+    {
+        if (!m_slots.has_elements())
+            return invalid_slot_index;
+
+        const usize slot_mask = m_slots.count() - 1;
+        usize slot_index = home_slot(key, slot_mask);
+        while (m_slots[slot_index].is_used) {
+            if (m_slots[slot_index].key == key)
+                return slot_index;
+            slot_index = (slot_index + 1) & slot_mask;
+        }
+
+        return invalid_slot_index;
+    }
+
+    ALWAYS_INLINE void insert_into_free_slot(const K& key, const V& value)
+    {
+        const usize slot_mask = m_slots.count() - 1;
+        usize slot_index = home_slot(key, slot_mask);
+        while (m_slots[slot_index].is_used)
+            slot_index = (slot_index + 1) & slot_mask;
+
+        Slot& slot = m_slots[slot_index];
+        slot.key = key;
+        slot.value = value;
+        slot.is_used = true;
+    }
+
+    void grow()
+    {
+        const usize new_slot_count = m_slots.has_elements() ? (2 * m_slots.count()) : m_minimum_slot_count;
+        Vector<Slot> old_slots = move(m_slots);
+        m_slots = Vector<Slot>::from_template_element(new_slot_count, {});
+
+        for (usize slot_index = 0; slot_index < old_slots.count(); ++slot_index) {
+            if (old_slots[slot_index].is_used)
+                insert_into_free_slot(old_slots[slot_index].key, old_slots[slot_index].value);
+        }
+    }
+
+private:
+    Vector<Slot> m_slots;
+    usize m_count { 0 };
+    usize m_minimum_slot_count { minimum_slot_count };
+};
+
+} // namespace AT
+
+using AT::IntegerHashMap;
@@ -9,6 +9,8 @@
     #define WIN32_LEAN_AND_MEAN
     #define NOMINMAX
     #include <Windows.h>
+#else
+    #include <unistd.h>
 #endif // AT_PLATFORM_WINDOWS
 
 namespace AT {
@@ -43,6 +45,16 @@ void LogStream::insert(StringView message)
         // NOTE: What should happen here? We can't log anything because that is the action that failed, but
         //       asserting when a log fails seems excessive. Think about it.
     }
+#else
+    const int file_descriptor = (m_type == Type::Error) ? STDERR_FILENO : STDOUT_FILENO;
+    usize written_byte_count = 0;
+    while (written_byte_count < message.byte_count()) {
+        const ssize_t result = ::write(file_descriptor, message.characters() + written_byte_count, message.byte_count() - written_byte_count);
+        // NOTE: Same as on Windows, a failed log is silently dropped.
+        if (result <= 0)
+            break;
+        written_byte_count += static_cast<usize>(result);
+    }
 #endif // AT_PLATFORM_WINDOWS
 }
 
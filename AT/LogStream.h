@@ -66,3 +66,8 @@ ALWAYS_INLINE void errorln(const char* message, Args&&... args)
 }
 
 } // namespace AT
+
+using AT::dbgln;
+using AT::errorln;
+using AT::LogStream;
+using AT::warnln;
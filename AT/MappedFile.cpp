@@ -0,0 +1,241 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#include <AT/BitOperations.h>
+#include <AT/MappedFile.h>
+#include <AT/String.h>
+
+#if AT_PLATFORM_WINDOWS
+    #define WIN32_LEAN_AND_MEAN
+    #define NOMINMAX
+    #include <Windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif // AT_PLATFORM_WINDOWS
+
+namespace AT {
+
+#if !AT_PLATFORM_WINDOWS
+static constexpr usize huge_page_byte_count = 2 * 1024 * 1024;
+
+NODISCARD static int get_native_advice(MappedFileAccessPattern access_pattern)
+{
+    switch (access_pattern) {
+        case MappedFileAccessPattern::Normal: return MADV_NORMAL;
+        case MappedFileAccessPattern::Sequential: return MADV_SEQUENTIAL;
+        case MappedFileAccessPattern::Random: return MADV_RANDOM;
+        case MappedFileAccessPattern::WillNeed: return MADV_WILLNEED;
+        case MappedFileAccessPattern::DontNeed: return MADV_DONTNEED;
+    }
+
+    VERIFY_NOT_REACHED();
+    return MADV_NORMAL;
+}
+
+// Maps the file at an address aligned to the huge page size, which is a requirement for the kernel to be able
+// to back the mapping with huge pages. This is achieved by reserving a slightly larger anonymous region, mapping
+// the file over its aligned part and releasing the rest.
+NODISCARD static void* map_file_aligned_to_huge_page(int file_descriptor, usize mapping_byte_count)
+{
+    const usize reservation_byte_count = mapping_byte_count + huge_page_byte_count;
+    void* reservation = mmap(nullptr, reservation_byte_count, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (reservation == MAP_FAILED)
+        return MAP_FAILED;
+
+    const uintptr reservation_address = reinterpret_cast<uintptr>(reservation);
+    const uintptr aligned_address = align_up(reservation_address, huge_page_byte_count);
+    void* mapping = mmap(reinterpret_cast<void*>(aligned_address), mapping_byte_count, PROT_READ, MAP_PRIVATE | MAP_FIXED, file_descriptor, 0);
+    if (mapping == MAP_FAILED) {
+        munmap(reservation, reservation_byte_count);
+        return MAP_FAILED;
+    }
+
+    const usize leading_byte_count = aligned_address - reservation_address;
+    const usize trailing_byte_count = reservation_byte_count - leading_byte_count - mapping_byte_count;
+    if (leading_byte_count > 0)
+        munmap(reservation, leading_byte_count);
+    if (trailing_byte_count > 0)
+        munmap(reinterpret_cast<void*>(aligned_address + mapping_byte_count), trailing_byte_count);
+
+    #ifdef MADV_HUGEPAGE
+    madvise(mapping, mapping_byte_count, MADV_HUGEPAGE);
+    #endif // MADV_HUGEPAGE
+    return mapping;
+}
+#endif // !AT_PLATFORM_WINDOWS
+
+Optional<MappedFile> MappedFile::open(StringView filepath, bool prefer_huge_pages)
+{
+    // NOTE: The native APIs require a null-terminated path.
+    const String null_terminated_filepath = String(filepath);
+    MappedFile mapped_file;
+
+#if AT_PLATFORM_WINDOWS
+    // NOTE: Large pages are not used on Windows. They require the 'SeLockMemoryPrivilege' privilege and
+    //       are only available for pagefile-backed sections, not for file mappings.
+    (void)prefer_huge_pages;
+
+    const HANDLE file_handle = CreateFileA(
+        null_terminated_filepath.characters(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr
+    );
+    if (file_handle == INVALID_HANDLE_VALUE)
+        return {};
+
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file_handle, &file_size)) {
+        CloseHandle(file_handle);
+        return {};
+    }
+
+    // NOTE: Mapping an empty file is an error on Windows, but is a perfectly valid (and empty) mapped file for us.
+    if (file_size.QuadPart == 0) {
+        CloseHandle(file_handle);
+        return move(mapped_file);
+    }
+
+    const HANDLE mapping_handle = CreateFileMappingA(file_handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file_handle);
+    if (mapping_handle == nullptr)
+        return {};
+
+    // NOTE: The view keeps a reference to the file mapping object, so the handle can be closed right away.
+    void* mapping = MapViewOfFile(mapping_handle, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping_handle);
+    if (mapping == nullptr)
+        return {};
+
+    mapped_file.m_mapping_base = mapping;
+    mapped_file.m_mapping_byte_count = static_cast<usize>(file_size.QuadPart);
+#else
+    const int file_descriptor = ::open(null_terminated_filepath.characters(), O_RDONLY | O_CLOEXEC);
+    if (file_descriptor < 0)
+        return {};
+
+    struct stat file_status = {};
+    if (fstat(file_descriptor, &file_status) != 0) {
+        close(file_descriptor);
+        return {};
+    }
+
+    // NOTE: Mapping an empty file is an error, but is a perfectly valid (and empty) mapped file for us.
+    if (file_status.st_size == 0) {
+        close(file_descriptor);
+        return move(mapped_file);
+    }
+
+    const usize mapping_byte_count = static_cast<usize>(file_status.st_size);
+    void* mapping;
+    if (prefer_huge_pages && mapping_byte_count >= huge_page_byte_count)
+        mapping = map_file_aligned_to_huge_page(file_descriptor, mapping_byte_count);
+    else
+        mapping = mmap(nullptr, mapping_byte_count, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+
+    // NOTE: The mapping keeps a reference to the file, so the file descriptor can be closed right away.
+    close(file_descriptor);
+    if (mapping == MAP_FAILED)
+        return {};
+
+    mapped_file.m_mapping_base = mapping;
+    mapped_file.m_mapping_byte_count = mapping_byte_count;
+#endif // AT_PLATFORM_WINDOWS
+
+    mapped_file.m_bytes = static_cast<ReadonlyBytes>(mapped_file.m_mapping_base);
+    mapped_file.m_byte_count = mapped_file.m_mapping_byte_count;
+    return move(mapped_file);
+}
+
+MappedFile::MappedFile()
+    : m_bytes(nullptr)
+    , m_byte_count(0)
+    , m_mapping_base(nullptr)
+    , m_mapping_byte_count(0)
+{}
+
+MappedFile::~MappedFile()
+{
+    unmap();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : m_bytes(other.m_bytes)
+    , m_byte_count(other.m_byte_count)
+    , m_mapping_base(other.m_mapping_base)
+    , m_mapping_byte_count(other.m_mapping_byte_count)
+{
+    other.m_bytes = nullptr;
+    other.m_byte_count = 0;
+    other.m_mapping_base = nullptr;
+    other.m_mapping_byte_count = 0;
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+{
+    // Handle self-assignment case.
+    if (this == &other)
+        return *this;
+
+    unmap();
+    m_bytes = other.m_bytes;
+    m_byte_count = other.m_byte_count;
+    m_mapping_base = other.m_mapping_base;
+    m_mapping_byte_count = other.m_mapping_byte_count;
+
+    other.m_bytes = nullptr;
+    other.m_byte_count = 0;
+    other.m_mapping_base = nullptr;
+    other.m_mapping_byte_count = 0;
+    return *this;
+}
+
+void MappedFile::advise(MappedFileAccessPattern access_pattern)
+{
+    advise_range(0, m_byte_count, access_pattern);
+}
+
+void MappedFile::advise_range(usize byte_offset, usize byte_count, MappedFileAccessPattern access_pattern)
+{
+    VERIFY(byte_offset + byte_count <= m_byte_count);
+    if (byte_count == 0)
+        return;
+
+#if AT_PLATFORM_WINDOWS
+    if (access_pattern == MappedFileAccessPattern::WillNeed) {
+        WIN32_MEMORY_RANGE_ENTRY memory_range;
+        memory_range.VirtualAddress = const_cast<u8*>(m_bytes + byte_offset);
+        memory_range.NumberOfBytes = byte_count;
+        PrefetchVirtualMemory(GetCurrentProcess(), 1, &memory_range, 0);
+    }
+    // NOTE: Windows has no equivalent for the other access patterns.
+#else
+    // NOTE: The range passed to 'madvise' must start at a page boundary.
+    const uintptr page_byte_count = static_cast<uintptr>(sysconf(_SC_PAGESIZE));
+    const uintptr range_begin = reinterpret_cast<uintptr>(m_bytes + byte_offset);
+    const uintptr aligned_range_begin = range_begin & ~(page_byte_count - 1);
+    const usize aligned_byte_count = byte_count + (range_begin - aligned_range_begin);
+
+    madvise(reinterpret_cast<void*>(aligned_range_begin), aligned_byte_count, get_native_advice(access_pattern));
+#endif // AT_PLATFORM_WINDOWS
+}
+
+void MappedFile::unmap()
+{
+    if (m_mapping_base != nullptr) {
+#if AT_PLATFORM_WINDOWS
+        UnmapViewOfFile(m_mapping_base);
+#else
+        munmap(m_mapping_base, m_mapping_byte_count);
+#endif // AT_PLATFORM_WINDOWS
+    }
+
+    m_bytes = nullptr;
+    m_byte_count = 0;
+    m_mapping_base = nullptr;
+    m_mapping_byte_count = 0;
+}
+
+} // namespace AT
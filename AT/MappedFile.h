@@ -0,0 +1,77 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#pragma once
+
+#include <AT/API.h>
+#include <AT/Optional.h>
+#include <AT/Span.h>
+#include <AT/StringView.h>
+#include <AT/Types.h>
+
+namespace AT {
+
+// Hints about how the contents of a mapped file are going to be accessed, which allow the
+// operating system to tune its read-ahead and page reclaiming policies.
+enum class MappedFileAccessPattern : u8 {
+    Normal,
+    // The pages will be accessed in increasing order, so aggressive read-ahead is beneficial.
+    Sequential,
+    // The pages will be accessed in no particular order, so read-ahead is wasteful.
+    Random,
+    // The pages will be accessed soon, so they should be read in the background right away.
+    WillNeed,
+    // The pages won't be accessed again soon, so they can be reclaimed first.
+    DontNeed,
+};
+
+// Read-only memory mapping of an entire file. The contents are exposed directly, without ever being copied
+// into a buffer, and are paged in lazily by the operating system the first time they are accessed.
+class MappedFile {
+    AT_MAKE_NONCOPYABLE(MappedFile);
+
+public:
+    // NOTE: When `prefer_huge_pages` is set, the mapping is aligned to the huge page size and the operating
+    //       system is asked to back it with huge pages. This reduces the TLB pressure for large files, but
+    //       is only a hint, as not all file systems support huge pages for file-backed memory.
+    NODISCARD AT_API static Optional<MappedFile> open(StringView filepath, bool prefer_huge_pages = false);
+
+public:
+    AT_API MappedFile();
+    AT_API ~MappedFile();
+
+    AT_API MappedFile(MappedFile&& other) noexcept;
+    AT_API MappedFile& operator=(MappedFile&& other) noexcept;
+
+public:
+    NODISCARD ALWAYS_INLINE ReadonlyBytes bytes() const { return m_bytes; }
+    NODISCARD ALWAYS_INLINE usize byte_count() const { return m_byte_count; }
+    NODISCARD ALWAYS_INLINE bool is_empty() const { return (m_byte_count == 0); }
+
+    NODISCARD ALWAYS_INLINE ReadonlyByteSpan byte_span() const { return ReadonlyByteSpan(m_bytes, m_byte_count); }
+
+    // NOTE: No validation of the UTF-8 encoding is performed.
+    NODISCARD ALWAYS_INLINE StringView string_view() const { return StringView::from_utf8(byte_span()); }
+
+public:
+    AT_API void advise(MappedFileAccessPattern access_pattern);
+    AT_API void advise_range(usize byte_offset, usize byte_count, MappedFileAccessPattern access_pattern);
+
+    AT_API void unmap();
+
+private:
+    ReadonlyBytes m_bytes;
+    usize m_byte_count;
+
+    // NOTE: The memory region that was actually mapped, which can be larger than the file contents
+    //       when the mapping was aligned for huge pages.
+    void* m_mapping_base;
+    usize m_mapping_byte_count;
+};
+
+} // namespace AT
+
+using AT::MappedFile;
+using AT::MappedFileAccessPattern;
@@ -19,6 +19,23 @@ void copy_memory(void* destination_buffer, const void* source_buffer, usize byte
         destination[byte_offset] = source[byte_offset];
 }
 
+void move_memory(void* destination_buffer, const void* source_buffer, usize byte_count)
+{
+    const WriteonlyBytes destination = static_cast<WriteonlyBytes>(destination_buffer);
+    const ReadonlyBytes source = static_cast<ReadonlyBytes>(source_buffer);
+
+    // NOTE: Copying in the direction away from the overlapping region ensures that no source byte is
+    //       overwritten before it is read.
+    if (destination < source) {
+        for (usize byte_offset = 0; byte_offset < byte_count; ++byte_offset)
+            destination[byte_offset] = source[byte_offset];
+    }
+    else {
+        for (usize byte_offset = byte_count; byte_offset > 0; --byte_offset)
+            destination[byte_offset - 1] = source[byte_offset - 1];
+    }
+}
+
 void set_memory(void* destination_buffer, u8 byte_value, usize byte_count)
 {
     const WriteonlyBytes destination = static_cast<WriteonlyBytes>(destination_buffer);
@@ -12,6 +12,9 @@ namespace AT {
 
 AT_API void copy_memory(void* destination_buffer, const void* source_buffer, usize byte_count);
 
+// NOTE: Unlike AT::copy_memory(), the source and the destination buffers are allowed to overlap.
+AT_API void move_memory(void* destination_buffer, const void* source_buffer, usize byte_count);
+
 AT_API void set_memory(void* destination_buffer, u8 byte_value, usize byte_count);
 
 AT_API void zero_memory(void* destination_buffer, usize byte_count);
@@ -19,5 +22,6 @@ AT_API void zero_memory(void* destination_buffer, usize byte_count);
 } // namespace AT
 
 using AT::copy_memory;
+using AT::move_memory;
 using AT::set_memory;
 using AT::zero_memory;
@@ -5,7 +5,7 @@
 
 #pragma once
 
-inline void* operator new(size_t, void* address)
-{
-    return address;
-}
+// NOTE: The placement new operator can't be redefined by us, as it would collide with the one
+//       declared by the standard library as soon as any standard header (such as <coroutine>
+//       or <thread>) pulls in the <new> header.
+#include <new>
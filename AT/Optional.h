@@ -6,6 +6,7 @@
 #pragma once
 
 #include <AT/Assertions.h>
+#include <AT/New.h>
 #include <AT/Types.h>
 
 namespace AT {
@@ -6,6 +6,7 @@
 #pragma once
 
 #include <AT/Assertions.h>
+#include <AT/NumericLimits.h>
 #include <AT/Types.h>
 
 namespace AT {
@@ -42,8 +43,10 @@ public:
     u64 m_reference_count;
 };
 
+// NOTE: The type is not constrained at the class level, so that a class can refer to references of itself while it
+//       is still incomplete, for example in its factory functions. Casting the instance to `RefCounted` when the
+//       reference count is modified enforces the requirement instead.
 template<typename T>
-requires (is_derived_from<T, RefCounted>)
 class RefPtr {
     template<typename Q>
     friend RefPtr<Q> adopt_ref(Q*);
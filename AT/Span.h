@@ -114,6 +114,10 @@ public:
     }
 
 private:
+    // NOTE: Required by the implicit conversion from a non-const span to a const span.
+    template<typename Q>
+    friend class Span;
+
     T* m_elements;
     usize m_count;
 };
@@ -0,0 +1,233 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#include <AT/MemoryOperations.h>
+#include <AT/Stream.h>
+
+namespace AT {
+
+BufferedReader::BufferedReader(InputStream& stream, usize buffer_byte_count)
+    : m_stream(&stream)
+    , m_buffer(ByteBuffer::from_initial_byte_count(buffer_byte_count))
+{
+    VERIFY(buffer_byte_count > 0);
+    m_bytes = m_buffer.bytes();
+}
+
+BufferedReader::BufferedReader(ReadonlyByteSpan bytes)
+    : m_stream(nullptr)
+    , m_bytes(bytes.elements())
+    , m_byte_count(bytes.count())
+    , m_has_reached_end_of_stream(true)
+{}
+
+Optional<ReadonlyByteSpan> BufferedReader::peek_span(usize min_byte_count)
+{
+    if (m_byte_count - m_offset < min_byte_count && !m_has_reached_end_of_stream) {
+        if (!fill_buffer(min_byte_count))
+            return {};
+    }
+
+    return ReadonlyByteSpan(m_bytes + m_offset, m_byte_count - m_offset);
+}
+
+void BufferedReader::consume(usize byte_count)
+{
+    VERIFY(byte_count <= m_byte_count - m_offset);
+    m_offset += byte_count;
+}
+
+Optional<usize> BufferedReader::read(WriteonlyByteSpan destination)
+{
+    usize read_byte_count = 0;
+
+    while (read_byte_count < destination.count()) {
+        if (m_offset == m_byte_count) {
+            if (m_has_reached_end_of_stream)
+                break;
+
+            // NOTE: Large reads bypass the buffer entirely, as copying through it would only add overhead.
+            const usize remaining_byte_count = destination.count() - read_byte_count;
+            if (remaining_byte_count >= m_buffer.byte_count()) {
+                const Optional<usize> result = m_stream->read_some(destination.slice(read_byte_count));
+                if (!result.has_value())
+                    return {};
+                if (result.value() == 0)
+                    m_has_reached_end_of_stream = true;
+                read_byte_count += result.value();
+                continue;
+            }
+
+            if (!fill_buffer(1))
+                return {};
+            continue;
+        }
+
+        usize copy_byte_count = m_byte_count - m_offset;
+        if (copy_byte_count > destination.count() - read_byte_count)
+            copy_byte_count = destination.count() - read_byte_count;
+
+        copy_memory(destination.elements() + read_byte_count, m_bytes + m_offset, copy_byte_count);
+        m_offset += copy_byte_count;
+        read_byte_count += copy_byte_count;
+    }
+
+    return read_byte_count;
+}
+
+bool BufferedReader::fill_buffer(usize min_byte_count)
+{
+    VERIFY(m_stream != nullptr);
+    VERIFY(min_byte_count <= m_buffer.byte_count());
+
+    // NOTE: Move the bytes that weren't consumed yet to the beginning of the buffer, so they remain
+    //       contiguous with the bytes that are about to be read.
+    const usize remaining_byte_count = m_byte_count - m_offset;
+    if (m_offset > 0) {
+        move_memory(m_buffer.bytes(), m_buffer.bytes() + m_offset, remaining_byte_count);
+        m_offset = 0;
+        m_byte_count = remaining_byte_count;
+    }
+
+    while (m_byte_count < min_byte_count) {
+        const Optional<usize> result = m_stream->read_some(m_buffer.byte_span().slice(m_byte_count));
+        if (!result.has_value())
+            return false;
+
+        if (result.value() == 0) {
+            m_has_reached_end_of_stream = true;
+            break;
+        }
+        m_byte_count += result.value();
+    }
+
+    return true;
+}
+
+BufferedWriter::BufferedWriter(OutputStream& stream, usize buffer_byte_count)
+    : m_stream(&stream)
+    , m_buffer(ByteBuffer::from_initial_byte_count(buffer_byte_count))
+{
+    VERIFY(buffer_byte_count > 0);
+    m_bytes = m_buffer.bytes();
+    m_byte_count = m_buffer.byte_count();
+}
+
+BufferedWriter::BufferedWriter(ByteBuffer& destination)
+    : m_destination_buffer(&destination)
+    , m_bytes(destination.bytes())
+    , m_offset(destination.byte_count())
+    , m_byte_count(destination.byte_count())
+{}
+
+BufferedWriter::BufferedWriter(WriteonlyByteSpan destination)
+    : m_bytes(destination.elements())
+    , m_byte_count(destination.count())
+{}
+
+BufferedWriter::~BufferedWriter()
+{
+    MAYBE_UNUSED const bool finished = finish();
+}
+
+Optional<WriteonlyByteSpan> BufferedWriter::reserve_span(usize min_byte_count)
+{
+    if (!make_space(min_byte_count))
+        return {};
+    return WriteonlyByteSpan(m_bytes + m_offset, m_byte_count - m_offset);
+}
+
+void BufferedWriter::commit(usize byte_count)
+{
+    VERIFY(byte_count <= m_byte_count - m_offset);
+    m_offset += byte_count;
+    m_written_byte_count += byte_count;
+}
+
+bool BufferedWriter::write(ReadonlyByteSpan source)
+{
+    if (m_byte_count - m_offset < source.count()) {
+        // NOTE: Writes that don't fit in the buffer go directly to the stream, after the buffered bytes.
+        if (m_stream != nullptr && source.count() >= m_buffer.byte_count()) {
+            if (!make_space(m_buffer.byte_count()))
+                return false;
+            if (!m_stream->write(source))
+                return false;
+            m_written_byte_count += source.count();
+            return true;
+        }
+
+        if (!make_space(source.count()))
+            return false;
+    }
+
+    copy_memory(m_bytes + m_offset, source.elements(), source.count());
+    commit(source.count());
+    return true;
+}
+
+bool BufferedWriter::flush()
+{
+    if (m_stream != nullptr) {
+        if (!make_space(m_buffer.byte_count()))
+            return false;
+        return m_stream->flush();
+    }
+
+    // NOTE: The destination buffer keeps its capacity, so writing after a flush doesn't reallocate it.
+    return true;
+}
+
+bool BufferedWriter::finish()
+{
+    if (!flush())
+        return false;
+
+    // NOTE: Trim the unused capacity of the destination buffer, so its byte count matches the written bytes.
+    if (m_destination_buffer != nullptr && m_destination_buffer->byte_count() != m_offset) {
+        if (m_offset == 0)
+            m_destination_buffer->free();
+        else
+            m_destination_buffer->shrink(m_offset);
+
+        m_bytes = m_destination_buffer->bytes();
+        m_byte_count = m_offset;
+    }
+
+    return true;
+}
+
+bool BufferedWriter::make_space(usize min_byte_count)
+{
+    if (m_byte_count - m_offset >= min_byte_count)
+        return true;
+
+    if (m_stream != nullptr) {
+        VERIFY(min_byte_count <= m_buffer.byte_count());
+        const bool result = m_stream->write(ReadonlyByteSpan(m_bytes, m_offset));
+        m_offset = 0;
+        return result;
+    }
+
+    if (m_destination_buffer != nullptr) {
+        // NOTE: Grow geometrically, so appending many small pieces only copies each byte a constant
+        //       number of times on average.
+        usize new_byte_count = m_byte_count * 2;
+        if (new_byte_count < m_offset + min_byte_count)
+            new_byte_count = m_offset + min_byte_count;
+        if (new_byte_count < 256)
+            new_byte_count = 256;
+
+        m_destination_buffer->expand(new_byte_count);
+        m_bytes = m_destination_buffer->bytes();
+        m_byte_count = new_byte_count;
+        return true;
+    }
+
+    // NOTE: A fixed block of memory can't be grown.
+    return false;
+}
+
+} // namespace AT
@@ -0,0 +1,153 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#pragma once
+
+#include <AT/API.h>
+#include <AT/ByteBuffer.h>
+#include <AT/Optional.h>
+#include <AT/Span.h>
+#include <AT/Types.h>
+
+namespace AT {
+
+// Source of bytes that can only be read sequentially, such as a file or a socket.
+class InputStream {
+public:
+    virtual ~InputStream() = default;
+
+    // Reads at most the size of the destination span. Returns the number of bytes read, which is
+    // zero only when the end of the stream is reached.
+    NODISCARD virtual Optional<usize> read_some(WriteonlyByteSpan destination) = 0;
+};
+
+// Destination of bytes that can only be written sequentially, such as a file or a socket.
+class OutputStream {
+public:
+    virtual ~OutputStream() = default;
+
+    // Writes the entire source span. Returns whether all the bytes were written.
+    NODISCARD virtual bool write(ReadonlyByteSpan source) = 0;
+
+    NODISCARD virtual bool flush() { return true; }
+};
+
+// Reads from an input stream through an intermediate buffer, or directly from a block of memory. Parsers should
+// inspect the bytes in place with BufferedReader::peek_span() and then BufferedReader::consume() them, which
+// never copies the bytes when reading from memory, and copies them only once (from the kernel) when reading
+// from a stream.
+class BufferedReader {
+    AT_MAKE_NONCOPYABLE(BufferedReader);
+    AT_MAKE_NONMOVABLE(BufferedReader);
+
+public:
+    static constexpr usize default_buffer_byte_count = 64 * 1024;
+
+public:
+    // NOTE: The stream must outlive the reader.
+    AT_API explicit BufferedReader(InputStream& stream, usize buffer_byte_count = default_buffer_byte_count);
+
+    // NOTE: The bytes are read in place, so the memory they are stored in must outlive the reader.
+    AT_API explicit BufferedReader(ReadonlyByteSpan bytes);
+
+    ~BufferedReader() = default;
+
+public:
+    // Returns all the bytes that are currently available without reading from the stream. When fewer than
+    // `min_byte_count` bytes are available, the buffer is refilled first. The returned span is shorter than
+    // `min_byte_count` only when the end of the stream is reached. The span is invalidated by any other call.
+    // NOTE: When reading from a stream, `min_byte_count` must not exceed the size of the buffer.
+    NODISCARD AT_API Optional<ReadonlyByteSpan> peek_span(usize min_byte_count = 1);
+
+    // Advances past bytes that were previously returned by BufferedReader::peek_span().
+    AT_API void consume(usize byte_count);
+
+    // Copies bytes into the destination span. Returns the number of bytes read, which is less than the size
+    // of the destination span only when the end of the stream is reached.
+    NODISCARD AT_API Optional<usize> read(WriteonlyByteSpan destination);
+
+    // NOTE: Only returns true after a read or peek operation observed the end of the stream.
+    NODISCARD ALWAYS_INLINE bool is_end_of_stream() const { return m_has_reached_end_of_stream && (m_offset == m_byte_count); }
+
+private:
+    NODISCARD bool fill_buffer(usize min_byte_count);
+
+private:
+    InputStream* m_stream;
+    ByteBuffer m_buffer;
+
+    // NOTE: Points either to the internal buffer or to the memory the reader was created from.
+    ReadonlyBytes m_bytes;
+    usize m_offset { 0 };
+    usize m_byte_count { 0 };
+    bool m_has_reached_end_of_stream { false };
+};
+
+// Writes to an output stream through an intermediate buffer, or directly to a block of memory. Encoders should
+// produce their output in place, in the span returned by BufferedWriter::reserve_span(), and then
+// BufferedWriter::commit() it, which avoids copying the output through a temporary buffer.
+class BufferedWriter {
+    AT_MAKE_NONCOPYABLE(BufferedWriter);
+    AT_MAKE_NONMOVABLE(BufferedWriter);
+
+public:
+    static constexpr usize default_buffer_byte_count = 64 * 1024;
+
+public:
+    // NOTE: The stream must outlive the writer. The buffered bytes are written when the buffer is full, when
+    //       BufferedWriter::flush() is called and when the writer is destroyed.
+    AT_API explicit BufferedWriter(OutputStream& stream, usize buffer_byte_count = default_buffer_byte_count);
+
+    // Appends the bytes to the given buffer, which is grown geometrically as required. The byte count of the
+    // buffer is trimmed to the written bytes when BufferedWriter::finish() is called and when the writer is destroyed.
+    AT_API explicit BufferedWriter(ByteBuffer& destination);
+
+    // Writes the bytes to a fixed block of memory. Writing past its end fails.
+    AT_API explicit BufferedWriter(WriteonlyByteSpan destination);
+
+    AT_API ~BufferedWriter();
+
+public:
+    // NOTE: The number of bytes that were written or committed through this writer, including the ones not flushed yet.
+    NODISCARD ALWAYS_INLINE u64 written_byte_count() const { return m_written_byte_count; }
+
+    // Returns a span of at least `min_byte_count` bytes that can be filled in place. The span is invalidated by
+    // any other call. Returns an empty optional if the required space couldn't be made available.
+    // NOTE: When writing to a stream, `min_byte_count` must not exceed the size of the buffer.
+    NODISCARD AT_API Optional<WriteonlyByteSpan> reserve_span(usize min_byte_count);
+
+    // Marks bytes of the span previously returned by BufferedWriter::reserve_span() as written.
+    AT_API void commit(usize byte_count);
+
+    NODISCARD AT_API bool write(ReadonlyByteSpan source);
+
+    NODISCARD AT_API bool flush();
+
+    // Flushes the writer and trims the destination buffer to the written bytes. Trimming reallocates the buffer, so
+    // it is only done once the output is complete, and not on every flush.
+    // NOTE: Writing again after finishing grows the destination buffer again.
+    NODISCARD AT_API bool finish();
+
+private:
+    NODISCARD bool make_space(usize min_byte_count);
+
+private:
+    OutputStream* m_stream { nullptr };
+    ByteBuffer* m_destination_buffer { nullptr };
+    ByteBuffer m_buffer;
+
+    // NOTE: Points either to the internal buffer, to the destination buffer or to the destination memory block.
+    WriteonlyBytes m_bytes { nullptr };
+    usize m_offset { 0 };
+    usize m_byte_count { 0 };
+    u64 m_written_byte_count { 0 };
+};
+
+} // namespace AT
+
+using AT::BufferedReader;
+using AT::BufferedWriter;
+using AT::InputStream;
+using AT::OutputStream;
@@ -81,8 +81,8 @@ public:
     AT_API StringView& operator=(const String& string);
 
 public:
-    NODISCARD ALWAYS_INLINE const char* characters() const { return m_characters; }
-    NODISCARD ALWAYS_INLINE usize byte_count() const { return m_byte_count; }
+    NODISCARD ALWAYS_INLINE constexpr const char* characters() const { return m_characters; }
+    NODISCARD ALWAYS_INLINE constexpr usize byte_count() const { return m_byte_count; }
 
     NODISCARD ALWAYS_INLINE bool is_empty() const { return (m_byte_count == 0); }
     NODISCARD ALWAYS_INLINE bool has_characters() const { return (m_byte_count > 0); }
@@ -0,0 +1,72 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#include <AT/Task.h>
+
+namespace AT {
+
+struct TaskFreeFrame {
+    TaskFreeFrame* next_free_frame;
+};
+
+struct TaskFramePool {
+    TaskFreeFrame* free_frames[TaskFrameAllocator::size_class_count] = {};
+    usize cached_frame_counts[TaskFrameAllocator::size_class_count] = {};
+
+    ~TaskFramePool()
+    {
+        for (usize size_class_index = 0; size_class_index < TaskFrameAllocator::size_class_count; ++size_class_index) {
+            TaskFreeFrame* free_frame = free_frames[size_class_index];
+            while (free_frame) {
+                TaskFreeFrame* next_free_frame = free_frame->next_free_frame;
+                ::operator delete(free_frame);
+                free_frame = next_free_frame;
+            }
+        }
+    }
+};
+
+// NOTE: A frame can be released on a different thread than the one that allocated it (for example,
+//       when the task is resumed on a worker thread). In that case the frame simply migrates to the
+//       pool of the releasing thread, which is fine as the pools are just caches.
+static thread_local TaskFramePool t_frame_pool;
+
+NODISCARD ALWAYS_INLINE static usize get_size_class_index(usize frame_byte_count)
+{
+    return (frame_byte_count + TaskFrameAllocator::size_class_granularity - 1) / TaskFrameAllocator::size_class_granularity - 1;
+}
+
+void* TaskFrameAllocator::allocate(usize frame_byte_count)
+{
+    const usize size_class_index = get_size_class_index(frame_byte_count);
+    if (size_class_index >= size_class_count)
+        return ::operator new(frame_byte_count);
+
+    TaskFreeFrame* free_frame = t_frame_pool.free_frames[size_class_index];
+    if (free_frame) {
+        t_frame_pool.free_frames[size_class_index] = free_frame->next_free_frame;
+        --t_frame_pool.cached_frame_counts[size_class_index];
+        return free_frame;
+    }
+
+    // NOTE: Always allocate the full size class, so the frame can be reused by any coroutine of the same class.
+    return ::operator new((size_class_index + 1) * size_class_granularity);
+}
+
+void TaskFrameAllocator::free(void* frame, usize frame_byte_count)
+{
+    const usize size_class_index = get_size_class_index(frame_byte_count);
+    if (size_class_index >= size_class_count || t_frame_pool.cached_frame_counts[size_class_index] >= max_cached_frame_count_per_size_class) {
+        ::operator delete(frame);
+        return;
+    }
+
+    TaskFreeFrame* free_frame = static_cast<TaskFreeFrame*>(frame);
+    free_frame->next_free_frame = t_frame_pool.free_frames[size_class_index];
+    t_frame_pool.free_frames[size_class_index] = free_frame;
+    ++t_frame_pool.cached_frame_counts[size_class_index];
+}
+
+} // namespace AT
@@ -0,0 +1,224 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#pragma once
+
+#include <AT/API.h>
+#include <AT/Assertions.h>
+#include <AT/Optional.h>
+#include <AT/Types.h>
+
+// NOTE: Headers from the standard library.
+#include <coroutine>
+
+namespace AT {
+
+// Allocator used for the frames of all task coroutines. The frames are grouped into size classes and
+// the released ones are cached in a per-thread free list, so creating a coroutine almost never has to
+// go through the global heap. Frames larger than the biggest size class bypass the cache.
+class TaskFrameAllocator {
+public:
+    static constexpr usize size_class_granularity = 64;
+    static constexpr usize size_class_count = 16;
+    static constexpr usize max_cached_frame_count_per_size_class = 64;
+
+public:
+    NODISCARD AT_API static void* allocate(usize frame_byte_count);
+    AT_API static void free(void* frame, usize frame_byte_count);
+};
+
+template<typename T>
+class Task;
+
+namespace Implementation {
+
+class TaskPromiseBase {
+public:
+    struct FinalAwaiter {
+        NODISCARD ALWAYS_INLINE bool await_ready() const noexcept { return false; }
+
+        template<typename PromiseType>
+        NODISCARD ALWAYS_INLINE std::coroutine_handle<> await_suspend(std::coroutine_handle<PromiseType> handle) noexcept
+        {
+            TaskPromiseBase& promise = handle.promise();
+            if (promise.m_continuation)
+                return promise.m_continuation;
+
+            // NOTE: Nobody owns the frame of a detached task, so it must destroy itself once completed.
+            if (promise.m_is_detached)
+                handle.destroy();
+            return std::noop_coroutine();
+        }
+
+        ALWAYS_INLINE void await_resume() const noexcept {}
+    };
+
+public:
+    NODISCARD ALWAYS_INLINE static void* operator new(std::size_t frame_byte_count) { return TaskFrameAllocator::allocate(frame_byte_count); }
+    ALWAYS_INLINE static void operator delete(void* frame, std::size_t frame_byte_count) { TaskFrameAllocator::free(frame, frame_byte_count); }
+
+    // NOTE: Tasks are lazy. The coroutine body starts executing only when the task is awaited or started.
+    NODISCARD ALWAYS_INLINE std::suspend_always initial_suspend() const noexcept { return {}; }
+    NODISCARD ALWAYS_INLINE FinalAwaiter final_suspend() const noexcept { return {}; }
+
+    // NOTE: Exceptions are not used anywhere in the codebase.
+    ALWAYS_INLINE void unhandled_exception() { VERIFY_NOT_REACHED(); }
+
+public:
+    std::coroutine_handle<> m_continuation;
+    bool m_is_detached { false };
+};
+
+template<typename T>
+class TaskPromise : public TaskPromiseBase {
+public:
+    NODISCARD ALWAYS_INLINE Task<T> get_return_object();
+
+    ALWAYS_INLINE void return_value(const T& value) { m_result = value; }
+    ALWAYS_INLINE void return_value(T&& value) { m_result = move(value); }
+
+    NODISCARD ALWAYS_INLINE T release_result()
+    {
+        T result = move(m_result.value());
+        m_result.release();
+        return result;
+    }
+
+private:
+    Optional<T> m_result;
+};
+
+template<>
+class TaskPromise<void> : public TaskPromiseBase {
+public:
+    NODISCARD ALWAYS_INLINE Task<void> get_return_object();
+
+    ALWAYS_INLINE void return_void() {}
+    ALWAYS_INLINE void release_result() {}
+};
+
+} // namespace Implementation
+
+template<typename T = void>
+class Task {
+    AT_MAKE_NONCOPYABLE(Task);
+    friend class Implementation::TaskPromise<T>;
+
+public:
+    // NOTE: The name of this type alias is required by the coroutine machinery.
+    using promise_type = Implementation::TaskPromise<T>;
+    using HandleType = std::coroutine_handle<promise_type>;
+
+    class Awaiter {
+    public:
+        ALWAYS_INLINE explicit Awaiter(HandleType handle)
+            : m_handle(handle)
+        {}
+
+        NODISCARD ALWAYS_INLINE bool await_ready() const noexcept { return m_handle.done(); }
+
+        NODISCARD ALWAYS_INLINE std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting_handle) noexcept
+        {
+            // NOTE: Symmetric transfer. The awaited task starts running on the current thread and, once it
+            //       completes, control is transferred back to the awaiting coroutine without growing the stack.
+            m_handle.promise().m_continuation = awaiting_handle;
+            return m_handle;
+        }
+
+        ALWAYS_INLINE T await_resume() { return m_handle.promise().release_result(); }
+
+    private:
+        HandleType m_handle;
+    };
+
+public:
+    ALWAYS_INLINE Task()
+        : m_handle(nullptr)
+    {}
+
+    ALWAYS_INLINE Task(Task&& other) noexcept
+        : m_handle(other.m_handle)
+    {
+        other.m_handle = nullptr;
+    }
+
+    ALWAYS_INLINE ~Task() { release(); }
+
+    ALWAYS_INLINE Task& operator=(Task&& other) noexcept
+    {
+        // Handle self-assignment case.
+        if (this == &other)
+            return *this;
+
+        release();
+        m_handle = other.m_handle;
+        other.m_handle = nullptr;
+        return *this;
+    }
+
+public:
+    NODISCARD ALWAYS_INLINE bool is_valid() const { return (m_handle != nullptr); }
+
+    NODISCARD ALWAYS_INLINE bool is_done() const
+    {
+        VERIFY(is_valid());
+        return m_handle.done();
+    }
+
+    NODISCARD ALWAYS_INLINE Awaiter operator co_await() const
+    {
+        VERIFY(is_valid());
+        return Awaiter(m_handle);
+    }
+
+public:
+    // Starts executing the task on the current thread without anyone awaiting its completion.
+    // The ownership of the coroutine frame is released, and the frame destroys itself once the task completes.
+    ALWAYS_INLINE void start_detached()
+    {
+        VERIFY(is_valid());
+        HandleType handle = m_handle;
+        m_handle = nullptr;
+
+        handle.promise().m_is_detached = true;
+        handle.resume();
+    }
+
+    ALWAYS_INLINE void release()
+    {
+        if (m_handle) {
+            m_handle.destroy();
+            m_handle = nullptr;
+        }
+    }
+
+private:
+    ALWAYS_INLINE explicit Task(HandleType handle)
+        : m_handle(handle)
+    {}
+
+private:
+    HandleType m_handle;
+};
+
+namespace Implementation {
+
+template<typename T>
+ALWAYS_INLINE Task<T> TaskPromise<T>::get_return_object()
+{
+    return Task<T>(Task<T>::HandleType::from_promise(*this));
+}
+
+ALWAYS_INLINE Task<void> TaskPromise<void>::get_return_object()
+{
+    return Task<void>(Task<void>::HandleType::from_promise(*this));
+}
+
+} // namespace Implementation
+
+} // namespace AT
+
+using AT::Task;
+using AT::TaskFrameAllocator;
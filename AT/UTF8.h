@@ -0,0 +1,95 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#pragma once
+
+#include <AT/Span.h>
+#include <AT/Types.h>
+
+namespace AT {
+
+// NOTE: Substituted for the bytes that don't form a valid UTF-8 sequence.
+inline constexpr u32 replacement_code_point = 0xFFFD;
+
+// Decodes the code point that starts at the offset, and advances the offset past its bytes.
+//
+// An invalid sequence decodes to the replacement character and the offset only advances past its first byte, so
+// that decoding resynchronizes at the next byte that could start a sequence. Overlong encodings, surrogates and code
+// points beyond the Unicode range are all invalid.
+// NOTE: The offset must be less than the number of bytes.
+NODISCARD ALWAYS_INLINE u32 decode_utf8_code_point(ReadonlyByteSpan bytes, usize& offset)
+{
+    const u8 lead_byte = bytes[offset];
+    if (lead_byte < 0x80) {
+        ++offset;
+        return lead_byte;
+    }
+
+    u32 continuation_byte_count;
+    u32 code_point;
+    u32 min_code_point;
+    if ((lead_byte & 0xE0) == 0xC0) {
+        continuation_byte_count = 1;
+        code_point = lead_byte & 0x1F;
+        min_code_point = 0x80;
+    }
+    else if ((lead_byte & 0xF0) == 0xE0) {
+        continuation_byte_count = 2;
+        code_point = lead_byte & 0x0F;
+        min_code_point = 0x800;
+    }
+    else if ((lead_byte & 0xF8) == 0xF0) {
+        continuation_byte_count = 3;
+        code_point = lead_byte & 0x07;
+        min_code_point = 0x10000;
+    }
+    else {
+        ++offset;
+        return replacement_code_point;
+    }
+
+    if (offset + continuation_byte_count >= bytes.count()) {
+        ++offset;
+        return replacement_code_point;
+    }
+
+    for (u32 byte_index = 1; byte_index <= continuation_byte_count; ++byte_index) {
+        const u8 continuation_byte = bytes[offset + byte_index];
+        if ((continuation_byte & 0xC0) != 0x80) {
+            ++offset;
+            return replacement_code_point;
+        }
+        code_point = (code_point << 6) | (continuation_byte & 0x3F);
+    }
+
+    if (code_point < min_code_point || (code_point >= 0xD800 && code_point <= 0xDFFF) || code_point > 0x10FFFF) {
+        ++offset;
+        return replacement_code_point;
+    }
+
+    offset += continuation_byte_count + 1;
+    return code_point;
+}
+
+// Returns the offset of the code point that ends at the offset, as decode_utf8_code_point() would have decoded it
+// when decoding from the start of the bytes.
+// NOTE: The offset must be greater than zero, and it must be the end of a code point.
+NODISCARD ALWAYS_INLINE usize previous_utf8_code_point_offset(ReadonlyByteSpan bytes, usize offset)
+{
+    usize lead_offset = offset - 1;
+    while (lead_offset > 0 && offset - lead_offset < 4 && (bytes[lead_offset] & 0xC0) == 0x80)
+        --lead_offset;
+
+    // NOTE: If the bytes don't form a valid sequence that ends at the offset, each of them decodes on its own.
+    usize decoded_offset = lead_offset;
+    MAYBE_UNUSED const u32 code_point = decode_utf8_code_point(bytes, decoded_offset);
+    return (decoded_offset == offset) ? lead_offset : (offset - 1);
+}
+
+} // namespace AT
+
+using AT::decode_utf8_code_point;
+using AT::previous_utf8_code_point_offset;
+using AT::replacement_code_point;
@@ -96,7 +96,7 @@ public:
         if (this == &other)
             return *this;
 
-        clear();
+        clear_and_shrink();
 
         m_elements = other.m_elements;
         m_capacity = other.m_capacity;
@@ -0,0 +1,142 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#include <AT/LogStream.h>
+#include <AT/StringView.h>
+#include <Core/Time.h>
+#include <Graphics/Bitmap.h>
+#include <Graphics/Compositing.h>
+
+//
+// Measures the pixel throughput of every compositing kernel, by repeatedly compositing a bitmap over another one
+// of the same size. The bitmaps are small enough to stay in the L2 cache, so that the results reflect the cost of
+// the kernels rather than the memory bandwidth.
+//
+
+using namespace Graphics;
+
+static constexpr u32 bitmap_width = 256;
+static constexpr u32 bitmap_height = 256;
+static constexpr u64 minimum_measurement_time_in_nanoseconds = 250 * Core::nanoseconds_per_millisecond;
+
+static constexpr BlendMode blend_modes[] = {
+    BlendMode::SourceOver, BlendMode::SourceIn, BlendMode::DestinationOut, BlendMode::Multiply, BlendMode::Screen, BlendMode::Additive,
+};
+
+enum class SourceKind : u8 {
+    Bitmap,
+    MaskedBitmap,
+    MaskedColor,
+};
+
+NODISCARD static u32 next_random(u32& state)
+{
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+// Fills the bitmap with premultiplied pixels, where a quarter of them are transparent and another quarter are
+// opaque, which roughly matches the content of anti-aliased drawings.
+static void fill_with_random_pixels(Bitmap& bitmap, u32 seed)
+{
+    u32 state = seed;
+    for (u32 y = 0; y < bitmap.height(); ++y) {
+        ReadWriteBytes scanline = bitmap.scanline(y);
+        for (u32 x = 0; x < bitmap.width(); ++x) {
+            const u32 random = next_random(state);
+            const u32 alpha_kind = random & 3;
+            const u8 alpha = (alpha_kind == 0) ? 0 : ((alpha_kind == 1) ? 255 : static_cast<u8>(random >> 24));
+            const Color color = { static_cast<u8>(random >> 2), static_cast<u8>(random >> 10), static_cast<u8>(random >> 18), alpha };
+            const Color premultiplied_color = color.premultiplied();
+            scanline[4 * x + 0] = premultiplied_color.r;
+            scanline[4 * x + 1] = premultiplied_color.g;
+            scanline[4 * x + 2] = premultiplied_color.b;
+            scanline[4 * x + 3] = premultiplied_color.a;
+        }
+    }
+}
+
+// Fills the mask with the coverage of a circle, so that it has large uncovered and fully covered areas with
+// partially covered edges between them.
+static void fill_with_circle(Bitmap& mask)
+{
+    const s32 center_x = static_cast<s32>(mask.width() / 2);
+    const s32 center_y = static_cast<s32>(mask.height() / 2);
+    const s32 radius = center_x - 8;
+    for (u32 y = 0; y < mask.height(); ++y) {
+        ReadWriteBytes scanline = mask.scanline(y);
+        for (u32 x = 0; x < mask.width(); ++x) {
+            const s32 delta_x = static_cast<s32>(x) - center_x;
+            const s32 delta_y = static_cast<s32>(y) - center_y;
+            const s32 distance_squared = delta_x * delta_x + delta_y * delta_y;
+            const s32 edge_distance = (radius * radius - distance_squared) / (2 * radius);
+            scanline[x] = static_cast<u8>((edge_distance <= 0) ? 0 : ((edge_distance >= 8) ? 255 : edge_distance * 32));
+        }
+    }
+}
+
+static void composite_once(Bitmap& destination, const Bitmap& source, const Bitmap& mask, BlendMode mode, SourceKind source_kind)
+{
+    const usize pixel_count = destination.width();
+    for (u32 y = 0; y < destination.height(); ++y) {
+        switch (source_kind) {
+            case SourceKind::Bitmap: composite_row(mode, destination.scanline(y), source.scanline(y), nullptr, pixel_count); break;
+            case SourceKind::MaskedBitmap: composite_row(mode, destination.scanline(y), source.scanline(y), mask.scanline(y), pixel_count); break;
+            case SourceKind::MaskedColor: composite_color_row(mode, destination.scanline(y), 0xC0804020, mask.scanline(y), pixel_count); break;
+        }
+    }
+}
+
+// Returns the number of composited pixels per second, in millions.
+NODISCARD static f64 measure_throughput(Bitmap& destination, const Bitmap& source, const Bitmap& mask, BlendMode mode, SourceKind source_kind)
+{
+    // NOTE: Warm up the caches, and restore the destination so that every kernel starts from the same pixels.
+    fill_with_random_pixels(destination, 0x9E3779B9);
+    composite_once(destination, source, mask, mode, source_kind);
+
+    u64 iteration_count = 0;
+    const u64 start_time = Core::monotonic_time_in_nanoseconds();
+    u64 elapsed_time = 0;
+    do {
+        composite_once(destination, source, mask, mode, source_kind);
+        ++iteration_count;
+        elapsed_time = Core::monotonic_time_in_nanoseconds() - start_time;
+    } while (elapsed_time < minimum_measurement_time_in_nanoseconds);
+
+    const f64 pixel_count = static_cast<f64>(iteration_count) * static_cast<f64>(bitmap_width) * static_cast<f64>(bitmap_height);
+    return pixel_count * 1000.0 / static_cast<f64>(elapsed_time);
+}
+
+int main()
+{
+    RefPtr<Bitmap> destination = Bitmap::create(PixelFormat::RGBA8, bitmap_width, bitmap_height);
+    RefPtr<Bitmap> source = Bitmap::create(PixelFormat::RGBA8, bitmap_width, bitmap_height);
+    RefPtr<Bitmap> mask = Bitmap::create(PixelFormat::A8, bitmap_width, bitmap_height);
+    if (!destination.is_valid() || !source.is_valid() || !mask.is_valid()) {
+        errorln("Failed to allocate the bitmaps!");
+        return 1;
+    }
+
+    fill_with_random_pixels(*source, 0x2545F491);
+    fill_with_circle(*mask);
+
+    dbgln("Compositing throughput of {}x{} pixels, in millions of pixels per second:", bitmap_width, bitmap_height);
+    for (BlendMode mode : blend_modes) {
+        const f64 bitmap_throughput = measure_throughput(*destination, *source, *mask, mode, SourceKind::Bitmap);
+        const f64 masked_bitmap_throughput = measure_throughput(*destination, *source, *mask, mode, SourceKind::MaskedBitmap);
+        const f64 masked_color_throughput = measure_throughput(*destination, *source, *mask, mode, SourceKind::MaskedColor);
+        dbgln(
+            "    {}: bitmap {}, masked bitmap {}, masked color {}",
+            StringView::from_utf8(blend_mode_name(mode)),
+            bitmap_throughput,
+            masked_bitmap_throughput,
+            masked_color_throughput
+        );
+    }
+
+    return 0;
+}
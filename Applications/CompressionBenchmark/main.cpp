@@ -0,0 +1,141 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#include <AT/ByteBuffer.h>
+#include <AT/LogStream.h>
+#include <AT/StringView.h>
+#include <Core/Compression.h>
+#include <Core/Time.h>
+
+//
+// Measures the compression ratio and the throughput of the block compressor and decompressor, on a few kinds of
+// synthetic data. The blocks are the size of the default frame blocks, so the results reflect the cost of
+// compressing or decompressing a frame, and the throughput is reported in gigabytes of uncompressed data per second.
+//
+
+static constexpr usize block_byte_count = static_cast<usize>(1) << Core::compression_default_block_byte_count_log2;
+static constexpr u64 minimum_measurement_time_in_nanoseconds = 250 * Core::nanoseconds_per_millisecond;
+
+enum class DataKind : u8 {
+    Text,
+    Pixels,
+    Random,
+};
+
+NODISCARD static const char* data_kind_name(DataKind data_kind)
+{
+    switch (data_kind) {
+        case DataKind::Text: return "text";
+        case DataKind::Pixels: return "pixels";
+        case DataKind::Random: return "random";
+    }
+    return "unknown";
+}
+
+NODISCARD static u32 next_random(u32& state)
+{
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+// Text is a random sequence of words from a small vocabulary, which has many short matches at short distances.
+// Pixels are runs of a few colors with some noise, like the contents of a user interface. Random bytes are not
+// compressible at all, which measures how quickly the compressor skips over them.
+static void fill_with_data(ByteBuffer& buffer, DataKind data_kind)
+{
+    static constexpr const char* words[] = { "the ", "quick ", "brown ", "fox ", "jumps ", "over ", "the ", "lazy ", "dog, ", "and ", "then " };
+    static constexpr u32 colors[] = { 0xFFFFFFFF, 0xFFF0F0F0, 0xFF202020, 0xFF3478F6 };
+
+    u32 state = 0x2545F491;
+    usize offset = 0;
+    while (offset < buffer.byte_count()) {
+        const u32 random = next_random(state);
+        switch (data_kind) {
+            case DataKind::Text: {
+                const StringView word = StringView::from_utf8(words[random % (sizeof(words) / sizeof(words[0]))]);
+                for (usize byte_index = 0; byte_index < word.byte_count() && offset < buffer.byte_count(); ++byte_index)
+                    buffer.bytes()[offset++] = static_cast<u8>(word.characters()[byte_index]);
+                break;
+            }
+            case DataKind::Pixels: {
+                const u32 run_pixel_count = 1 + (random >> 8) % 64;
+                const u32 color = colors[random % 4] ^ (((random >> 16) % 8 == 0) ? ((random >> 20) & 0x030303) : 0);
+                for (u32 pixel_index = 0; pixel_index < run_pixel_count; ++pixel_index) {
+                    for (u32 byte_index = 0; byte_index < 4 && offset < buffer.byte_count(); ++byte_index)
+                        buffer.bytes()[offset++] = static_cast<u8>(color >> (8 * byte_index));
+                }
+                break;
+            }
+            case DataKind::Random: {
+                for (u32 byte_index = 0; byte_index < 4 && offset < buffer.byte_count(); ++byte_index)
+                    buffer.bytes()[offset++] = static_cast<u8>(random >> (8 * byte_index));
+                break;
+            }
+        }
+    }
+}
+
+// Returns the number of uncompressed bytes processed per second, in gigabytes.
+template<typename Function>
+NODISCARD static f64 measure_throughput(Function function)
+{
+    // NOTE: Warm up the caches.
+    function();
+
+    u64 iteration_count = 0;
+    const u64 start_time = Core::monotonic_time_in_nanoseconds();
+    u64 elapsed_time = 0;
+    do {
+        function();
+        ++iteration_count;
+        elapsed_time = Core::monotonic_time_in_nanoseconds() - start_time;
+    } while (elapsed_time < minimum_measurement_time_in_nanoseconds);
+
+    return static_cast<f64>(iteration_count) * static_cast<f64>(block_byte_count) / static_cast<f64>(elapsed_time);
+}
+
+int main()
+{
+    ByteBuffer data = ByteBuffer::from_initial_byte_count(block_byte_count);
+    ByteBuffer compressed = ByteBuffer::from_initial_byte_count(Core::compression_bound(block_byte_count));
+    ByteBuffer decompressed = ByteBuffer::from_initial_byte_count(block_byte_count);
+
+    dbgln("Compression of blocks of {} bytes, in gigabytes of uncompressed data per second:", block_byte_count);
+    for (DataKind data_kind : { DataKind::Text, DataKind::Pixels, DataKind::Random }) {
+        fill_with_data(data, data_kind);
+
+        usize compressed_byte_count = 0;
+        const f64 compression_throughput = measure_throughput([&] {
+            compressed_byte_count = Core::compress_block(data.readonly_byte_span(), compressed.byte_span()).value_or(0);
+        });
+
+        bool is_roundtrip_valid = false;
+        const ReadonlyByteSpan compressed_block = ReadonlyByteSpan(compressed.bytes(), compressed_byte_count);
+        const f64 decompression_throughput = measure_throughput([&] {
+            const Optional<usize> decompressed_byte_count = Core::decompress_block(compressed_block, decompressed.byte_span());
+            is_roundtrip_valid = (decompressed_byte_count.value_or(0) == block_byte_count);
+        });
+
+        for (usize byte_offset = 0; byte_offset < block_byte_count && is_roundtrip_valid; ++byte_offset)
+            is_roundtrip_valid = (data.bytes()[byte_offset] == decompressed.bytes()[byte_offset]);
+        if (!is_roundtrip_valid) {
+            errorln("The {} data wasn't decompressed correctly!", StringView::from_utf8(data_kind_name(data_kind)));
+            return 1;
+        }
+
+        const f64 compression_ratio = static_cast<f64>(compressed_byte_count) / static_cast<f64>(block_byte_count);
+        dbgln(
+            "    {}: ratio {}, compression {}, decompression {}",
+            StringView::from_utf8(data_kind_name(data_kind)),
+            compression_ratio,
+            compression_throughput,
+            decompression_throughput
+        );
+    }
+
+    return 0;
+}
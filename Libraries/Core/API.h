@@ -0,0 +1,18 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#pragma once
+
+#include <AT/APISpecifiers.h>
+
+#ifdef CORE_BUILD_SHARED_LIBRARY
+    #define CORE_API AT_API_SPECIFIER_EXPORT
+#else
+    #ifdef CORE_LINK_AS_SHARED_LIBRARY
+        #define CORE_API AT_API_SPECIFIER_IMPORT
+    #else
+        #define CORE_API
+    #endif // CORE_LINK_AS_SHARED_LIBRARY
+#endif // CORE_BUILD_SHARED_LIBRARY
@@ -0,0 +1,575 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#include <AT/File.h>
+#include <AT/MemoryOperations.h>
+#include <AT/NumericLimits.h>
+#include <Core/AsyncFileReader.h>
+
+#if AT_PLATFORM_LINUX
+    #include <errno.h>
+    #include <fcntl.h>
+    #include <linux/io_uring.h>
+    #include <linux/stat.h>
+    #include <sys/eventfd.h>
+    #include <sys/mman.h>
+    #include <sys/syscall.h>
+    #include <sys/uio.h>
+    #include <unistd.h>
+#endif // AT_PLATFORM_LINUX
+
+namespace Core {
+
+struct AsyncFileReader::FallbackRead {
+    AsyncFileReader* reader { nullptr };
+    QueuedRead queued_read;
+    Optional<ByteBuffer> file_contents;
+};
+
+#if AT_PLATFORM_LINUX
+enum RingOperation : u8 {
+    RingOperationOpen,
+    RingOperationStatus,
+    RingOperationRead,
+    RingOperationClose,
+};
+
+struct AsyncFileReader::InFlightRead {
+    QueuedRead queued_read;
+
+    // NOTE: Written by the kernel when the status operation completes.
+    struct statx file_status;
+
+    int file_descriptor { -1 };
+    u32 pending_operation_count { 0 };
+    bool is_reading { false };
+    bool has_failed { false };
+
+    ByteBuffer file_contents;
+    usize read_byte_count { 0 };
+    u16 registered_buffer_index { NumericLimits<u16>::max() };
+};
+
+NODISCARD static int io_uring_setup(u32 entry_count, io_uring_params* parameters)
+{
+    return static_cast<int>(syscall(__NR_io_uring_setup, entry_count, parameters));
+}
+
+NODISCARD static int io_uring_enter(int ring_file_descriptor, u32 submit_count, u32 min_complete_count, u32 flags)
+{
+    return static_cast<int>(syscall(__NR_io_uring_enter, ring_file_descriptor, submit_count, min_complete_count, flags, nullptr, 0));
+}
+
+NODISCARD static int io_uring_register(int ring_file_descriptor, u32 opcode, const void* arguments, u32 argument_count)
+{
+    return static_cast<int>(syscall(__NR_io_uring_register, ring_file_descriptor, opcode, arguments, argument_count));
+}
+
+// NOTE: The head and tail indices of the rings are shared with the kernel, so they must be accessed atomically.
+NODISCARD ALWAYS_INLINE static u32 load_acquire(const u32* address)
+{
+    return __atomic_load_n(address, __ATOMIC_ACQUIRE);
+}
+
+ALWAYS_INLINE static void store_release(u32* address, u32 value)
+{
+    __atomic_store_n(address, value, __ATOMIC_RELEASE);
+}
+
+// NOTE: The delay after which the submission is retried when the kernel temporarily ran out of resources, and no
+//       operation is in flight whose completion would trigger the retry.
+static constexpr u64 submission_retry_delay_in_milliseconds = 1;
+
+NODISCARD ALWAYS_INLINE static u64 encode_operation_user_data(u32 read_index, u8 operation)
+{
+    return (static_cast<u64>(read_index) << 8) | static_cast<u64>(operation);
+}
+#endif // AT_PLATFORM_LINUX
+
+AsyncFileReader::AsyncFileReader(EventLoop& event_loop, ThreadPool& thread_pool)
+    : m_event_loop(event_loop)
+    , m_thread_pool(thread_pool)
+{
+#if AT_PLATFORM_LINUX
+    // NOTE: If the kernel doesn't support io_uring (or any of the required operations), or if the process is not
+    //       allowed to use it, all reads are performed by the thread pool instead.
+    if (!initialize_ring())
+        destroy_ring();
+#endif // AT_PLATFORM_LINUX
+}
+
+AsyncFileReader::~AsyncFileReader()
+{
+    VERIFY(m_pending_read_count == 0);
+#if AT_PLATFORM_LINUX
+    destroy_ring();
+#endif // AT_PLATFORM_LINUX
+}
+
+void AsyncFileReader::read_file(StringView filepath, FileReadCallback callback, void* user_data)
+{
+    QueuedRead queued_read;
+    queued_read.filepath = String(filepath);
+    queued_read.callback = callback;
+    queued_read.user_data = user_data;
+    ++m_pending_read_count;
+
+#if AT_PLATFORM_LINUX
+    if (is_using_io_uring()) {
+        m_queued_reads.enqueue(move(queued_read));
+        start_queued_reads();
+        return;
+    }
+#endif // AT_PLATFORM_LINUX
+
+    start_fallback_read(move(queued_read));
+}
+
+void AsyncFileReader::start_fallback_read(QueuedRead&& queued_read)
+{
+    FallbackRead* fallback_read = new FallbackRead();
+    fallback_read->reader = this;
+    fallback_read->queued_read = move(queued_read);
+    m_thread_pool.enqueue(Job::from_function(fallback_read_job, fallback_read));
+}
+
+void AsyncFileReader::fallback_read_job(void* user_data)
+{
+    FallbackRead& fallback_read = *static_cast<FallbackRead*>(user_data);
+    const String& filepath = fallback_read.queued_read.filepath;
+    fallback_read.file_contents = File::read_entire_file(StringView::from_utf8(filepath.characters(), filepath.byte_count()));
+
+    // NOTE: The callback must be invoked by the thread that runs the event loop.
+    fallback_read.reader->m_event_loop.deferred_invoke(Job::from_function(fallback_read_completed_job, user_data));
+}
+
+void AsyncFileReader::fallback_read_completed_job(void* user_data)
+{
+    FallbackRead* fallback_read = static_cast<FallbackRead*>(user_data);
+    --fallback_read->reader->m_pending_read_count;
+    fallback_read->queued_read.callback(move(fallback_read->file_contents), fallback_read->queued_read.user_data);
+    delete fallback_read;
+}
+
+#if AT_PLATFORM_LINUX
+bool AsyncFileReader::initialize_ring()
+{
+    io_uring_params parameters = {};
+    m_ring_file_descriptor = io_uring_setup(submission_queue_entry_count, &parameters);
+    if (m_ring_file_descriptor < 0)
+        return false;
+
+    // NOTE: The completion queue is always larger than the number of operations that can be in flight, so
+    //       completions are never dropped. Mapping both rings at once is supported by every kernel that
+    //       implements the operations used below.
+    if (!(parameters.features & IORING_FEAT_SINGLE_MMAP) || parameters.sq_entries < submission_queue_entry_count)
+        return false;
+
+    // Verify that all the required operations are supported by the running kernel.
+    constexpr u32 probed_operation_count = IORING_OP_LAST;
+    const usize probe_byte_count = sizeof(io_uring_probe) + probed_operation_count * sizeof(io_uring_probe_op);
+    ByteBuffer probe_buffer = ByteBuffer::from_initial_byte_count(probe_byte_count);
+    zero_memory(probe_buffer.bytes(), probe_buffer.byte_count());
+    io_uring_probe* probe = reinterpret_cast<io_uring_probe*>(probe_buffer.bytes());
+    if (io_uring_register(m_ring_file_descriptor, IORING_REGISTER_PROBE, probe, probed_operation_count) < 0)
+        return false;
+
+    const u8 required_operations[] = { IORING_OP_OPENAT, IORING_OP_STATX, IORING_OP_READ, IORING_OP_READ_FIXED, IORING_OP_CLOSE };
+    for (const u8 operation : required_operations) {
+        if (operation > probe->last_op || !(probe->ops[operation].flags & IO_URING_OP_SUPPORTED))
+            return false;
+    }
+
+    const usize submission_ring_byte_count = parameters.sq_off.array + parameters.sq_entries * sizeof(u32);
+    const usize completion_ring_byte_count = parameters.cq_off.cqes + parameters.cq_entries * sizeof(io_uring_cqe);
+    m_ring_memory_byte_count = (submission_ring_byte_count > completion_ring_byte_count) ? submission_ring_byte_count : completion_ring_byte_count;
+    m_ring_memory = mmap(nullptr, m_ring_memory_byte_count, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ring_file_descriptor, IORING_OFF_SQ_RING);
+    if (m_ring_memory == MAP_FAILED) {
+        m_ring_memory = nullptr;
+        return false;
+    }
+
+    m_submission_entries_byte_count = parameters.sq_entries * sizeof(io_uring_sqe);
+    m_submission_entries =
+        mmap(nullptr, m_submission_entries_byte_count, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ring_file_descriptor, IORING_OFF_SQES);
+    if (m_submission_entries == MAP_FAILED) {
+        m_submission_entries = nullptr;
+        return false;
+    }
+
+    u8* ring_bytes = static_cast<u8*>(m_ring_memory);
+    m_submission_head = reinterpret_cast<u32*>(ring_bytes + parameters.sq_off.head);
+    m_submission_tail = reinterpret_cast<u32*>(ring_bytes + parameters.sq_off.tail);
+    m_submission_array = reinterpret_cast<u32*>(ring_bytes + parameters.sq_off.array);
+    m_submission_mask = *reinterpret_cast<u32*>(ring_bytes + parameters.sq_off.ring_mask);
+    m_completion_head = reinterpret_cast<u32*>(ring_bytes + parameters.cq_off.head);
+    m_completion_tail = reinterpret_cast<u32*>(ring_bytes + parameters.cq_off.tail);
+    m_completion_entries = ring_bytes + parameters.cq_off.cqes;
+    m_completion_mask = *reinterpret_cast<u32*>(ring_bytes + parameters.cq_off.ring_mask);
+
+    // NOTE: The kernel signals the event file descriptor whenever completions are posted, which integrates the
+    //       ring with the event loop without dedicating a thread to waiting for completions.
+    m_completion_event_file_descriptor = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (m_completion_event_file_descriptor < 0)
+        return false;
+    if (io_uring_register(m_ring_file_descriptor, IORING_REGISTER_EVENTFD, &m_completion_event_file_descriptor, 1) < 0)
+        return false;
+
+    // NOTE: Registering the buffers can fail if the amount of memory the process is allowed to lock is too low.
+    //       In that case, all the files are read directly into their own buffers.
+    m_registered_buffers = new u8[registered_buffer_count * registered_buffer_byte_count];
+    iovec registered_buffer_vectors[registered_buffer_count];
+    for (u32 buffer_index = 0; buffer_index < registered_buffer_count; ++buffer_index) {
+        registered_buffer_vectors[buffer_index].iov_base = m_registered_buffers + buffer_index * registered_buffer_byte_count;
+        registered_buffer_vectors[buffer_index].iov_len = registered_buffer_byte_count;
+    }
+
+    if (io_uring_register(m_ring_file_descriptor, IORING_REGISTER_BUFFERS, registered_buffer_vectors, registered_buffer_count) == 0) {
+        for (u32 buffer_index = registered_buffer_count; buffer_index > 0; --buffer_index)
+            m_free_registered_buffer_indices.add(static_cast<u16>(buffer_index - 1));
+    }
+    else {
+        delete[] m_registered_buffers;
+        m_registered_buffers = nullptr;
+    }
+
+    m_in_flight_reads = new InFlightRead[max_in_flight_read_count];
+    for (u32 read_index = max_in_flight_read_count; read_index > 0; --read_index)
+        m_free_read_indices.add(read_index - 1);
+
+    m_completion_watcher_id = m_event_loop.watch_file_descriptor(
+        m_completion_event_file_descriptor, FileDescriptorEvents::Readable, Job::from_function(ring_completions_job, this)
+    );
+    return true;
+}
+
+void AsyncFileReader::destroy_ring()
+{
+    if (m_is_submission_retry_scheduled) {
+        m_event_loop.cancel_timer(m_submission_retry_timer_id);
+        m_is_submission_retry_scheduled = false;
+    }
+
+    if (m_in_flight_reads) {
+        m_event_loop.unwatch_file_descriptor(m_completion_watcher_id);
+        delete[] m_in_flight_reads;
+        m_in_flight_reads = nullptr;
+    }
+
+    // NOTE: Closing the ring file descriptor also unregisters the buffers and the event file descriptor.
+    if (m_submission_entries)
+        munmap(m_submission_entries, m_submission_entries_byte_count);
+    if (m_ring_memory)
+        munmap(m_ring_memory, m_ring_memory_byte_count);
+    if (m_ring_file_descriptor >= 0)
+        close(m_ring_file_descriptor);
+    if (m_completion_event_file_descriptor >= 0)
+        close(m_completion_event_file_descriptor);
+
+    delete[] m_registered_buffers;
+    m_registered_buffers = nullptr;
+    m_free_registered_buffer_indices.clear();
+    m_free_read_indices.clear();
+
+    m_submission_entries = nullptr;
+    m_ring_memory = nullptr;
+    m_ring_file_descriptor = -1;
+    m_completion_event_file_descriptor = -1;
+}
+
+void AsyncFileReader::start_queued_reads()
+{
+    while (m_queued_reads.has_elements() && m_free_read_indices.has_elements()) {
+        const u32 read_index = m_free_read_indices[m_free_read_indices.count() - 1];
+        m_free_read_indices.remove_last();
+        start_read(read_index, m_queued_reads.dequeue());
+    }
+
+    // NOTE: Defer the submission to the end of the current event loop iteration, so that all the reads
+    //       started in the meantime are submitted with a single system call.
+    if (m_unsubmitted_entry_count > 0 && !m_is_flush_scheduled) {
+        m_is_flush_scheduled = true;
+        m_event_loop.deferred_invoke(Job::from_function(flush_submissions_job, this));
+    }
+}
+
+void AsyncFileReader::start_read(u32 read_index, QueuedRead&& queued_read)
+{
+    InFlightRead& read = m_in_flight_reads[read_index];
+    read.queued_read = move(queued_read);
+    read.file_descriptor = -1;
+    read.is_reading = false;
+    read.has_failed = false;
+    read.read_byte_count = 0;
+
+    // NOTE: The file is opened and its size is queried in parallel, as both operations only need the path. On
+    //       network file systems each of them is a round trip to the server, which makes this the slowest part.
+    const char* filepath = read.queued_read.filepath.characters();
+
+    io_uring_sqe* open_entry = static_cast<io_uring_sqe*>(acquire_submission_entry(read_index, RingOperationOpen));
+    open_entry->opcode = IORING_OP_OPENAT;
+    open_entry->fd = AT_FDCWD;
+    open_entry->addr = reinterpret_cast<u64>(filepath);
+    open_entry->open_flags = O_RDONLY | O_CLOEXEC;
+
+    io_uring_sqe* status_entry = static_cast<io_uring_sqe*>(acquire_submission_entry(read_index, RingOperationStatus));
+    status_entry->opcode = IORING_OP_STATX;
+    status_entry->fd = AT_FDCWD;
+    status_entry->addr = reinterpret_cast<u64>(filepath);
+    status_entry->len = STATX_SIZE;
+    status_entry->off = reinterpret_cast<u64>(&read.file_status);
+
+    read.pending_operation_count = 2;
+}
+
+void AsyncFileReader::submit_read_and_close(u32 read_index)
+{
+    InFlightRead& read = m_in_flight_reads[read_index];
+    const usize remaining_byte_count = read.file_contents.byte_count() - read.read_byte_count;
+
+    io_uring_sqe* read_entry = static_cast<io_uring_sqe*>(acquire_submission_entry(read_index, RingOperationRead));
+    read_entry->fd = read.file_descriptor;
+    read_entry->off = read.read_byte_count;
+    read_entry->len = (remaining_byte_count > 0x7FFFF000) ? 0x7FFFF000 : static_cast<u32>(remaining_byte_count);
+    // NOTE: The file is closed as soon as the read completes, without an additional round trip through the event loop.
+    read_entry->flags = IOSQE_IO_LINK;
+
+    if (read.registered_buffer_index != NumericLimits<u16>::max()) {
+        read_entry->opcode = IORING_OP_READ_FIXED;
+        read_entry->addr = reinterpret_cast<u64>(m_registered_buffers + read.registered_buffer_index * registered_buffer_byte_count + read.read_byte_count);
+        read_entry->buf_index = read.registered_buffer_index;
+    }
+    else {
+        read_entry->opcode = IORING_OP_READ;
+        read_entry->addr = reinterpret_cast<u64>(read.file_contents.bytes() + read.read_byte_count);
+    }
+
+    io_uring_sqe* close_entry = static_cast<io_uring_sqe*>(acquire_submission_entry(read_index, RingOperationClose));
+    close_entry->opcode = IORING_OP_CLOSE;
+    close_entry->fd = read.file_descriptor;
+
+    read.pending_operation_count = 2;
+}
+
+void AsyncFileReader::complete_read(u32 read_index)
+{
+    InFlightRead& read = m_in_flight_reads[read_index];
+
+    // NOTE: The file descriptor is still open if the read failed before the linked close operation was executed.
+    if (read.file_descriptor >= 0)
+        close(read.file_descriptor);
+
+    Optional<ByteBuffer> file_contents;
+    if (!read.has_failed) {
+        if (read.registered_buffer_index != NumericLimits<u16>::max()) {
+            const u8* registered_buffer = m_registered_buffers + read.registered_buffer_index * registered_buffer_byte_count;
+            copy_memory(read.file_contents.bytes(), registered_buffer, read.file_contents.byte_count());
+        }
+        file_contents = move(read.file_contents);
+    }
+
+    if (read.registered_buffer_index != NumericLimits<u16>::max()) {
+        m_free_registered_buffer_indices.add(read.registered_buffer_index);
+        read.registered_buffer_index = NumericLimits<u16>::max();
+    }
+
+    const QueuedRead queued_read = move(read.queued_read);
+    read.file_contents = {};
+    m_free_read_indices.add(read_index);
+    --m_pending_read_count;
+
+    queued_read.callback(move(file_contents), queued_read.user_data);
+}
+
+void* AsyncFileReader::acquire_submission_entry(u32 read_index, u8 operation)
+{
+    // NOTE: Only the thread that runs the event loop produces entries, so the tail doesn't have to be loaded atomically.
+    const u32 tail = *m_submission_tail;
+    VERIFY(tail - load_acquire(m_submission_head) < submission_queue_entry_count);
+
+    const u32 entry_index = tail & m_submission_mask;
+    io_uring_sqe* entry = static_cast<io_uring_sqe*>(m_submission_entries) + entry_index;
+    zero_memory(entry, sizeof(io_uring_sqe));
+    entry->user_data = encode_operation_user_data(read_index, operation);
+
+    m_submission_array[entry_index] = entry_index;
+    store_release(m_submission_tail, tail + 1);
+    ++m_unsubmitted_entry_count;
+    return entry;
+}
+
+void AsyncFileReader::submit_pending_entries()
+{
+    while (m_unsubmitted_entry_count > 0) {
+        const int result = io_uring_enter(m_ring_file_descriptor, m_unsubmitted_entry_count, 0, 0);
+        if (result > 0) {
+            m_unsubmitted_entry_count -= static_cast<u32>(result);
+            m_submitted_operation_count += static_cast<u32>(result);
+            continue;
+        }
+        if (result < 0 && errno == EINTR)
+            continue;
+
+        if (result == 0 || errno == EAGAIN || errno == EBUSY) {
+            // NOTE: The kernel temporarily ran out of resources. The remaining entries are submitted when the next
+            //       completions are processed, or after a delay if no operation is in flight.
+            if (m_submitted_operation_count == 0 && !m_is_submission_retry_scheduled) {
+                m_is_submission_retry_scheduled = true;
+                m_submission_retry_timer_id =
+                    m_event_loop.deferred_invoke_after(submission_retry_delay_in_milliseconds, Job::from_function(retry_submissions_job, this));
+            }
+            return;
+        }
+
+        // NOTE: Any other error means that the entries can't be submitted, so the reads they belong to fail.
+        fail_unsubmitted_entries();
+        return;
+    }
+}
+
+void AsyncFileReader::fail_unsubmitted_entries()
+{
+    // NOTE: The kernel only consumes the submission ring while it is entered, so the entries that it didn't consume
+    //       are taken back by moving the tail. The reads are completed only after all the entries were taken back,
+    //       as the callbacks can start new reads.
+    const u32 tail = *m_submission_tail;
+    const u32 first_unsubmitted_position = tail - m_unsubmitted_entry_count;
+    store_release(m_submission_tail, first_unsubmitted_position);
+    m_unsubmitted_entry_count = 0;
+
+    Vector<u32> failed_read_indices;
+    for (u32 position = first_unsubmitted_position; position != tail; ++position) {
+        const io_uring_sqe& entry = static_cast<const io_uring_sqe*>(m_submission_entries)[m_submission_array[position & m_submission_mask]];
+        const u32 read_index = static_cast<u32>(entry.user_data >> 8);
+
+        // NOTE: The other operations of the read may already be in flight, in which case the read is completed
+        //       when their completions are processed.
+        InFlightRead& read = m_in_flight_reads[read_index];
+        read.has_failed = true;
+        VERIFY(read.pending_operation_count > 0);
+        if (--read.pending_operation_count == 0)
+            failed_read_indices.add(read_index);
+    }
+
+    for (usize failed_index = 0; failed_index < failed_read_indices.count(); ++failed_index)
+        complete_read(failed_read_indices[failed_index]);
+
+    // NOTE: The failed reads made room for the queued ones, which are retried by the next submission.
+    start_queued_reads();
+}
+
+void AsyncFileReader::flush_submissions_job(void* user_data)
+{
+    AsyncFileReader& reader = *static_cast<AsyncFileReader*>(user_data);
+    reader.m_is_flush_scheduled = false;
+    reader.submit_pending_entries();
+}
+
+void AsyncFileReader::retry_submissions_job(void* user_data)
+{
+    AsyncFileReader& reader = *static_cast<AsyncFileReader*>(user_data);
+    reader.m_is_submission_retry_scheduled = false;
+    reader.submit_pending_entries();
+}
+
+void AsyncFileReader::ring_completions_job(void* user_data)
+{
+    AsyncFileReader& reader = *static_cast<AsyncFileReader*>(user_data);
+    u64 counter_value;
+    MAYBE_UNUSED const ssize_t result = read(reader.m_completion_event_file_descriptor, &counter_value, sizeof(counter_value));
+    reader.process_completions();
+}
+
+void AsyncFileReader::process_completions()
+{
+    u32 head = *m_completion_head;
+    const u32 tail = load_acquire(m_completion_tail);
+
+    while (head != tail) {
+        const io_uring_cqe& completion = static_cast<const io_uring_cqe*>(m_completion_entries)[head & m_completion_mask];
+        const u32 read_index = static_cast<u32>(completion.user_data >> 8);
+        const u8 operation = static_cast<u8>(completion.user_data & 0xFF);
+        const s32 result = completion.res;
+        ++head;
+        --m_submitted_operation_count;
+
+        InFlightRead& read = m_in_flight_reads[read_index];
+        switch (operation) {
+            case RingOperationOpen:
+                if (result < 0)
+                    read.has_failed = true;
+                else
+                    read.file_descriptor = result;
+                break;
+            case RingOperationStatus:
+                if (result < 0)
+                    read.has_failed = true;
+                break;
+            case RingOperationRead:
+                // NOTE: Reaching the end of the file before reading all the bytes means the file was truncated.
+                if (result <= 0)
+                    read.has_failed = true;
+                else
+                    read.read_byte_count += static_cast<usize>(result);
+                break;
+            case RingOperationClose:
+                // NOTE: The linked close operation is cancelled if the read failed or returned fewer bytes than requested.
+                if (result != -ECANCELED)
+                    read.file_descriptor = -1;
+                break;
+        }
+
+        VERIFY(read.pending_operation_count > 0);
+        if (--read.pending_operation_count > 0)
+            continue;
+
+        if (read.has_failed) {
+            complete_read(read_index);
+            continue;
+        }
+
+        if (!read.is_reading) {
+            read.is_reading = true;
+            const usize file_byte_count = static_cast<usize>(read.file_status.stx_size);
+            read.file_contents = ByteBuffer::from_initial_byte_count(file_byte_count);
+            if (file_byte_count == 0) {
+                complete_read(read_index);
+                continue;
+            }
+
+            if (file_byte_count <= registered_buffer_byte_count && m_free_registered_buffer_indices.has_elements()) {
+                read.registered_buffer_index = m_free_registered_buffer_indices[m_free_registered_buffer_indices.count() - 1];
+                m_free_registered_buffer_indices.remove_last();
+            }
+
+            submit_read_and_close(read_index);
+            continue;
+        }
+
+        if (read.read_byte_count == read.file_contents.byte_count()) {
+            complete_read(read_index);
+            continue;
+        }
+
+        // NOTE: The read returned fewer bytes than requested. Continue reading if the file is still open.
+        if (read.file_descriptor < 0) {
+            read.has_failed = true;
+            complete_read(read_index);
+            continue;
+        }
+
+        submit_read_and_close(read_index);
+    }
+
+    store_release(m_completion_head, head);
+
+    // NOTE: The completed reads made room for the queued ones. All the follow-up operations are submitted right
+    //       away, as the event loop is already processing the completions of the previous batch.
+    start_queued_reads();
+    submit_pending_entries();
+}
+#endif // AT_PLATFORM_LINUX
+
+} // namespace Core
@@ -0,0 +1,146 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#pragma once
+
+#include <AT/ByteBuffer.h>
+#include <AT/CircularQueue.h>
+#include <AT/Optional.h>
+#include <AT/String.h>
+#include <AT/Vector.h>
+#include <Core/API.h>
+#include <Core/EventLoop.h>
+#include <Core/ThreadPool.h>
+
+namespace Core {
+
+// Invoked on the thread that runs the event loop when the read finishes. The file contents are
+// empty if the file couldn't be opened or read.
+using FileReadCallback = void (*)(Optional<ByteBuffer> file_contents, void* user_data);
+
+// Reads entire files asynchronously, without dedicating a thread to each file. On Linux the reads are batched
+// through an io_uring instance, so hundreds of files can be in flight while only a single system call is made
+// for each batch. When io_uring is not available (old kernels, restrictive sandboxes or other platforms) the
+// files are read by the worker threads of the given pool instead.
+class AsyncFileReader {
+    AT_MAKE_NONCOPYABLE(AsyncFileReader);
+    AT_MAKE_NONMOVABLE(AsyncFileReader);
+
+public:
+    // NOTE: Each read has at most two operations in flight, so the number of reads that are submitted to the
+    //       kernel at the same time is half the number of submission queue entries. Additional reads are queued.
+    static constexpr u32 submission_queue_entry_count = 256;
+    static constexpr u32 max_in_flight_read_count = submission_queue_entry_count / 2;
+
+    // NOTE: Files that fit in a registered buffer are read into it and then copied to their own buffer. Registered
+    //       buffers are pinned once, instead of on every read, which matters for the many small files (such as
+    //       icons) that are loaded during startup.
+    static constexpr u32 registered_buffer_count = 32;
+    static constexpr usize registered_buffer_byte_count = 64 * 1024;
+
+public:
+    // NOTE: Must be called by the thread that runs the event loop.
+    CORE_API AsyncFileReader(EventLoop& event_loop, ThreadPool& thread_pool);
+
+    // NOTE: All the reads must be completed before the reader is destroyed.
+    CORE_API ~AsyncFileReader();
+
+public:
+    NODISCARD ALWAYS_INLINE bool is_using_io_uring() const
+    {
+#if AT_PLATFORM_LINUX
+        return (m_ring_file_descriptor >= 0);
+#else
+        return false;
+#endif // AT_PLATFORM_LINUX
+    }
+
+    NODISCARD ALWAYS_INLINE u32 pending_read_count() const { return m_pending_read_count; }
+
+    // Starts reading the entire file. The reads that are started during the same iteration of the event loop are
+    // submitted to the kernel together. This function must only be called by the thread that runs the event loop.
+    CORE_API void read_file(StringView filepath, FileReadCallback callback, void* user_data);
+
+private:
+    struct QueuedRead {
+        String filepath;
+        FileReadCallback callback { nullptr };
+        void* user_data { nullptr };
+    };
+
+    // NOTE: Defined in the implementation file, as they depend on the platform headers.
+    struct FallbackRead;
+#if AT_PLATFORM_LINUX
+    struct InFlightRead;
+#endif // AT_PLATFORM_LINUX
+
+private:
+    void start_fallback_read(QueuedRead&& queued_read);
+    static void fallback_read_job(void* user_data);
+    static void fallback_read_completed_job(void* user_data);
+
+#if AT_PLATFORM_LINUX
+    NODISCARD bool initialize_ring();
+    void destroy_ring();
+
+    void start_queued_reads();
+    void start_read(u32 read_index, QueuedRead&& queued_read);
+    void submit_read_and_close(u32 read_index);
+    void complete_read(u32 read_index);
+
+    // Returns the next free submission queue entry, which is cleared and tagged with the given operation.
+    NODISCARD void* acquire_submission_entry(u32 read_index, u8 operation);
+    void submit_pending_entries();
+    void fail_unsubmitted_entries();
+
+    static void flush_submissions_job(void* user_data);
+    static void retry_submissions_job(void* user_data);
+    static void ring_completions_job(void* user_data);
+    void process_completions();
+#endif // AT_PLATFORM_LINUX
+
+private:
+    EventLoop& m_event_loop;
+    ThreadPool& m_thread_pool;
+    u32 m_pending_read_count { 0 };
+
+#if AT_PLATFORM_LINUX
+    int m_ring_file_descriptor { -1 };
+    int m_completion_event_file_descriptor { -1 };
+    FileDescriptorWatcherID m_completion_watcher_id { 0 };
+
+    // NOTE: The memory region shared with the kernel, which contains both the submission and the completion rings.
+    void* m_ring_memory { nullptr };
+    usize m_ring_memory_byte_count { 0 };
+    void* m_submission_entries { nullptr };
+    usize m_submission_entries_byte_count { 0 };
+
+    u32* m_submission_head { nullptr };
+    u32* m_submission_tail { nullptr };
+    u32* m_submission_array { nullptr };
+    u32 m_submission_mask { 0 };
+    u32* m_completion_head { nullptr };
+    u32* m_completion_tail { nullptr };
+    void* m_completion_entries { nullptr };
+    u32 m_completion_mask { 0 };
+
+    u32 m_unsubmitted_entry_count { 0 };
+    bool m_is_flush_scheduled { false };
+    // NOTE: The number of operations that were submitted to the kernel and whose completions weren't processed yet.
+    u32 m_submitted_operation_count { 0 };
+    bool m_is_submission_retry_scheduled { false };
+    TimerID m_submission_retry_timer_id { 0 };
+
+    // NOTE: The reads must have a stable address while they are in flight, as the kernel writes into them.
+    InFlightRead* m_in_flight_reads { nullptr };
+    Vector<u32> m_free_read_indices;
+    CircularQueue<QueuedRead> m_queued_reads;
+
+    u8* m_registered_buffers { nullptr };
+    Vector<u16> m_free_registered_buffer_indices;
+#endif // AT_PLATFORM_LINUX
+};
+
+} // namespace Core
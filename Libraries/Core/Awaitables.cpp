@@ -0,0 +1,25 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#include <AT/File.h>
+#include <Core/Awaitables.h>
+
+namespace Core {
+
+void ReadFileAwaiter::read_file_job(void* user_data)
+{
+    ReadFileAwaiter& awaiter = *static_cast<ReadFileAwaiter*>(user_data);
+    awaiter.m_file_contents = File::read_entire_file(StringView::from_utf8(awaiter.m_filepath.characters(), awaiter.m_filepath.byte_count()));
+    awaiter.m_awaiting_handle.resume();
+}
+
+void AsyncReadFileAwaiter::read_completed(Optional<ByteBuffer> file_contents, void* user_data)
+{
+    AsyncReadFileAwaiter& awaiter = *static_cast<AsyncReadFileAwaiter*>(user_data);
+    awaiter.m_file_contents = move(file_contents);
+    awaiter.m_awaiting_handle.resume();
+}
+
+} // namespace Core
@@ -0,0 +1,155 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#pragma once
+
+#include <AT/ByteBuffer.h>
+#include <AT/Optional.h>
+#include <AT/String.h>
+#include <Core/API.h>
+#include <Core/AsyncFileReader.h>
+#include <Core/EventLoop.h>
+#include <Core/ThreadPool.h>
+
+namespace Core {
+
+class ResumeOnEventLoopAwaiter {
+public:
+    ALWAYS_INLINE explicit ResumeOnEventLoopAwaiter(EventLoop& event_loop)
+        : m_event_loop(event_loop)
+    {}
+
+    NODISCARD ALWAYS_INLINE bool await_ready() const noexcept { return false; }
+    ALWAYS_INLINE void await_suspend(std::coroutine_handle<> handle) { m_event_loop.deferred_invoke(Job::from_coroutine_handle(handle)); }
+    ALWAYS_INLINE void await_resume() const noexcept {}
+
+private:
+    EventLoop& m_event_loop;
+};
+
+class ResumeOnThreadPoolAwaiter {
+public:
+    ALWAYS_INLINE explicit ResumeOnThreadPoolAwaiter(ThreadPool& thread_pool)
+        : m_thread_pool(thread_pool)
+    {}
+
+    NODISCARD ALWAYS_INLINE bool await_ready() const noexcept { return false; }
+    ALWAYS_INLINE void await_suspend(std::coroutine_handle<> handle) { m_thread_pool.enqueue(Job::from_coroutine_handle(handle)); }
+    ALWAYS_INLINE void await_resume() const noexcept {}
+
+private:
+    ThreadPool& m_thread_pool;
+};
+
+class SleepAwaiter {
+public:
+    ALWAYS_INLINE SleepAwaiter(EventLoop& event_loop, u64 delay_in_milliseconds)
+        : m_event_loop(event_loop)
+        , m_delay_in_milliseconds(delay_in_milliseconds)
+    {}
+
+    NODISCARD ALWAYS_INLINE bool await_ready() const noexcept { return false; }
+
+    ALWAYS_INLINE void await_suspend(std::coroutine_handle<> handle)
+    {
+        m_event_loop.deferred_invoke_after(m_delay_in_milliseconds, Job::from_coroutine_handle(handle));
+    }
+
+    ALWAYS_INLINE void await_resume() const noexcept {}
+
+private:
+    EventLoop& m_event_loop;
+    u64 m_delay_in_milliseconds;
+};
+
+class ReadFileAwaiter {
+public:
+    ALWAYS_INLINE ReadFileAwaiter(ThreadPool& thread_pool, StringView filepath)
+        : m_thread_pool(thread_pool)
+        , m_filepath(filepath)
+    {}
+
+    NODISCARD ALWAYS_INLINE bool await_ready() const noexcept { return false; }
+
+    ALWAYS_INLINE void await_suspend(std::coroutine_handle<> handle)
+    {
+        m_awaiting_handle = handle;
+        m_thread_pool.enqueue(Job::from_function(read_file_job, this));
+    }
+
+    // NOTE: Returns an empty optional if the file couldn't be opened or read.
+    NODISCARD ALWAYS_INLINE Optional<ByteBuffer> await_resume() { return move(m_file_contents); }
+
+private:
+    CORE_API static void read_file_job(void* user_data);
+
+private:
+    ThreadPool& m_thread_pool;
+    String m_filepath;
+    std::coroutine_handle<> m_awaiting_handle;
+    Optional<ByteBuffer> m_file_contents;
+};
+
+class AsyncReadFileAwaiter {
+public:
+    ALWAYS_INLINE AsyncReadFileAwaiter(AsyncFileReader& file_reader, StringView filepath)
+        : m_file_reader(file_reader)
+        , m_filepath(filepath)
+    {}
+
+    NODISCARD ALWAYS_INLINE bool await_ready() const noexcept { return false; }
+
+    ALWAYS_INLINE void await_suspend(std::coroutine_handle<> handle)
+    {
+        m_awaiting_handle = handle;
+        m_file_reader.read_file(StringView::from_utf8(m_filepath.characters(), m_filepath.byte_count()), read_completed, this);
+    }
+
+    // NOTE: Returns an empty optional if the file couldn't be opened or read.
+    NODISCARD ALWAYS_INLINE Optional<ByteBuffer> await_resume() { return move(m_file_contents); }
+
+private:
+    CORE_API static void read_completed(Optional<ByteBuffer> file_contents, void* user_data);
+
+private:
+    AsyncFileReader& m_file_reader;
+    String m_filepath;
+    std::coroutine_handle<> m_awaiting_handle;
+    Optional<ByteBuffer> m_file_contents;
+};
+
+// Suspends the calling coroutine and resumes it on the thread that runs the given event loop.
+NODISCARD ALWAYS_INLINE ResumeOnEventLoopAwaiter resume_on(EventLoop& event_loop)
+{
+    return ResumeOnEventLoopAwaiter(event_loop);
+}
+
+// Suspends the calling coroutine and resumes it on one of the worker threads of the given pool.
+NODISCARD ALWAYS_INLINE ResumeOnThreadPoolAwaiter resume_on(ThreadPool& thread_pool)
+{
+    return ResumeOnThreadPoolAwaiter(thread_pool);
+}
+
+// Suspends the calling coroutine and resumes it on the thread that runs the given event loop, after the delay expires.
+NODISCARD ALWAYS_INLINE SleepAwaiter sleep_for(EventLoop& event_loop, u64 delay_in_milliseconds)
+{
+    return SleepAwaiter(event_loop, delay_in_milliseconds);
+}
+
+// Reads the entire file on one of the worker threads of the given pool. The calling coroutine is resumed
+// on the worker thread that performed the read.
+NODISCARD ALWAYS_INLINE ReadFileAwaiter read_file(ThreadPool& thread_pool, StringView filepath)
+{
+    return ReadFileAwaiter(thread_pool, filepath);
+}
+
+// Reads the entire file through the given asynchronous reader. The calling coroutine is resumed on the thread
+// that runs the event loop of the reader, which must also be the thread that awaits the read.
+NODISCARD ALWAYS_INLINE AsyncReadFileAwaiter read_file(AsyncFileReader& file_reader, StringView filepath)
+{
+    return AsyncReadFileAwaiter(file_reader, filepath);
+}
+
+} // namespace Core
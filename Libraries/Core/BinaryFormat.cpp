@@ -0,0 +1,355 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#include <AT/BitOperations.h>
+#include <AT/File.h>
+#include <AT/Hash.h>
+#include <AT/MemoryOperations.h>
+#include <AT/NumericLimits.h>
+#include <AT/Stream.h>
+#include <Core/BinaryFormat.h>
+#include <Core/Compression.h>
+
+namespace Core {
+
+static constexpr u32 empty_string_slot = 0;
+
+NODISCARD static bool write_padding(BufferedWriter& writer, usize padding_byte_count)
+{
+    static constexpr u8 zero_bytes[64] = {};
+    while (padding_byte_count > 0) {
+        const usize chunk_byte_count = (padding_byte_count < sizeof(zero_bytes)) ? padding_byte_count : sizeof(zero_bytes);
+        if (!writer.write(ReadonlyByteSpan(zero_bytes, chunk_byte_count)))
+            return false;
+        padding_byte_count -= chunk_byte_count;
+    }
+    return true;
+}
+
+BinaryFormatWriter::BinaryFormatWriter(u32 schema_version)
+    : m_schema_version(schema_version)
+{
+    m_string_table.tag = binary_string_table_section_tag;
+    m_string_table.alignment = 1;
+}
+
+BinaryFormatWriter::~BinaryFormatWriter() = default;
+
+void BinaryFormatWriter::begin_section(u32 tag, u32 alignment)
+{
+    VERIFY(is_power_of_two(alignment) && alignment <= binary_format_max_section_alignment);
+    VERIFY(tag != binary_string_table_section_tag);
+
+    Section section;
+    section.tag = tag;
+    section.alignment = alignment;
+    m_sections.add(move(section));
+}
+
+void BinaryFormatWriter::begin_compressed_section(u32 tag, u32 alignment)
+{
+    begin_section(tag, alignment);
+    m_sections[m_sections.count() - 1].is_compressed = true;
+}
+
+u32 BinaryFormatWriter::append_bytes(ReadonlyByteSpan bytes, u32 alignment)
+{
+    VERIFY(m_sections.has_elements());
+    Section& section = m_sections[m_sections.count() - 1];
+
+    // NOTE: Alignments stricter than the alignment of the section can't be guaranteed in the file.
+    VERIFY(is_power_of_two(alignment) && alignment <= section.alignment);
+
+    const usize offset = align_up(section.byte_count, alignment);
+    append_to_section(section, bytes, alignment);
+    VERIFY(offset <= NumericLimits<u32>::max());
+    return static_cast<u32>(offset);
+}
+
+BinaryStringReference BinaryFormatWriter::add_string(StringView string)
+{
+    // NOTE: Keep the load factor of the deduplication table below one half.
+    if (2 * (m_string_references.count() + 1) > m_string_slots.count()) {
+        const usize new_slot_count = (m_string_slots.count() > 0) ? (2 * m_string_slots.count()) : 64;
+        m_string_slots = Vector<u32>::from_template_element(new_slot_count, empty_string_slot);
+
+        for (usize reference_index = 0; reference_index < m_string_references.count(); ++reference_index) {
+            const BinaryStringReference& reference = m_string_references[reference_index];
+            const StringView existing_string =
+                StringView::from_utf8(reinterpret_cast<const char*>(m_string_table.bytes.bytes() + reference.offset), reference.byte_count);
+
+            usize slot_index = hash_string(existing_string) & (new_slot_count - 1);
+            while (m_string_slots[slot_index] != empty_string_slot)
+                slot_index = (slot_index + 1) & (new_slot_count - 1);
+            m_string_slots[slot_index] = static_cast<u32>(reference_index + 1);
+        }
+    }
+
+    const usize slot_mask = m_string_slots.count() - 1;
+    usize slot_index = hash_string(string) & slot_mask;
+    while (m_string_slots[slot_index] != empty_string_slot) {
+        const BinaryStringReference& reference = m_string_references[m_string_slots[slot_index] - 1];
+        const StringView existing_string =
+            StringView::from_utf8(reinterpret_cast<const char*>(m_string_table.bytes.bytes() + reference.offset), reference.byte_count);
+        if (existing_string == string)
+            return reference;
+        slot_index = (slot_index + 1) & slot_mask;
+    }
+
+    VERIFY(m_string_table.byte_count + string.byte_count() <= NumericLimits<u32>::max());
+    BinaryStringReference reference;
+    reference.offset = static_cast<u32>(m_string_table.byte_count);
+    reference.byte_count = static_cast<u32>(string.byte_count());
+    append_to_section(m_string_table, string.byte_span(), 1);
+
+    m_string_references.add(reference);
+    m_string_slots[slot_index] = static_cast<u32>(m_string_references.count());
+    return reference;
+}
+
+ByteBuffer BinaryFormatWriter::finalize() const
+{
+    Vector<ByteBuffer> compressed_sections;
+    compress_sections(compressed_sections);
+
+    Vector<BinarySectionEntry> section_entries;
+    BinaryFormatHeader header;
+    compute_layout(compressed_sections, section_entries, header);
+
+    ByteBuffer file_bytes = ByteBuffer::from_initial_byte_count(header.file_byte_count);
+    BufferedWriter writer(file_bytes.byte_span());
+    MAYBE_UNUSED const bool result = write_contents(writer, compressed_sections, section_entries, header);
+    VERIFY(result && writer.written_byte_count() == header.file_byte_count);
+    return file_bytes;
+}
+
+bool BinaryFormatWriter::write_to_file(StringView filepath) const
+{
+    Vector<ByteBuffer> compressed_sections;
+    compress_sections(compressed_sections);
+
+    Vector<BinarySectionEntry> section_entries;
+    BinaryFormatHeader header;
+    compute_layout(compressed_sections, section_entries, header);
+
+    Optional<File> file = File::open(filepath, FileOpenMode::Write);
+    if (!file.has_value())
+        return false;
+
+    FileOutputStream file_stream(file.value());
+    BufferedWriter writer(file_stream);
+    if (!write_contents(writer, compressed_sections, section_entries, header))
+        return false;
+    return writer.flush();
+}
+
+void BinaryFormatWriter::append_to_section(Section& section, ReadonlyByteSpan bytes, u32 alignment)
+{
+    const usize offset = align_up(section.byte_count, alignment);
+    const usize required_byte_count = offset + bytes.count();
+
+    if (required_byte_count > section.bytes.byte_count()) {
+        usize new_byte_count = 2 * section.bytes.byte_count();
+        if (new_byte_count < required_byte_count)
+            new_byte_count = required_byte_count;
+        if (new_byte_count < 256)
+            new_byte_count = 256;
+        section.bytes.expand(new_byte_count);
+    }
+
+    zero_memory(section.bytes.bytes() + section.byte_count, offset - section.byte_count);
+    copy_memory(section.bytes.bytes() + offset, bytes.elements(), bytes.count());
+    section.byte_count = required_byte_count;
+}
+
+void BinaryFormatWriter::compress_sections(Vector<ByteBuffer>& compressed_sections) const
+{
+    for (usize section_index = 0; section_index < m_sections.count(); ++section_index) {
+        const Section& section = m_sections[section_index];
+        ByteBuffer compressed_bytes;
+        if (section.is_compressed && section.byte_count > 0) {
+            Optional<ByteBuffer> compressed = compress(ReadonlyByteSpan(section.bytes.bytes(), section.byte_count));
+            if (compressed.has_value() && compressed->byte_count() < section.byte_count)
+                compressed_bytes = move(compressed.value());
+        }
+        compressed_sections.add(move(compressed_bytes));
+    }
+}
+
+void BinaryFormatWriter::compute_layout(const Vector<ByteBuffer>& compressed_sections, Vector<BinarySectionEntry>& section_entries, BinaryFormatHeader& header) const
+{
+    const usize section_count = m_sections.count() + (m_string_references.has_elements() ? 1 : 0);
+    u64 offset = sizeof(BinaryFormatHeader) + section_count * sizeof(BinarySectionEntry);
+
+    const auto add_section_entry = [&](const Section& section, const ByteBuffer* compressed_bytes) {
+        offset = align_up(offset, section.alignment);
+
+        BinarySectionEntry entry = {};
+        entry.tag = section.tag;
+        entry.alignment = section.alignment;
+        entry.offset = offset;
+        entry.byte_count = section.byte_count;
+        if (compressed_bytes && compressed_bytes->byte_count() > 0) {
+            entry.byte_count = compressed_bytes->byte_count();
+            entry.flags = binary_section_flag_compressed;
+            entry.decompressed_byte_count = static_cast<u32>(section.byte_count);
+        }
+        section_entries.add(entry);
+
+        offset += entry.byte_count;
+    };
+
+    for (usize section_index = 0; section_index < m_sections.count(); ++section_index)
+        add_section_entry(m_sections[section_index], &compressed_sections[section_index]);
+    if (m_string_references.has_elements())
+        add_section_entry(m_string_table, nullptr);
+
+    header = {};
+    header.magic = binary_format_magic;
+    header.major_version = binary_format_major_version;
+    header.minor_version = binary_format_minor_version;
+    header.schema_version = m_schema_version;
+    header.section_count = static_cast<u32>(section_count);
+    header.file_byte_count = offset;
+    header.section_table_offset = sizeof(BinaryFormatHeader);
+}
+
+bool BinaryFormatWriter::write_contents(
+    BufferedWriter& writer,
+    const Vector<ByteBuffer>& compressed_sections,
+    const Vector<BinarySectionEntry>& section_entries,
+    const BinaryFormatHeader& header
+) const
+{
+    if (!writer.write(ReadonlyByteSpan(reinterpret_cast<ReadonlyBytes>(&header), sizeof(header))))
+        return false;
+    if (!writer.write(ReadonlyByteSpan(reinterpret_cast<ReadonlyBytes>(section_entries.elements()), section_entries.count() * sizeof(BinarySectionEntry))))
+        return false;
+
+    for (usize section_index = 0; section_index < section_entries.count(); ++section_index) {
+        const BinarySectionEntry& entry = section_entries[section_index];
+        const Section& section = (section_index < m_sections.count()) ? m_sections[section_index] : m_string_table;
+        const u8* bytes = (entry.flags & binary_section_flag_compressed) ? compressed_sections[section_index].bytes() : section.bytes.bytes();
+
+        if (!write_padding(writer, entry.offset - writer.written_byte_count()))
+            return false;
+        if (!writer.write(ReadonlyByteSpan(bytes, entry.byte_count)))
+            return false;
+    }
+
+    return true;
+}
+
+Optional<BinaryFormatReader> BinaryFormatReader::open(StringView filepath)
+{
+    Optional<MappedFile> mapped_file = MappedFile::open(filepath);
+    if (!mapped_file.has_value())
+        return {};
+
+    BinaryFormatReader reader;
+    reader.m_bytes = mapped_file->byte_span();
+    reader.m_mapped_file = move(mapped_file.value());
+    if (!reader.validate())
+        return {};
+
+    // NOTE: The section data is accessed in no particular order, so read-ahead would mostly load pages that
+    //       are never used. The header and the section table were already loaded by the validation.
+    reader.m_mapped_file.advise(MappedFileAccessPattern::Random);
+    return move(reader);
+}
+
+Optional<BinaryFormatReader> BinaryFormatReader::from_bytes(ReadonlyByteSpan bytes)
+{
+    BinaryFormatReader reader;
+    reader.m_bytes = bytes;
+    if (!reader.validate())
+        return {};
+    return move(reader);
+}
+
+BinaryFormatReader::BinaryFormatReader() = default;
+BinaryFormatReader::~BinaryFormatReader() = default;
+
+BinaryFormatReader::BinaryFormatReader(BinaryFormatReader&& other) noexcept = default;
+BinaryFormatReader& BinaryFormatReader::operator=(BinaryFormatReader&& other) noexcept = default;
+
+Optional<ReadonlyByteSpan> BinaryFormatReader::find_section(u32 tag) const
+{
+    const Span<const BinarySectionEntry> entries = section_entries();
+    for (usize entry_index = 0; entry_index < entries.count(); ++entry_index) {
+        const BinarySectionEntry& entry = entries[entry_index];
+        if (entry.tag != tag)
+            continue;
+        if (entry.flags & binary_section_flag_compressed)
+            return {};
+        return ReadonlyByteSpan(m_bytes.elements() + entry.offset, entry.byte_count);
+    }
+    return {};
+}
+
+Optional<ByteBuffer> BinaryFormatReader::read_section(u32 tag) const
+{
+    const Span<const BinarySectionEntry> entries = section_entries();
+    for (usize entry_index = 0; entry_index < entries.count(); ++entry_index) {
+        const BinarySectionEntry& entry = entries[entry_index];
+        if (entry.tag != tag)
+            continue;
+
+        const ReadonlyByteSpan stored_bytes = ReadonlyByteSpan(m_bytes.elements() + entry.offset, entry.byte_count);
+        if (entry.flags & binary_section_flag_compressed)
+            return decompress(stored_bytes, entry.decompressed_byte_count);
+        return ByteBuffer::from_byte_span(stored_bytes);
+    }
+    return {};
+}
+
+bool BinaryFormatReader::validate()
+{
+    const u64 byte_count = m_bytes.count();
+    if (byte_count < sizeof(BinaryFormatHeader))
+        return false;
+    if (reinterpret_cast<uintptr>(m_bytes.elements()) % alignof(BinaryFormatHeader) != 0)
+        return false;
+
+    // NOTE: A file written on a machine with a different byte order has its magic number byte-swapped.
+    const BinaryFormatHeader& file_header = header();
+    if (file_header.magic != binary_format_magic)
+        return false;
+    if (file_header.major_version != binary_format_major_version)
+        return false;
+    if (file_header.file_byte_count != byte_count)
+        return false;
+
+    if (file_header.section_table_offset % alignof(BinarySectionEntry) != 0 || file_header.section_table_offset > byte_count)
+        return false;
+    if (file_header.section_count > (byte_count - file_header.section_table_offset) / sizeof(BinarySectionEntry))
+        return false;
+
+    const Span<const BinarySectionEntry> entries = section_entries();
+    for (usize entry_index = 0; entry_index < entries.count(); ++entry_index) {
+        const BinarySectionEntry& entry = entries[entry_index];
+        if (!is_power_of_two(entry.alignment) || entry.alignment > binary_format_max_section_alignment)
+            return false;
+        if (entry.offset % entry.alignment != 0)
+            return false;
+        if (entry.offset > byte_count || entry.byte_count > byte_count - entry.offset)
+            return false;
+        if ((entry.flags & ~binary_section_flag_compressed) != 0)
+            return false;
+        if (!(entry.flags & binary_section_flag_compressed) && entry.decompressed_byte_count != 0)
+            return false;
+
+        // NOTE: The strings are referenced in place, so the string table is never compressed.
+        if (entry.tag == binary_string_table_section_tag && (entry.flags & binary_section_flag_compressed))
+            return false;
+    }
+
+    const Optional<ReadonlyByteSpan> string_table = find_section(binary_string_table_section_tag);
+    if (string_table.has_value())
+        m_string_table = string_table.value();
+    return true;
+}
+
+} // namespace Core
@@ -0,0 +1,255 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#pragma once
+
+#include <AT/ByteBuffer.h>
+#include <AT/MappedFile.h>
+#include <AT/Optional.h>
+#include <AT/Span.h>
+#include <AT/Stream.h>
+#include <AT/StringView.h>
+#include <AT/Vector.h>
+#include <Core/API.h>
+
+namespace Core {
+
+//
+// The binary format is designed to be memory mapped and used directly, without any parsing step. The file is
+// composed of a fixed-size header, followed by a table of section entries and the contents of the sections.
+// Each section is aligned to its declared alignment, relative to the beginning of the file. All references
+// between (or within) sections are stored as offsets relative to the beginning of the referenced section, so
+// the file can be mapped at any address.
+//
+// Sections can also be stored compressed, which trades the use in place for a smaller file. This suits the data
+// that is read once and copied anyway, such as the resources of a bundle or the contents of an on-disk cache.
+//
+// NOTE: All the values are stored in little-endian byte order, which is the native order of every platform
+//       that we support. A file written on a big-endian machine is rejected when it is opened.
+//
+
+static constexpr u32 binary_format_magic = 0x42495547; // 'GUIB' when read as little-endian bytes.
+
+// NOTE: Files with a different major version are rejected. The minor version is incremented for backwards
+//       compatible changes, such as adding new section kinds that older readers can ignore.
+// NOTE: Version 2 added compressed sections, which readers of version 1 would use as if they weren't compressed.
+static constexpr u16 binary_format_major_version = 2;
+static constexpr u16 binary_format_minor_version = 0;
+
+// NOTE: The alignment of a section can't exceed the size of a page, as the mapping itself is only page aligned.
+static constexpr u32 binary_format_max_section_alignment = 4096;
+
+NODISCARD ALWAYS_INLINE constexpr u32 make_binary_section_tag(char a, char b, char c, char d)
+{
+    return static_cast<u32>(static_cast<u8>(a)) | (static_cast<u32>(static_cast<u8>(b)) << 8) |
+           (static_cast<u32>(static_cast<u8>(c)) << 16) | (static_cast<u32>(static_cast<u8>(d)) << 24);
+}
+
+// NOTE: The tag of the section that contains the UTF-8 bytes of all the strings, without null terminators.
+static constexpr u32 binary_string_table_section_tag = make_binary_section_tag('S', 'T', 'R', 'S');
+
+// NOTE: The section is stored as a single compressed block (see Core/Compression.h). Files with other flags set
+//       are rejected when they are opened.
+static constexpr u32 binary_section_flag_compressed = 1 << 0;
+
+struct BinaryFormatHeader {
+    u32 magic;
+    u16 major_version;
+    u16 minor_version;
+    // NOTE: The version of the data stored in the file, which is chosen by the application.
+    u32 schema_version;
+    u32 section_count;
+    u64 file_byte_count;
+    u64 section_table_offset;
+    u64 reserved[4];
+};
+static_assert(sizeof(BinaryFormatHeader) == 64);
+
+struct BinarySectionEntry {
+    u32 tag;
+    u32 alignment;
+    u64 offset;
+    // NOTE: The number of bytes stored in the file, which are compressed if the section is compressed.
+    u64 byte_count;
+    u32 flags;
+    // NOTE: The size of the contents once decompressed, or zero if the section isn't compressed.
+    u32 decompressed_byte_count;
+};
+static_assert(sizeof(BinarySectionEntry) == 32);
+
+// Reference to a string stored in the string table.
+struct BinaryStringReference {
+    u32 offset;
+    u32 byte_count;
+};
+static_assert(sizeof(BinaryStringReference) == 8);
+
+// Reference to a contiguous array of elements, stored in the same section as the reference itself
+// or in a section that is known from the context.
+struct BinaryArrayReference {
+    u32 offset;
+    u32 count;
+};
+static_assert(sizeof(BinaryArrayReference) == 8);
+
+class BinaryFormatWriter {
+    AT_MAKE_NONCOPYABLE(BinaryFormatWriter);
+    AT_MAKE_NONMOVABLE(BinaryFormatWriter);
+
+public:
+    CORE_API explicit BinaryFormatWriter(u32 schema_version);
+    CORE_API ~BinaryFormatWriter();
+
+public:
+    // All the data that is appended after this call is stored in the new section, until another section begins.
+    // NOTE: The alignment must be a power of two, not greater than `binary_format_max_section_alignment`.
+    CORE_API void begin_section(u32 tag, u32 alignment = 16);
+
+    // Same as begin_section(), but the section is compressed when the file is written. The section is stored
+    // uncompressed instead if compressing it doesn't make it smaller, or if it is too large to be compressed.
+    CORE_API void begin_compressed_section(u32 tag, u32 alignment = 16);
+
+    // Appends the bytes to the current section and returns their offset, relative to the beginning of the section.
+    NODISCARD CORE_API u32 append_bytes(ReadonlyByteSpan bytes, u32 alignment = 1);
+
+    template<typename T>
+    ALWAYS_INLINE u32 append(const T& value)
+    {
+        static_assert(__is_trivially_copyable(T), "Only trivially copyable types can be stored in the binary format");
+        return append_bytes(ReadonlyByteSpan(reinterpret_cast<ReadonlyBytes>(&value), sizeof(T)), alignof(T));
+    }
+
+    template<typename T>
+    NODISCARD ALWAYS_INLINE BinaryArrayReference append_array(Span<const T> elements)
+    {
+        static_assert(__is_trivially_copyable(T), "Only trivially copyable types can be stored in the binary format");
+        BinaryArrayReference reference;
+        reference.offset = append_bytes(ReadonlyByteSpan(reinterpret_cast<ReadonlyBytes>(elements.elements()), elements.count() * sizeof(T)), alignof(T));
+        reference.count = static_cast<u32>(elements.count());
+        return reference;
+    }
+
+    // Stores the string in the string table. Identical strings are only stored once.
+    NODISCARD CORE_API BinaryStringReference add_string(StringView string);
+
+public:
+    // Lays out the header, the section table and all the sections in a single buffer.
+    NODISCARD CORE_API ByteBuffer finalize() const;
+
+    NODISCARD CORE_API bool write_to_file(StringView filepath) const;
+
+private:
+    struct Section {
+        u32 tag { 0 };
+        u32 alignment { 1 };
+        bool is_compressed { false };
+        ByteBuffer bytes;
+        usize byte_count { 0 };
+    };
+
+private:
+    static void append_to_section(Section& section, ReadonlyByteSpan bytes, u32 alignment);
+
+    // Compresses the sections that should be compressed. The buffers of the sections that are stored uncompressed
+    // are left empty.
+    void compress_sections(Vector<ByteBuffer>& compressed_sections) const;
+
+    // Computes the offsets of all the sections, as they will be laid out in the file.
+    void compute_layout(const Vector<ByteBuffer>& compressed_sections, Vector<BinarySectionEntry>& section_entries, BinaryFormatHeader& header) const;
+
+    NODISCARD bool write_contents(
+        BufferedWriter& writer,
+        const Vector<ByteBuffer>& compressed_sections,
+        const Vector<BinarySectionEntry>& section_entries,
+        const BinaryFormatHeader& header
+    ) const;
+
+private:
+    u32 m_schema_version;
+    Vector<Section> m_sections;
+    Section m_string_table;
+
+    // NOTE: Open-addressed table of indices into `m_string_references`, used to deduplicate strings.
+    Vector<BinaryStringReference> m_string_references;
+    Vector<u32> m_string_slots;
+};
+
+class BinaryFormatReader {
+    AT_MAKE_NONCOPYABLE(BinaryFormatReader);
+
+public:
+    // Maps the file and validates its header and section table. No other part of the file is accessed, so
+    // its pages are only loaded when the data is used.
+    NODISCARD CORE_API static Optional<BinaryFormatReader> open(StringView filepath);
+
+    // NOTE: The bytes are used in place, so the memory they are stored in must outlive the reader.
+    NODISCARD CORE_API static Optional<BinaryFormatReader> from_bytes(ReadonlyByteSpan bytes);
+
+public:
+    CORE_API BinaryFormatReader();
+    CORE_API ~BinaryFormatReader();
+
+    CORE_API BinaryFormatReader(BinaryFormatReader&& other) noexcept;
+    CORE_API BinaryFormatReader& operator=(BinaryFormatReader&& other) noexcept;
+
+public:
+    NODISCARD ALWAYS_INLINE const BinaryFormatHeader& header() const { return *reinterpret_cast<const BinaryFormatHeader*>(m_bytes.elements()); }
+    NODISCARD ALWAYS_INLINE u32 schema_version() const { return header().schema_version; }
+
+    NODISCARD ALWAYS_INLINE Span<const BinarySectionEntry> section_entries() const
+    {
+        const BinaryFormatHeader& file_header = header();
+        const BinarySectionEntry* entries = reinterpret_cast<const BinarySectionEntry*>(m_bytes.elements() + file_header.section_table_offset);
+        return Span<const BinarySectionEntry>(entries, file_header.section_count);
+    }
+
+    // Returns the contents of the first section with the given tag. Compressed sections can't be used in place, so
+    // an empty optional is returned for them.
+    NODISCARD CORE_API Optional<ReadonlyByteSpan> find_section(u32 tag) const;
+
+    // Returns a copy of the contents of the first section with the given tag, which is decompressed if the section
+    // is compressed. Returns an empty optional if the section doesn't exist or if it can't be decompressed.
+    NODISCARD CORE_API Optional<ByteBuffer> read_section(u32 tag) const;
+
+    // Returns the contents of the first section with the given tag, interpreted as an array of elements. Returns
+    // an empty optional if the section doesn't exist, or if it isn't aligned or sized for the element type.
+    template<typename T>
+    NODISCARD ALWAYS_INLINE Optional<Span<const T>> find_section_as(u32 tag) const
+    {
+        static_assert(__is_trivially_copyable(T), "Only trivially copyable types can be stored in the binary format");
+        const Optional<ReadonlyByteSpan> section = find_section(tag);
+        if (!section.has_value())
+            return {};
+        if (reinterpret_cast<uintptr>(section->elements()) % alignof(T) != 0 || section->count() % sizeof(T) != 0)
+            return {};
+        return Span<const T>(reinterpret_cast<const T*>(section->elements()), section->count() / sizeof(T));
+    }
+
+    // NOTE: The references are validated against the bounds of the section. Out of bounds references are only
+    //       possible if the file was corrupted, and trigger an assertion.
+    template<typename T>
+    NODISCARD ALWAYS_INLINE Span<const T> array(ReadonlyByteSpan section, BinaryArrayReference reference) const
+    {
+        VERIFY(reference.offset % alignof(T) == 0);
+        VERIFY(static_cast<u64>(reference.offset) + static_cast<u64>(reference.count) * sizeof(T) <= section.count());
+        return Span<const T>(reinterpret_cast<const T*>(section.elements() + reference.offset), reference.count);
+    }
+
+    NODISCARD ALWAYS_INLINE StringView string(BinaryStringReference reference) const
+    {
+        VERIFY(static_cast<u64>(reference.offset) + reference.byte_count <= m_string_table.count());
+        return StringView::from_utf8(reinterpret_cast<const char*>(m_string_table.elements() + reference.offset), reference.byte_count);
+    }
+
+private:
+    NODISCARD bool validate();
+
+private:
+    MappedFile m_mapped_file;
+    ReadonlyByteSpan m_bytes;
+    ReadonlyByteSpan m_string_table;
+};
+
+} // namespace Core
@@ -0,0 +1,628 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#include <AT/BitOperations.h>
+#include <AT/MemoryOperations.h>
+#include <Core/Compression.h>
+
+#if AT_SIMD_SSE2
+    #include <emmintrin.h>
+#endif // AT_SIMD_SSE2
+
+namespace Core {
+
+// NOTE: The constraints of the LZ4 block format. The last five bytes are always literals, and the last match must
+//       start at least twelve bytes before the end of the block, so that the decompressor can copy in wide chunks.
+static constexpr usize min_match_byte_count = 4;
+static constexpr usize last_literals_byte_count = 5;
+static constexpr usize match_find_limit_byte_count = 12;
+static constexpr usize max_match_offset = 65535;
+static constexpr u32 run_mask = 15;
+
+static constexpr u32 hash_table_bit_count = 12;
+static constexpr usize hash_table_entry_count = static_cast<usize>(1) << hash_table_bit_count;
+
+// NOTE: The search step grows after every 64 failed attempts, which skips quickly over incompressible data.
+static constexpr u32 search_acceleration_shift = 6;
+
+NODISCARD ALWAYS_INLINE static u32 read_u32(ReadonlyBytes bytes)
+{
+    return static_cast<u32>(bytes[0]) | (static_cast<u32>(bytes[1]) << 8) | (static_cast<u32>(bytes[2]) << 16) |
+           (static_cast<u32>(bytes[3]) << 24);
+}
+
+NODISCARD ALWAYS_INLINE static u64 read_u64(ReadonlyBytes bytes)
+{
+    return static_cast<u64>(read_u32(bytes)) | (static_cast<u64>(read_u32(bytes + 4)) << 32);
+}
+
+ALWAYS_INLINE static void write_u32(WriteonlyBytes bytes, u32 value)
+{
+    bytes[0] = static_cast<u8>(value);
+    bytes[1] = static_cast<u8>(value >> 8);
+    bytes[2] = static_cast<u8>(value >> 16);
+    bytes[3] = static_cast<u8>(value >> 24);
+}
+
+// NOTE: Copies exactly 16 bytes, with a single unaligned vector load and store.
+ALWAYS_INLINE static void copy_16_bytes(WriteonlyBytes destination, ReadonlyBytes source)
+{
+#if AT_SIMD_SSE2
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(destination), _mm_loadu_si128(reinterpret_cast<const __m128i*>(source)));
+#else
+    for (usize byte_index = 0; byte_index < 16; ++byte_index)
+        destination[byte_index] = source[byte_index];
+#endif // AT_SIMD_SSE2
+}
+
+ALWAYS_INLINE static void copy_8_bytes(WriteonlyBytes destination, ReadonlyBytes source)
+{
+#if AT_SIMD_SSE2
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(destination), _mm_loadl_epi64(reinterpret_cast<const __m128i*>(source)));
+#else
+    for (usize byte_index = 0; byte_index < 8; ++byte_index)
+        destination[byte_index] = source[byte_index];
+#endif // AT_SIMD_SSE2
+}
+
+// NOTE: Writes the 8-byte pattern repeatedly, overshooting the byte count by up to 15 bytes.
+ALWAYS_INLINE static void fill_with_pattern(WriteonlyBytes destination, usize byte_count, u64 pattern)
+{
+#if AT_SIMD_SSE2
+    const __m128i pattern_register = _mm_set1_epi64x(static_cast<long long>(pattern));
+    for (usize filled_byte_count = 0; filled_byte_count < byte_count; filled_byte_count += 16)
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + filled_byte_count), pattern_register);
+#else
+    for (usize filled_byte_count = 0; filled_byte_count < byte_count; filled_byte_count += 8) {
+        for (usize byte_index = 0; byte_index < 8; ++byte_index)
+            destination[filled_byte_count + byte_index] = static_cast<u8>(pattern >> (8 * byte_index));
+    }
+#endif // AT_SIMD_SSE2
+}
+
+// NOTE: On 64-bit targets the hash covers the first five bytes of the sequence, like in LZ4, so the positions that
+//       only share the four bytes of the minimum match collide less often and the matches that are found are longer.
+//       The compressor never hashes a position closer than twelve bytes to the end, so reading eight bytes is safe.
+NODISCARD ALWAYS_INLINE static u32 hash_sequence(ReadonlyBytes sequence)
+{
+    if constexpr (sizeof(usize) == 8)
+        return static_cast<u32>(((read_u64(sequence) << 24) * 889523592379ULL) >> (64 - hash_table_bit_count));
+    else
+        return (read_u32(sequence) * 2654435761U) >> (32 - hash_table_bit_count);
+}
+
+// Returns the number of equal bytes at the two positions, without reading at or past the limit.
+NODISCARD ALWAYS_INLINE static usize count_matching_bytes(ReadonlyBytes bytes, usize position, usize match_position, usize limit)
+{
+    const usize start_position = position;
+    while (position + 8 <= limit) {
+        const u64 difference = read_u64(bytes + position) ^ read_u64(bytes + match_position);
+        if (difference != 0)
+            return position - start_position + count_trailing_zeroes(difference) / 8;
+        position += 8;
+        match_position += 8;
+    }
+
+    while (position < limit && bytes[position] == bytes[match_position]) {
+        ++position;
+        ++match_position;
+    }
+    return position - start_position;
+}
+
+ALWAYS_INLINE static void write_length_extension(WriteonlyBytes destination, usize& output_offset, usize length)
+{
+    while (length >= 255) {
+        destination[output_offset++] = 255;
+        length -= 255;
+    }
+    destination[output_offset++] = static_cast<u8>(length);
+}
+
+ALWAYS_INLINE static void write_literals(WriteonlyBytes output, usize& output_offset, usize token_offset, ReadonlyBytes literals, usize literal_byte_count)
+{
+    if (literal_byte_count >= run_mask) {
+        output[token_offset] = static_cast<u8>(run_mask << 4);
+        write_length_extension(output, output_offset, literal_byte_count - run_mask);
+    }
+    else {
+        output[token_offset] = static_cast<u8>(literal_byte_count << 4);
+    }
+
+    copy_memory(output + output_offset, literals, literal_byte_count);
+    output_offset += literal_byte_count;
+}
+
+// Emits all the sequences that contain a match, and returns the position of the first byte that wasn't encoded.
+// NOTE: The input must be longer than `match_find_limit_byte_count` bytes.
+NODISCARD static usize write_match_sequences(ReadonlyBytes input, usize input_byte_count, WriteonlyBytes output, usize& output_offset)
+{
+    // NOTE: The positions are stored relative to the start of the block, and a zero entry refers to the first
+    //       position, which is always a valid (if unlikely) match candidate.
+    u32 hash_table[hash_table_entry_count] = {};
+
+    const usize match_start_limit = input_byte_count - match_find_limit_byte_count;
+    const usize match_end_limit = input_byte_count - last_literals_byte_count;
+    usize anchor = 0;
+    usize position = 1;
+
+    while (true) {
+        usize match_position;
+        usize forward_position = position;
+        u32 search_attempt_count = 1 << search_acceleration_shift;
+        do {
+            position = forward_position;
+            forward_position += search_attempt_count++ >> search_acceleration_shift;
+            if (forward_position > match_start_limit)
+                return anchor;
+
+            const u32 hash = hash_sequence(input + position);
+            match_position = hash_table[hash];
+            hash_table[hash] = static_cast<u32>(position);
+        } while (position - match_position > max_match_offset || read_u32(input + match_position) != read_u32(input + position));
+
+        // NOTE: Extend the match backwards, over the literals that happen to match as well.
+        while (position > anchor && match_position > 0 && input[position - 1] == input[match_position - 1]) {
+            --position;
+            --match_position;
+        }
+
+        usize token_offset = output_offset++;
+        write_literals(output, output_offset, token_offset, input + anchor, position - anchor);
+
+        while (true) {
+            const usize match_offset = position - match_position;
+            output[output_offset++] = static_cast<u8>(match_offset);
+            output[output_offset++] = static_cast<u8>(match_offset >> 8);
+
+            const usize match_byte_count =
+                min_match_byte_count + count_matching_bytes(input, position + min_match_byte_count, match_position + min_match_byte_count, match_end_limit);
+            position += match_byte_count;
+
+            const usize encoded_match_byte_count = match_byte_count - min_match_byte_count;
+            if (encoded_match_byte_count >= run_mask) {
+                output[token_offset] |= static_cast<u8>(run_mask);
+                write_length_extension(output, output_offset, encoded_match_byte_count - run_mask);
+            }
+            else {
+                output[token_offset] |= static_cast<u8>(encoded_match_byte_count);
+            }
+
+            anchor = position;
+            if (position > match_start_limit)
+                return anchor;
+
+            hash_table[hash_sequence(input + position - 2)] = static_cast<u32>(position - 2);
+
+            // NOTE: Check whether another match starts right away, in which case the sequence has no literals.
+            const u32 hash = hash_sequence(input + position);
+            match_position = hash_table[hash];
+            hash_table[hash] = static_cast<u32>(position);
+            if (position - match_position > max_match_offset || read_u32(input + match_position) != read_u32(input + position))
+                break;
+
+            token_offset = output_offset++;
+            output[token_offset] = 0;
+        }
+
+        ++position;
+    }
+}
+
+Optional<usize> compress_block(ReadonlyByteSpan source, WriteonlyByteSpan destination)
+{
+    if (source.count() > max_compression_block_byte_count || destination.count() < compression_bound(source.count()))
+        return {};
+
+    usize output_offset = 0;
+    usize anchor = 0;
+
+    // NOTE: Blocks that are too small to contain a match are stored as a single run of literals.
+    if (source.count() > match_find_limit_byte_count)
+        anchor = write_match_sequences(source.elements(), source.count(), destination.elements(), output_offset);
+
+    const usize token_offset = output_offset++;
+    write_literals(destination.elements(), output_offset, token_offset, source.elements() + anchor, source.count() - anchor);
+    return output_offset;
+}
+
+// NOTE: The smallest multiple of each match offset (below 8) that is at least 8.
+static constexpr u8 extended_pattern_distances[8] = { 0, 8, 8, 9, 8, 10, 12, 14 };
+
+// Copies a match in chunks of 8 or 16 bytes, which may write up to 15 bytes past its end.
+ALWAYS_INLINE static void copy_match_in_wide_chunks(
+    WriteonlyBytes match_destination,
+    ReadonlyBytes match_source,
+    usize match_offset,
+    usize match_byte_count
+)
+{
+    if (match_offset >= 16) {
+        // NOTE: The chunks never overlap.
+        usize copied_byte_count = 0;
+        for (; copied_byte_count + 32 <= match_byte_count; copied_byte_count += 32) {
+            copy_16_bytes(match_destination + copied_byte_count, match_source + copied_byte_count);
+            copy_16_bytes(match_destination + copied_byte_count + 16, match_source + copied_byte_count + 16);
+        }
+        for (; copied_byte_count < match_byte_count; copied_byte_count += 16)
+            copy_16_bytes(match_destination + copied_byte_count, match_source + copied_byte_count);
+    }
+    else if ((match_offset & (match_offset - 1)) == 0 && match_offset <= 8) {
+        // NOTE: The periods that divide 8 are common in pixel data, and the repeated pattern can be kept in a
+        //       register, so the match is written without reading back any of the output.
+        u64 pattern;
+        switch (match_offset) {
+            case 1: pattern = static_cast<u64>(match_source[0]) * 0x0101010101010101; break;
+            case 2: pattern = (static_cast<u64>(match_source[0]) | (static_cast<u64>(match_source[1]) << 8)) * 0x0001000100010001; break;
+            case 4: pattern = static_cast<u64>(read_u32(match_source)) * 0x0000000100000001; break;
+            default: pattern = read_u64(match_source); break;
+        }
+        fill_with_pattern(match_destination, match_byte_count, pattern);
+    }
+    else {
+        // NOTE: The match overlaps the bytes it produces, so it repeats a pattern with a period of the offset.
+        //       Short periods are first extended to at least 8 bytes, one byte at a time. From then on, the
+        //       pattern can be copied in chunks of 8 bytes, from a distance that is a multiple of the period.
+        usize copied_byte_count = 0;
+        usize pattern_distance = match_offset;
+        if (match_offset < 8) {
+            for (; copied_byte_count < 8; ++copied_byte_count)
+                match_destination[copied_byte_count] = match_source[copied_byte_count];
+            pattern_distance = extended_pattern_distances[match_offset];
+        }
+
+        const ReadonlyBytes pattern_source = match_destination - pattern_distance;
+        for (; copied_byte_count < match_byte_count; copied_byte_count += 8)
+            copy_8_bytes(match_destination + copied_byte_count, pattern_source + copied_byte_count);
+    }
+}
+
+// Reads the extension bytes of a literal or match length. Returns false if the block ends before the extension does.
+NODISCARD ALWAYS_INLINE static bool read_length_extension(ReadonlyBytes input, usize input_byte_count, usize& input_offset, usize& length)
+{
+    u8 extension_byte;
+    do {
+        if (input_offset >= input_byte_count)
+            return false;
+        extension_byte = input[input_offset++];
+        length += extension_byte;
+    } while (extension_byte == 255);
+    return true;
+}
+
+Optional<usize> decompress_block(ReadonlyByteSpan source, WriteonlyByteSpan destination)
+{
+    const ReadonlyBytes input = source.elements();
+    const WriteonlyBytes output = destination.elements();
+    const usize input_byte_count = source.count();
+    const usize output_byte_count = destination.count();
+    usize input_offset = 0;
+    usize output_offset = 0;
+
+    while (true) {
+        if (input_offset >= input_byte_count)
+            return {};
+        const u32 token = input[input_offset++];
+
+        usize literal_byte_count = token >> 4;
+        if (literal_byte_count == run_mask && !read_length_extension(input, input_byte_count, input_offset, literal_byte_count))
+            return {};
+        if (literal_byte_count > input_byte_count - input_offset || literal_byte_count > output_byte_count - output_offset)
+            return {};
+
+        // NOTE: Literal runs are copied in wide chunks that may overshoot the run, when there is enough room on both
+        //       sides. The overshoot is overwritten by the following sequences.
+        if (input_byte_count - input_offset >= literal_byte_count + 16 && output_byte_count - output_offset >= literal_byte_count + 16) {
+            for (usize copied_byte_count = 0; copied_byte_count < literal_byte_count; copied_byte_count += 16)
+                copy_16_bytes(output + output_offset + copied_byte_count, input + input_offset + copied_byte_count);
+        }
+        else {
+            copy_memory(output + output_offset, input + input_offset, literal_byte_count);
+        }
+        input_offset += literal_byte_count;
+        output_offset += literal_byte_count;
+
+        // NOTE: The last sequence of the block only contains literals.
+        if (input_offset == input_byte_count)
+            return output_offset;
+
+        if (input_byte_count - input_offset < 2)
+            return {};
+        const usize match_offset = static_cast<usize>(input[input_offset]) | (static_cast<usize>(input[input_offset + 1]) << 8);
+        input_offset += 2;
+        if (match_offset == 0 || match_offset > output_offset)
+            return {};
+
+        usize match_byte_count = token & run_mask;
+        if (match_byte_count == run_mask && !read_length_extension(input, input_byte_count, input_offset, match_byte_count))
+            return {};
+        match_byte_count += min_match_byte_count;
+        if (match_byte_count > output_byte_count - output_offset)
+            return {};
+
+        WriteonlyBytes match_destination = output + output_offset;
+        ReadonlyBytes match_source = output + output_offset - match_offset;
+        output_offset += match_byte_count;
+
+        if (match_byte_count <= 18 && match_offset >= 8 && output_byte_count - output_offset >= 24) {
+            // NOTE: Fast path for the short matches that make up most of the sequences, without any loop.
+            copy_8_bytes(match_destination, match_source);
+            copy_8_bytes(match_destination + 8, match_source + 8);
+            copy_8_bytes(match_destination + 16, match_source + 16);
+        }
+        else {
+            // NOTE: The wide copies may write up to 15 bytes past the bytes they copy, so only the part of the match
+            //       that ends at least 16 bytes before the end of the destination is copied in wide chunks. The rest
+            //       is copied one byte at a time, which also handles overlapping matches.
+            const usize byte_count_from_match_start = output_byte_count - (output_offset - match_byte_count);
+            usize wide_byte_count = 0;
+            if (byte_count_from_match_start > 16) {
+                const usize max_wide_byte_count = byte_count_from_match_start - 16;
+                wide_byte_count = (match_byte_count < max_wide_byte_count) ? match_byte_count : max_wide_byte_count;
+            }
+
+            if (wide_byte_count > 0)
+                copy_match_in_wide_chunks(match_destination, match_source, match_offset, wide_byte_count);
+            for (usize byte_index = wide_byte_count; byte_index < match_byte_count; ++byte_index)
+                match_destination[byte_index] = match_source[byte_index];
+        }
+    }
+}
+
+Optional<ByteBuffer> compress(ReadonlyByteSpan source)
+{
+    if (source.count() > max_compression_block_byte_count)
+        return {};
+
+    ByteBuffer compressed = ByteBuffer::from_initial_byte_count(compression_bound(source.count()));
+    const Optional<usize> compressed_byte_count = compress_block(source, compressed.byte_span());
+    VERIFY(compressed_byte_count.has_value());
+    compressed.shrink(compressed_byte_count.value());
+    return compressed;
+}
+
+Optional<ByteBuffer> decompress(ReadonlyByteSpan source, usize decompressed_byte_count)
+{
+    ByteBuffer decompressed = ByteBuffer::from_initial_byte_count(decompressed_byte_count);
+    const Optional<usize> result = decompress_block(source, decompressed.byte_span());
+    if (!result.has_value() || result.value() != decompressed_byte_count)
+        return {};
+    return decompressed;
+}
+
+static constexpr usize frame_header_byte_count = 8;
+static constexpr usize block_header_byte_count = 4;
+static constexpr u32 block_uncompressed_flag = static_cast<u32>(1) << 31;
+
+CompressedOutputStream::CompressedOutputStream(OutputStream& destination, u32 block_byte_count_log2, bool store_content_hash)
+    : m_destination(destination)
+    , m_block_byte_count(static_cast<usize>(1) << block_byte_count_log2)
+    , m_block_byte_count_log2(block_byte_count_log2)
+    , m_store_content_hash(store_content_hash)
+{
+    VERIFY(block_byte_count_log2 >= compression_min_block_byte_count_log2);
+    VERIFY(block_byte_count_log2 <= compression_max_block_byte_count_log2);
+
+    m_block = ByteBuffer::from_initial_byte_count(m_block_byte_count);
+    m_compressed_block = ByteBuffer::from_initial_byte_count(compression_bound(m_block_byte_count));
+}
+
+CompressedOutputStream::~CompressedOutputStream()
+{
+    if (!m_is_finished) {
+        MAYBE_UNUSED const bool finished = finish();
+    }
+}
+
+bool CompressedOutputStream::write(ReadonlyByteSpan source)
+{
+    VERIFY(!m_is_finished);
+    if (!m_has_written_frame_header && !write_frame_header())
+        return false;
+
+    usize offset = 0;
+    while (offset < source.count()) {
+        // NOTE: Full blocks are compressed directly from the source, instead of being copied to the block buffer.
+        if (m_buffered_byte_count == 0 && source.count() - offset >= m_block_byte_count) {
+            if (!write_block(source.slice(offset, m_block_byte_count)))
+                return false;
+            offset += m_block_byte_count;
+            continue;
+        }
+
+        usize copy_byte_count = m_block_byte_count - m_buffered_byte_count;
+        if (copy_byte_count > source.count() - offset)
+            copy_byte_count = source.count() - offset;
+
+        copy_memory(m_block.bytes() + m_buffered_byte_count, source.elements() + offset, copy_byte_count);
+        m_buffered_byte_count += copy_byte_count;
+        offset += copy_byte_count;
+
+        if (m_buffered_byte_count == m_block_byte_count) {
+            m_buffered_byte_count = 0;
+            if (!write_block(m_block.byte_span()))
+                return false;
+        }
+    }
+
+    return true;
+}
+
+bool CompressedOutputStream::flush()
+{
+    VERIFY(!m_is_finished);
+    if (!m_has_written_frame_header && !write_frame_header())
+        return false;
+
+    if (m_buffered_byte_count > 0) {
+        const usize block_byte_count = m_buffered_byte_count;
+        m_buffered_byte_count = 0;
+        if (!write_block(m_block.byte_span().slice(0, block_byte_count)))
+            return false;
+    }
+
+    return m_destination.flush();
+}
+
+bool CompressedOutputStream::finish()
+{
+    VERIFY(!m_is_finished);
+    if (!flush())
+        return false;
+    m_is_finished = true;
+
+    u8 end_mark[block_header_byte_count + sizeof(u64)] = {};
+    usize end_mark_byte_count = block_header_byte_count;
+    if (m_store_content_hash) {
+        const u64 content_hash = m_content_hasher.finalize();
+        write_u32(end_mark + block_header_byte_count, static_cast<u32>(content_hash));
+        write_u32(end_mark + block_header_byte_count + 4, static_cast<u32>(content_hash >> 32));
+        end_mark_byte_count += sizeof(u64);
+    }
+
+    if (!m_destination.write(ReadonlyByteSpan(end_mark, end_mark_byte_count)))
+        return false;
+    return m_destination.flush();
+}
+
+bool CompressedOutputStream::write_frame_header()
+{
+    m_has_written_frame_header = true;
+
+    u8 frame_header[frame_header_byte_count] = {};
+    write_u32(frame_header, compression_frame_magic);
+    frame_header[4] = compression_frame_version;
+    frame_header[5] = m_store_content_hash ? compression_frame_flag_content_hash : 0;
+    frame_header[6] = static_cast<u8>(m_block_byte_count_log2);
+    return m_destination.write(ReadonlyByteSpan(frame_header, frame_header_byte_count));
+}
+
+bool CompressedOutputStream::write_block(ReadonlyByteSpan block)
+{
+    if (m_store_content_hash)
+        m_content_hasher.update(block);
+
+    const Optional<usize> compressed_byte_count = compress_block(block, m_compressed_block.byte_span());
+    VERIFY(compressed_byte_count.has_value());
+
+    // NOTE: Blocks that don't shrink are stored as they are, so incompressible data is never expanded by more
+    //       than the block header.
+    u8 block_header[block_header_byte_count];
+    if (compressed_byte_count.value() >= block.count()) {
+        write_u32(block_header, static_cast<u32>(block.count()) | block_uncompressed_flag);
+        if (!m_destination.write(ReadonlyByteSpan(block_header, block_header_byte_count)))
+            return false;
+        return m_destination.write(block);
+    }
+
+    write_u32(block_header, static_cast<u32>(compressed_byte_count.value()));
+    if (!m_destination.write(ReadonlyByteSpan(block_header, block_header_byte_count)))
+        return false;
+    return m_destination.write(m_compressed_block.byte_span().slice(0, compressed_byte_count.value()));
+}
+
+CompressedInputStream::CompressedInputStream(InputStream& source)
+    : m_source(source)
+{}
+
+CompressedInputStream::~CompressedInputStream() = default;
+
+Optional<usize> CompressedInputStream::read_some(WriteonlyByteSpan destination)
+{
+    if (!m_has_read_frame_header && !read_frame_header())
+        return {};
+
+    while (m_block_offset == m_decompressed_byte_count) {
+        if (m_has_reached_end_of_frame || destination.count() == 0)
+            return 0;
+        if (!read_next_block())
+            return {};
+    }
+
+    usize copy_byte_count = m_decompressed_byte_count - m_block_offset;
+    if (copy_byte_count > destination.count())
+        copy_byte_count = destination.count();
+
+    copy_memory(destination.elements(), m_block.bytes() + m_block_offset, copy_byte_count);
+    m_block_offset += copy_byte_count;
+    return copy_byte_count;
+}
+
+bool CompressedInputStream::read_frame_header()
+{
+    u8 frame_header[frame_header_byte_count];
+    const Optional<usize> read_byte_count = m_source.read(WriteonlyByteSpan(frame_header, frame_header_byte_count));
+    if (!read_byte_count.has_value() || read_byte_count.value() != frame_header_byte_count)
+        return false;
+
+    if (read_u32(frame_header) != compression_frame_magic || frame_header[4] != compression_frame_version)
+        return false;
+    if ((frame_header[5] & ~compression_frame_flag_content_hash) != 0)
+        return false;
+
+    const u32 block_byte_count_log2 = frame_header[6];
+    if (block_byte_count_log2 < compression_min_block_byte_count_log2 || block_byte_count_log2 > compression_max_block_byte_count_log2)
+        return false;
+
+    m_has_read_frame_header = true;
+    m_has_content_hash = (frame_header[5] & compression_frame_flag_content_hash) != 0;
+    m_block_byte_count = static_cast<usize>(1) << block_byte_count_log2;
+    m_block = ByteBuffer::from_initial_byte_count(m_block_byte_count);
+    m_compressed_block = ByteBuffer::from_initial_byte_count(compression_bound(m_block_byte_count));
+    return true;
+}
+
+bool CompressedInputStream::read_next_block()
+{
+    u8 block_header[block_header_byte_count];
+    Optional<usize> read_byte_count = m_source.read(WriteonlyByteSpan(block_header, block_header_byte_count));
+    if (!read_byte_count.has_value() || read_byte_count.value() != block_header_byte_count)
+        return false;
+
+    const u32 block_header_value = read_u32(block_header);
+    if (block_header_value == 0) {
+        m_has_reached_end_of_frame = true;
+        if (!m_has_content_hash)
+            return true;
+
+        u8 content_hash[sizeof(u64)];
+        read_byte_count = m_source.read(WriteonlyByteSpan(content_hash, sizeof(content_hash)));
+        if (!read_byte_count.has_value() || read_byte_count.value() != sizeof(content_hash))
+            return false;
+        return read_u64(content_hash) == m_content_hasher.finalize();
+    }
+
+    const bool is_uncompressed = (block_header_value & block_uncompressed_flag) != 0;
+    const usize stored_byte_count = block_header_value & ~block_uncompressed_flag;
+
+    if (is_uncompressed) {
+        if (stored_byte_count > m_block_byte_count)
+            return false;
+        read_byte_count = m_source.read(m_block.byte_span().slice(0, stored_byte_count));
+        if (!read_byte_count.has_value() || read_byte_count.value() != stored_byte_count)
+            return false;
+        m_decompressed_byte_count = stored_byte_count;
+    }
+    else {
+        if (stored_byte_count > m_compressed_block.byte_count())
+            return false;
+        read_byte_count = m_source.read(m_compressed_block.byte_span().slice(0, stored_byte_count));
+        if (!read_byte_count.has_value() || read_byte_count.value() != stored_byte_count)
+            return false;
+
+        const Optional<usize> decompressed_byte_count =
+            decompress_block(m_compressed_block.byte_span().slice(0, stored_byte_count), m_block.byte_span());
+        if (!decompressed_byte_count.has_value())
+            return false;
+        m_decompressed_byte_count = decompressed_byte_count.value();
+    }
+
+    if (m_has_content_hash)
+        m_content_hasher.update(ReadonlyByteSpan(m_block.bytes(), m_decompressed_byte_count));
+    m_block_offset = 0;
+    return true;
+}
+
+} // namespace Core
@@ -0,0 +1,145 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#pragma once
+
+#include <AT/ByteBuffer.h>
+#include <AT/Hash.h>
+#include <AT/Optional.h>
+#include <AT/Span.h>
+#include <AT/Stream.h>
+#include <Core/API.h>
+
+namespace Core {
+
+//
+// Fast LZ77 compression, using the LZ4 block format. The compressor is a single greedy pass driven by a small hash
+// table of recent positions, and the decompressor is a plain sequence of literal and match copies, which runs at a
+// few gigabytes per second. The compression ratio is modest, so the format is meant for data that is loaded often
+// and where the time spent decompressing must stay below the time saved on I/O, such as the compressed sections of
+// the binary format (see Core/BinaryFormat.h).
+//
+
+// NOTE: The largest input that can be compressed as a single block, which is the same as the limit of LZ4.
+static constexpr usize max_compression_block_byte_count = 0x7E000000;
+
+// Returns the size of the destination buffer that guarantees that the compression never fails, even if the data
+// is not compressible at all.
+NODISCARD ALWAYS_INLINE constexpr usize compression_bound(usize source_byte_count)
+{
+    return source_byte_count + (source_byte_count / 255) + 16;
+}
+
+// Compresses the source as a single block. Returns the size of the compressed block, or an empty optional if the
+// destination is smaller than `compression_bound(source.count())` or if the source is too large.
+NODISCARD CORE_API Optional<usize> compress_block(ReadonlyByteSpan source, WriteonlyByteSpan destination);
+
+// Decompresses a single block and returns the number of bytes written to the destination. Returns an empty optional
+// if the block is malformed or if it doesn't fit in the destination.
+// NOTE: Every access is bounds checked, so blocks from untrusted sources can be decompressed safely.
+NODISCARD CORE_API Optional<usize> decompress_block(ReadonlyByteSpan source, WriteonlyByteSpan destination);
+
+NODISCARD CORE_API Optional<ByteBuffer> compress(ReadonlyByteSpan source);
+
+// NOTE: The decompressed size is not stored in the block, so it must be known by the caller.
+NODISCARD CORE_API Optional<ByteBuffer> decompress(ReadonlyByteSpan source, usize decompressed_byte_count);
+
+//
+// The framed format splits the data into independently compressed blocks, so that data of unknown size can be
+// compressed and decompressed as a stream, with bounded memory:
+//   - The frame header: the magic number, the version, the flags and the base-two logarithm of the block size.
+//   - The blocks: each block starts with a 32-bit header that stores the size of the block data. If the most
+//     significant bit is set, the block data is stored uncompressed, because it wasn't compressible.
+//   - The end mark, which is a zero block header, optionally followed by the 64-bit hash of the uncompressed content.
+// All the values are stored in little-endian byte order.
+//
+
+static constexpr u32 compression_frame_magic = 0x5A495547; // 'GUIZ' when read as little-endian bytes.
+static constexpr u8 compression_frame_version = 1;
+static constexpr u8 compression_frame_flag_content_hash = 1 << 0;
+
+static constexpr u32 compression_min_block_byte_count_log2 = 16;
+static constexpr u32 compression_max_block_byte_count_log2 = 22;
+static constexpr u32 compression_default_block_byte_count_log2 = 18;
+
+// Compresses everything that is written to it and writes the frame to the destination stream.
+class CompressedOutputStream final : public OutputStream {
+    AT_MAKE_NONCOPYABLE(CompressedOutputStream);
+    AT_MAKE_NONMOVABLE(CompressedOutputStream);
+
+public:
+    // NOTE: The destination stream must outlive the compressed stream.
+    CORE_API explicit CompressedOutputStream(
+        OutputStream& destination,
+        u32 block_byte_count_log2 = compression_default_block_byte_count_log2,
+        bool store_content_hash = true
+    );
+
+    // NOTE: If the frame wasn't finished explicitly, it is finished here and any error is ignored.
+    CORE_API virtual ~CompressedOutputStream() override;
+
+public:
+    NODISCARD CORE_API virtual bool write(ReadonlyByteSpan source) override;
+
+    // Compresses the partially filled block and flushes the destination stream. Flushing often degrades the
+    // compression ratio, as every flush ends a block.
+    NODISCARD CORE_API virtual bool flush() override;
+
+    // Writes the remaining data and the end mark of the frame. Nothing can be written after the frame is finished.
+    NODISCARD CORE_API bool finish();
+
+private:
+    NODISCARD bool write_frame_header();
+    NODISCARD bool write_block(ReadonlyByteSpan block);
+
+private:
+    OutputStream& m_destination;
+    usize m_block_byte_count;
+    u32 m_block_byte_count_log2;
+    bool m_store_content_hash;
+    bool m_has_written_frame_header { false };
+    bool m_is_finished { false };
+
+    ByteBuffer m_block;
+    usize m_buffered_byte_count { 0 };
+    ByteBuffer m_compressed_block;
+    Hasher m_content_hasher;
+};
+
+// Reads a frame from the source stream and returns the decompressed content. Reading fails if the frame is
+// malformed or if its content doesn't match the stored hash.
+class CompressedInputStream final : public InputStream {
+    AT_MAKE_NONCOPYABLE(CompressedInputStream);
+    AT_MAKE_NONMOVABLE(CompressedInputStream);
+
+public:
+    // NOTE: The source stream must outlive the compressed stream.
+    CORE_API explicit CompressedInputStream(InputStream& source);
+    CORE_API virtual ~CompressedInputStream() override;
+
+public:
+    NODISCARD CORE_API virtual Optional<usize> read_some(WriteonlyByteSpan destination) override;
+
+private:
+    NODISCARD bool read_frame_header();
+
+    // Reads and decompresses the next block. Sets the end of frame flag when the end mark is reached.
+    NODISCARD bool read_next_block();
+
+private:
+    BufferedReader m_source;
+    bool m_has_read_frame_header { false };
+    bool m_has_reached_end_of_frame { false };
+    bool m_has_content_hash { false };
+    usize m_block_byte_count { 0 };
+
+    ByteBuffer m_block;
+    usize m_block_offset { 0 };
+    usize m_decompressed_byte_count { 0 };
+    ByteBuffer m_compressed_block;
+    Hasher m_content_hasher;
+};
+
+} // namespace Core
@@ -0,0 +1,310 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#include <AT/NumericLimits.h>
+#include <Core/EventLoop.h>
+#include <Core/Time.h>
+
+#if AT_PLATFORM_LINUX
+    #include <errno.h>
+    #include <sys/epoll.h>
+    #include <sys/eventfd.h>
+    #include <sys/timerfd.h>
+    #include <unistd.h>
+#else
+    // NOTE: Headers from the standard library.
+    #include <chrono>
+#endif // AT_PLATFORM_LINUX
+
+namespace Core {
+
+#if AT_PLATFORM_LINUX
+// NOTE: The identifiers of the file descriptor watchers never reach these values, as the watcher
+//       slot index would have to be greater than four billion.
+static constexpr u64 wake_event_epoll_tag = NumericLimits<u64>::max();
+static constexpr u64 timer_epoll_tag = NumericLimits<u64>::max() - 1;
+
+NODISCARD ALWAYS_INLINE static FileDescriptorWatcherID encode_watcher_id(u32 watcher_index, u32 generation)
+{
+    return (static_cast<u64>(generation) << 32) | static_cast<u64>(watcher_index);
+}
+
+NODISCARD ALWAYS_INLINE static u32 get_watcher_index(FileDescriptorWatcherID watcher_id)
+{
+    return static_cast<u32>(watcher_id & 0xFFFFFFFF);
+}
+
+NODISCARD ALWAYS_INLINE static u32 get_watcher_generation(FileDescriptorWatcherID watcher_id)
+{
+    return static_cast<u32>(watcher_id >> 32);
+}
+
+// NOTE: Both the event and the timer file descriptors report a 64-bit counter, which must be read
+//       in order to reset their readiness.
+static void drain_counter_file_descriptor(int file_descriptor)
+{
+    u64 counter_value;
+    MAYBE_UNUSED const ssize_t result = read(file_descriptor, &counter_value, sizeof(counter_value));
+}
+#endif // AT_PLATFORM_LINUX
+
+EventLoop::EventLoop()
+    : m_timer_wheel(monotonic_time_in_milliseconds())
+{
+#if AT_PLATFORM_LINUX
+    m_epoll_file_descriptor = epoll_create1(EPOLL_CLOEXEC);
+    VERIFY(m_epoll_file_descriptor >= 0);
+
+    m_wake_event_file_descriptor = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    VERIFY(m_wake_event_file_descriptor >= 0);
+
+    m_timer_file_descriptor = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    VERIFY(m_timer_file_descriptor >= 0);
+
+    epoll_event wake_event = {};
+    wake_event.events = EPOLLIN;
+    wake_event.data.u64 = wake_event_epoll_tag;
+    VERIFY(epoll_ctl(m_epoll_file_descriptor, EPOLL_CTL_ADD, m_wake_event_file_descriptor, &wake_event) == 0);
+
+    epoll_event timer_event = {};
+    timer_event.events = EPOLLIN;
+    timer_event.data.u64 = timer_epoll_tag;
+    VERIFY(epoll_ctl(m_epoll_file_descriptor, EPOLL_CTL_ADD, m_timer_file_descriptor, &timer_event) == 0);
+
+    m_ready_events = new epoll_event[max_event_count_per_batch];
+    m_ready_watcher_ids = Vector<FileDescriptorWatcherID>::from_initial_capacity(max_event_count_per_batch);
+#endif // AT_PLATFORM_LINUX
+}
+
+EventLoop::~EventLoop()
+{
+#if AT_PLATFORM_LINUX
+    delete[] m_ready_events;
+    close(m_timer_file_descriptor);
+    close(m_wake_event_file_descriptor);
+    close(m_epoll_file_descriptor);
+#endif // AT_PLATFORM_LINUX
+}
+
+void EventLoop::deferred_invoke(Job job)
+{
+    bool should_wake_up;
+    {
+        std::lock_guard lock(m_mutex);
+        // NOTE: If there already are pending jobs, the event loop has already been woken up.
+        should_wake_up = m_pending_jobs.is_empty();
+        m_pending_jobs.add(job);
+    }
+
+    if (should_wake_up)
+        wake_up();
+}
+
+TimerID EventLoop::deferred_invoke_after(u64 delay_in_milliseconds, Job job)
+{
+    // NOTE: Round the deadline up to the next tick, so the timer never expires before the delay elapsed.
+    const u64 deadline_in_nanoseconds = monotonic_time_in_nanoseconds() + delay_in_milliseconds * nanoseconds_per_millisecond;
+    const u64 deadline_tick = (deadline_in_nanoseconds + nanoseconds_per_millisecond - 1) / nanoseconds_per_millisecond;
+
+    std::lock_guard lock(m_mutex);
+    const TimerID timer_id = m_timer_wheel.insert(deadline_tick, job);
+    arm_next_timer_deadline();
+    return timer_id;
+}
+
+bool EventLoop::cancel_timer(TimerID timer_id)
+{
+    std::lock_guard lock(m_mutex);
+    // NOTE: The platform timer is intentionally left armed. Waking up once for nothing is cheaper than
+    //       reprogramming the timer on every cancellation, as most timers (debounces, for example) are
+    //       cancelled and re-armed in quick succession.
+    return m_timer_wheel.cancel(timer_id);
+}
+
+#if AT_PLATFORM_LINUX
+FileDescriptorWatcherID EventLoop::watch_file_descriptor(int file_descriptor, FileDescriptorEvents events, Job job)
+{
+    u32 watcher_index;
+    if (m_free_watcher_indices.has_elements()) {
+        watcher_index = m_free_watcher_indices[m_free_watcher_indices.count() - 1];
+        m_free_watcher_indices.remove_last();
+    }
+    else {
+        watcher_index = static_cast<u32>(m_watchers.count());
+        m_watchers.add(FileDescriptorWatcher());
+    }
+
+    FileDescriptorWatcher& watcher = m_watchers[watcher_index];
+    watcher.file_descriptor = file_descriptor;
+    watcher.job = job;
+    watcher.is_active = true;
+    const FileDescriptorWatcherID watcher_id = encode_watcher_id(watcher_index, watcher.generation);
+
+    epoll_event watcher_event = {};
+    if (static_cast<u8>(events) & static_cast<u8>(FileDescriptorEvents::Readable))
+        watcher_event.events |= EPOLLIN;
+    if (static_cast<u8>(events) & static_cast<u8>(FileDescriptorEvents::Writable))
+        watcher_event.events |= EPOLLOUT;
+    watcher_event.data.u64 = watcher_id;
+    VERIFY(epoll_ctl(m_epoll_file_descriptor, EPOLL_CTL_ADD, file_descriptor, &watcher_event) == 0);
+
+    return watcher_id;
+}
+
+void EventLoop::unwatch_file_descriptor(FileDescriptorWatcherID watcher_id)
+{
+    const u32 watcher_index = get_watcher_index(watcher_id);
+    VERIFY(watcher_index < m_watchers.count());
+    FileDescriptorWatcher& watcher = m_watchers[watcher_index];
+    VERIFY(watcher.is_active && watcher.generation == get_watcher_generation(watcher_id));
+
+    epoll_ctl(m_epoll_file_descriptor, EPOLL_CTL_DEL, watcher.file_descriptor, nullptr);
+    watcher.file_descriptor = -1;
+    watcher.is_active = false;
+    ++watcher.generation;
+    m_free_watcher_indices.add(watcher_index);
+}
+#endif // AT_PLATFORM_LINUX
+
+void EventLoop::run()
+{
+    while (true) {
+        {
+            std::lock_guard lock(m_mutex);
+            if (m_should_quit) {
+                m_should_quit = false;
+                return;
+            }
+        }
+        pump(true);
+    }
+}
+
+void EventLoop::pump(bool wait_for_events)
+{
+    wait_for_platform_events(wait_for_events);
+
+    {
+        std::lock_guard lock(m_mutex);
+
+        // NOTE: Move all the expired timers in the processing batch, in the order of their deadlines.
+        const u64 current_tick = monotonic_time_in_milliseconds();
+        m_timer_wheel.advance(current_tick, m_processing_jobs);
+
+        // NOTE: The platform timer is a one-shot timer, so it has to be programmed again after it fired.
+        if (m_armed_timer_tick != 0 && m_armed_timer_tick <= current_tick)
+            m_armed_timer_tick = 0;
+        arm_next_timer_deadline();
+
+        for (usize job_index = 0; job_index < m_pending_jobs.count(); ++job_index)
+            m_processing_jobs.add(m_pending_jobs[job_index]);
+        m_pending_jobs.clear();
+    }
+
+    // NOTE: The jobs are invoked without holding the lock, as they are allowed to schedule other jobs.
+    //       The batches keep their capacity, so the steady state doesn't allocate memory.
+#if AT_PLATFORM_LINUX
+    for (usize ready_index = 0; ready_index < m_ready_watcher_ids.count(); ++ready_index) {
+        const FileDescriptorWatcherID watcher_id = m_ready_watcher_ids[ready_index];
+        const FileDescriptorWatcher& watcher = m_watchers[get_watcher_index(watcher_id)];
+
+        // NOTE: The watcher might have been removed by a job invoked earlier in this batch.
+        if (!watcher.is_active || watcher.generation != get_watcher_generation(watcher_id))
+            continue;
+
+        const Job watcher_job = watcher.job;
+        watcher_job.invoke();
+    }
+    m_ready_watcher_ids.clear();
+#endif // AT_PLATFORM_LINUX
+
+    for (usize job_index = 0; job_index < m_processing_jobs.count(); ++job_index)
+        m_processing_jobs[job_index].invoke();
+    m_processing_jobs.clear();
+}
+
+void EventLoop::quit()
+{
+    {
+        std::lock_guard lock(m_mutex);
+        m_should_quit = true;
+    }
+    wake_up();
+}
+
+void EventLoop::wake_up()
+{
+#if AT_PLATFORM_LINUX
+    const u64 increment = 1;
+    MAYBE_UNUSED const ssize_t result = write(m_wake_event_file_descriptor, &increment, sizeof(increment));
+#else
+    m_wake_condition.notify_one();
+#endif // AT_PLATFORM_LINUX
+}
+
+void EventLoop::arm_next_timer_deadline()
+{
+    const Optional<u64> next_tick = m_timer_wheel.next_expiration_tick();
+    // NOTE: Only reprogram the platform timer when it would otherwise fire too late.
+    if (!next_tick.has_value() || (m_armed_timer_tick != 0 && m_armed_timer_tick <= next_tick.value()))
+        return;
+    m_armed_timer_tick = next_tick.value();
+
+#if AT_PLATFORM_LINUX
+    const u64 next_deadline = m_armed_timer_tick * nanoseconds_per_millisecond;
+    itimerspec timer_specification = {};
+    timer_specification.it_value.tv_sec = static_cast<time_t>(next_deadline / 1000000000);
+    timer_specification.it_value.tv_nsec = static_cast<long>(next_deadline % 1000000000);
+    timerfd_settime(m_timer_file_descriptor, TFD_TIMER_ABSTIME, &timer_specification, nullptr);
+#else
+    m_wake_condition.notify_one();
+#endif // AT_PLATFORM_LINUX
+}
+
+void EventLoop::wait_for_platform_events(bool wait_for_events)
+{
+#if AT_PLATFORM_LINUX
+    int timeout_in_milliseconds = -1;
+    {
+        std::lock_guard lock(m_mutex);
+        if (!wait_for_events || m_pending_jobs.has_elements() || m_should_quit)
+            timeout_in_milliseconds = 0;
+    }
+
+    // NOTE: The timers are handled by the kernel through the timer file descriptor, so the loop can
+    //       block indefinitely and will still be woken up precisely when the next timer expires.
+    const int ready_event_count = epoll_wait(m_epoll_file_descriptor, m_ready_events, max_event_count_per_batch, timeout_in_milliseconds);
+    if (ready_event_count < 0) {
+        VERIFY(errno == EINTR);
+        return;
+    }
+
+    for (int event_index = 0; event_index < ready_event_count; ++event_index) {
+        const u64 event_tag = m_ready_events[event_index].data.u64;
+        if (event_tag == wake_event_epoll_tag)
+            drain_counter_file_descriptor(m_wake_event_file_descriptor);
+        else if (event_tag == timer_epoll_tag)
+            drain_counter_file_descriptor(m_timer_file_descriptor);
+        else
+            m_ready_watcher_ids.add(event_tag);
+    }
+#else
+    std::unique_lock lock(m_mutex);
+    while (wait_for_events && m_pending_jobs.is_empty() && !m_should_quit) {
+        const u64 current_tick = monotonic_time_in_milliseconds();
+        const Optional<u64> next_tick = m_timer_wheel.next_expiration_tick();
+        if (next_tick.has_value()) {
+            if (next_tick.value() <= current_tick)
+                break;
+            m_wake_condition.wait_for(lock, std::chrono::milliseconds(next_tick.value() - current_tick));
+        }
+        else {
+            m_wake_condition.wait(lock);
+        }
+    }
+#endif // AT_PLATFORM_LINUX
+}
+
+} // namespace Core
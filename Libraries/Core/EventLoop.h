@@ -0,0 +1,130 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#pragma once
+
+#include <AT/Vector.h>
+#include <Core/API.h>
+#include <Core/Job.h>
+#include <Core/TimerWheel.h>
+
+// NOTE: Headers from the standard library.
+#include <mutex>
+#if !AT_PLATFORM_LINUX
+    #include <condition_variable>
+#endif // !AT_PLATFORM_LINUX
+
+#if AT_PLATFORM_LINUX
+// Forward declaration.
+struct epoll_event;
+#endif // AT_PLATFORM_LINUX
+
+namespace Core {
+
+#if AT_PLATFORM_LINUX
+enum class FileDescriptorEvents : u8 {
+    Readable = 1 << 0,
+    Writable = 1 << 1,
+    ReadableAndWritable = Readable | Writable,
+};
+
+// NOTE: Encodes both the slot of the watcher and its generation, so a stale identifier
+//       can never refer to a watcher that reused the same slot.
+using FileDescriptorWatcherID = u64;
+#endif // AT_PLATFORM_LINUX
+
+class EventLoop {
+    AT_MAKE_NONCOPYABLE(EventLoop);
+    AT_MAKE_NONMOVABLE(EventLoop);
+
+public:
+    // NOTE: The maximum number of kernel events that are collected by a single pump of the loop.
+    static constexpr u32 max_event_count_per_batch = 64;
+
+public:
+    CORE_API EventLoop();
+    CORE_API ~EventLoop();
+
+public:
+    // Schedules the job to be invoked by the thread that runs the event loop.
+    // This function is thread-safe.
+    CORE_API void deferred_invoke(Job job);
+
+    // Schedules the job to be invoked by the thread that runs the event loop, after the given delay expires.
+    // The returned identifier can be used to cancel the timer before it expires. This function is thread-safe.
+    CORE_API TimerID deferred_invoke_after(u64 delay_in_milliseconds, Job job);
+
+    // Returns whether the timer was cancelled before it expired. This function is thread-safe.
+    CORE_API bool cancel_timer(TimerID timer_id);
+
+#if AT_PLATFORM_LINUX
+    // Invokes the job every time the file descriptor reports any of the requested events. The watcher is
+    // level-triggered, so the job keeps being invoked for as long as the condition holds.
+    // This function must only be called by the thread that runs the event loop.
+    NODISCARD CORE_API FileDescriptorWatcherID watch_file_descriptor(int file_descriptor, FileDescriptorEvents events, Job job);
+
+    // NOTE: It is safe to unwatch a file descriptor from within any job, including the job of the watcher itself.
+    CORE_API void unwatch_file_descriptor(FileDescriptorWatcherID watcher_id);
+#endif // AT_PLATFORM_LINUX
+
+    // Processes events until EventLoop::quit() is called.
+    CORE_API void run();
+
+    // Processes a single batch of events. If no events are ready and `wait_for_events` is set, the calling
+    // thread is blocked until at least one event becomes available.
+    CORE_API void pump(bool wait_for_events);
+
+    // Requests the event loop to stop. This function is thread-safe.
+    CORE_API void quit();
+
+private:
+#if AT_PLATFORM_LINUX
+    struct FileDescriptorWatcher {
+        int file_descriptor { -1 };
+        u32 generation { 0 };
+        Job job;
+        bool is_active { false };
+    };
+#endif // AT_PLATFORM_LINUX
+
+private:
+    // Wakes up the thread that runs the event loop, if it is blocked waiting for events.
+    void wake_up();
+
+    // Programs the platform timer to fire at the tick when the timer wheel has work to do next.
+    // The mutex must be locked by the calling thread.
+    void arm_next_timer_deadline();
+
+    // Blocks until at least one event is available, or the platform reports a timer expiration.
+    // Returns without blocking if `wait_for_events` is not set.
+    void wait_for_platform_events(bool wait_for_events);
+
+private:
+    std::mutex m_mutex;
+
+    Vector<Job> m_pending_jobs;
+    Vector<Job> m_processing_jobs;
+
+    // NOTE: The ticks of the timer wheel are milliseconds of the monotonic clock.
+    TimerWheel m_timer_wheel;
+    u64 m_armed_timer_tick { 0 };
+
+    bool m_should_quit { false };
+
+#if AT_PLATFORM_LINUX
+    int m_epoll_file_descriptor { -1 };
+    int m_wake_event_file_descriptor { -1 };
+    int m_timer_file_descriptor { -1 };
+    epoll_event* m_ready_events { nullptr };
+
+    Vector<FileDescriptorWatcher> m_watchers;
+    Vector<u32> m_free_watcher_indices;
+    Vector<FileDescriptorWatcherID> m_ready_watcher_ids;
+#else
+    std::condition_variable m_wake_condition;
+#endif // AT_PLATFORM_LINUX
+};
+
+} // namespace Core
@@ -0,0 +1,967 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#include <AT/BitOperations.h>
+#include <AT/MemoryOperations.h>
+#include <AT/NumericLimits.h>
+#include <Core/JSON.h>
+
+#if AT_SIMD_SSE2
+    #include <emmintrin.h>
+#endif // AT_SIMD_SSE2
+
+// NOTE: Headers from the standard library.
+#include <charconv>
+#include <limits>
+
+namespace Core {
+
+static constexpr u32 tape_tag_shift = 56;
+static constexpr u64 tape_payload_mask = (static_cast<u64>(1) << tape_tag_shift) - 1;
+static constexpr u64 tape_index_mask = 0xFFFFFFFF;
+
+// NOTE: Set in the payload of a string whose characters are stored in the document, because it contained escape
+//       sequences, and in the payload of a number that has neither a fractional part nor an exponent.
+static constexpr u64 tape_flag_bit = static_cast<u64>(1) << 32;
+
+// NOTE: The element count of arrays and objects is stored in 24 bits. Larger containers are counted when queried.
+static constexpr u32 tape_count_shift = 32;
+static constexpr u64 tape_max_stored_count = 0xFFFFFF;
+
+NODISCARD ALWAYS_INLINE static u64 make_tape_word(JSONTapeTag tag, u64 payload)
+{
+    return (static_cast<u64>(tag) << tape_tag_shift) | payload;
+}
+
+NODISCARD ALWAYS_INLINE static JSONTapeTag get_tape_tag(u64 word)
+{
+    return static_cast<JSONTapeTag>(word >> tape_tag_shift);
+}
+
+//
+// Stage one: structural indexing.
+//
+// The input is processed in blocks of 64 bytes, and each byte class of interest is represented as a 64-bit mask
+// with one bit per byte. Using only bitwise operations on these masks, the parser determines which quotes are
+// escaped, which bytes are inside strings and where each token starts, without any branch that depends on the
+// contents of the input. The output is the list of offsets of all the structural characters, opening quotes and
+// starts of scalar values (numbers, true, false and null).
+//
+
+struct BlockMasks {
+    u64 quote;
+    u64 backslash;
+    u64 operators;
+    u64 whitespace;
+    u64 control;
+    u64 non_ascii;
+};
+
+static constexpr usize block_byte_count = 64;
+
+static void classify_block(const u8* block, BlockMasks& masks)
+{
+#if AT_SIMD_SSE2
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i backslash = _mm_set1_epi8('\\');
+    const __m128i opening_bracket = _mm_set1_epi8('{');
+    const __m128i closing_bracket = _mm_set1_epi8('}');
+    const __m128i colon = _mm_set1_epi8(':');
+    const __m128i comma = _mm_set1_epi8(',');
+    const __m128i space = _mm_set1_epi8(' ');
+    const __m128i tab = _mm_set1_epi8('\t');
+    const __m128i line_feed = _mm_set1_epi8('\n');
+    const __m128i carriage_return = _mm_set1_epi8('\r');
+    const __m128i lowercase_bit = _mm_set1_epi8(0x20);
+    const __m128i max_control = _mm_set1_epi8(0x1F);
+
+    masks = {};
+    for (u32 lane = 0; lane < 4; ++lane) {
+        const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + lane * 16));
+        const u32 shift = lane * 16;
+
+        // NOTE: '[' and ']' differ from '{' and '}' only by the 0x20 bit, so both pairs are matched at once.
+        const __m128i lowercase_bytes = _mm_or_si128(bytes, lowercase_bit);
+        const __m128i operators = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(lowercase_bytes, opening_bracket), _mm_cmpeq_epi8(lowercase_bytes, closing_bracket)),
+            _mm_or_si128(_mm_cmpeq_epi8(bytes, colon), _mm_cmpeq_epi8(bytes, comma))
+        );
+        const __m128i whitespace = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(bytes, space), _mm_cmpeq_epi8(bytes, tab)),
+            _mm_or_si128(_mm_cmpeq_epi8(bytes, line_feed), _mm_cmpeq_epi8(bytes, carriage_return))
+        );
+        const __m128i control = _mm_cmpeq_epi8(_mm_min_epu8(bytes, max_control), bytes);
+
+        masks.quote |= static_cast<u64>(static_cast<u32>(_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, quote)))) << shift;
+        masks.backslash |= static_cast<u64>(static_cast<u32>(_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, backslash)))) << shift;
+        masks.operators |= static_cast<u64>(static_cast<u32>(_mm_movemask_epi8(operators))) << shift;
+        masks.whitespace |= static_cast<u64>(static_cast<u32>(_mm_movemask_epi8(whitespace))) << shift;
+        masks.control |= static_cast<u64>(static_cast<u32>(_mm_movemask_epi8(control))) << shift;
+        masks.non_ascii |= static_cast<u64>(static_cast<u32>(_mm_movemask_epi8(bytes))) << shift;
+    }
+#else
+    masks = {};
+    for (u32 byte_index = 0; byte_index < block_byte_count; ++byte_index) {
+        const u8 byte = block[byte_index];
+        const u64 bit = static_cast<u64>(1) << byte_index;
+
+        if (byte == '"')
+            masks.quote |= bit;
+        else if (byte == '\\')
+            masks.backslash |= bit;
+        else if (byte == '{' || byte == '}' || byte == '[' || byte == ']' || byte == ':' || byte == ',')
+            masks.operators |= bit;
+
+        if (byte == ' ' || byte == '\t' || byte == '\n' || byte == '\r')
+            masks.whitespace |= bit;
+        if (byte <= 0x1F)
+            masks.control |= bit;
+        if (byte >= 0x80)
+            masks.non_ascii |= bit;
+    }
+#endif // AT_SIMD_SSE2
+}
+
+// Returns the mask of the characters that are escaped by a backslash. A backslash that is itself escaped doesn't
+// escape the next character, so the runs of consecutive backslashes have to be split by the parity of their length.
+NODISCARD ALWAYS_INLINE static u64 find_escaped_characters(u64 backslash, u64& previous_block_escaped)
+{
+    static constexpr u64 even_bits = 0x5555555555555555;
+
+    backslash &= ~previous_block_escaped;
+    const u64 follows_escape = (backslash << 1) | previous_block_escaped;
+
+    // NOTE: Adding the starts of the runs that begin on odd bits to the backslash mask carries through each such
+    //       run, which reveals the parity of the run length in the bit that follows it.
+    const u64 odd_sequence_starts = backslash & ~even_bits & ~follows_escape;
+    const u64 sequences_starting_on_even_bits = odd_sequence_starts + backslash;
+    previous_block_escaped = (sequences_starting_on_even_bits < backslash) ? 1 : 0;
+
+    const u64 invert_mask = sequences_starting_on_even_bits << 1;
+    return (even_bits ^ invert_mask) & follows_escape;
+}
+
+// Each bit of the result is the exclusive-or of all the bits of the value up to (and including) its position.
+NODISCARD ALWAYS_INLINE static u64 prefix_xor(u64 value)
+{
+    value ^= value << 1;
+    value ^= value << 2;
+    value ^= value << 4;
+    value ^= value << 8;
+    value ^= value << 16;
+    value ^= value << 32;
+    return value;
+}
+
+// The part of a UTF-8 sequence that is still expected when a block ends in the middle of it.
+struct UTF8ValidationState {
+    u8 remaining_byte_count { 0 };
+    // NOTE: The range of the next continuation byte, which is narrower than [0x80, 0xBF] right after some lead bytes
+    //       in order to reject overlong encodings, surrogates and code points beyond the Unicode range.
+    u8 next_byte_min { 0x80 };
+    u8 next_byte_max { 0xBF };
+};
+
+// Validates the UTF-8 encoding of a block, continuing a sequence that the previous block ended in the middle of.
+// Only the non-ASCII bytes can start a sequence, so the ASCII text between them is skipped by using the mask.
+NODISCARD static bool validate_utf8_block(const u8* block, u64 non_ascii, UTF8ValidationState& state)
+{
+    usize offset = 0;
+    while (true) {
+        while (state.remaining_byte_count > 0) {
+            if (offset == block_byte_count)
+                return true;
+            const u8 continuation_byte = block[offset++];
+            if (continuation_byte < state.next_byte_min || continuation_byte > state.next_byte_max)
+                return false;
+            state.next_byte_min = 0x80;
+            state.next_byte_max = 0xBF;
+            --state.remaining_byte_count;
+        }
+
+        const u64 remaining_non_ascii = (offset < block_byte_count) ? (non_ascii & (~static_cast<u64>(0) << offset)) : 0;
+        if (remaining_non_ascii == 0)
+            return true;
+        offset = count_trailing_zeroes(remaining_non_ascii);
+
+        const u8 lead_byte = block[offset++];
+        if (lead_byte >= 0xC2 && lead_byte <= 0xDF) {
+            state.remaining_byte_count = 1;
+        }
+        else if (lead_byte >= 0xE0 && lead_byte <= 0xEF) {
+            state.remaining_byte_count = 2;
+            if (lead_byte == 0xE0)
+                state.next_byte_min = 0xA0;
+            else if (lead_byte == 0xED)
+                state.next_byte_max = 0x9F;
+        }
+        else if (lead_byte >= 0xF0 && lead_byte <= 0xF4) {
+            state.remaining_byte_count = 3;
+            if (lead_byte == 0xF0)
+                state.next_byte_min = 0x90;
+            else if (lead_byte == 0xF4)
+                state.next_byte_max = 0x8F;
+        }
+        else {
+            // NOTE: A continuation byte without a lead byte, or a lead byte that can only start an overlong encoding
+            //       or a code point beyond the Unicode range.
+            return false;
+        }
+    }
+}
+
+NODISCARD static bool find_structural_indices(ReadonlyByteSpan input, Vector<u32>& structural_indices)
+{
+    u64 previous_block_escaped = 0;
+    u64 previous_block_in_string = 0;
+    u64 previous_block_scalar = 0;
+    UTF8ValidationState utf8_state;
+
+    for (usize block_offset = 0; block_offset < input.count(); block_offset += block_byte_count) {
+        // NOTE: The last block is padded with whitespace, which never produces any structural index.
+        const u8* block = input.elements() + block_offset;
+        u8 padded_block[block_byte_count];
+        if (input.count() - block_offset < block_byte_count) {
+            set_memory(padded_block, ' ', block_byte_count);
+            copy_memory(padded_block, block, input.count() - block_offset);
+            block = padded_block;
+        }
+
+        BlockMasks masks;
+        classify_block(block, masks);
+
+        // NOTE: The UTF-8 encoding is only validated in the blocks that contain a non-ASCII byte, or that continue a
+        //       sequence from the previous block.
+        if ((masks.non_ascii | utf8_state.remaining_byte_count) != 0 && !validate_utf8_block(block, masks.non_ascii, utf8_state))
+            return false;
+
+        const u64 escaped = find_escaped_characters(masks.backslash, previous_block_escaped);
+        const u64 quotes = masks.quote & ~escaped;
+
+        // NOTE: The mask includes the opening quote of each string, but not the closing one.
+        const u64 in_string = prefix_xor(quotes) ^ previous_block_in_string;
+        previous_block_in_string = static_cast<u64>(static_cast<s64>(in_string) >> 63);
+
+        // NOTE: Control characters must always be escaped inside strings.
+        if (masks.control & in_string)
+            return false;
+
+        // NOTE: Any byte outside of strings that is not whitespace, an operator or a quote belongs to a scalar.
+        const u64 scalar = ~(masks.operators | masks.whitespace | masks.quote | in_string);
+        const u64 scalar_starts = scalar & ~((scalar << 1) | previous_block_scalar);
+        previous_block_scalar = scalar >> 63;
+
+        u64 structurals = (masks.operators & ~in_string) | (quotes & in_string) | scalar_starts;
+        while (structurals != 0) {
+            structural_indices.add(static_cast<u32>(block_offset + count_trailing_zeroes(structurals)));
+            structurals &= structurals - 1;
+        }
+    }
+
+    // NOTE: The input ended inside of a string.
+    if (previous_block_in_string != 0)
+        return false;
+
+    // NOTE: The input ended in the middle of a UTF-8 sequence.
+    if (utf8_state.remaining_byte_count != 0)
+        return false;
+
+    return true;
+}
+
+//
+// Stage two: building the tape.
+//
+// The structural indices are visited in order, by a state machine that validates the grammar and emits the
+// tape words. Only the scalar values and the strings are inspected byte by byte.
+//
+
+class JSONParser {
+public:
+    JSONParser(JSONDocument& document, ReadonlyByteSpan input, const Vector<u32>& structural_indices)
+        : m_document(document)
+        , m_input(input)
+        , m_structural_indices(structural_indices)
+    {}
+
+    NODISCARD bool parse();
+
+private:
+    struct OpenContainer {
+        u32 tape_index;
+        u32 element_count;
+        bool is_object;
+    };
+
+    NODISCARD ALWAYS_INLINE bool has_next_structural() const { return m_next_structural < m_structural_indices.count(); }
+    NODISCARD ALWAYS_INLINE u32 next_structural() { return m_structural_indices[m_next_structural++]; }
+
+    NODISCARD ALWAYS_INLINE bool is_scalar_boundary(usize offset) const
+    {
+        if (offset >= m_input.count())
+            return true;
+        const u8 byte = m_input[offset];
+        return byte == ' ' || byte == '\t' || byte == '\n' || byte == '\r' || byte == ',' || byte == ':' || byte == ']' || byte == '}' ||
+               byte == '[' || byte == '{' || byte == '"';
+    }
+
+    NODISCARD bool parse_literal(u32 offset, StringView literal, JSONTapeTag tag);
+    NODISCARD bool parse_number(u32 offset);
+    NODISCARD bool parse_string(u32 offset);
+    NODISCARD bool unescape_string(u32 content_offset, u32 escape_offset);
+
+    void open_container(bool is_object);
+    void close_container();
+
+    void append_unescaped_bytes(const void* bytes, usize byte_count);
+
+private:
+    JSONDocument& m_document;
+    ReadonlyByteSpan m_input;
+    const Vector<u32>& m_structural_indices;
+    usize m_next_structural { 0 };
+    Vector<OpenContainer> m_open_containers;
+    usize m_unescaped_byte_count { 0 };
+};
+
+bool JSONParser::parse()
+{
+    enum class State : u8 {
+        Value,
+        AfterValue,
+        ObjectKey,
+    };
+
+    State state = State::Value;
+
+    while (true) {
+        switch (state) {
+            case State::Value: {
+                if (!has_next_structural())
+                    return false;
+                const u32 offset = next_structural();
+
+                switch (m_input[offset]) {
+                    case '{':
+                    case '[': {
+                        const bool is_object = (m_input[offset] == '{');
+                        if (m_open_containers.count() >= JSONDocument::max_depth)
+                            return false;
+                        open_container(is_object);
+
+                        // NOTE: Empty containers are closed right away.
+                        if (has_next_structural() && m_input[m_structural_indices[m_next_structural]] == (is_object ? '}' : ']')) {
+                            ++m_next_structural;
+                            close_container();
+                            state = State::AfterValue;
+                        }
+                        else {
+                            state = is_object ? State::ObjectKey : State::Value;
+                        }
+                        continue;
+                    }
+                    case '"':
+                        if (!parse_string(offset))
+                            return false;
+                        break;
+                    case 't':
+                        if (!parse_literal(offset, "true"sv, JSONTapeTag::True))
+                            return false;
+                        break;
+                    case 'f':
+                        if (!parse_literal(offset, "false"sv, JSONTapeTag::False))
+                            return false;
+                        break;
+                    case 'n':
+                        if (!parse_literal(offset, "null"sv, JSONTapeTag::Null))
+                            return false;
+                        break;
+                    default:
+                        if (!parse_number(offset))
+                            return false;
+                        break;
+                }
+
+                state = State::AfterValue;
+                continue;
+            }
+
+            case State::AfterValue: {
+                if (!m_open_containers.has_elements()) {
+                    // NOTE: Nothing can follow the root value.
+                    return !has_next_structural();
+                }
+                if (!has_next_structural())
+                    return false;
+
+                OpenContainer& container = m_open_containers[m_open_containers.count() - 1];
+                ++container.element_count;
+
+                const u8 separator = m_input[next_structural()];
+                if (separator == ',') {
+                    state = container.is_object ? State::ObjectKey : State::Value;
+                    continue;
+                }
+                if (separator != (container.is_object ? '}' : ']'))
+                    return false;
+
+                close_container();
+                continue;
+            }
+
+            case State::ObjectKey: {
+                if (!has_next_structural())
+                    return false;
+                const u32 offset = next_structural();
+                if (m_input[offset] != '"' || !parse_string(offset))
+                    return false;
+
+                if (!has_next_structural() || m_input[next_structural()] != ':')
+                    return false;
+                state = State::Value;
+                continue;
+            }
+        }
+    }
+}
+
+bool JSONParser::parse_literal(u32 offset, StringView literal, JSONTapeTag tag)
+{
+    if (m_input.count() - offset < literal.byte_count())
+        return false;
+    for (usize byte_index = 0; byte_index < literal.byte_count(); ++byte_index) {
+        if (m_input[offset + byte_index] != static_cast<u8>(literal.characters()[byte_index]))
+            return false;
+    }
+    if (!is_scalar_boundary(offset + literal.byte_count()))
+        return false;
+
+    m_document.m_tape.add(make_tape_word(tag, 0));
+    return true;
+}
+
+bool JSONParser::parse_number(u32 offset)
+{
+    usize end_offset = offset;
+    const auto is_digit = [&](usize byte_offset) { return byte_offset < m_input.count() && m_input[byte_offset] >= '0' && m_input[byte_offset] <= '9'; };
+
+    if (end_offset < m_input.count() && m_input[end_offset] == '-')
+        ++end_offset;
+
+    // NOTE: Leading zeros are not allowed, so the integer part is either a single zero or starts with a non-zero digit.
+    if (!is_digit(end_offset))
+        return false;
+    if (m_input[end_offset] == '0') {
+        ++end_offset;
+    }
+    else {
+        while (is_digit(end_offset))
+            ++end_offset;
+    }
+
+    bool is_integer = true;
+    if (end_offset < m_input.count() && m_input[end_offset] == '.') {
+        is_integer = false;
+        ++end_offset;
+        if (!is_digit(end_offset))
+            return false;
+        while (is_digit(end_offset))
+            ++end_offset;
+    }
+
+    if (end_offset < m_input.count() && (m_input[end_offset] == 'e' || m_input[end_offset] == 'E')) {
+        is_integer = false;
+        ++end_offset;
+        if (end_offset < m_input.count() && (m_input[end_offset] == '+' || m_input[end_offset] == '-'))
+            ++end_offset;
+        if (!is_digit(end_offset))
+            return false;
+        while (is_digit(end_offset))
+            ++end_offset;
+    }
+
+    if (!is_scalar_boundary(end_offset))
+        return false;
+
+    m_document.m_tape.add(make_tape_word(JSONTapeTag::Number, offset | (is_integer ? tape_flag_bit : 0)));
+    m_document.m_tape.add(end_offset - offset);
+    return true;
+}
+
+bool JSONParser::parse_string(u32 offset)
+{
+    const u32 content_offset = offset + 1;
+    usize scan_offset = content_offset;
+
+    // NOTE: Strings without escape sequences are referenced in place. The stage one guarantees that the string
+    //       is terminated, so the scan always finds either the closing quote or a backslash.
+#if AT_SIMD_SSE2
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i backslash = _mm_set1_epi8('\\');
+    while (scan_offset + 16 <= m_input.count()) {
+        const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(m_input.elements() + scan_offset));
+        const u32 mask = static_cast<u32>(_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(bytes, quote), _mm_cmpeq_epi8(bytes, backslash))));
+        if (mask != 0) {
+            scan_offset += count_trailing_zeroes(mask);
+            break;
+        }
+        scan_offset += 16;
+    }
+#endif // AT_SIMD_SSE2
+    while (scan_offset < m_input.count() && m_input[scan_offset] != '"' && m_input[scan_offset] != '\\')
+        ++scan_offset;
+    VERIFY(scan_offset < m_input.count());
+
+    if (m_input[scan_offset] == '"') {
+        m_document.m_tape.add(make_tape_word(JSONTapeTag::String, content_offset));
+        m_document.m_tape.add(scan_offset - content_offset);
+        return true;
+    }
+
+    const usize unescaped_offset = m_unescaped_byte_count;
+    if (!unescape_string(content_offset, static_cast<u32>(scan_offset)))
+        return false;
+
+    m_document.m_tape.add(make_tape_word(JSONTapeTag::String, unescaped_offset | tape_flag_bit));
+    m_document.m_tape.add(m_unescaped_byte_count - unescaped_offset);
+    return true;
+}
+
+NODISCARD static Optional<u32> parse_hexadecimal_code_unit(ReadonlyByteSpan input, usize offset)
+{
+    if (input.count() - offset < 4)
+        return {};
+
+    u32 code_unit = 0;
+    for (usize digit_index = 0; digit_index < 4; ++digit_index) {
+        const u8 digit = input[offset + digit_index];
+        code_unit <<= 4;
+        if (digit >= '0' && digit <= '9')
+            code_unit |= digit - '0';
+        else if (digit >= 'a' && digit <= 'f')
+            code_unit |= digit - 'a' + 10;
+        else if (digit >= 'A' && digit <= 'F')
+            code_unit |= digit - 'A' + 10;
+        else
+            return {};
+    }
+    return code_unit;
+}
+
+bool JSONParser::unescape_string(u32 content_offset, u32 escape_offset)
+{
+    // NOTE: Copy the bytes that precede the first escape sequence.
+    append_unescaped_bytes(m_input.elements() + content_offset, escape_offset - content_offset);
+
+    usize offset = escape_offset;
+    while (true) {
+        VERIFY(offset < m_input.count());
+        const u8 byte = m_input[offset];
+
+        if (byte == '"')
+            return true;
+        if (byte != '\\') {
+            usize run_end_offset = offset + 1;
+            while (run_end_offset < m_input.count() && m_input[run_end_offset] != '"' && m_input[run_end_offset] != '\\')
+                ++run_end_offset;
+            append_unescaped_bytes(m_input.elements() + offset, run_end_offset - offset);
+            offset = run_end_offset;
+            continue;
+        }
+
+        if (offset + 1 >= m_input.count())
+            return false;
+        const u8 escaped_byte = m_input[offset + 1];
+        offset += 2;
+
+        u8 unescaped_byte;
+        switch (escaped_byte) {
+            case '"': unescaped_byte = '"'; break;
+            case '\\': unescaped_byte = '\\'; break;
+            case '/': unescaped_byte = '/'; break;
+            case 'b': unescaped_byte = '\b'; break;
+            case 'f': unescaped_byte = '\f'; break;
+            case 'n': unescaped_byte = '\n'; break;
+            case 'r': unescaped_byte = '\r'; break;
+            case 't': unescaped_byte = '\t'; break;
+            case 'u': {
+                const Optional<u32> code_unit = parse_hexadecimal_code_unit(m_input, offset);
+                if (!code_unit.has_value())
+                    return false;
+                offset += 4;
+
+                u32 code_point = code_unit.value();
+                if (code_point >= 0xDC00 && code_point <= 0xDFFF)
+                    return false;
+                if (code_point >= 0xD800 && code_point <= 0xDBFF) {
+                    // NOTE: A high surrogate must be immediately followed by an escaped low surrogate.
+                    if (m_input.count() - offset < 2 || m_input[offset] != '\\' || m_input[offset + 1] != 'u')
+                        return false;
+                    const Optional<u32> low_surrogate = parse_hexadecimal_code_unit(m_input, offset + 2);
+                    if (!low_surrogate.has_value() || low_surrogate.value() < 0xDC00 || low_surrogate.value() > 0xDFFF)
+                        return false;
+                    offset += 6;
+                    code_point = 0x10000 + ((code_point - 0xD800) << 10) + (low_surrogate.value() - 0xDC00);
+                }
+
+                u8 encoded_bytes[4];
+                usize encoded_byte_count;
+                if (code_point < 0x80) {
+                    encoded_bytes[0] = static_cast<u8>(code_point);
+                    encoded_byte_count = 1;
+                }
+                else if (code_point < 0x800) {
+                    encoded_bytes[0] = static_cast<u8>(0xC0 | (code_point >> 6));
+                    encoded_bytes[1] = static_cast<u8>(0x80 | (code_point & 0x3F));
+                    encoded_byte_count = 2;
+                }
+                else if (code_point < 0x10000) {
+                    encoded_bytes[0] = static_cast<u8>(0xE0 | (code_point >> 12));
+                    encoded_bytes[1] = static_cast<u8>(0x80 | ((code_point >> 6) & 0x3F));
+                    encoded_bytes[2] = static_cast<u8>(0x80 | (code_point & 0x3F));
+                    encoded_byte_count = 3;
+                }
+                else {
+                    encoded_bytes[0] = static_cast<u8>(0xF0 | (code_point >> 18));
+                    encoded_bytes[1] = static_cast<u8>(0x80 | ((code_point >> 12) & 0x3F));
+                    encoded_bytes[2] = static_cast<u8>(0x80 | ((code_point >> 6) & 0x3F));
+                    encoded_bytes[3] = static_cast<u8>(0x80 | (code_point & 0x3F));
+                    encoded_byte_count = 4;
+                }
+                append_unescaped_bytes(encoded_bytes, encoded_byte_count);
+                continue;
+            }
+            default: return false;
+        }
+
+        append_unescaped_bytes(&unescaped_byte, 1);
+    }
+}
+
+void JSONParser::open_container(bool is_object)
+{
+    OpenContainer container;
+    container.tape_index = static_cast<u32>(m_document.m_tape.count());
+    container.element_count = 0;
+    container.is_object = is_object;
+    m_open_containers.add(container);
+
+    // NOTE: The start word is patched when the container is closed.
+    m_document.m_tape.add(0);
+}
+
+void JSONParser::close_container()
+{
+    const OpenContainer container = m_open_containers[m_open_containers.count() - 1];
+    m_open_containers.remove_last();
+
+    Vector<u64>& tape = m_document.m_tape;
+    const u64 end_index = tape.count();
+    const u64 stored_count = (container.element_count < tape_max_stored_count) ? container.element_count : tape_max_stored_count;
+
+    tape[container.tape_index] =
+        make_tape_word(container.is_object ? JSONTapeTag::ObjectStart : JSONTapeTag::ArrayStart, (stored_count << tape_count_shift) | end_index);
+    tape.add(make_tape_word(container.is_object ? JSONTapeTag::ObjectEnd : JSONTapeTag::ArrayEnd, container.tape_index));
+}
+
+void JSONParser::append_unescaped_bytes(const void* bytes, usize byte_count)
+{
+    ByteBuffer& buffer = m_document.m_unescaped_strings;
+    if (m_unescaped_byte_count + byte_count > buffer.byte_count()) {
+        usize new_byte_count = 2 * buffer.byte_count();
+        if (new_byte_count < m_unescaped_byte_count + byte_count)
+            new_byte_count = m_unescaped_byte_count + byte_count;
+        if (new_byte_count < 256)
+            new_byte_count = 256;
+        buffer.expand(new_byte_count);
+    }
+
+    copy_memory(buffer.bytes() + m_unescaped_byte_count, bytes, byte_count);
+    m_unescaped_byte_count += byte_count;
+}
+
+Optional<JSONDocument> JSONDocument::parse(ReadonlyByteSpan input)
+{
+    if (input.count() > NumericLimits<u32>::max())
+        return {};
+
+    // NOTE: Most JSON documents have one structural character every few bytes.
+    Vector<u32> structural_indices = Vector<u32>::from_initial_capacity(input.count() / 4 + 16);
+    if (!find_structural_indices(input, structural_indices))
+        return {};
+
+    JSONDocument document;
+    document.m_input = input;
+    // NOTE: Each structural index produces at most two tape words, so the tape never has to grow.
+    document.m_tape = Vector<u64>::from_initial_capacity(2 * structural_indices.count() + 1);
+
+    JSONParser parser(document, input, structural_indices);
+    if (!parser.parse())
+        return {};
+    return move(document);
+}
+
+JSONDocument::JSONDocument() = default;
+JSONDocument::~JSONDocument() = default;
+
+JSONDocument::JSONDocument(JSONDocument&& other) noexcept = default;
+JSONDocument& JSONDocument::operator=(JSONDocument&& other) noexcept = default;
+
+StringView JSONDocument::string_at(u32 tape_index) const
+{
+    const u64 word = m_tape[tape_index];
+    const u32 offset = static_cast<u32>(word & tape_index_mask);
+    const usize byte_count = static_cast<usize>(m_tape[tape_index + 1]);
+
+    const ReadonlyBytes bytes = (word & tape_flag_bit) ? m_unescaped_strings.bytes() : m_input.elements();
+    return StringView::from_utf8(reinterpret_cast<const char*>(bytes + offset), byte_count);
+}
+
+StringView JSONDocument::number_text_at(u32 tape_index) const
+{
+    const u32 offset = static_cast<u32>(m_tape[tape_index] & tape_index_mask);
+    const usize byte_count = static_cast<usize>(m_tape[tape_index + 1]);
+    return StringView::from_utf8(reinterpret_cast<const char*>(m_input.elements() + offset), byte_count);
+}
+
+u32 JSONDocument::next_value_index(u32 tape_index) const
+{
+    const u64 word = m_tape[tape_index];
+    switch (get_tape_tag(word)) {
+        case JSONTapeTag::Null:
+        case JSONTapeTag::True:
+        case JSONTapeTag::False: return tape_index + 1;
+        case JSONTapeTag::Number:
+        case JSONTapeTag::String: return tape_index + 2;
+        case JSONTapeTag::ArrayStart:
+        case JSONTapeTag::ObjectStart: return static_cast<u32>(word & tape_index_mask) + 1;
+        case JSONTapeTag::ArrayEnd:
+        case JSONTapeTag::ObjectEnd: break;
+    }
+
+    VERIFY_NOT_REACHED();
+    return tape_index;
+}
+
+JSONValue JSONArrayIterator::operator*() const
+{
+    return JSONValue(m_document, m_tape_index);
+}
+
+JSONArrayIterator& JSONArrayIterator::operator++()
+{
+    m_tape_index = m_document->next_value_index(m_tape_index);
+    return *this;
+}
+
+JSONObjectIterator& JSONObjectIterator::operator++()
+{
+    // NOTE: Skip over the key string and then over the value.
+    m_tape_index = m_document->next_value_index(m_tape_index + 2);
+    return *this;
+}
+
+StringView JSONObjectIterator::key() const
+{
+    return m_document->string_at(m_tape_index);
+}
+
+JSONValue JSONObjectIterator::value() const
+{
+    return JSONValue(m_document, m_tape_index + 2);
+}
+
+JSONType JSONValue::type() const
+{
+    switch (get_tape_tag(m_document->m_tape[m_tape_index])) {
+        case JSONTapeTag::Null: return JSONType::Null;
+        case JSONTapeTag::True:
+        case JSONTapeTag::False: return JSONType::Boolean;
+        case JSONTapeTag::Number: return JSONType::Number;
+        case JSONTapeTag::String: return JSONType::String;
+        case JSONTapeTag::ArrayStart: return JSONType::Array;
+        case JSONTapeTag::ObjectStart: return JSONType::Object;
+        case JSONTapeTag::ArrayEnd:
+        case JSONTapeTag::ObjectEnd: break;
+    }
+
+    VERIFY_NOT_REACHED();
+    return JSONType::Null;
+}
+
+Optional<bool> JSONValue::as_boolean() const
+{
+    const JSONTapeTag tag = get_tape_tag(m_document->m_tape[m_tape_index]);
+    if (tag == JSONTapeTag::True)
+        return true;
+    if (tag == JSONTapeTag::False)
+        return false;
+    return {};
+}
+
+Optional<StringView> JSONValue::as_string() const
+{
+    if (get_tape_tag(m_document->m_tape[m_tape_index]) != JSONTapeTag::String)
+        return {};
+    return m_document->string_at(m_tape_index);
+}
+
+Optional<s64> JSONValue::as_integer() const
+{
+    const u64 word = m_document->m_tape[m_tape_index];
+    if (get_tape_tag(word) != JSONTapeTag::Number || !(word & tape_flag_bit))
+        return {};
+
+    const StringView text = m_document->number_text_at(m_tape_index);
+    const bool is_negative = (text.characters()[0] == '-');
+
+    // NOTE: Accumulate the magnitude as an unsigned value, so that the most negative value can be represented.
+    u64 magnitude = 0;
+    for (usize digit_index = is_negative ? 1 : 0; digit_index < text.byte_count(); ++digit_index) {
+        const u64 digit = static_cast<u64>(text.characters()[digit_index] - '0');
+        if (magnitude > (NumericLimits<u64>::max() - digit) / 10)
+            return {};
+        magnitude = magnitude * 10 + digit;
+    }
+
+    const u64 max_magnitude = static_cast<u64>(NumericLimits<s64>::max()) + (is_negative ? 1 : 0);
+    if (magnitude > max_magnitude)
+        return {};
+    return is_negative ? static_cast<s64>(0 - magnitude) : static_cast<s64>(magnitude);
+}
+
+// Returns whether a number that doesn't fit in a double is too large to be represented, as opposed to too small.
+// The magnitude of the number is decided by the position of its first significant digit, which JSON numbers with an
+// integer part other than zero have at the start, and adjusted by the exponent.
+NODISCARD static bool is_out_of_range_number_too_large(StringView text)
+{
+    usize offset = (text.characters()[0] == '-') ? 1 : 0;
+    s64 decimal_exponent = 0;
+    if (text.characters()[offset] != '0') {
+        while (offset < text.byte_count() && text.characters()[offset] >= '0' && text.characters()[offset] <= '9') {
+            ++decimal_exponent;
+            ++offset;
+        }
+    }
+    else {
+        // NOTE: Skip the zero and the decimal point, and count the leading zeros of the fractional part.
+        ++offset;
+        if (offset < text.byte_count() && text.characters()[offset] == '.')
+            ++offset;
+        while (offset < text.byte_count() && text.characters()[offset] == '0') {
+            --decimal_exponent;
+            ++offset;
+        }
+    }
+
+    while (offset < text.byte_count() && text.characters()[offset] != 'e' && text.characters()[offset] != 'E')
+        ++offset;
+    if (offset == text.byte_count())
+        return decimal_exponent > 0;
+
+    ++offset;
+    const bool is_exponent_negative = (text.characters()[offset] == '-');
+    if (text.characters()[offset] == '-' || text.characters()[offset] == '+')
+        ++offset;
+
+    // NOTE: The exponent is saturated, because only its sign matters once it is larger than any number of digits.
+    static constexpr s64 max_exponent = 1'000'000'000'000;
+    s64 exponent = 0;
+    for (; offset < text.byte_count() && exponent < max_exponent; ++offset)
+        exponent = exponent * 10 + (text.characters()[offset] - '0');
+    decimal_exponent += is_exponent_negative ? -exponent : exponent;
+    return decimal_exponent > 0;
+}
+
+Optional<f64> JSONValue::as_floating_point() const
+{
+    if (get_tape_tag(m_document->m_tape[m_tape_index]) != JSONTapeTag::Number)
+        return {};
+
+    // NOTE: The standard library conversion is locale-independent and correctly rounded.
+    const StringView text = m_document->number_text_at(m_tape_index);
+    f64 value = 0;
+    const std::from_chars_result result = std::from_chars(text.characters(), text.characters() + text.byte_count(), value);
+    if (result.ec == std::errc())
+        return value;
+    if (result.ec != std::errc::result_out_of_range)
+        return {};
+
+    // NOTE: The conversion leaves the value unchanged when it is out of range, so the result is rounded as the
+    //       IEEE 754 conversion would, to an infinity or to a zero that keeps the sign of the number.
+    const bool is_negative = (text.characters()[0] == '-');
+    if (is_out_of_range_number_too_large(text))
+        return is_negative ? -std::numeric_limits<f64>::infinity() : std::numeric_limits<f64>::infinity();
+    return is_negative ? -0.0 : 0.0;
+}
+
+usize JSONValue::element_count() const
+{
+    const u64 word = m_document->m_tape[m_tape_index];
+    const JSONTapeTag tag = get_tape_tag(word);
+    VERIFY(tag == JSONTapeTag::ArrayStart || tag == JSONTapeTag::ObjectStart);
+
+    const u64 stored_count = (word & tape_payload_mask) >> tape_count_shift;
+    if (stored_count < tape_max_stored_count)
+        return static_cast<usize>(stored_count);
+
+    // NOTE: The count of very large containers doesn't fit in the tape word, so the elements are counted.
+    usize element_count = 0;
+    if (tag == JSONTapeTag::ArrayStart) {
+        for (MAYBE_UNUSED const JSONValue element : elements())
+            ++element_count;
+    }
+    else {
+        for (MAYBE_UNUSED const JSONObjectIterator& member : members())
+            ++element_count;
+    }
+    return element_count;
+}
+
+Optional<JSONValue> JSONValue::find(StringView key) const
+{
+    if (!is_object())
+        return {};
+
+    for (const JSONObjectIterator& member : members()) {
+        if (member.key() == key)
+            return member.value();
+    }
+    return {};
+}
+
+Optional<JSONValue> JSONValue::element_at(usize index) const
+{
+    if (!is_array())
+        return {};
+
+    usize element_index = 0;
+    for (const JSONValue element : elements()) {
+        if (element_index == index)
+            return element;
+        ++element_index;
+    }
+    return {};
+}
+
+JSONRange<JSONArrayIterator> JSONValue::elements() const
+{
+    const u64 word = m_document->m_tape[m_tape_index];
+    VERIFY(get_tape_tag(word) == JSONTapeTag::ArrayStart);
+
+    const u32 end_index = static_cast<u32>(word & tape_index_mask);
+    return JSONRange<JSONArrayIterator>(JSONArrayIterator(m_document, m_tape_index + 1), JSONArrayIterator(m_document, end_index));
+}
+
+JSONRange<JSONObjectIterator> JSONValue::members() const
+{
+    const u64 word = m_document->m_tape[m_tape_index];
+    VERIFY(get_tape_tag(word) == JSONTapeTag::ObjectStart);
+
+    const u32 end_index = static_cast<u32>(word & tape_index_mask);
+    return JSONRange<JSONObjectIterator>(JSONObjectIterator(m_document, m_tape_index + 1), JSONObjectIterator(m_document, end_index));
+}
+
+} // namespace Core
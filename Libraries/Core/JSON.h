@@ -0,0 +1,210 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#pragma once
+
+#include <AT/ByteBuffer.h>
+#include <AT/Optional.h>
+#include <AT/Span.h>
+#include <AT/StringView.h>
+#include <AT/Vector.h>
+#include <Core/API.h>
+
+namespace Core {
+
+// Forward declarations.
+class JSONDocument;
+class JSONValue;
+
+enum class JSONType : u8 {
+    Null,
+    Boolean,
+    Number,
+    String,
+    Array,
+    Object,
+};
+
+//
+// The document is stored as a tape, a flat array of 64-bit words in the order the values appear in the text:
+//   - Null, true and false take a single word.
+//   - Strings and numbers take two words, the offset and the byte count of their text. Numbers are only
+//     converted when they are accessed. Strings reference the input directly, unless they contain escape
+//     sequences, in which case they reference their unescaped copy stored in the document.
+//   - Arrays and objects take a word before their elements, which stores the element count and the index of
+//     the closing word, and a closing word after their elements. Object members are stored as the key string
+//     followed by the value.
+// This allows skipping over an entire array or object in constant time.
+//
+enum class JSONTapeTag : u8 {
+    Null = 'n',
+    True = 't',
+    False = 'f',
+    Number = '0',
+    String = '"',
+    ArrayStart = '[',
+    ArrayEnd = ']',
+    ObjectStart = '{',
+    ObjectEnd = '}',
+};
+
+class JSONArrayIterator {
+public:
+    ALWAYS_INLINE JSONArrayIterator(const JSONDocument* document, u32 tape_index)
+        : m_document(document)
+        , m_tape_index(tape_index)
+    {}
+
+    NODISCARD ALWAYS_INLINE bool operator==(const JSONArrayIterator& other) const { return (m_tape_index == other.m_tape_index); }
+    NODISCARD ALWAYS_INLINE bool operator!=(const JSONArrayIterator& other) const { return (m_tape_index != other.m_tape_index); }
+
+    NODISCARD CORE_API JSONValue operator*() const;
+    CORE_API JSONArrayIterator& operator++();
+
+private:
+    const JSONDocument* m_document;
+    u32 m_tape_index;
+};
+
+class JSONObjectIterator {
+public:
+    ALWAYS_INLINE JSONObjectIterator(const JSONDocument* document, u32 tape_index)
+        : m_document(document)
+        , m_tape_index(tape_index)
+    {}
+
+    NODISCARD ALWAYS_INLINE bool operator==(const JSONObjectIterator& other) const { return (m_tape_index == other.m_tape_index); }
+    NODISCARD ALWAYS_INLINE bool operator!=(const JSONObjectIterator& other) const { return (m_tape_index != other.m_tape_index); }
+
+    // NOTE: Dereferencing the iterator yields the iterator itself, so the key and the value of the member
+    //       can be accessed in range-based for loops.
+    NODISCARD ALWAYS_INLINE const JSONObjectIterator& operator*() const { return *this; }
+    CORE_API JSONObjectIterator& operator++();
+
+    NODISCARD CORE_API StringView key() const;
+    NODISCARD CORE_API JSONValue value() const;
+
+private:
+    const JSONDocument* m_document;
+    u32 m_tape_index;
+};
+
+template<typename IteratorType>
+class JSONRange {
+public:
+    ALWAYS_INLINE JSONRange(IteratorType begin_iterator, IteratorType end_iterator)
+        : m_begin(begin_iterator)
+        , m_end(end_iterator)
+    {}
+
+    NODISCARD ALWAYS_INLINE IteratorType begin() const { return m_begin; }
+    NODISCARD ALWAYS_INLINE IteratorType end() const { return m_end; }
+
+private:
+    IteratorType m_begin;
+    IteratorType m_end;
+};
+
+// Lightweight cursor into a parsed document, which is only valid for as long as the document is. Values are
+// decoded on demand, so the cost of accessing a value is only paid for the values that are actually used.
+class JSONValue {
+public:
+    ALWAYS_INLINE JSONValue(const JSONDocument* document, u32 tape_index)
+        : m_document(document)
+        , m_tape_index(tape_index)
+    {}
+
+public:
+    NODISCARD CORE_API JSONType type() const;
+
+    NODISCARD ALWAYS_INLINE bool is_null() const { return type() == JSONType::Null; }
+    NODISCARD ALWAYS_INLINE bool is_boolean() const { return type() == JSONType::Boolean; }
+    NODISCARD ALWAYS_INLINE bool is_number() const { return type() == JSONType::Number; }
+    NODISCARD ALWAYS_INLINE bool is_string() const { return type() == JSONType::String; }
+    NODISCARD ALWAYS_INLINE bool is_array() const { return type() == JSONType::Array; }
+    NODISCARD ALWAYS_INLINE bool is_object() const { return type() == JSONType::Object; }
+
+    NODISCARD CORE_API Optional<bool> as_boolean() const;
+
+    // NOTE: The returned view references either the input text or the document, so it remains
+    //       valid for as long as both of them are alive.
+    NODISCARD CORE_API Optional<StringView> as_string() const;
+
+    // Returns an empty optional if the value is not a number, has a fractional part or an exponent, or doesn't fit.
+    NODISCARD CORE_API Optional<s64> as_integer() const;
+
+    // Returns an empty optional if the value is not a number. Numbers that are too large to be represented are converted
+    // to an infinity, and numbers that are too small to a zero, both with the sign of the number.
+    NODISCARD CORE_API Optional<f64> as_floating_point() const;
+
+    // Returns the number of elements of an array or the number of members of an object.
+    NODISCARD CORE_API usize element_count() const;
+
+    // Returns the value of the first member with the given key. The members are searched linearly, but the values
+    // of the members are skipped in constant time, regardless of their size.
+    NODISCARD CORE_API Optional<JSONValue> find(StringView key) const;
+
+    // Returns the element at the given index of an array, if it exists. The elements are visited linearly.
+    NODISCARD CORE_API Optional<JSONValue> element_at(usize index) const;
+
+    // NOTE: The value must be an array.
+    NODISCARD CORE_API JSONRange<JSONArrayIterator> elements() const;
+
+    // NOTE: The value must be an object.
+    NODISCARD CORE_API JSONRange<JSONObjectIterator> members() const;
+
+private:
+    friend class JSONArrayIterator;
+    friend class JSONObjectIterator;
+
+    const JSONDocument* m_document;
+    u32 m_tape_index;
+};
+
+class JSONDocument {
+    AT_MAKE_NONCOPYABLE(JSONDocument);
+
+public:
+    // NOTE: The maximum nesting depth of arrays and objects. Deeper documents are rejected.
+    static constexpr u32 max_depth = 1024;
+
+    // Parses and validates the entire document, including its UTF-8 encoding. The input text is not copied,
+    // so it must outlive the document. Returns an empty optional if the text is not valid JSON.
+    // NOTE: Inputs larger than 4GiB are not supported.
+    NODISCARD CORE_API static Optional<JSONDocument> parse(ReadonlyByteSpan input);
+
+    NODISCARD ALWAYS_INLINE static Optional<JSONDocument> parse(StringView input) { return parse(input.byte_span()); }
+
+public:
+    CORE_API JSONDocument();
+    CORE_API ~JSONDocument();
+
+    CORE_API JSONDocument(JSONDocument&& other) noexcept;
+    CORE_API JSONDocument& operator=(JSONDocument&& other) noexcept;
+
+public:
+    NODISCARD ALWAYS_INLINE JSONValue root() const { return JSONValue(this, 0); }
+
+    NODISCARD ALWAYS_INLINE Span<const u64> tape() const { return Span<const u64>(m_tape.elements(), m_tape.count()); }
+
+private:
+    friend class JSONArrayIterator;
+    friend class JSONObjectIterator;
+    friend class JSONParser;
+    friend class JSONValue;
+
+    NODISCARD StringView string_at(u32 tape_index) const;
+    NODISCARD StringView number_text_at(u32 tape_index) const;
+
+    // Returns the tape index of the value that follows the value at the given index.
+    NODISCARD u32 next_value_index(u32 tape_index) const;
+
+private:
+    ReadonlyByteSpan m_input;
+    Vector<u64> m_tape;
+    ByteBuffer m_unescaped_strings;
+};
+
+} // namespace Core
@@ -0,0 +1,48 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#pragma once
+
+#include <AT/Assertions.h>
+#include <AT/Types.h>
+
+// NOTE: Headers from the standard library.
+#include <coroutine>
+
+namespace Core {
+
+// A unit of work that can be scheduled on an event loop or a thread pool. It is represented as a plain
+// function pointer and an opaque user data pointer, so scheduling work never requires a heap allocation.
+struct Job {
+    using FunctionType = void (*)(void* user_data);
+
+    NODISCARD ALWAYS_INLINE static Job from_function(FunctionType function, void* user_data)
+    {
+        Job job;
+        job.function = function;
+        job.user_data = user_data;
+        return job;
+    }
+
+    // NOTE: Invoking the returned job resumes the given coroutine on the invoking thread.
+    NODISCARD ALWAYS_INLINE static Job from_coroutine_handle(std::coroutine_handle<> handle)
+    {
+        Job job;
+        job.function = [](void* user_data) { std::coroutine_handle<>::from_address(user_data).resume(); };
+        job.user_data = handle.address();
+        return job;
+    }
+
+    ALWAYS_INLINE void invoke() const
+    {
+        VERIFY(function != nullptr);
+        function(user_data);
+    }
+
+    FunctionType function { nullptr };
+    void* user_data { nullptr };
+};
+
+} // namespace Core
@@ -0,0 +1,198 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#include <Core/ResourceCache.h>
+
+namespace Core {
+
+ResourceCacheBase::ResourceCacheBase(usize byte_budget)
+    : m_byte_budget(byte_budget)
+{}
+
+ResourceCacheBase::~ResourceCacheBase()
+{
+    clear();
+}
+
+void ResourceCacheBase::set_byte_budget(usize byte_budget)
+{
+    m_byte_budget = byte_budget;
+    evict_to_budget();
+}
+
+bool ResourceCacheBase::contains(const ResourceKey& key) const
+{
+    return find_entry_index(key) != invalid_entry_index;
+}
+
+bool ResourceCacheBase::pin(const ResourceKey& key)
+{
+    const u32 entry_index = find_entry_index(key);
+    if (entry_index == invalid_entry_index)
+        return false;
+
+    ++m_entries[entry_index].pin_count;
+    return true;
+}
+
+void ResourceCacheBase::unpin(const ResourceKey& key)
+{
+    const u32 entry_index = find_entry_index(key);
+    VERIFY(entry_index != invalid_entry_index);
+    VERIFY(m_entries[entry_index].pin_count > 0);
+    --m_entries[entry_index].pin_count;
+}
+
+void ResourceCacheBase::unpin_all()
+{
+    for (usize entry_index = 0; entry_index < m_entries.count(); ++entry_index)
+        m_entries[entry_index].pin_count = 0;
+
+    // NOTE: The entries that were kept alive by their pins can now be evicted.
+    evict_to_budget();
+}
+
+bool ResourceCacheBase::remove(const ResourceKey& key)
+{
+    const u32 entry_index = find_entry_index(key);
+    if (entry_index == invalid_entry_index)
+        return false;
+
+    remove_entry(entry_index);
+    return true;
+}
+
+void ResourceCacheBase::clear()
+{
+    for (usize entry_index = 0; entry_index < m_entries.count(); ++entry_index) {
+        if (m_entries[entry_index].resource != nullptr)
+            release_resource(m_entries[entry_index]);
+    }
+
+    m_entries.clear();
+    m_entry_indices.clear();
+    m_first_free_index = invalid_entry_index;
+    m_clock_hand = 0;
+    m_resident_byte_count = 0;
+}
+
+RefCounted* ResourceCacheBase::find_resource(const ResourceKey& key)
+{
+    const u32 entry_index = find_entry_index(key);
+    if (entry_index == invalid_entry_index) {
+        ++m_statistics.miss_count;
+        return nullptr;
+    }
+
+    Entry& entry = m_entries[entry_index];
+    entry.is_referenced = true;
+    ++m_statistics.hit_count;
+    return entry.resource;
+}
+
+void ResourceCacheBase::insert_resource(const ResourceKey& key, RefCounted* resource, usize byte_count)
+{
+    VERIFY(resource != nullptr);
+    ++m_statistics.insertion_count;
+
+    const u32 existing_entry_index = find_entry_index(key);
+    if (existing_entry_index != invalid_entry_index) {
+        // NOTE: Take the new reference before releasing the old one, in case both are the same resource.
+        Entry& entry = m_entries[existing_entry_index];
+        resource->increment_reference_count();
+        release_resource(entry);
+
+        m_resident_byte_count = m_resident_byte_count - entry.byte_count + byte_count;
+        entry.resource = resource;
+        entry.byte_count = byte_count;
+        entry.is_referenced = true;
+        evict_to_budget();
+        return;
+    }
+
+    u32 entry_index;
+    if (m_first_free_index != invalid_entry_index) {
+        entry_index = m_first_free_index;
+        m_first_free_index = m_entries[entry_index].next_free_index;
+    }
+    else {
+        entry_index = static_cast<u32>(m_entries.count());
+        m_entries.add({});
+    }
+
+    Entry& entry = m_entries[entry_index];
+    entry.key = key;
+    entry.resource = resource;
+    entry.byte_count = byte_count;
+    entry.pin_count = 0;
+    entry.is_referenced = true;
+    entry.next_free_index = invalid_entry_index;
+    resource->increment_reference_count();
+
+    m_entry_indices.set(key, entry_index);
+
+    m_resident_byte_count += byte_count;
+    evict_to_budget();
+}
+
+u32 ResourceCacheBase::find_entry_index(const ResourceKey& key) const
+{
+    const u32* entry_index = m_entry_indices.find(key);
+    return (entry_index != nullptr) ? *entry_index : invalid_entry_index;
+}
+
+void ResourceCacheBase::remove_entry(u32 entry_index)
+{
+    Entry& entry = m_entries[entry_index];
+    const bool was_removed = m_entry_indices.remove(entry.key);
+    VERIFY(was_removed);
+
+    m_resident_byte_count -= entry.byte_count;
+    release_resource(entry);
+
+    entry.byte_count = 0;
+    entry.pin_count = 0;
+    entry.is_referenced = false;
+    entry.next_free_index = m_first_free_index;
+    m_first_free_index = entry_index;
+}
+
+void ResourceCacheBase::release_resource(Entry& entry)
+{
+    RefCounted* resource = entry.resource;
+    entry.resource = nullptr;
+    if (resource->decrement_reference_count())
+        delete resource;
+}
+
+void ResourceCacheBase::evict_to_budget()
+{
+    // NOTE: Two full sweeps are enough to clear the referenced flag of every entry and then evict it. If nothing
+    //       was evicted by then, all the remaining entries are either pinned or in use.
+    const usize max_step_count = 2 * m_entries.count();
+    for (usize step_index = 0; step_index < max_step_count && m_resident_byte_count > m_byte_budget; ++step_index) {
+        if (m_clock_hand >= m_entries.count())
+            m_clock_hand = 0;
+
+        const u32 entry_index = static_cast<u32>(m_clock_hand++);
+        Entry& entry = m_entries[entry_index];
+        if (entry.resource == nullptr || entry.pin_count > 0)
+            continue;
+
+        // NOTE: The cache isn't the only owner of the resource, so evicting it wouldn't release its memory.
+        if (entry.resource->reference_count() > 1)
+            continue;
+
+        if (entry.is_referenced) {
+            entry.is_referenced = false;
+            continue;
+        }
+
+        remove_entry(entry_index);
+        ++m_statistics.eviction_count;
+    }
+}
+
+} // namespace Core
@@ -0,0 +1,161 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#pragma once
+
+#include <AT/Hash.h>
+#include <AT/IntegerHashMap.h>
+#include <AT/NumericLimits.h>
+#include <AT/RefPtr.h>
+#include <AT/Span.h>
+#include <AT/Vector.h>
+#include <Core/API.h>
+
+namespace Core {
+
+// NOTE: Resources are identified by the 128-bit hash of the content they were decoded from, so identical
+//       content requested from different places maps to the same entry.
+using ResourceKey = Hash128;
+
+struct ResourceCacheStatistics {
+    u64 hit_count { 0 };
+    u64 miss_count { 0 };
+    u64 insertion_count { 0 };
+    u64 eviction_count { 0 };
+};
+
+// Type-erased implementation of the resource cache. The entries are stored in a slab and indexed by an
+// open-addressed hash table. When the resident size exceeds the budget, the entries are evicted in CLOCK order,
+// which approximates LRU without touching any shared list on a cache hit.
+//
+// An entry is never evicted while it is pinned, or while it is referenced outside of the cache, as evicting it
+// wouldn't release any memory. If no entry can be evicted, the cache temporarily exceeds its budget.
+//
+// NOTE: The reference counts of the resources are not atomic, so a cache must only be used from a single thread.
+class ResourceCacheBase {
+    AT_MAKE_NONCOPYABLE(ResourceCacheBase);
+    AT_MAKE_NONMOVABLE(ResourceCacheBase);
+
+public:
+    CORE_API explicit ResourceCacheBase(usize byte_budget);
+    CORE_API ~ResourceCacheBase();
+
+public:
+    NODISCARD ALWAYS_INLINE usize byte_budget() const { return m_byte_budget; }
+    NODISCARD ALWAYS_INLINE usize resident_byte_count() const { return m_resident_byte_count; }
+    NODISCARD ALWAYS_INLINE usize entry_count() const { return m_entry_indices.count(); }
+    NODISCARD ALWAYS_INLINE const ResourceCacheStatistics& statistics() const { return m_statistics; }
+
+    ALWAYS_INLINE void reset_statistics() { m_statistics = {}; }
+
+    // NOTE: Shrinking the budget evicts entries immediately.
+    CORE_API void set_byte_budget(usize byte_budget);
+
+    NODISCARD CORE_API bool contains(const ResourceKey& key) const;
+
+    // Prevents the entry from being evicted, until it is unpinned. Pins are counted, so each call must be matched
+    // by a call to ResourceCacheBase::unpin(). Returns false if the entry doesn't exist.
+    CORE_API bool pin(const ResourceKey& key);
+    CORE_API void unpin(const ResourceKey& key);
+
+    // Releases all the pins, which is typically done at the end of the frame that used the pinned entries.
+    CORE_API void unpin_all();
+
+    // Removes the entry from the cache, even if it is pinned. The resource itself stays alive for as long as it
+    // is referenced elsewhere.
+    CORE_API bool remove(const ResourceKey& key);
+
+    CORE_API void clear();
+
+protected:
+    // NOTE: On a hit the returned resource is not yet referenced by the caller.
+    NODISCARD CORE_API RefCounted* find_resource(const ResourceKey& key);
+
+    // Stores a new reference to the resource. If an entry with the same key already exists, it is replaced.
+    CORE_API void insert_resource(const ResourceKey& key, RefCounted* resource, usize byte_count);
+
+private:
+    static constexpr u32 invalid_entry_index = NumericLimits<u32>::max();
+
+    struct Entry {
+        ResourceKey key {};
+        RefCounted* resource { nullptr };
+        usize byte_count { 0 };
+        u32 pin_count { 0 };
+        // NOTE: Set on every hit and cleared by the clock hand, which gives recently used entries a second chance.
+        bool is_referenced { false };
+        // NOTE: For free entries, this is the index of the next free entry.
+        u32 next_free_index { invalid_entry_index };
+    };
+
+private:
+    NODISCARD u32 find_entry_index(const ResourceKey& key) const;
+
+    void remove_entry(u32 entry_index);
+    void release_resource(Entry& entry);
+
+    // Evicts entries until the resident size fits in the budget, or until no more entries can be evicted.
+    void evict_to_budget();
+
+private:
+    usize m_byte_budget;
+    usize m_resident_byte_count { 0 };
+    ResourceCacheStatistics m_statistics;
+
+    Vector<Entry> m_entries;
+    u32 m_first_free_index { invalid_entry_index };
+    usize m_clock_hand { 0 };
+
+    // NOTE: Maps the key of each resident entry to its index in the entries.
+    IntegerHashMap<ResourceKey, u32> m_entry_indices;
+};
+
+// Cache of decoded resources of a single type, such as images, glyph atlases or parsed styles.
+template<typename T>
+requires (AT::is_derived_from<T, RefCounted>)
+class ResourceCache : public ResourceCacheBase {
+public:
+    ALWAYS_INLINE explicit ResourceCache(usize byte_budget)
+        : ResourceCacheBase(byte_budget)
+    {}
+
+public:
+    NODISCARD ALWAYS_INLINE static ResourceKey key_for_content(ReadonlyByteSpan content) { return hash_bytes_128(content); }
+
+    // Returns an invalid reference if the cache doesn't contain the resource.
+    NODISCARD ALWAYS_INLINE RefPtr<T> find(const ResourceKey& key)
+    {
+        RefCounted* resource = find_resource(key);
+        if (resource == nullptr)
+            return {};
+        return adopt_ref(static_cast<T*>(resource));
+    }
+
+    // NOTE: The byte count is the memory used by the resource, which is charged against the budget of the cache.
+    ALWAYS_INLINE void insert(const ResourceKey& key, RefPtr<T> resource, usize byte_count)
+    {
+        insert_resource(key, static_cast<RefCounted*>(resource.get()), byte_count);
+    }
+
+    // Returns the cached resource decoded from the content, or decodes it on a miss. The decoder is invoked as
+    // `RefPtr<T> decode(ReadonlyByteSpan content, usize& byte_count)`, and the resource is only cached if the
+    // returned reference is valid.
+    template<typename DecoderFunction>
+    NODISCARD ALWAYS_INLINE RefPtr<T> find_or_decode(ReadonlyByteSpan content, DecoderFunction decode)
+    {
+        const ResourceKey key = key_for_content(content);
+        RefPtr<T> resource = find(key);
+        if (resource.is_valid())
+            return resource;
+
+        usize byte_count = 0;
+        resource = decode(content, byte_count);
+        if (resource.is_valid())
+            insert(key, resource, byte_count);
+        return resource;
+    }
+};
+
+} // namespace Core
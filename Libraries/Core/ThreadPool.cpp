@@ -0,0 +1,65 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#include <Core/ThreadPool.h>
+
+namespace Core {
+
+ThreadPool::ThreadPool(u32 worker_count)
+{
+    if (worker_count == 0)
+        worker_count = std::thread::hardware_concurrency();
+    // NOTE: The hardware concurrency might not be computable on some platforms.
+    if (worker_count == 0)
+        worker_count = 1;
+
+    m_worker_count = worker_count;
+    m_workers = new std::thread[m_worker_count];
+    for (u32 worker_index = 0; worker_index < m_worker_count; ++worker_index)
+        m_workers[worker_index] = std::thread([this] { worker_main(); });
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard lock(m_jobs_mutex);
+        m_is_shutting_down = true;
+    }
+    m_jobs_condition.notify_all();
+
+    for (u32 worker_index = 0; worker_index < m_worker_count; ++worker_index)
+        m_workers[worker_index].join();
+    delete[] m_workers;
+}
+
+void ThreadPool::enqueue(Job job)
+{
+    {
+        std::lock_guard lock(m_jobs_mutex);
+        VERIFY(!m_is_shutting_down);
+        m_jobs.enqueue(job);
+    }
+    m_jobs_condition.notify_one();
+}
+
+void ThreadPool::worker_main()
+{
+    while (true) {
+        Job job;
+        {
+            std::unique_lock lock(m_jobs_mutex);
+            m_jobs_condition.wait(lock, [this] { return m_jobs.has_elements() || m_is_shutting_down; });
+
+            // NOTE: The remaining jobs are still executed when the pool is shutting down.
+            if (m_jobs.is_empty())
+                return;
+            job = m_jobs.dequeue();
+        }
+
+        job.invoke();
+    }
+}
+
+} // namespace Core
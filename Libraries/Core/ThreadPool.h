@@ -0,0 +1,52 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#pragma once
+
+#include <AT/CircularQueue.h>
+#include <Core/API.h>
+#include <Core/Job.h>
+
+// NOTE: Headers from the standard library.
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace Core {
+
+class ThreadPool {
+    AT_MAKE_NONCOPYABLE(ThreadPool);
+    AT_MAKE_NONMOVABLE(ThreadPool);
+
+public:
+    // NOTE: A worker count of zero creates one worker thread for each hardware thread.
+    CORE_API explicit ThreadPool(u32 worker_count = 0);
+
+    // NOTE: Blocks until all the jobs that were enqueued before destruction are executed.
+    CORE_API ~ThreadPool();
+
+public:
+    NODISCARD ALWAYS_INLINE u32 worker_count() const { return m_worker_count; }
+
+    // Schedules the job to be invoked by one of the worker threads. Jobs are started in the order they are
+    // enqueued, but because they run in parallel no guarantees are made about the order of completion.
+    // This function is thread-safe.
+    CORE_API void enqueue(Job job);
+
+private:
+    void worker_main();
+
+private:
+    // NOTE: The standard library types can't be stored in the AT containers, as the unqualified calls to `move`
+    //       become ambiguous because of argument-dependent lookup.
+    std::thread* m_workers { nullptr };
+    u32 m_worker_count { 0 };
+    std::mutex m_jobs_mutex;
+    std::condition_variable m_jobs_condition;
+    CircularQueue<Job> m_jobs;
+    bool m_is_shutting_down { false };
+};
+
+} // namespace Core
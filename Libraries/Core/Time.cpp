@@ -0,0 +1,37 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#include <Core/Time.h>
+
+#if AT_PLATFORM_WINDOWS
+    #define WIN32_LEAN_AND_MEAN
+    #define NOMINMAX
+    #include <Windows.h>
+#else
+    #include <time.h>
+#endif // AT_PLATFORM_WINDOWS
+
+namespace Core {
+
+u64 monotonic_time_in_nanoseconds()
+{
+#if AT_PLATFORM_WINDOWS
+    LARGE_INTEGER frequency;
+    LARGE_INTEGER counter;
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+
+    // NOTE: Split the conversion in order to avoid overflowing the 64-bit integer.
+    const u64 seconds = static_cast<u64>(counter.QuadPart) / static_cast<u64>(frequency.QuadPart);
+    const u64 remainder = static_cast<u64>(counter.QuadPart) % static_cast<u64>(frequency.QuadPart);
+    return (seconds * 1000000000) + (remainder * 1000000000) / static_cast<u64>(frequency.QuadPart);
+#else
+    timespec time_spec = {};
+    clock_gettime(CLOCK_MONOTONIC, &time_spec);
+    return (static_cast<u64>(time_spec.tv_sec) * 1000000000) + static_cast<u64>(time_spec.tv_nsec);
+#endif // AT_PLATFORM_WINDOWS
+}
+
+} // namespace Core
@@ -0,0 +1,24 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#pragma once
+
+#include <AT/Types.h>
+#include <Core/API.h>
+
+namespace Core {
+
+static constexpr u64 nanoseconds_per_millisecond = 1000 * 1000;
+
+// Returns the value of a monotonic clock, which is not affected by changes of the system time.
+// The reference point of the clock is unspecified, so only differences between values are meaningful.
+NODISCARD CORE_API u64 monotonic_time_in_nanoseconds();
+
+NODISCARD ALWAYS_INLINE u64 monotonic_time_in_milliseconds()
+{
+    return monotonic_time_in_nanoseconds() / nanoseconds_per_millisecond;
+}
+
+} // namespace Core
@@ -0,0 +1,238 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#include <AT/BitOperations.h>
+#include <AT/NumericLimits.h>
+#include <Core/TimerWheel.h>
+
+namespace Core {
+
+static constexpr u64 slot_index_mask = TimerWheel::slot_count_per_level - 1;
+
+TimerWheel::TimerWheel(u64 current_tick)
+    : m_next_tick(current_tick)
+{
+    for (usize bucket_index = 0; bucket_index < m_bucket_heads.count(); ++bucket_index)
+        m_bucket_heads[bucket_index] = invalid_index;
+    for (usize level = 0; level < level_count; ++level)
+        m_occupied_slot_masks[level] = 0;
+}
+
+TimerWheel::~TimerWheel() = default;
+
+TimerID TimerWheel::insert(u64 deadline_tick, Job job)
+{
+    u32 node_index;
+    if (m_free_node_indices.has_elements()) {
+        node_index = m_free_node_indices[m_free_node_indices.count() - 1];
+        m_free_node_indices.remove_last();
+    }
+    else {
+        node_index = static_cast<u32>(m_nodes.count());
+        m_nodes.add(TimerNode());
+    }
+
+    TimerNode& node = m_nodes[node_index];
+    node.deadline_tick = deadline_tick;
+    node.job = job;
+    place_timer(node_index);
+    ++m_timer_count;
+
+    return (static_cast<u64>(node.generation) << 32) | static_cast<u64>(node_index);
+}
+
+bool TimerWheel::cancel(TimerID timer_id)
+{
+    const u32 node_index = static_cast<u32>(timer_id & 0xFFFFFFFF);
+    const u32 generation = static_cast<u32>(timer_id >> 32);
+    if (node_index >= m_nodes.count())
+        return false;
+
+    const TimerNode& node = m_nodes[node_index];
+    if (node.generation != generation || node.bucket_index == invalid_index)
+        return false;
+
+    unlink_timer(node_index);
+    free_timer(node_index);
+    return true;
+}
+
+void TimerWheel::advance(u64 current_tick, Vector<Job>& expired_jobs)
+{
+    while (m_next_tick <= current_tick) {
+        if (m_timer_count == 0) {
+            m_next_tick = current_tick + 1;
+            return;
+        }
+
+        const u32 slot_index = static_cast<u32>(m_next_tick & slot_index_mask);
+        if (slot_index != 0 && m_occupied_slot_masks[0] == 0) {
+            // NOTE: Nothing can expire before the next cascade, so skip directly to it.
+            const u64 next_cascade_tick = (m_next_tick | slot_index_mask) + 1;
+            m_next_tick = (next_cascade_tick < current_tick + 1) ? next_cascade_tick : (current_tick + 1);
+            continue;
+        }
+
+        if (slot_index == 0)
+            cascade();
+
+        const u64 processed_tick = m_next_tick;
+        ++m_next_tick;
+
+        u32 node_index = detach_bucket(slot_index);
+        while (node_index != invalid_index) {
+            TimerNode& node = m_nodes[node_index];
+            const u32 next_node_index = node.next_index;
+            node.bucket_index = invalid_index;
+
+            // NOTE: Timers with a deadline beyond the range of the wheel are parked in the last level, and
+            //       thus can reach the first level before their deadline.
+            if (node.deadline_tick > processed_tick) {
+                place_timer(node_index);
+            }
+            else {
+                expired_jobs.add(node.job);
+                free_timer(node_index);
+            }
+
+            node_index = next_node_index;
+        }
+    }
+}
+
+Optional<u64> TimerWheel::next_expiration_tick() const
+{
+    if (m_timer_count == 0)
+        return {};
+
+    u64 next_tick = NumericLimits<u64>::max();
+    for (u32 level = 0; level < level_count; ++level) {
+        const u64 occupied_slot_mask = m_occupied_slot_masks[level];
+        if (occupied_slot_mask == 0)
+            continue;
+
+        // NOTE: The slots of the first level expire their timers, while the slots of the other levels are
+        //       cascaded when all the levels below them wrap around. In both cases, the slot is processed at
+        //       the first tick aligned to the granularity of the level whose level index matches the slot.
+        const u32 level_shift = level * bit_count_per_level;
+        const u64 level_tick_count = static_cast<u64>(1) << level_shift;
+        const u64 first_level_index = (m_next_tick + level_tick_count - 1) >> level_shift;
+
+        const u32 first_slot_index = static_cast<u32>(first_level_index & slot_index_mask);
+        const u32 slot_distance = count_trailing_zeroes(rotate_right(occupied_slot_mask, first_slot_index));
+
+        const u64 level_next_tick = (first_level_index + slot_distance) << level_shift;
+        if (level_next_tick < next_tick)
+            next_tick = level_next_tick;
+    }
+
+    return next_tick;
+}
+
+void TimerWheel::place_timer(u32 node_index)
+{
+    const TimerNode& node = m_nodes[node_index];
+
+    u64 placement_tick = node.deadline_tick;
+    if (placement_tick < m_next_tick)
+        placement_tick = m_next_tick;
+    if (placement_tick - m_next_tick > max_tick_delta)
+        placement_tick = m_next_tick + max_tick_delta;
+
+    // NOTE: The timer is placed in the first level whose range covers the distance to the deadline.
+    const u64 tick_delta = placement_tick - m_next_tick;
+    u32 level = 0;
+    while (level + 1 < level_count && (tick_delta >> (bit_count_per_level * (level + 1))) != 0)
+        ++level;
+
+    const u32 slot_index = static_cast<u32>((placement_tick >> (bit_count_per_level * level)) & slot_index_mask);
+    link_timer(node_index, level * slot_count_per_level + slot_index);
+}
+
+void TimerWheel::link_timer(u32 node_index, u32 bucket_index)
+{
+    TimerNode& node = m_nodes[node_index];
+    const u32 head_index = m_bucket_heads[bucket_index];
+
+    node.bucket_index = bucket_index;
+    node.previous_index = invalid_index;
+    node.next_index = head_index;
+    if (head_index != invalid_index)
+        m_nodes[head_index].previous_index = node_index;
+    m_bucket_heads[bucket_index] = node_index;
+
+    const u32 level = bucket_index / slot_count_per_level;
+    const u32 slot_index = bucket_index % slot_count_per_level;
+    m_occupied_slot_masks[level] |= static_cast<u64>(1) << slot_index;
+}
+
+void TimerWheel::unlink_timer(u32 node_index)
+{
+    TimerNode& node = m_nodes[node_index];
+    const u32 bucket_index = node.bucket_index;
+
+    if (node.previous_index != invalid_index)
+        m_nodes[node.previous_index].next_index = node.next_index;
+    else
+        m_bucket_heads[bucket_index] = node.next_index;
+
+    if (node.next_index != invalid_index)
+        m_nodes[node.next_index].previous_index = node.previous_index;
+
+    if (m_bucket_heads[bucket_index] == invalid_index) {
+        const u32 level = bucket_index / slot_count_per_level;
+        const u32 slot_index = bucket_index % slot_count_per_level;
+        m_occupied_slot_masks[level] &= ~(static_cast<u64>(1) << slot_index);
+    }
+
+    node.bucket_index = invalid_index;
+    node.previous_index = invalid_index;
+    node.next_index = invalid_index;
+}
+
+void TimerWheel::free_timer(u32 node_index)
+{
+    TimerNode& node = m_nodes[node_index];
+    // NOTE: Invalidates all the identifiers that refer to this slab slot.
+    ++node.generation;
+    node.job = {};
+    node.bucket_index = invalid_index;
+
+    m_free_node_indices.add(node_index);
+    --m_timer_count;
+}
+
+u32 TimerWheel::detach_bucket(u32 bucket_index)
+{
+    const u32 head_index = m_bucket_heads[bucket_index];
+    m_bucket_heads[bucket_index] = invalid_index;
+
+    const u32 level = bucket_index / slot_count_per_level;
+    const u32 slot_index = bucket_index % slot_count_per_level;
+    m_occupied_slot_masks[level] &= ~(static_cast<u64>(1) << slot_index);
+
+    return head_index;
+}
+
+void TimerWheel::cascade()
+{
+    for (u32 level = 1; level < level_count; ++level) {
+        const u32 slot_index = static_cast<u32>((m_next_tick >> (bit_count_per_level * level)) & slot_index_mask);
+
+        u32 node_index = detach_bucket(level * slot_count_per_level + slot_index);
+        while (node_index != invalid_index) {
+            const u32 next_node_index = m_nodes[node_index].next_index;
+            m_nodes[node_index].bucket_index = invalid_index;
+            place_timer(node_index);
+            node_index = next_node_index;
+        }
+
+        // NOTE: The next level is cascaded only when this level wraps around as well.
+        if (slot_index != 0)
+            break;
+    }
+}
+
+} // namespace Core
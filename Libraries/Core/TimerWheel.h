@@ -0,0 +1,96 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#pragma once
+
+#include <AT/Array.h>
+#include <AT/Optional.h>
+#include <AT/Vector.h>
+#include <Core/API.h>
+#include <Core/Job.h>
+
+namespace Core {
+
+// NOTE: Encodes both the slab slot of the timer and its generation, so a stale identifier
+//       can never cancel a timer that reused the same slot.
+using TimerID = u64;
+
+// Hierarchical timing wheel, as described by Varghese and Lauck. The timers are bucketed by their deadline
+// into a few levels of slots with increasingly coarse granularity, and the buckets of a level are cascaded
+// into the level below as the time advances. Both inserting and cancelling a timer are O(1).
+//
+// The timers live in a slab and the buckets are intrusive lists of slab indices, so once the slab reached
+// its peak size no memory is allocated, regardless of how many timers are armed and cancelled.
+class TimerWheel {
+    AT_MAKE_NONCOPYABLE(TimerWheel);
+    AT_MAKE_NONMOVABLE(TimerWheel);
+
+public:
+    static constexpr u32 bit_count_per_level = 6;
+    static constexpr u32 slot_count_per_level = 1 << bit_count_per_level;
+    static constexpr u32 level_count = 4;
+
+    // NOTE: Timers with a deadline further away than this are parked in the last level and re-inserted
+    //       once they reach it. With a tick of one millisecond this is about four and a half hours.
+    static constexpr u64 max_tick_delta = (static_cast<u64>(1) << (bit_count_per_level * level_count)) - 1;
+
+public:
+    CORE_API explicit TimerWheel(u64 current_tick);
+    CORE_API ~TimerWheel();
+
+public:
+    NODISCARD ALWAYS_INLINE u32 timer_count() const { return m_timer_count; }
+
+    // NOTE: A deadline that is already in the past expires on the next call to TimerWheel::advance().
+    CORE_API TimerID insert(u64 deadline_tick, Job job);
+
+    // Returns whether the timer was cancelled. Cancelling a timer that already expired (or that was
+    // already cancelled) does nothing and returns false.
+    CORE_API bool cancel(TimerID timer_id);
+
+    // Expires all timers with a deadline less than or equal to the given tick. The jobs of the expired
+    // timers are appended to the given vector, in the order of their deadlines.
+    CORE_API void advance(u64 current_tick, Vector<Job>& expired_jobs);
+
+    // Returns a lower bound of the tick at which the next call to TimerWheel::advance() has any work to do.
+    // Waiting until this tick never misses a timer, but might occasionally wake up only to cascade a bucket.
+    NODISCARD CORE_API Optional<u64> next_expiration_tick() const;
+
+private:
+    static constexpr u32 invalid_index = 0xFFFFFFFF;
+
+    struct TimerNode {
+        u64 deadline_tick { 0 };
+        Job job;
+        u32 previous_index { invalid_index };
+        u32 next_index { invalid_index };
+        u32 bucket_index { invalid_index };
+        u32 generation { 0 };
+    };
+
+private:
+    void place_timer(u32 node_index);
+    void link_timer(u32 node_index, u32 bucket_index);
+    void unlink_timer(u32 node_index);
+    void free_timer(u32 node_index);
+
+    // Detaches the whole list of the bucket and returns the index of its first timer.
+    NODISCARD u32 detach_bucket(u32 bucket_index);
+
+    void cascade();
+
+private:
+    Vector<TimerNode> m_nodes;
+    Vector<u32> m_free_node_indices;
+
+    Array<u32, slot_count_per_level * level_count> m_bucket_heads;
+    Array<u64, level_count> m_occupied_slot_masks;
+
+    // NOTE: The next tick that will be processed by TimerWheel::advance().
+    u64 m_next_tick;
+    u32 m_timer_count { 0 };
+};
+
+} // namespace Core
@@ -0,0 +1,18 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#pragma once
+
+#include <AT/APISpecifiers.h>
+
+#ifdef GRAPHICS_BUILD_SHARED_LIBRARY
+    #define GRAPHICS_API AT_API_SPECIFIER_EXPORT
+#else
+    #ifdef GRAPHICS_LINK_AS_SHARED_LIBRARY
+        #define GRAPHICS_API AT_API_SPECIFIER_IMPORT
+    #else
+        #define GRAPHICS_API
+    #endif // GRAPHICS_LINK_AS_SHARED_LIBRARY
+#endif // GRAPHICS_BUILD_SHARED_LIBRARY
@@ -0,0 +1,381 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#include <AT/NumericLimits.h>
+#include <Graphics/Bitmap.h>
+#include <Graphics/PixelOperations.h>
+#include <Graphics/RasterPipeline.h>
+
+#if AT_PLATFORM_WINDOWS
+    #define WIN32_LEAN_AND_MEAN
+    #define NOMINMAX
+    #include <Windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif // AT_PLATFORM_WINDOWS
+
+namespace Graphics {
+
+static void fill_row_32(WriteonlyBytes destination, usize pixel_count, u32 value)
+{
+    usize pixel_index = 0;
+#if AT_SIMD_SSE2
+    const __m128i pattern = _mm_set1_epi32(static_cast<int>(value));
+    for (; pixel_index + 16 <= pixel_count; pixel_index += 16) {
+        __m128i* chunk = reinterpret_cast<__m128i*>(destination + 4 * pixel_index);
+        _mm_storeu_si128(chunk + 0, pattern);
+        _mm_storeu_si128(chunk + 1, pattern);
+        _mm_storeu_si128(chunk + 2, pattern);
+        _mm_storeu_si128(chunk + 3, pattern);
+    }
+    for (; pixel_index + 4 <= pixel_count; pixel_index += 4)
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + 4 * pixel_index), pattern);
+#endif // AT_SIMD_SSE2
+    for (; pixel_index < pixel_count; ++pixel_index)
+        store_pixel(destination + 4 * pixel_index, value);
+}
+
+static void fill_row_8(WriteonlyBytes destination, usize pixel_count, u8 value)
+{
+    usize pixel_index = 0;
+#if AT_SIMD_SSE2
+    const __m128i pattern = _mm_set1_epi8(static_cast<char>(value));
+    for (; pixel_index + 16 <= pixel_count; pixel_index += 16)
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + pixel_index), pattern);
+#endif // AT_SIMD_SSE2
+    for (; pixel_index < pixel_count; ++pixel_index)
+        destination[pixel_index] = value;
+}
+
+static void copy_row(WriteonlyBytes destination, ReadonlyBytes source, usize byte_count)
+{
+    usize byte_offset = 0;
+#if AT_SIMD_SSE2
+    for (; byte_offset + 64 <= byte_count; byte_offset += 64) {
+        const __m128i* source_chunk = reinterpret_cast<const __m128i*>(source + byte_offset);
+        __m128i* destination_chunk = reinterpret_cast<__m128i*>(destination + byte_offset);
+        const __m128i chunk_0 = _mm_loadu_si128(source_chunk + 0);
+        const __m128i chunk_1 = _mm_loadu_si128(source_chunk + 1);
+        const __m128i chunk_2 = _mm_loadu_si128(source_chunk + 2);
+        const __m128i chunk_3 = _mm_loadu_si128(source_chunk + 3);
+        _mm_storeu_si128(destination_chunk + 0, chunk_0);
+        _mm_storeu_si128(destination_chunk + 1, chunk_1);
+        _mm_storeu_si128(destination_chunk + 2, chunk_2);
+        _mm_storeu_si128(destination_chunk + 3, chunk_3);
+    }
+    for (; byte_offset + 16 <= byte_count; byte_offset += 16)
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + byte_offset), _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + byte_offset)));
+#endif // AT_SIMD_SSE2
+    for (; byte_offset < byte_count; ++byte_offset)
+        destination[byte_offset] = source[byte_offset];
+}
+
+static void swap_red_and_blue_row(WriteonlyBytes destination, ReadonlyBytes source, usize pixel_count)
+{
+    usize pixel_index = 0;
+#if AT_SIMD_SSE2
+    for (; pixel_index + 4 <= pixel_count; pixel_index += 4) {
+        const __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + 4 * pixel_index));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + 4 * pixel_index), swap_red_and_blue_4(pixels));
+    }
+#endif // AT_SIMD_SSE2
+    for (; pixel_index < pixel_count; ++pixel_index)
+        store_pixel(destination + 4 * pixel_index, swap_red_and_blue(load_pixel(source + 4 * pixel_index)));
+}
+
+static void extract_alpha_row(WriteonlyBytes destination, ReadonlyBytes source, usize pixel_count)
+{
+    usize pixel_index = 0;
+#if AT_SIMD_SSE2
+    for (; pixel_index + 16 <= pixel_count; pixel_index += 16) {
+        const __m128i* source_chunk = reinterpret_cast<const __m128i*>(source + 4 * pixel_index);
+        const __m128i alpha_0 = _mm_srli_epi32(_mm_loadu_si128(source_chunk + 0), 24);
+        const __m128i alpha_1 = _mm_srli_epi32(_mm_loadu_si128(source_chunk + 1), 24);
+        const __m128i alpha_2 = _mm_srli_epi32(_mm_loadu_si128(source_chunk + 2), 24);
+        const __m128i alpha_3 = _mm_srli_epi32(_mm_loadu_si128(source_chunk + 3), 24);
+        const __m128i alpha = _mm_packus_epi16(_mm_packs_epi32(alpha_0, alpha_1), _mm_packs_epi32(alpha_2, alpha_3));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + pixel_index), alpha);
+    }
+#endif // AT_SIMD_SSE2
+    for (; pixel_index < pixel_count; ++pixel_index)
+        destination[pixel_index] = source[4 * pixel_index + 3];
+}
+
+static void expand_alpha_row(WriteonlyBytes destination, ReadonlyBytes source, usize pixel_count)
+{
+    usize pixel_index = 0;
+#if AT_SIMD_SSE2
+    const __m128i zero = _mm_setzero_si128();
+    for (; pixel_index + 16 <= pixel_count; pixel_index += 16) {
+        const __m128i alpha = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + pixel_index));
+        const __m128i alpha_low = _mm_unpacklo_epi8(zero, alpha);
+        const __m128i alpha_high = _mm_unpackhi_epi8(zero, alpha);
+
+        __m128i* destination_chunk = reinterpret_cast<__m128i*>(destination + 4 * pixel_index);
+        _mm_storeu_si128(destination_chunk + 0, _mm_unpacklo_epi16(zero, alpha_low));
+        _mm_storeu_si128(destination_chunk + 1, _mm_unpackhi_epi16(zero, alpha_low));
+        _mm_storeu_si128(destination_chunk + 2, _mm_unpacklo_epi16(zero, alpha_high));
+        _mm_storeu_si128(destination_chunk + 3, _mm_unpackhi_epi16(zero, alpha_high));
+    }
+#endif // AT_SIMD_SSE2
+    for (; pixel_index < pixel_count; ++pixel_index)
+        store_pixel(destination + 4 * pixel_index, static_cast<u32>(source[pixel_index]) << 24);
+}
+
+NODISCARD static bool are_dimensions_valid(u32 width, u32 height)
+{
+    return (width > 0) && (height > 0) && (width <= Bitmap::max_dimension) && (height <= Bitmap::max_dimension);
+}
+
+RefPtr<Bitmap> Bitmap::create(PixelFormat format, u32 width, u32 height)
+{
+    if (!are_dimensions_valid(width, height))
+        return {};
+
+    const usize stride = minimum_stride(format, width);
+    RefPtr<Bitmap> bitmap = adopt_ref(new Bitmap(format, width, height, stride, BitmapStorage::Heap));
+
+    // NOTE: The allocator only guarantees the alignment of fundamental types, so the buffer is over-allocated and
+    //       the pixels start at the first aligned address inside it.
+    bitmap->m_buffer = ByteBuffer::from_initial_byte_count(stride * height + stride_alignment - 1);
+    const uintptr buffer_address = reinterpret_cast<uintptr>(bitmap->m_buffer.bytes());
+    bitmap->m_pixels = bitmap->m_buffer.bytes() + (align_up(buffer_address, stride_alignment) - buffer_address);
+    bitmap->clear();
+    return bitmap;
+}
+
+RefPtr<Bitmap> Bitmap::create_shared(PixelFormat format, u32 width, u32 height)
+{
+    if (!are_dimensions_valid(width, height))
+        return {};
+
+    const usize stride = minimum_stride(format, width);
+    const usize byte_count = stride * height;
+
+#if AT_PLATFORM_WINDOWS
+    // NOTE: The pages of a pagefile-backed section are zeroed, so the pixels of the bitmap are already transparent.
+    const u64 section_byte_count = byte_count;
+    const HANDLE mapping_handle = CreateFileMappingA(
+        INVALID_HANDLE_VALUE,
+        nullptr,
+        PAGE_READWRITE,
+        static_cast<DWORD>(section_byte_count >> 32),
+        static_cast<DWORD>(section_byte_count & 0xFFFFFFFF),
+        nullptr
+    );
+    if (mapping_handle == nullptr)
+        return {};
+
+    void* mapping = MapViewOfFile(mapping_handle, FILE_MAP_READ | FILE_MAP_WRITE, 0, 0, byte_count);
+    if (mapping == nullptr) {
+        CloseHandle(mapping_handle);
+        return {};
+    }
+
+    RefPtr<Bitmap> bitmap = adopt_ref(new Bitmap(format, width, height, stride, BitmapStorage::SharedMemory));
+    bitmap->m_pixels = static_cast<ReadWriteBytes>(mapping);
+    bitmap->m_shared_memory_handle = mapping_handle;
+    return bitmap;
+#else
+    const int file_descriptor = memfd_create("Bitmap", MFD_CLOEXEC);
+    if (file_descriptor < 0)
+        return {};
+
+    // NOTE: The file is extended with zeroes, so the pixels of the bitmap are already transparent.
+    if (ftruncate(file_descriptor, static_cast<off_t>(byte_count)) != 0) {
+        close(file_descriptor);
+        return {};
+    }
+
+    void* mapping = mmap(nullptr, byte_count, PROT_READ | PROT_WRITE, MAP_SHARED, file_descriptor, 0);
+    if (mapping == MAP_FAILED) {
+        close(file_descriptor);
+        return {};
+    }
+
+    RefPtr<Bitmap> bitmap = adopt_ref(new Bitmap(format, width, height, stride, BitmapStorage::SharedMemory));
+    bitmap->m_pixels = static_cast<ReadWriteBytes>(mapping);
+    bitmap->m_shared_memory_handle = file_descriptor;
+    return bitmap;
+#endif // AT_PLATFORM_WINDOWS
+}
+
+RefPtr<Bitmap> Bitmap::create_from_shared_memory(SharedMemoryHandle handle, PixelFormat format, u32 width, u32 height, usize stride)
+{
+    if (!are_dimensions_valid(width, height) || stride < static_cast<usize>(width) * bytes_per_pixel(format))
+        return {};
+
+    // NOTE: The stride comes from another process, so the size of the pixels can overflow.
+    if (stride > NumericLimits<usize>::max() / height)
+        return {};
+    const usize byte_count = stride * height;
+
+#if AT_PLATFORM_WINDOWS
+    const HANDLE current_process = GetCurrentProcess();
+    HANDLE duplicated_handle = nullptr;
+    if (!DuplicateHandle(current_process, handle, current_process, &duplicated_handle, 0, FALSE, DUPLICATE_SAME_ACCESS))
+        return {};
+
+    // NOTE: Mapping a view that is larger than the section fails, so the pixels are never mapped past its end.
+    void* mapping = MapViewOfFile(duplicated_handle, FILE_MAP_READ | FILE_MAP_WRITE, 0, 0, byte_count);
+    if (mapping == nullptr) {
+        CloseHandle(duplicated_handle);
+        return {};
+    }
+
+    RefPtr<Bitmap> bitmap = adopt_ref(new Bitmap(format, width, height, stride, BitmapStorage::SharedMemory));
+    bitmap->m_pixels = static_cast<ReadWriteBytes>(mapping);
+    bitmap->m_shared_memory_handle = duplicated_handle;
+    return bitmap;
+#else
+    // NOTE: Accessing the pages of a mapping that lie past the end of the file raises SIGBUS, so the file must be
+    //       large enough to hold all the pixels.
+    struct stat file_status;
+    if (fstat(handle, &file_status) != 0 || file_status.st_size < 0 || static_cast<u64>(file_status.st_size) < byte_count)
+        return {};
+
+    const int duplicated_file_descriptor = fcntl(handle, F_DUPFD_CLOEXEC, 0);
+    if (duplicated_file_descriptor < 0)
+        return {};
+
+    void* mapping = mmap(nullptr, byte_count, PROT_READ | PROT_WRITE, MAP_SHARED, duplicated_file_descriptor, 0);
+    if (mapping == MAP_FAILED) {
+        close(duplicated_file_descriptor);
+        return {};
+    }
+
+    RefPtr<Bitmap> bitmap = adopt_ref(new Bitmap(format, width, height, stride, BitmapStorage::SharedMemory));
+    bitmap->m_pixels = static_cast<ReadWriteBytes>(mapping);
+    bitmap->m_shared_memory_handle = duplicated_file_descriptor;
+    return bitmap;
+#endif // AT_PLATFORM_WINDOWS
+}
+
+RefPtr<Bitmap> Bitmap::create_wrapper(PixelFormat format, u32 width, u32 height, usize stride, ReadWriteBytes pixels)
+{
+    if (!are_dimensions_valid(width, height) || stride < static_cast<usize>(width) * bytes_per_pixel(format) || pixels == nullptr)
+        return {};
+
+    RefPtr<Bitmap> bitmap = adopt_ref(new Bitmap(format, width, height, stride, BitmapStorage::External));
+    bitmap->m_pixels = pixels;
+    return bitmap;
+}
+
+Bitmap::Bitmap(PixelFormat format, u32 width, u32 height, usize stride, BitmapStorage storage)
+    : m_format(format)
+    , m_storage(storage)
+    , m_width(width)
+    , m_height(height)
+    , m_stride(stride)
+{}
+
+Bitmap::~Bitmap()
+{
+    if (m_storage == BitmapStorage::SharedMemory) {
+#if AT_PLATFORM_WINDOWS
+        UnmapViewOfFile(m_pixels);
+        CloseHandle(m_shared_memory_handle);
+#else
+        munmap(m_pixels, byte_count());
+        close(m_shared_memory_handle);
+#endif // AT_PLATFORM_WINDOWS
+    }
+}
+
+void Bitmap::fill_rect(const IntRect& rect, Color color)
+{
+    const IntRect clipped_rect = rect.intersected(this->rect());
+    if (clipped_rect.is_empty())
+        return;
+
+    const usize pixel_count = static_cast<usize>(clipped_rect.width);
+    if (m_format == PixelFormat::A8) {
+        for (s32 y = clipped_rect.top(); y < clipped_rect.bottom(); ++y)
+            fill_row_8(scanline(y) + clipped_rect.x, pixel_count, color.a);
+        return;
+    }
+
+    const u32 value = color_to_pixel(color, m_format);
+    for (s32 y = clipped_rect.top(); y < clipped_rect.bottom(); ++y)
+        fill_row_32(scanline(y) + 4 * static_cast<usize>(clipped_rect.x), pixel_count, value);
+}
+
+void Bitmap::blit(IntPoint position, const Bitmap& source, const IntRect& source_rect)
+{
+    VERIFY(&source != this);
+
+    IntPoint clipped_position = position;
+    IntRect clipped_source_rect = source_rect;
+    if (!clip_blit(clipped_position, source, clipped_source_rect))
+        return;
+
+    const usize pixel_count = static_cast<usize>(clipped_source_rect.width);
+    const usize source_bytes_per_pixel = bytes_per_pixel(source.m_format);
+    const usize destination_bytes_per_pixel = bytes_per_pixel(m_format);
+
+    for (s32 row_index = 0; row_index < clipped_source_rect.height; ++row_index) {
+        ReadonlyBytes source_row = source.scanline(clipped_source_rect.y + row_index) + source_bytes_per_pixel * clipped_source_rect.x;
+        WriteonlyBytes destination_row = scanline(clipped_position.y + row_index) + destination_bytes_per_pixel * clipped_position.x;
+
+        if (source.m_format == m_format)
+            copy_row(destination_row, source_row, pixel_count * destination_bytes_per_pixel);
+        else if (m_format == PixelFormat::A8)
+            extract_alpha_row(destination_row, source_row, pixel_count);
+        else if (source.m_format == PixelFormat::A8)
+            expand_alpha_row(destination_row, source_row, pixel_count);
+        else
+            swap_red_and_blue_row(destination_row, source_row, pixel_count);
+    }
+}
+
+void Bitmap::blit_with_opacity(IntPoint position, const Bitmap& source, const IntRect& source_rect, f32 opacity)
+{
+    VERIFY(&source != this);
+
+    if (!(opacity > 0.0F))
+        return;
+    const u8 opacity_8 = (opacity >= 1.0F) ? 255 : static_cast<u8>(opacity * 255.0F + 0.5F);
+
+    IntPoint clipped_position = position;
+    IntRect clipped_source_rect = source_rect;
+    if (!clip_blit(clipped_position, source, clipped_source_rect))
+        return;
+
+    const RasterSpanFunction function = select_span_function(m_format, PaintSource::Bitmap, source.m_format, BlendMode::SourceOver, false);
+    const usize pixel_byte_count = bytes_per_pixel(m_format);
+    const usize source_pixel_byte_count = bytes_per_pixel(source.m_format);
+
+    for (s32 row_index = 0; row_index < clipped_source_rect.height; ++row_index) {
+        RasterSpan span = {};
+        span.destination = scanline(clipped_position.y + row_index) + pixel_byte_count * clipped_position.x;
+        span.source = source.scanline(clipped_source_rect.y + row_index) + source_pixel_byte_count * clipped_source_rect.x;
+        span.pixel_count = static_cast<usize>(clipped_source_rect.width);
+        span.opacity = opacity_8;
+        function(span);
+    }
+}
+
+bool Bitmap::clip_blit(IntPoint& position, const Bitmap& source, IntRect& source_rect) const
+{
+    // NOTE: Clip against the source first, then shift the result into the space of this bitmap to clip it again.
+    IntRect clipped_source_rect = source_rect.intersected(source.rect());
+    if (clipped_source_rect.is_empty())
+        return false;
+
+    const s32 delta_x = position.x - source_rect.x;
+    const s32 delta_y = position.y - source_rect.y;
+    const IntRect destination_rect = clipped_source_rect.translated(delta_x, delta_y).intersected(rect());
+    if (destination_rect.is_empty())
+        return false;
+
+    source_rect = destination_rect.translated(-delta_x, -delta_y);
+    position = { destination_rect.x, destination_rect.y };
+    return true;
+}
+
+} // namespace Graphics
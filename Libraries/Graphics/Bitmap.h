@@ -0,0 +1,174 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#pragma once
+
+#include <AT/BitOperations.h>
+#include <AT/ByteBuffer.h>
+#include <AT/RefPtr.h>
+#include <AT/Span.h>
+#include <AT/Vector.h>
+#include <Graphics/API.h>
+#include <Graphics/Color.h>
+#include <Graphics/Rect.h>
+
+namespace Core {
+class ThreadPool;
+} // namespace Core
+
+namespace Graphics {
+
+// NOTE: The names describe the order of the channels in memory. The color formats store premultiplied alpha, and
+//       in both of them the alpha is the most significant byte of the pixel when read as a little-endian integer.
+enum class PixelFormat : u8 {
+    RGBA8,
+    BGRA8,
+    A8,
+};
+
+NODISCARD ALWAYS_INLINE constexpr u32 bytes_per_pixel(PixelFormat format)
+{
+    return (format == PixelFormat::A8) ? 1 : 4;
+}
+
+// The reconstruction filters used to resample bitmaps. The later filters are sharper but also more expensive, as
+// they read more source pixels for every destination pixel.
+enum class ScalingFilter : u8 {
+    // Triangle filter, which reads 2x2 source pixels when magnifying.
+    Bilinear,
+    // Catmull-Rom spline, which reads 4x4 source pixels when magnifying.
+    Bicubic,
+    // Windowed sinc with three lobes, which reads 6x6 source pixels when magnifying.
+    Lanczos3,
+};
+
+enum class BitmapStorage : u8 {
+    // The pixels are stored in a buffer owned by the bitmap.
+    Heap,
+    // The pixels are stored in anonymous shared memory, which can be mapped by other processes, such as the
+    // compositor, without copying the pixels.
+    SharedMemory,
+    // The pixels are owned by someone else, for example a mapped file or a buffer of the windowing system.
+    External,
+};
+
+#if AT_PLATFORM_WINDOWS
+// NOTE: A handle to a pagefile-backed file mapping object.
+using SharedMemoryHandle = void*;
+#else
+// NOTE: A file descriptor of an anonymous memory file.
+using SharedMemoryHandle = int;
+#endif // AT_PLATFORM_WINDOWS
+
+// CPU-only pixel surface, which is the target of the whole software rendering path.
+//
+// Every scanline starts at an address aligned to `Bitmap::stride_alignment`, so that the rows never share a cache
+// line and the vector loops can process any row the same way. The padding at the end of each row is never read.
+class Bitmap : public RefCounted {
+    AT_MAKE_NONCOPYABLE(Bitmap);
+    AT_MAKE_NONMOVABLE(Bitmap);
+
+public:
+    static constexpr usize stride_alignment = 64;
+    static constexpr u32 max_dimension = 32768;
+
+    // NOTE: The factory functions return an invalid reference if the dimensions are zero or too large, or if the
+    //       memory can't be allocated. The pixels of new bitmaps are fully transparent.
+    NODISCARD GRAPHICS_API static RefPtr<Bitmap> create(PixelFormat format, u32 width, u32 height);
+    NODISCARD GRAPHICS_API static RefPtr<Bitmap> create_shared(PixelFormat format, u32 width, u32 height);
+
+    // Maps a shared bitmap that was created by another process. The handle is duplicated, so the caller remains
+    // responsible for closing it. Returns an invalid reference if the shared memory is smaller than the pixels.
+    // NOTE: On Windows, the handle must have been duplicated into this process by the process that created it.
+    NODISCARD GRAPHICS_API static RefPtr<Bitmap>
+    create_from_shared_memory(SharedMemoryHandle handle, PixelFormat format, u32 width, u32 height, usize stride);
+
+    // NOTE: The pixels must remain valid for the lifetime of the bitmap, and the stride doesn't have to be aligned.
+    NODISCARD GRAPHICS_API static RefPtr<Bitmap> create_wrapper(PixelFormat format, u32 width, u32 height, usize stride, ReadWriteBytes pixels);
+
+    NODISCARD ALWAYS_INLINE static constexpr usize minimum_stride(PixelFormat format, u32 width)
+    {
+        return align_up(static_cast<usize>(width) * bytes_per_pixel(format), stride_alignment);
+    }
+
+public:
+    GRAPHICS_API virtual ~Bitmap() override;
+
+public:
+    NODISCARD ALWAYS_INLINE PixelFormat format() const { return m_format; }
+    NODISCARD ALWAYS_INLINE BitmapStorage storage() const { return m_storage; }
+    NODISCARD ALWAYS_INLINE u32 width() const { return m_width; }
+    NODISCARD ALWAYS_INLINE u32 height() const { return m_height; }
+    NODISCARD ALWAYS_INLINE usize stride() const { return m_stride; }
+    NODISCARD ALWAYS_INLINE IntRect rect() const { return { 0, 0, static_cast<s32>(m_width), static_cast<s32>(m_height) }; }
+
+    NODISCARD ALWAYS_INLINE ReadWriteBytes pixels() { return m_pixels; }
+    NODISCARD ALWAYS_INLINE ReadonlyBytes pixels() const { return m_pixels; }
+    NODISCARD ALWAYS_INLINE usize byte_count() const { return m_stride * m_height; }
+
+    NODISCARD ALWAYS_INLINE ReadWriteBytes scanline(u32 y) { return m_pixels + static_cast<usize>(y) * m_stride; }
+    NODISCARD ALWAYS_INLINE ReadonlyBytes scanline(u32 y) const { return m_pixels + static_cast<usize>(y) * m_stride; }
+
+    // NOTE: Only valid for bitmaps stored in shared memory. The handle is owned by the bitmap.
+    NODISCARD ALWAYS_INLINE SharedMemoryHandle shared_memory_handle() const { return m_shared_memory_handle; }
+
+public:
+    // Replaces the pixels inside the rectangle with the color, without blending. The rectangle is clipped to the
+    // bounds of the bitmap.
+    GRAPHICS_API void fill_rect(const IntRect& rect, Color color);
+    ALWAYS_INLINE void clear(Color color = {}) { fill_rect(rect(), color); }
+
+    // Copies the pixels of the source rectangle to the position, converting them to the format of this bitmap.
+    // Alpha-only pixels are expanded to black with the same alpha.
+    // NOTE: The source must be a different bitmap than the destination.
+    GRAPHICS_API void blit(IntPoint position, const Bitmap& source, const IntRect& source_rect);
+
+    // Composites the pixels of the source rectangle over this bitmap, after scaling them by the opacity. The source
+    // pixels are converted to the format of this bitmap like `blit` does.
+    GRAPHICS_API void blit_with_opacity(IntPoint position, const Bitmap& source, const IntRect& source_rect, f32 opacity);
+
+    // Clips the source rectangle against both bitmaps, and returns the clipped rectangle together with the
+    // position where it lands in this bitmap. Returns false if nothing is left to copy.
+    NODISCARD GRAPHICS_API bool clip_blit(IntPoint& position, const Bitmap& source, IntRect& source_rect) const;
+
+public:
+    // Returns a copy of this bitmap resampled to the given dimensions, with the same pixel format. Returns an invalid
+    // reference if the dimensions are invalid or if the memory can't be allocated.
+    //
+    // When minifying, the filter is stretched by the scale factor so that every source pixel contributes to the
+    // result, which avoids aliasing regardless of how much the bitmap is shrunk.
+    // NOTE: Without a thread pool, the whole bitmap is resampled on the calling thread. Otherwise, the calling thread
+    //       blocks until the workers are done.
+    NODISCARD GRAPHICS_API RefPtr<Bitmap> scaled(u32 width, u32 height, ScalingFilter filter, Core::ThreadPool* thread_pool = nullptr) const;
+
+    // Same as `scaled`, but writes the result over all the pixels of the destination, which must have the same
+    // pixel format as this bitmap and be a different bitmap.
+    GRAPHICS_API void scale_into(Bitmap& destination, ScalingFilter filter, Core::ThreadPool* thread_pool = nullptr) const;
+
+    // Returns the mipmap levels of this bitmap, starting with the level that has half its dimensions and ending with
+    // the 1x1 level. Each level averages the 2x2 blocks of the previous one, and odd dimensions are rounded down.
+    // NOTE: Returns an empty vector if this bitmap is already 1x1, or if the memory can't be allocated.
+    NODISCARD GRAPHICS_API Vector<RefPtr<Bitmap>> create_mip_chain(Core::ThreadPool* thread_pool = nullptr) const;
+
+private:
+    Bitmap(PixelFormat format, u32 width, u32 height, usize stride, BitmapStorage storage);
+
+private:
+    PixelFormat m_format;
+    BitmapStorage m_storage;
+    u32 m_width;
+    u32 m_height;
+    usize m_stride;
+    ReadWriteBytes m_pixels { nullptr };
+
+    ByteBuffer m_buffer;
+#if AT_PLATFORM_WINDOWS
+    SharedMemoryHandle m_shared_memory_handle { nullptr };
+#else
+    SharedMemoryHandle m_shared_memory_handle { -1 };
+#endif // AT_PLATFORM_WINDOWS
+};
+
+} // namespace Graphics
@@ -0,0 +1,635 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#include <AT/Assertions.h>
+#include <Core/ThreadPool.h>
+#include <Graphics/Bitmap.h>
+#include <Graphics/PixelOperations.h>
+
+// NOTE: Headers from the standard library.
+#include <atomic>
+#include <cmath>
+#include <condition_variable>
+#include <mutex>
+
+//
+// Resampling is done in two separable passes. Every destination row is first filtered horizontally from the source
+// rows that it depends on, and the filtered rows are then combined vertically. The weights of both passes only
+// depend on the dimensions, so they are computed once per call and stored as fixed-point numbers, which lets the
+// vector loops multiply and accumulate eight 16-bit channels per instruction.
+//
+// The destination is split into bands of rows, which are claimed by the calling thread and by the workers of the
+// thread pool. Each band filters the source rows that it needs into a buffer owned by the thread, so the bands are
+// completely independent.
+//
+
+namespace Graphics {
+
+// NOTE: The weights are stored as 2.14 fixed-point numbers, so that the weights of a window add up to exactly
+//       `weight_one`, while the sum of the products of the weights and the 8-bit channels still fits in 32 bits.
+static constexpr u32 weight_bits = 14;
+static constexpr s32 weight_one = 1 << weight_bits;
+static constexpr s32 weight_rounding = 1 << (weight_bits - 1);
+
+// NOTE: The number of destination rows that are processed by one thread at a time. The source rows that a band
+//       reads are filtered horizontally once per band, so the rows shared by two neighbouring bands are filtered
+//       twice. A band of 32 rows keeps that overhead below a fifth even for the widest filter.
+static constexpr u32 band_height = 32;
+
+static constexpr f64 pi = 3.14159265358979323846;
+
+template<typename T>
+ALWAYS_INLINE static void ensure_element_count(Vector<T>& vector, usize element_count, const T& template_element)
+{
+    while (vector.count() < element_count)
+        vector.add(template_element);
+}
+
+//
+// Filter tables.
+//
+
+NODISCARD static f64 filter_support(ScalingFilter filter)
+{
+    switch (filter) {
+        case ScalingFilter::Bilinear: return 1.0;
+        case ScalingFilter::Bicubic: return 2.0;
+        case ScalingFilter::Lanczos3: return 3.0;
+    }
+
+    VERIFY_NOT_REACHED();
+}
+
+NODISCARD static f64 sinc(f64 x)
+{
+    if (x == 0.0)
+        return 1.0;
+    return std::sin(pi * x) / (pi * x);
+}
+
+NODISCARD static f64 evaluate_filter(ScalingFilter filter, f64 x)
+{
+    x = std::fabs(x);
+    switch (filter) {
+        case ScalingFilter::Bilinear: return (x < 1.0) ? (1.0 - x) : 0.0;
+        case ScalingFilter::Bicubic:
+            // NOTE: The Catmull-Rom spline is the cubic convolution kernel with `a = -0.5`.
+            if (x < 1.0)
+                return (1.5 * x - 2.5) * x * x + 1.0;
+            if (x < 2.0)
+                return ((-0.5 * x + 2.5) * x - 4.0) * x + 2.0;
+            return 0.0;
+        case ScalingFilter::Lanczos3: return (x < 3.0) ? sinc(x) * sinc(x / 3.0) : 0.0;
+    }
+
+    VERIFY_NOT_REACHED();
+}
+
+// The source pixels that contribute to one destination pixel, along one axis.
+struct FilterWindow {
+    u32 first_source_index;
+    u32 tap_count;
+    // NOTE: The index of the weight of the first source pixel in `FilterTable::weights`.
+    u32 weight_offset;
+};
+
+struct FilterTable {
+    Vector<FilterWindow> windows;
+    Vector<s16> weights;
+};
+
+static void build_filter_table(FilterTable& table, ScalingFilter filter, u32 source_size, u32 destination_size)
+{
+    const f64 scale = static_cast<f64>(source_size) / static_cast<f64>(destination_size);
+    // NOTE: When minifying, the filter is stretched over the source pixels that are covered by a destination pixel,
+    //       so that it also removes the frequencies that the destination can't represent.
+    const f64 filter_scale = (scale > 1.0) ? scale : 1.0;
+    const f64 support = filter_support(filter) * filter_scale;
+
+    Vector<f64> window_weights;
+    for (u32 destination_index = 0; destination_index < destination_size; ++destination_index) {
+        // NOTE: The center of the destination pixel, in the coordinate space of the source, where the center of the
+        //       source pixel `i` is at `i + 0.5`.
+        const f64 center = (static_cast<f64>(destination_index) + 0.5) * scale;
+        const f64 window_begin = std::floor(center - support);
+        const f64 window_end = std::ceil(center + support);
+        const u32 first_index = (window_begin > 0.0) ? static_cast<u32>(window_begin) : 0;
+        const u32 end_index = (window_end < static_cast<f64>(source_size)) ? static_cast<u32>(window_end) : source_size;
+
+        window_weights.clear();
+        f64 weight_sum = 0.0;
+        for (u32 source_index = first_index; source_index < end_index; ++source_index) {
+            const f64 weight = evaluate_filter(filter, (static_cast<f64>(source_index) + 0.5 - center) / filter_scale);
+            window_weights.add(weight);
+            weight_sum += weight;
+        }
+
+        // NOTE: The weights that fall outside the source are dropped, and the remaining ones are normalized, which
+        //       is equivalent to extending the edges of the source without reading outside of it. The rounding error
+        //       is added to the largest weight, so that a uniform area keeps exactly the same value.
+        s32 fixed_weights_sum = 0;
+        u32 largest_weight_index = 0;
+        const usize weight_offset = table.weights.count();
+        for (u32 tap_index = 0; tap_index < window_weights.count(); ++tap_index) {
+            const f64 normalized_weight = (weight_sum != 0.0) ? window_weights[tap_index] / weight_sum : 0.0;
+            const s16 fixed_weight = static_cast<s16>(std::lround(normalized_weight * static_cast<f64>(weight_one)));
+            table.weights.add(fixed_weight);
+            fixed_weights_sum += fixed_weight;
+            if (window_weights[tap_index] > window_weights[largest_weight_index])
+                largest_weight_index = tap_index;
+        }
+        table.weights[weight_offset + largest_weight_index] += static_cast<s16>(weight_one - fixed_weights_sum);
+
+        // NOTE: Skip the taps whose weights were rounded to zero at both ends of the window. When the dimensions don't
+        //       change, only the tap in the middle is left, so the pass degenerates into a copy.
+        FilterWindow window = { first_index, end_index - first_index, static_cast<u32>(weight_offset) };
+        while (window.tap_count > 1 && table.weights[window.weight_offset] == 0) {
+            ++window.first_source_index;
+            --window.tap_count;
+            ++window.weight_offset;
+        }
+        while (window.tap_count > 1 && table.weights[window.weight_offset + window.tap_count - 1] == 0)
+            --window.tap_count;
+        table.windows.add(window);
+    }
+}
+
+//
+// Filtering passes.
+//
+
+NODISCARD ALWAYS_INLINE static u8 round_weighted_sum(s32 sum)
+{
+    const s32 value = (sum + weight_rounding) >> weight_bits;
+    return static_cast<u8>((value < 0) ? 0 : ((value > 255) ? 255 : value));
+}
+
+// NOTE: The filters with negative lobes overshoot near the edges, which can leave a color channel greater than the
+//       alpha. Such a pixel isn't a valid premultiplied color, so the channels are clamped to the alpha.
+NODISCARD ALWAYS_INLINE static u32 clamp_colors_to_alpha(u32 pixel)
+{
+    const u32 alpha = pixel >> 24;
+    u32 result = pixel & 0xFF000000;
+    for (u32 shift = 0; shift < 24; shift += 8) {
+        const u32 channel = (pixel >> shift) & 0xFF;
+        result |= ((channel < alpha) ? channel : alpha) << shift;
+    }
+    return result;
+}
+
+#if AT_SIMD_SSE2
+
+// Packs two consecutive weights in the layout expected by `_mm_madd_epi16`, where the first weight multiplies the
+// even 16-bit lanes and the second one multiplies the odd lanes.
+NODISCARD ALWAYS_INLINE static __m128i load_weight_pair(const s16* weights)
+{
+    const u32 pair = static_cast<u32>(static_cast<u16>(weights[0])) | (static_cast<u32>(static_cast<u16>(weights[1])) << 16);
+    return _mm_set1_epi32(static_cast<int>(pair));
+}
+
+NODISCARD ALWAYS_INLINE static __m128i load_single_weight(s16 weight)
+{
+    return _mm_set1_epi32(static_cast<int>(static_cast<u16>(weight)));
+}
+
+NODISCARD ALWAYS_INLINE static __m128i clamp_colors_to_alpha_4(__m128i pixels)
+{
+    const __m128i alpha = _mm_srli_epi32(pixels, 24);
+    const __m128i alpha_16 = _mm_or_si128(alpha, _mm_slli_epi32(alpha, 8));
+    return _mm_min_epu8(pixels, _mm_or_si128(alpha_16, _mm_slli_epi32(alpha_16, 16)));
+}
+
+// Returns the four channels of the filtered pixel, as 32-bit lanes that aren't clamped yet.
+NODISCARD ALWAYS_INLINE static __m128i filter_pixel_32(ReadonlyBytes source, const FilterTable& table, usize pixel_index)
+{
+    const FilterWindow& window = table.windows[pixel_index];
+    ReadonlyBytes first_pixel = source + 4 * static_cast<usize>(window.first_source_index);
+    const s16* weights = table.weights.elements() + window.weight_offset;
+
+    const __m128i zero = _mm_setzero_si128();
+    __m128i sum = _mm_set1_epi32(weight_rounding);
+    u32 tap_index = 0;
+    for (; tap_index + 2 <= window.tap_count; tap_index += 2) {
+        // NOTE: Interleave the channels of the two pixels, so that `_mm_madd_epi16` multiplies each channel by the
+        //       weight of its pixel and adds the two products together.
+        const __m128i pixels = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(first_pixel + 4 * tap_index));
+        const __m128i channels = _mm_unpacklo_epi8(_mm_unpacklo_epi8(pixels, _mm_srli_si128(pixels, 4)), zero);
+        sum = _mm_add_epi32(sum, _mm_madd_epi16(channels, load_weight_pair(weights + tap_index)));
+    }
+    if (tap_index < window.tap_count) {
+        const __m128i pixel = _mm_cvtsi32_si128(static_cast<int>(load_pixel(first_pixel + 4 * tap_index)));
+        const __m128i channels = _mm_unpacklo_epi16(_mm_unpacklo_epi8(pixel, zero), zero);
+        sum = _mm_add_epi32(sum, _mm_madd_epi16(channels, load_single_weight(weights[tap_index])));
+    }
+    return _mm_srai_epi32(sum, weight_bits);
+}
+
+#endif // AT_SIMD_SSE2
+
+static void filter_row_horizontally_32(WriteonlyBytes destination, ReadonlyBytes source, const FilterTable& table)
+{
+    const usize pixel_count = table.windows.count();
+    usize pixel_index = 0;
+#if AT_SIMD_SSE2
+    for (; pixel_index + 4 <= pixel_count; pixel_index += 4) {
+        const __m128i pixel_0 = filter_pixel_32(source, table, pixel_index + 0);
+        const __m128i pixel_1 = filter_pixel_32(source, table, pixel_index + 1);
+        const __m128i pixel_2 = filter_pixel_32(source, table, pixel_index + 2);
+        const __m128i pixel_3 = filter_pixel_32(source, table, pixel_index + 3);
+        const __m128i pixels = _mm_packus_epi16(_mm_packs_epi32(pixel_0, pixel_1), _mm_packs_epi32(pixel_2, pixel_3));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + 4 * pixel_index), clamp_colors_to_alpha_4(pixels));
+    }
+#endif // AT_SIMD_SSE2
+    for (; pixel_index < pixel_count; ++pixel_index) {
+        const FilterWindow& window = table.windows[pixel_index];
+        ReadonlyBytes first_pixel = source + 4 * static_cast<usize>(window.first_source_index);
+        const s16* weights = table.weights.elements() + window.weight_offset;
+
+        s32 sums[4] = {};
+        for (u32 tap_index = 0; tap_index < window.tap_count; ++tap_index) {
+            for (u32 channel_index = 0; channel_index < 4; ++channel_index)
+                sums[channel_index] += weights[tap_index] * first_pixel[4 * tap_index + channel_index];
+        }
+
+        u32 pixel = 0;
+        for (u32 channel_index = 0; channel_index < 4; ++channel_index)
+            pixel |= static_cast<u32>(round_weighted_sum(sums[channel_index])) << (8 * channel_index);
+        store_pixel(destination + 4 * pixel_index, clamp_colors_to_alpha(pixel));
+    }
+}
+
+static void filter_row_horizontally_8(WriteonlyBytes destination, ReadonlyBytes source, const FilterTable& table)
+{
+    for (usize pixel_index = 0; pixel_index < table.windows.count(); ++pixel_index) {
+        const FilterWindow& window = table.windows[pixel_index];
+        ReadonlyBytes first_pixel = source + window.first_source_index;
+        const s16* weights = table.weights.elements() + window.weight_offset;
+
+        s32 sum = 0;
+        u32 tap_index = 0;
+#if AT_SIMD_SSE2
+        // NOTE: The windows are only wide enough when minifying, where each destination pixel reads many sources.
+        if (window.tap_count >= 8) {
+            const __m128i zero = _mm_setzero_si128();
+            __m128i sums = _mm_setzero_si128();
+            for (; tap_index + 8 <= window.tap_count; tap_index += 8) {
+                const __m128i values = _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(first_pixel + tap_index)), zero);
+                const __m128i weight_values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(weights + tap_index));
+                sums = _mm_add_epi32(sums, _mm_madd_epi16(values, weight_values));
+            }
+            sums = _mm_add_epi32(sums, _mm_srli_si128(sums, 8));
+            sums = _mm_add_epi32(sums, _mm_srli_si128(sums, 4));
+            sum = _mm_cvtsi128_si32(sums);
+        }
+#endif // AT_SIMD_SSE2
+        for (; tap_index < window.tap_count; ++tap_index)
+            sum += weights[tap_index] * first_pixel[tap_index];
+        destination[pixel_index] = round_weighted_sum(sum);
+    }
+}
+
+// Filters the bytes of consecutive rows, which are `row_stride` bytes apart, into the destination row. The filter
+// doesn't depend on the pixel format, as every byte is a channel that is combined with the same byte of the other
+// rows.
+template<bool is_premultiplied_color>
+static void filter_rows_vertically(
+    WriteonlyBytes destination,
+    ReadonlyBytes first_row,
+    usize row_stride,
+    const s16* weights,
+    u32 tap_count,
+    usize byte_count
+)
+{
+    usize byte_offset = 0;
+#if AT_SIMD_SSE2
+    const __m128i zero = _mm_setzero_si128();
+    for (; byte_offset + 16 <= byte_count; byte_offset += 16) {
+        __m128i sum_0 = _mm_set1_epi32(weight_rounding);
+        __m128i sum_1 = sum_0;
+        __m128i sum_2 = sum_0;
+        __m128i sum_3 = sum_0;
+
+        ReadonlyBytes row = first_row + byte_offset;
+        u32 tap_index = 0;
+        for (; tap_index + 2 <= tap_count; tap_index += 2) {
+            // NOTE: Interleave the bytes of the two rows, so that `_mm_madd_epi16` combines each byte with the byte
+            //       below it.
+            const __m128i upper = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row));
+            const __m128i lower = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row + row_stride));
+            const __m128i weight_pair = load_weight_pair(weights + tap_index);
+            const __m128i low = _mm_unpacklo_epi8(upper, lower);
+            const __m128i high = _mm_unpackhi_epi8(upper, lower);
+            sum_0 = _mm_add_epi32(sum_0, _mm_madd_epi16(_mm_unpacklo_epi8(low, zero), weight_pair));
+            sum_1 = _mm_add_epi32(sum_1, _mm_madd_epi16(_mm_unpackhi_epi8(low, zero), weight_pair));
+            sum_2 = _mm_add_epi32(sum_2, _mm_madd_epi16(_mm_unpacklo_epi8(high, zero), weight_pair));
+            sum_3 = _mm_add_epi32(sum_3, _mm_madd_epi16(_mm_unpackhi_epi8(high, zero), weight_pair));
+            row += 2 * row_stride;
+        }
+        if (tap_index < tap_count) {
+            const __m128i last = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row));
+            const __m128i weight = load_single_weight(weights[tap_index]);
+            const __m128i low = _mm_unpacklo_epi8(last, zero);
+            const __m128i high = _mm_unpackhi_epi8(last, zero);
+            sum_0 = _mm_add_epi32(sum_0, _mm_madd_epi16(_mm_unpacklo_epi16(low, zero), weight));
+            sum_1 = _mm_add_epi32(sum_1, _mm_madd_epi16(_mm_unpackhi_epi16(low, zero), weight));
+            sum_2 = _mm_add_epi32(sum_2, _mm_madd_epi16(_mm_unpacklo_epi16(high, zero), weight));
+            sum_3 = _mm_add_epi32(sum_3, _mm_madd_epi16(_mm_unpackhi_epi16(high, zero), weight));
+        }
+
+        const __m128i low_values = _mm_packs_epi32(_mm_srai_epi32(sum_0, weight_bits), _mm_srai_epi32(sum_1, weight_bits));
+        const __m128i high_values = _mm_packs_epi32(_mm_srai_epi32(sum_2, weight_bits), _mm_srai_epi32(sum_3, weight_bits));
+        __m128i values = _mm_packus_epi16(low_values, high_values);
+        if constexpr (is_premultiplied_color)
+            values = clamp_colors_to_alpha_4(values);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + byte_offset), values);
+    }
+#endif // AT_SIMD_SSE2
+
+    const usize tail_offset = byte_offset;
+    for (; byte_offset < byte_count; ++byte_offset) {
+        s32 sum = 0;
+        for (u32 tap_index = 0; tap_index < tap_count; ++tap_index)
+            sum += weights[tap_index] * first_row[tap_index * row_stride + byte_offset];
+        destination[byte_offset] = round_weighted_sum(sum);
+    }
+
+    if constexpr (is_premultiplied_color) {
+        for (usize pixel_offset = tail_offset; pixel_offset < byte_count; pixel_offset += 4)
+            store_pixel(destination + pixel_offset, clamp_colors_to_alpha(load_pixel(destination + pixel_offset)));
+    }
+}
+
+//
+// Box filter.
+//
+
+// Averages the 2x2 blocks of the two source rows. The last column is repeated if the source is a single pixel wide.
+static void downsample_row_32(WriteonlyBytes destination, ReadonlyBytes upper_row, ReadonlyBytes lower_row, u32 destination_width, u32 source_width)
+{
+    u32 x = 0;
+#if AT_SIMD_SSE2
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i rounding = _mm_set1_epi16(2);
+    for (; x + 4 <= destination_width && source_width > 1; x += 4) {
+        const __m128i* upper = reinterpret_cast<const __m128i*>(upper_row + 8 * static_cast<usize>(x));
+        const __m128i* lower = reinterpret_cast<const __m128i*>(lower_row + 8 * static_cast<usize>(x));
+        const __m128i upper_0 = _mm_loadu_si128(upper + 0);
+        const __m128i upper_1 = _mm_loadu_si128(upper + 1);
+        const __m128i lower_0 = _mm_loadu_si128(lower + 0);
+        const __m128i lower_1 = _mm_loadu_si128(lower + 1);
+
+        // NOTE: Add the vertical pairs first, where each register holds the 16-bit channels of two pixels.
+        const __m128i pair_01 = _mm_add_epi16(_mm_unpacklo_epi8(upper_0, zero), _mm_unpacklo_epi8(lower_0, zero));
+        const __m128i pair_23 = _mm_add_epi16(_mm_unpackhi_epi8(upper_0, zero), _mm_unpackhi_epi8(lower_0, zero));
+        const __m128i pair_45 = _mm_add_epi16(_mm_unpacklo_epi8(upper_1, zero), _mm_unpacklo_epi8(lower_1, zero));
+        const __m128i pair_67 = _mm_add_epi16(_mm_unpackhi_epi8(upper_1, zero), _mm_unpackhi_epi8(lower_1, zero));
+
+        // NOTE: Then add the horizontal pairs, which are the two halves of each register.
+        const __m128i block_01 = _mm_add_epi16(_mm_unpacklo_epi64(pair_01, pair_23), _mm_unpackhi_epi64(pair_01, pair_23));
+        const __m128i block_23 = _mm_add_epi16(_mm_unpacklo_epi64(pair_45, pair_67), _mm_unpackhi_epi64(pair_45, pair_67));
+        const __m128i average_01 = _mm_srli_epi16(_mm_add_epi16(block_01, rounding), 2);
+        const __m128i average_23 = _mm_srli_epi16(_mm_add_epi16(block_23, rounding), 2);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + 4 * static_cast<usize>(x)), _mm_packus_epi16(average_01, average_23));
+    }
+#endif // AT_SIMD_SSE2
+    for (; x < destination_width; ++x) {
+        const usize left = 4 * static_cast<usize>(2 * x);
+        const usize right = 4 * static_cast<usize>((2 * x + 1 < source_width) ? (2 * x + 1) : (source_width - 1));
+        for (usize channel_index = 0; channel_index < 4; ++channel_index) {
+            const u32 sum = upper_row[left + channel_index] + upper_row[right + channel_index] + lower_row[left + channel_index] +
+                            lower_row[right + channel_index];
+            destination[4 * static_cast<usize>(x) + channel_index] = static_cast<u8>((sum + 2) >> 2);
+        }
+    }
+}
+
+static void downsample_row_8(WriteonlyBytes destination, ReadonlyBytes upper_row, ReadonlyBytes lower_row, u32 destination_width, u32 source_width)
+{
+    u32 x = 0;
+#if AT_SIMD_SSE2
+    const __m128i low_byte_mask = _mm_set1_epi16(0x00FF);
+    const __m128i rounding = _mm_set1_epi16(2);
+    for (; x + 16 <= destination_width && source_width > 1; x += 16) {
+        const __m128i* upper = reinterpret_cast<const __m128i*>(upper_row + 2 * static_cast<usize>(x));
+        const __m128i* lower = reinterpret_cast<const __m128i*>(lower_row + 2 * static_cast<usize>(x));
+        const __m128i upper_0 = _mm_loadu_si128(upper + 0);
+        const __m128i upper_1 = _mm_loadu_si128(upper + 1);
+        const __m128i lower_0 = _mm_loadu_si128(lower + 0);
+        const __m128i lower_1 = _mm_loadu_si128(lower + 1);
+
+        // NOTE: Split the even and the odd pixels into the two bytes of each 16-bit lane, so adding them together
+        //       sums the horizontal pairs.
+        const __m128i upper_sum_0 = _mm_add_epi16(_mm_and_si128(upper_0, low_byte_mask), _mm_srli_epi16(upper_0, 8));
+        const __m128i upper_sum_1 = _mm_add_epi16(_mm_and_si128(upper_1, low_byte_mask), _mm_srli_epi16(upper_1, 8));
+        const __m128i lower_sum_0 = _mm_add_epi16(_mm_and_si128(lower_0, low_byte_mask), _mm_srli_epi16(lower_0, 8));
+        const __m128i lower_sum_1 = _mm_add_epi16(_mm_and_si128(lower_1, low_byte_mask), _mm_srli_epi16(lower_1, 8));
+        const __m128i average_0 = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(upper_sum_0, lower_sum_0), rounding), 2);
+        const __m128i average_1 = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(upper_sum_1, lower_sum_1), rounding), 2);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + x), _mm_packus_epi16(average_0, average_1));
+    }
+#endif // AT_SIMD_SSE2
+    for (; x < destination_width; ++x) {
+        const usize left = 2 * static_cast<usize>(x);
+        const usize right = (2 * x + 1 < source_width) ? (2 * x + 1) : (source_width - 1);
+        const u32 sum = upper_row[left] + upper_row[right] + lower_row[left] + lower_row[right];
+        destination[x] = static_cast<u8>((sum + 2) >> 2);
+    }
+}
+
+//
+// Band scheduling.
+//
+
+using BandFunction = void (*)(const void* user_data, u32 band_index, Vector<u8>& scratch_buffer);
+
+struct BandDispatch {
+    BandFunction function { nullptr };
+    const void* user_data { nullptr };
+    u32 band_count { 0 };
+
+    std::atomic<u32> next_band_index { 0 };
+    std::mutex completion_mutex;
+    std::condition_variable completion_condition;
+    u32 pending_job_count { 0 };
+};
+
+// Processes bands until none of them is left unclaimed.
+static void process_bands(BandDispatch& dispatch)
+{
+    // NOTE: The scratch buffer is reused by all the bands that are processed by this thread.
+    Vector<u8> scratch_buffer;
+    while (true) {
+        const u32 band_index = dispatch.next_band_index.fetch_add(1, std::memory_order_relaxed);
+        if (band_index >= dispatch.band_count)
+            break;
+        dispatch.function(dispatch.user_data, band_index, scratch_buffer);
+    }
+}
+
+static void process_bands_job(void* user_data)
+{
+    BandDispatch& dispatch = *static_cast<BandDispatch*>(user_data);
+    process_bands(dispatch);
+
+    std::unique_lock<std::mutex> lock(dispatch.completion_mutex);
+    if (--dispatch.pending_job_count == 0)
+        dispatch.completion_condition.notify_one();
+}
+
+// Runs the function for every band, on the calling thread and on the workers of the thread pool. Blocks until all
+// the bands are processed.
+static void dispatch_bands(BandFunction function, const void* user_data, u32 band_count, Core::ThreadPool* thread_pool)
+{
+    BandDispatch dispatch;
+    dispatch.function = function;
+    dispatch.user_data = user_data;
+    dispatch.band_count = band_count;
+
+    u32 job_count = 0;
+    if (thread_pool != nullptr && band_count > 1) {
+        // NOTE: The calling thread processes bands as well, so one job fewer than the number of bands is enough.
+        job_count = thread_pool->worker_count();
+        if (job_count > band_count - 1)
+            job_count = band_count - 1;
+    }
+
+    if (job_count > 0) {
+        {
+            std::unique_lock<std::mutex> lock(dispatch.completion_mutex);
+            dispatch.pending_job_count = job_count;
+        }
+        for (u32 job_index = 0; job_index < job_count; ++job_index)
+            thread_pool->enqueue(Core::Job::from_function(process_bands_job, &dispatch));
+    }
+
+    process_bands(dispatch);
+
+    if (job_count > 0) {
+        std::unique_lock<std::mutex> lock(dispatch.completion_mutex);
+        dispatch.completion_condition.wait(lock, [&dispatch] { return (dispatch.pending_job_count == 0); });
+    }
+}
+
+NODISCARD ALWAYS_INLINE static u32 band_count_of(u32 height)
+{
+    return (height + band_height - 1) / band_height;
+}
+
+struct ScalingJob {
+    const Bitmap* source;
+    Bitmap* destination;
+    FilterTable horizontal_table;
+    FilterTable vertical_table;
+};
+
+static void scale_band(const void* user_data, u32 band_index, Vector<u8>& scratch_buffer)
+{
+    const ScalingJob& job = *static_cast<const ScalingJob*>(user_data);
+    const Bitmap& source = *job.source;
+    Bitmap& destination = *job.destination;
+
+    const u32 first_y = band_index * band_height;
+    const u32 end_y = (first_y + band_height < destination.height()) ? (first_y + band_height) : destination.height();
+
+    u32 first_source_row = job.vertical_table.windows[first_y].first_source_index;
+    u32 end_source_row = first_source_row;
+    for (u32 y = first_y; y < end_y; ++y) {
+        const FilterWindow& window = job.vertical_table.windows[y];
+        if (window.first_source_index < first_source_row)
+            first_source_row = window.first_source_index;
+        if (window.first_source_index + window.tap_count > end_source_row)
+            end_source_row = window.first_source_index + window.tap_count;
+    }
+
+    const bool is_alpha_only = (source.format() == PixelFormat::A8);
+    const usize row_byte_count = static_cast<usize>(destination.width()) * bytes_per_pixel(destination.format());
+    ensure_element_count(scratch_buffer, row_byte_count * (end_source_row - first_source_row), static_cast<u8>(0));
+
+    for (u32 source_y = first_source_row; source_y < end_source_row; ++source_y) {
+        WriteonlyBytes filtered_row = scratch_buffer.elements() + (source_y - first_source_row) * row_byte_count;
+        if (is_alpha_only)
+            filter_row_horizontally_8(filtered_row, source.scanline(source_y), job.horizontal_table);
+        else
+            filter_row_horizontally_32(filtered_row, source.scanline(source_y), job.horizontal_table);
+    }
+
+    for (u32 y = first_y; y < end_y; ++y) {
+        const FilterWindow& window = job.vertical_table.windows[y];
+        ReadonlyBytes first_row = scratch_buffer.elements() + (window.first_source_index - first_source_row) * row_byte_count;
+        const s16* weights = job.vertical_table.weights.elements() + window.weight_offset;
+        if (is_alpha_only)
+            filter_rows_vertically<false>(destination.scanline(y), first_row, row_byte_count, weights, window.tap_count, row_byte_count);
+        else
+            filter_rows_vertically<true>(destination.scanline(y), first_row, row_byte_count, weights, window.tap_count, row_byte_count);
+    }
+}
+
+struct DownsamplingJob {
+    const Bitmap* source;
+    Bitmap* destination;
+};
+
+static void downsample_band(const void* user_data, u32 band_index, Vector<u8>&)
+{
+    const DownsamplingJob& job = *static_cast<const DownsamplingJob*>(user_data);
+    const Bitmap& source = *job.source;
+    Bitmap& destination = *job.destination;
+
+    const u32 first_y = band_index * band_height;
+    const u32 end_y = (first_y + band_height < destination.height()) ? (first_y + band_height) : destination.height();
+    for (u32 y = first_y; y < end_y; ++y) {
+        ReadonlyBytes upper_row = source.scanline(2 * y);
+        ReadonlyBytes lower_row = source.scanline((2 * y + 1 < source.height()) ? (2 * y + 1) : (source.height() - 1));
+        if (source.format() == PixelFormat::A8)
+            downsample_row_8(destination.scanline(y), upper_row, lower_row, destination.width(), source.width());
+        else
+            downsample_row_32(destination.scanline(y), upper_row, lower_row, destination.width(), source.width());
+    }
+}
+
+RefPtr<Bitmap> Bitmap::scaled(u32 width, u32 height, ScalingFilter filter, Core::ThreadPool* thread_pool) const
+{
+    RefPtr<Bitmap> bitmap = create(m_format, width, height);
+    if (!bitmap.is_valid())
+        return {};
+
+    scale_into(*bitmap, filter, thread_pool);
+    return bitmap;
+}
+
+void Bitmap::scale_into(Bitmap& destination, ScalingFilter filter, Core::ThreadPool* thread_pool) const
+{
+    VERIFY(&destination != this);
+    VERIFY(destination.m_format == m_format);
+
+    ScalingJob job;
+    job.source = this;
+    job.destination = &destination;
+    build_filter_table(job.horizontal_table, filter, m_width, destination.m_width);
+    build_filter_table(job.vertical_table, filter, m_height, destination.m_height);
+    dispatch_bands(scale_band, &job, band_count_of(destination.m_height), thread_pool);
+}
+
+Vector<RefPtr<Bitmap>> Bitmap::create_mip_chain(Core::ThreadPool* thread_pool) const
+{
+    Vector<RefPtr<Bitmap>> levels;
+    const Bitmap* previous_level = this;
+    while (previous_level->m_width > 1 || previous_level->m_height > 1) {
+        const u32 width = (previous_level->m_width > 1) ? (previous_level->m_width / 2) : 1;
+        const u32 height = (previous_level->m_height > 1) ? (previous_level->m_height / 2) : 1;
+        RefPtr<Bitmap> level = create(m_format, width, height);
+        if (!level.is_valid())
+            return {};
+
+        const DownsamplingJob job = { previous_level, level.get() };
+        dispatch_bands(downsample_band, &job, band_count_of(height), thread_pool);
+        levels.add(move(level));
+        previous_level = levels[levels.count() - 1].get();
+    }
+    return levels;
+}
+
+} // namespace Graphics
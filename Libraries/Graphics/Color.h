@@ -0,0 +1,61 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#pragma once
+
+#include <AT/Types.h>
+
+namespace Graphics {
+
+// Color with 8-bit channels and straight (non-premultiplied) alpha, which is how colors are specified by the user.
+// The pixels of bitmaps store premultiplied alpha instead, so the conversion happens when the color is rasterized.
+struct Color {
+    u8 r { 0 };
+    u8 g { 0 };
+    u8 b { 0 };
+    u8 a { 0 };
+
+    ALWAYS_INLINE constexpr Color() = default;
+
+    ALWAYS_INLINE constexpr Color(u8 in_r, u8 in_g, u8 in_b, u8 in_a = 255)
+        : r(in_r)
+        , g(in_g)
+        , b(in_b)
+        , a(in_a)
+    {}
+
+    // NOTE: The value is interpreted as 0xRRGGBBAA, which is how colors are usually written in code.
+    NODISCARD ALWAYS_INLINE static constexpr Color from_rgba(u32 value)
+    {
+        return { static_cast<u8>(value >> 24), static_cast<u8>(value >> 16), static_cast<u8>(value >> 8), static_cast<u8>(value) };
+    }
+
+    NODISCARD ALWAYS_INLINE constexpr bool is_opaque() const { return (a == 255); }
+    NODISCARD ALWAYS_INLINE constexpr bool is_transparent() const { return (a == 0); }
+
+    NODISCARD ALWAYS_INLINE constexpr Color with_alpha(u8 new_alpha) const { return { r, g, b, new_alpha }; }
+
+    // Multiplies the color channels by the alpha, rounding to the nearest value.
+    NODISCARD ALWAYS_INLINE constexpr Color premultiplied() const
+    {
+        return { multiply_channels(r, a), multiply_channels(g, a), multiply_channels(b, a), a };
+    }
+
+    // Computes `(x * y) / 255`, rounded to the nearest integer, without a division.
+    NODISCARD ALWAYS_INLINE static constexpr u8 multiply_channels(u32 x, u32 y)
+    {
+        const u32 product = x * y + 128;
+        return static_cast<u8>((product + (product >> 8)) >> 8);
+    }
+
+    NODISCARD ALWAYS_INLINE constexpr bool operator==(const Color& other) const
+    {
+        return (r == other.r) && (g == other.g) && (b == other.b) && (a == other.a);
+    }
+
+    NODISCARD ALWAYS_INLINE constexpr bool operator!=(const Color& other) const { return !(*this == other); }
+};
+
+} // namespace Graphics
@@ -0,0 +1,81 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#include <AT/Assertions.h>
+#include <Graphics/Compositing.h>
+#include <Graphics/RasterPipeline.h>
+
+namespace Graphics {
+
+const char* blend_mode_name(BlendMode mode)
+{
+    switch (mode) {
+        case BlendMode::SourceOver: return "SourceOver";
+        case BlendMode::SourceIn: return "SourceIn";
+        case BlendMode::DestinationOut: return "DestinationOut";
+        case BlendMode::Multiply: return "Multiply";
+        case BlendMode::Screen: return "Screen";
+        case BlendMode::Additive: return "Additive";
+    }
+
+    VERIFY_NOT_REACHED();
+}
+
+void composite_row(BlendMode mode, ReadWriteBytes destination, ReadonlyBytes source, ReadonlyBytes coverage, usize pixel_count, u8 opacity)
+{
+    const RasterSpanFunction function = select_span_function(PixelFormat::RGBA8, PaintSource::Bitmap, PixelFormat::RGBA8, mode, coverage != nullptr);
+    function({ destination, source, 0, coverage, pixel_count, opacity });
+}
+
+void composite_color_row(BlendMode mode, ReadWriteBytes destination, u32 pixel, ReadonlyBytes coverage, usize pixel_count, u8 opacity)
+{
+    const RasterSpanFunction function =
+        select_span_function(PixelFormat::RGBA8, PaintSource::SolidColor, PixelFormat::RGBA8, mode, coverage != nullptr);
+    function({ destination, nullptr, pixel, coverage, pixel_count, opacity });
+}
+
+void composite(
+    Bitmap& destination,
+    IntPoint position,
+    const Bitmap& source,
+    const IntRect& source_rect,
+    BlendMode mode,
+    f32 opacity,
+    const Bitmap* mask
+)
+{
+    VERIFY(&source != &destination);
+    if (mask) {
+        VERIFY(mask->format() == PixelFormat::A8);
+        VERIFY(mask->width() == source.width() && mask->height() == source.height());
+    }
+
+    if (!(opacity > 0.0F))
+        return;
+    const u8 opacity_8 = (opacity >= 1.0F) ? 255 : static_cast<u8>(opacity * 255.0F + 0.5F);
+
+    IntPoint clipped_position = position;
+    IntRect clipped_source_rect = source_rect;
+    if (!destination.clip_blit(clipped_position, source, clipped_source_rect))
+        return;
+
+    const RasterSpanFunction function = select_span_function(destination.format(), PaintSource::Bitmap, source.format(), mode, mask != nullptr);
+    const usize destination_pixel_byte_count = bytes_per_pixel(destination.format());
+    const usize source_pixel_byte_count = bytes_per_pixel(source.format());
+
+    for (s32 row_index = 0; row_index < clipped_source_rect.height; ++row_index) {
+        const u32 source_y = static_cast<u32>(clipped_source_rect.y + row_index);
+        RasterSpan span = {};
+        const u32 destination_y = static_cast<u32>(clipped_position.y + row_index);
+        span.destination = destination.scanline(destination_y) + destination_pixel_byte_count * static_cast<usize>(clipped_position.x);
+        span.source = source.scanline(source_y) + source_pixel_byte_count * static_cast<usize>(clipped_source_rect.x);
+        span.coverage = mask ? mask->scanline(source_y) + clipped_source_rect.x : nullptr;
+        span.pixel_count = static_cast<usize>(clipped_source_rect.width);
+        span.opacity = opacity_8;
+        function(span);
+    }
+}
+
+} // namespace Graphics
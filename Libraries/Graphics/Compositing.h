@@ -0,0 +1,66 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#pragma once
+
+#include <AT/Span.h>
+#include <Graphics/API.h>
+#include <Graphics/Bitmap.h>
+
+namespace Graphics {
+
+// The operators that combine a premultiplied source pixel `s` with a premultiplied destination pixel `d`. In the
+// formulas below, the channels are normalized to [0, 1] and `sa` and `da` are the alphas of the two pixels.
+enum class BlendMode : u8 {
+    // s + d * (1 - sa)
+    SourceOver,
+    // s * da
+    SourceIn,
+    // d * (1 - sa)
+    DestinationOut,
+    // s * d + s * (1 - da) + d * (1 - sa)
+    Multiply,
+    // s + d - s * d
+    Screen,
+    // min(s + d, 1)
+    Additive,
+};
+
+NODISCARD GRAPHICS_API const char* blend_mode_name(BlendMode mode);
+
+// Composites a row of premultiplied 32-bit pixels over the destination row. Both rows must have the same color
+// format, although the formats that only differ by the order of the color channels all work the same way.
+//
+// The contribution of each source pixel is scaled by the global opacity and, if the coverage is not null, by the
+// coverage value of the pixel. A partially covered pixel is the interpolation between the destination and the
+// result of the blend mode, so pixels without coverage are never modified.
+GRAPHICS_API void composite_row(
+    BlendMode mode,
+    ReadWriteBytes destination,
+    ReadonlyBytes source,
+    ReadonlyBytes coverage,
+    usize pixel_count,
+    u8 opacity = 255
+);
+
+// Same as `composite_row`, but every source pixel has the same value, which is already premultiplied.
+GRAPHICS_API void
+composite_color_row(BlendMode mode, ReadWriteBytes destination, u32 pixel, ReadonlyBytes coverage, usize pixel_count, u8 opacity = 255);
+
+// Composites the pixels of the source rectangle over the destination bitmap, at the given position. The optional
+// mask is an alpha-only bitmap with the same dimensions as the source, which provides the coverage of each source
+// pixel. The bitmaps can have any pixel format, which is converted like `Bitmap::blit` does.
+// NOTE: The source must be a different bitmap than the destination.
+GRAPHICS_API void composite(
+    Bitmap& destination,
+    IntPoint position,
+    const Bitmap& source,
+    const IntRect& source_rect,
+    BlendMode mode,
+    f32 opacity = 1.0F,
+    const Bitmap* mask = nullptr
+);
+
+} // namespace Graphics
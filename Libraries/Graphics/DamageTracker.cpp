@@ -0,0 +1,136 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#include <AT/Assertions.h>
+#include <Graphics/DamageTracker.h>
+
+namespace Graphics {
+
+// NOTE: Finding the best pair to merge is quadratic in the number of rectangles, so longer lists are first shortened
+//       by merging the neighbours in the order of the region, which are close to each other.
+static constexpr usize maximum_exhaustive_rect_count = 32;
+
+// The number of pixels that would be repainted needlessly if the two rectangles were replaced by their bounds.
+NODISCARD static s64 merge_cost(const IntRect& first, const IntRect& second)
+{
+    return static_cast<s64>(first.united(second).area()) - static_cast<s64>(first.area()) - static_cast<s64>(second.area());
+}
+
+static void merge_neighbours(Vector<IntRect>& rects)
+{
+    usize write_index = 0;
+    for (usize read_index = 0; read_index < rects.count(); read_index += 2) {
+        if (read_index + 1 < rects.count())
+            rects[write_index++] = rects[read_index].united(rects[read_index + 1]);
+        else
+            rects[write_index++] = rects[read_index];
+    }
+    rects.remove_last(rects.count() - write_index);
+}
+
+// Merges every rectangle that intersects the one at the given index into it, until none of them intersects it, so
+// that the rectangles remain disjoint. Returns the new index of the rectangle.
+static usize absorb_intersecting_rects(Vector<IntRect>& rects, usize index)
+{
+    for (usize rect_index = 0; rect_index < rects.count();) {
+        if (rect_index == index || !rects[index].intersects(rects[rect_index])) {
+            ++rect_index;
+            continue;
+        }
+
+        rects[index] = rects[index].united(rects[rect_index]);
+        rects.remove_unordered(rect_index);
+        // NOTE: Removing moves the last rectangle into the hole, which might be the one that grows.
+        if (index == rects.count())
+            index = rect_index;
+
+        // NOTE: The rectangle grew, so it might intersect the rectangles that were already checked.
+        rect_index = 0;
+    }
+    return index;
+}
+
+static void simplify_rects(Vector<IntRect>& rects, usize maximum_rect_count)
+{
+    if (rects.count() > maximum_exhaustive_rect_count && rects.count() > maximum_rect_count) {
+        while (rects.count() > maximum_exhaustive_rect_count && rects.count() > maximum_rect_count)
+            merge_neighbours(rects);
+        for (usize rect_index = 0; rect_index < rects.count(); ++rect_index)
+            absorb_intersecting_rects(rects, rect_index);
+    }
+
+    while (rects.count() > maximum_rect_count) {
+        usize best_first_index = 0;
+        usize best_second_index = 1;
+        s64 best_cost = merge_cost(rects[0], rects[1]);
+        for (usize first_index = 0; first_index < rects.count(); ++first_index) {
+            for (usize second_index = first_index + 1; second_index < rects.count(); ++second_index) {
+                const s64 cost = merge_cost(rects[first_index], rects[second_index]);
+                if (cost < best_cost) {
+                    best_cost = cost;
+                    best_first_index = first_index;
+                    best_second_index = second_index;
+                }
+            }
+        }
+
+        rects[best_first_index] = rects[best_first_index].united(rects[best_second_index]);
+        rects.remove_unordered(best_second_index);
+        const usize merged_index = (best_first_index < rects.count()) ? best_first_index : best_second_index;
+        absorb_intersecting_rects(rects, merged_index);
+    }
+}
+
+DamageTracker::DamageTracker(const IntRect& bounds, usize maximum_rect_count)
+    : m_bounds(bounds)
+    , m_maximum_rect_count(maximum_rect_count)
+{
+    VERIFY(m_maximum_rect_count > 0);
+}
+
+void DamageTracker::set_bounds(const IntRect& bounds)
+{
+    if (bounds == m_bounds)
+        return;
+    m_bounds = bounds;
+    invalidate_all();
+}
+
+void DamageTracker::invalidate(const IntRect& rect)
+{
+    const IntRect clipped_rect = rect.intersected(m_bounds);
+    if (clipped_rect.is_empty())
+        return;
+    m_damage.unite(clipped_rect);
+}
+
+void DamageTracker::invalidate(const Region& region)
+{
+    if (region.is_empty())
+        return;
+    if (m_bounds.contains(region.bounds())) {
+        m_damage.unite(region);
+        return;
+    }
+    m_damage.unite(region.intersected(Region(m_bounds)));
+}
+
+void DamageTracker::invalidate_all()
+{
+    m_damage = Region(m_bounds);
+}
+
+void DamageTracker::take_repaint_rects(Vector<IntRect>& repaint_rects)
+{
+    repaint_rects.clear();
+    const Span<const IntRect> rects = m_damage.rects();
+    for (usize rect_index = 0; rect_index < rects.count(); ++rect_index)
+        repaint_rects.add(rects[rect_index]);
+
+    m_damage.clear();
+    simplify_rects(repaint_rects, m_maximum_rect_count);
+}
+
+} // namespace Graphics
@@ -0,0 +1,52 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#pragma once
+
+#include <AT/Vector.h>
+#include <Graphics/API.h>
+#include <Graphics/Region.h>
+
+namespace Graphics {
+
+// Accumulates the parts of a window surface that were invalidated since the last repaint, so that only those parts
+// are rasterized again. Each window owns one tracker, whose bounds are the bounds of its surface.
+//
+// The damage is stored exactly, as a region. When the window is repainted, the region is simplified into a small
+// number of rectangles that cover it, because every repaint rectangle has a fixed cost: the drawing commands are
+// clipped and issued once per rectangle. Merging two rectangles into their bounds costs the pixels that are repainted
+// needlessly, so the pairs that waste the fewest pixels are merged first. A merged rectangle also absorbs the ones
+// it overlaps, so that no pixel is repainted twice, which would blend translucent commands twice.
+class DamageTracker {
+public:
+    static constexpr usize default_maximum_rect_count = 8;
+
+    GRAPHICS_API explicit DamageTracker(const IntRect& bounds = {}, usize maximum_rect_count = default_maximum_rect_count);
+
+    NODISCARD ALWAYS_INLINE const IntRect& bounds() const { return m_bounds; }
+    NODISCARD ALWAYS_INLINE usize maximum_rect_count() const { return m_maximum_rect_count; }
+
+    NODISCARD ALWAYS_INLINE bool has_damage() const { return !m_damage.is_empty(); }
+    NODISCARD ALWAYS_INLINE const Region& damage() const { return m_damage; }
+
+    // NOTE: The whole surface is damaged when its bounds change.
+    GRAPHICS_API void set_bounds(const IntRect& bounds);
+
+    // NOTE: The rectangle is clipped to the bounds of the surface.
+    GRAPHICS_API void invalidate(const IntRect& rect);
+    GRAPHICS_API void invalidate(const Region& region);
+    GRAPHICS_API void invalidate_all();
+
+    // Replaces the contents of the vector with at most `maximum_rect_count` rectangles that cover all the damaged
+    // pixels, and clears the damage. The rectangles never overlap, so each damaged pixel is repainted exactly once.
+    GRAPHICS_API void take_repaint_rects(Vector<IntRect>& repaint_rects);
+
+private:
+    IntRect m_bounds;
+    usize m_maximum_rect_count;
+    Region m_damage;
+};
+
+} // namespace Graphics
@@ -0,0 +1,463 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#include <AT/Assertions.h>
+#include <AT/Hash.h>
+#include <AT/MemoryOperations.h>
+#include <AT/New.h>
+#include <Graphics/DisplayList.h>
+
+// NOTE: Headers from the standard library.
+#include <cmath>
+
+namespace Graphics {
+
+// NOTE: Every record starts at a multiple of the alignment, so that the header and the payload can be accessed
+//       directly in the buffer.
+static constexpr usize command_alignment = 8;
+static constexpr usize initial_command_buffer_byte_count = 4096;
+
+struct CommandHeader {
+    DisplayCommandType type;
+    // NOTE: The size of the whole record, including the header, which is the offset of the next record.
+    u32 byte_count;
+    IntRect bounds;
+};
+
+static_assert(sizeof(CommandHeader) % command_alignment == 0);
+
+// NOTE: The rectangles of the batch directly follow the payload.
+struct FillRectsPayload {
+    Color color;
+    u32 rect_count;
+};
+
+struct BlitPayload {
+    u32 bitmap_index;
+    IntPoint position;
+    IntRect source_rect;
+};
+
+struct CompositePayload {
+    u32 bitmap_index;
+    IntPoint position;
+    IntRect source_rect;
+    BlendMode mode;
+    f32 opacity;
+};
+
+struct FillPathPayload {
+    u32 path_index;
+    Color color;
+    FillRule fill_rule;
+};
+
+struct FillPathWithPaintPayload {
+    u32 path_index;
+    u32 paint_index;
+    FillRule fill_rule;
+};
+
+struct PaintRectPayload {
+    u32 paint_index;
+    IntRect rect;
+};
+
+static_assert(sizeof(FillRectsPayload) % alignof(IntRect) == 0);
+
+NODISCARD ALWAYS_INLINE static constexpr usize align_command_size(usize byte_count)
+{
+    return (byte_count + command_alignment - 1) & ~(command_alignment - 1);
+}
+
+template<typename Payload>
+NODISCARD ALWAYS_INLINE static Payload* command_payload(CommandHeader* header)
+{
+    return reinterpret_cast<Payload*>(header + 1);
+}
+
+template<typename Payload>
+NODISCARD ALWAYS_INLINE static const Payload* command_payload(const CommandHeader* header)
+{
+    return reinterpret_cast<const Payload*>(header + 1);
+}
+
+// Returns true if the union of the two rectangles doesn't contain any pixel that is outside of both of them.
+NODISCARD static bool union_is_rect(const IntRect& first, const IntRect& second)
+{
+    const u64 united_area = first.united(second).area();
+    return united_area == first.area() + second.area() - first.intersected(second).area();
+}
+
+// The smallest rectangle of whole pixels that contains the rectangle.
+NODISCARD static IntRect enclosing_int_rect(const FloatRect& rect)
+{
+    const s32 left = static_cast<s32>(std::floor(rect.left()));
+    const s32 top = static_cast<s32>(std::floor(rect.top()));
+    const s32 right = static_cast<s32>(std::ceil(rect.right()));
+    const s32 bottom = static_cast<s32>(std::ceil(rect.bottom()));
+    return IntRect::from_edges(left, top, right, bottom);
+}
+
+// Clips the source rectangle of a blit to the bounds of the source bitmap, moving the position by the same amount.
+NODISCARD static bool clip_to_source(IntPoint& position, const Bitmap& source, IntRect& source_rect)
+{
+    const IntRect clipped_source_rect = source_rect.intersected(source.rect());
+    if (clipped_source_rect.is_empty())
+        return false;
+
+    position.x += clipped_source_rect.x - source_rect.x;
+    position.y += clipped_source_rect.y - source_rect.y;
+    source_rect = clipped_source_rect;
+    return true;
+}
+
+// The bounds of a blit are exactly its destination rectangle, so the part of the source to draw is found by moving
+// the clipped destination rectangle back into the source.
+NODISCARD static IntRect clipped_blit_source_rect(const IntRect& destination_rect, IntPoint position, const IntRect& source_rect)
+{
+    return {
+        source_rect.x + (destination_rect.x - position.x),
+        source_rect.y + (destination_rect.y - position.y),
+        destination_rect.width,
+        destination_rect.height,
+    };
+}
+
+DisplayList::DisplayList() = default;
+DisplayList::~DisplayList() = default;
+
+DisplayList::DisplayList(DisplayList&& other) noexcept
+    : m_command_buffer(move(other.m_command_buffer))
+    , m_command_byte_count(other.m_command_byte_count)
+    , m_command_count(other.m_command_count)
+    , m_last_command_offset(other.m_last_command_offset)
+    , m_bounds(other.m_bounds)
+    , m_bitmaps(move(other.m_bitmaps))
+    , m_paths(move(other.m_paths))
+    , m_paints(move(other.m_paints))
+{
+    other.m_command_byte_count = 0;
+    other.m_command_count = 0;
+    other.m_last_command_offset = 0;
+    other.m_bounds = {};
+}
+
+DisplayList& DisplayList::operator=(DisplayList&& other) noexcept
+{
+    // Handle self-assignment case.
+    if (this == &other)
+        return *this;
+
+    m_command_buffer = move(other.m_command_buffer);
+    m_command_byte_count = other.m_command_byte_count;
+    m_command_count = other.m_command_count;
+    m_last_command_offset = other.m_last_command_offset;
+    m_bounds = other.m_bounds;
+    m_bitmaps = move(other.m_bitmaps);
+    m_paths = move(other.m_paths);
+    m_paints = move(other.m_paints);
+
+    other.m_command_byte_count = 0;
+    other.m_command_count = 0;
+    other.m_last_command_offset = 0;
+    other.m_bounds = {};
+    return *this;
+}
+
+void DisplayList::clear()
+{
+    m_command_byte_count = 0;
+    m_command_count = 0;
+    m_last_command_offset = 0;
+    m_bounds = {};
+    m_bitmaps.clear();
+    m_paths.clear();
+    m_paints.clear();
+}
+
+Hash128 DisplayList::structural_hash() const
+{
+    Hasher hasher;
+    hasher.update_value(m_command_count);
+    hasher.update(ReadonlyByteSpan(m_command_buffer.bytes(), m_command_byte_count));
+
+    // NOTE: The bitmaps are identified by their address. The bitmaps of this list are alive, so the same address
+    //       can't refer to a different bitmap in another list while both lists exist.
+    for (usize bitmap_index = 0; bitmap_index < m_bitmaps.count(); ++bitmap_index)
+        hasher.update_value(reinterpret_cast<uintptr>(m_bitmaps[bitmap_index].get()));
+
+    for (usize path_index = 0; path_index < m_paths.count(); ++path_index) {
+        const Path& path = m_paths[path_index];
+        hasher.update_value(path.verbs().count());
+        hasher.update(ReadonlyByteSpan(reinterpret_cast<ReadonlyBytes>(path.verbs().elements()), path.verbs().count() * sizeof(PathVerb)));
+        hasher.update(ReadonlyByteSpan(reinterpret_cast<ReadonlyBytes>(path.points().elements()), path.points().count() * sizeof(FloatPoint)));
+    }
+
+    for (usize paint_index = 0; paint_index < m_paints.count(); ++paint_index)
+        hasher.update_value(m_paints[paint_index].structural_hash());
+
+    return hasher.finalize_128();
+}
+
+//
+// Recording.
+//
+
+void DisplayList::fill_rect(const IntRect& rect, Color color)
+{
+    if (rect.is_empty())
+        return;
+
+    if (m_command_count > 0) {
+        CommandHeader* header = reinterpret_cast<CommandHeader*>(m_command_buffer.bytes() + m_last_command_offset);
+        FillRectsPayload* payload = command_payload<FillRectsPayload>(header);
+        if (header->type == DisplayCommandType::FillRects && payload->color == color) {
+            header->bounds = header->bounds.united(rect);
+            m_bounds = m_bounds.united(rect);
+
+            IntRect* rects = reinterpret_cast<IntRect*>(payload + 1);
+            IntRect& last_rect = rects[payload->rect_count - 1];
+            if (union_is_rect(last_rect, rect)) {
+                last_rect = last_rect.united(rect);
+                return;
+            }
+
+            // NOTE: Extending the command might move the buffer, so the pointers have to be computed again.
+            extend_last_command(sizeof(IntRect));
+            header = reinterpret_cast<CommandHeader*>(m_command_buffer.bytes() + m_last_command_offset);
+            payload = command_payload<FillRectsPayload>(header);
+            new (reinterpret_cast<IntRect*>(payload + 1) + payload->rect_count) IntRect(rect);
+            ++payload->rect_count;
+            return;
+        }
+    }
+
+    const usize offset = allocate_command(DisplayCommandType::FillRects, rect, sizeof(FillRectsPayload) + sizeof(IntRect));
+    FillRectsPayload* payload = command_payload<FillRectsPayload>(reinterpret_cast<CommandHeader*>(m_command_buffer.bytes() + offset));
+    new (payload) FillRectsPayload { color, 1 };
+    new (payload + 1) IntRect(rect);
+}
+
+void DisplayList::blit(IntPoint position, RefPtr<Bitmap> source, const IntRect& source_rect)
+{
+    VERIFY(source.is_valid());
+    IntPoint clipped_position = position;
+    IntRect clipped_source_rect = source_rect;
+    if (!clip_to_source(clipped_position, *source, clipped_source_rect))
+        return;
+
+    // NOTE: Consecutive commands often draw from the same bitmap, such as an atlas, which is only referenced once.
+    if (m_bitmaps.is_empty() || m_bitmaps[m_bitmaps.count() - 1] != source)
+        m_bitmaps.add(move(source));
+
+    const IntRect bounds = { clipped_position.x, clipped_position.y, clipped_source_rect.width, clipped_source_rect.height };
+    const usize offset = allocate_command(DisplayCommandType::Blit, bounds, sizeof(BlitPayload));
+    BlitPayload* payload = command_payload<BlitPayload>(reinterpret_cast<CommandHeader*>(m_command_buffer.bytes() + offset));
+    new (payload) BlitPayload { static_cast<u32>(m_bitmaps.count() - 1), clipped_position, clipped_source_rect };
+}
+
+void DisplayList::composite(IntPoint position, RefPtr<Bitmap> source, const IntRect& source_rect, BlendMode mode, f32 opacity)
+{
+    VERIFY(source.is_valid());
+    if (!(opacity > 0.0F))
+        return;
+
+    IntPoint clipped_position = position;
+    IntRect clipped_source_rect = source_rect;
+    if (!clip_to_source(clipped_position, *source, clipped_source_rect))
+        return;
+
+    if (m_bitmaps.is_empty() || m_bitmaps[m_bitmaps.count() - 1] != source)
+        m_bitmaps.add(move(source));
+
+    const IntRect bounds = { clipped_position.x, clipped_position.y, clipped_source_rect.width, clipped_source_rect.height };
+    const usize offset = allocate_command(DisplayCommandType::Composite, bounds, sizeof(CompositePayload));
+    CompositePayload* payload = command_payload<CompositePayload>(reinterpret_cast<CommandHeader*>(m_command_buffer.bytes() + offset));
+    new (payload) CompositePayload { static_cast<u32>(m_bitmaps.count() - 1), clipped_position, clipped_source_rect, mode, opacity };
+}
+
+void DisplayList::fill_path(const Path& path, Color color, FillRule fill_rule)
+{
+    if (path.is_empty() || color.a == 0)
+        return;
+
+    // NOTE: The coverage of a pixel is never larger than zero outside of the bounds of the control points.
+    const IntRect bounds = enclosing_int_rect(path.bounding_box());
+    if (bounds.is_empty())
+        return;
+
+    m_paths.add(path);
+    const usize offset = allocate_command(DisplayCommandType::FillPath, bounds, sizeof(FillPathPayload));
+    FillPathPayload* payload = command_payload<FillPathPayload>(reinterpret_cast<CommandHeader*>(m_command_buffer.bytes() + offset));
+    new (payload) FillPathPayload { static_cast<u32>(m_paths.count() - 1), color, fill_rule };
+}
+
+void DisplayList::fill_path(const Path& path, const Paint& paint, FillRule fill_rule)
+{
+    if (paint.is_solid_color()) {
+        fill_path(path, paint.color(), fill_rule);
+        return;
+    }
+
+    if (path.is_empty())
+        return;
+    const IntRect bounds = enclosing_int_rect(path.bounding_box());
+    if (bounds.is_empty())
+        return;
+
+    m_paths.add(path);
+    m_paints.add(paint);
+    const usize offset = allocate_command(DisplayCommandType::FillPathWithPaint, bounds, sizeof(FillPathWithPaintPayload));
+    FillPathWithPaintPayload* payload =
+        command_payload<FillPathWithPaintPayload>(reinterpret_cast<CommandHeader*>(m_command_buffer.bytes() + offset));
+    new (payload) FillPathWithPaintPayload { static_cast<u32>(m_paths.count() - 1), static_cast<u32>(m_paints.count() - 1), fill_rule };
+}
+
+void DisplayList::paint_rect(const IntRect& rect, const Paint& paint)
+{
+    if (rect.is_empty())
+        return;
+
+    m_paints.add(paint);
+    const usize offset = allocate_command(DisplayCommandType::PaintRect, rect, sizeof(PaintRectPayload));
+    PaintRectPayload* payload = command_payload<PaintRectPayload>(reinterpret_cast<CommandHeader*>(m_command_buffer.bytes() + offset));
+    new (payload) PaintRectPayload { static_cast<u32>(m_paints.count() - 1), rect };
+}
+
+usize DisplayList::allocate_command(DisplayCommandType type, const IntRect& bounds, usize payload_byte_count)
+{
+    const usize record_byte_count = align_command_size(sizeof(CommandHeader) + payload_byte_count);
+    const usize offset = m_command_byte_count;
+    ensure_command_buffer_capacity(offset + record_byte_count);
+
+    // NOTE: The padding bytes of the record are hashed as well, so they must always have the same value.
+    set_memory(m_command_buffer.bytes() + offset, 0, record_byte_count);
+    new (m_command_buffer.bytes() + offset) CommandHeader { type, static_cast<u32>(record_byte_count), bounds };
+    m_command_byte_count += record_byte_count;
+    m_last_command_offset = offset;
+    ++m_command_count;
+    m_bounds = m_bounds.united(bounds);
+    return offset;
+}
+
+void DisplayList::extend_last_command(usize byte_count)
+{
+    VERIFY(m_command_count > 0);
+    const usize extension_byte_count = align_command_size(byte_count);
+    ensure_command_buffer_capacity(m_command_byte_count + extension_byte_count);
+    set_memory(m_command_buffer.bytes() + m_command_byte_count, 0, extension_byte_count);
+
+    CommandHeader* header = reinterpret_cast<CommandHeader*>(m_command_buffer.bytes() + m_last_command_offset);
+    header->byte_count += static_cast<u32>(extension_byte_count);
+    m_command_byte_count += extension_byte_count;
+}
+
+void DisplayList::ensure_command_buffer_capacity(usize byte_count)
+{
+    if (m_command_buffer.byte_count() >= byte_count)
+        return;
+
+    usize new_byte_count = 2 * m_command_buffer.byte_count();
+    if (new_byte_count < initial_command_buffer_byte_count)
+        new_byte_count = initial_command_buffer_byte_count;
+    if (new_byte_count < byte_count)
+        new_byte_count = byte_count;
+    m_command_buffer.expand(new_byte_count);
+}
+
+//
+// Replaying.
+//
+
+void DisplayList::replay(Bitmap& target, PathRasterizer& rasterizer) const
+{
+    replay_clipped(target, target.rect(), rasterizer);
+}
+
+void DisplayList::replay(Bitmap& target, Span<const IntRect> clip_rects, PathRasterizer& rasterizer) const
+{
+    for (usize rect_index = 0; rect_index < clip_rects.count(); ++rect_index) {
+        const IntRect clip_rect = clip_rects[rect_index].intersected(target.rect());
+        if (!clip_rect.is_empty())
+            replay_clipped(target, clip_rect, rasterizer);
+    }
+}
+
+void DisplayList::replay(Bitmap& target, const Region& clip_region, PathRasterizer& rasterizer) const
+{
+    replay(target, clip_region.rects(), rasterizer);
+}
+
+void DisplayList::replay_clipped(Bitmap& target, const IntRect& clip_rect, PathRasterizer& rasterizer) const
+{
+    if (!m_bounds.intersects(clip_rect))
+        return;
+
+    const ReadonlyBytes commands = m_command_buffer.bytes();
+    for (usize offset = 0; offset < m_command_byte_count;) {
+        const CommandHeader* header = reinterpret_cast<const CommandHeader*>(commands + offset);
+        offset += header->byte_count;
+        if (!header->bounds.intersects(clip_rect))
+            continue;
+
+        switch (header->type) {
+            case DisplayCommandType::FillRects: {
+                const FillRectsPayload* payload = command_payload<FillRectsPayload>(header);
+                const IntRect* rects = reinterpret_cast<const IntRect*>(payload + 1);
+                for (u32 rect_index = 0; rect_index < payload->rect_count; ++rect_index) {
+                    const IntRect clipped_rect = rects[rect_index].intersected(clip_rect);
+                    if (!clipped_rect.is_empty())
+                        target.fill_rect(clipped_rect, payload->color);
+                }
+                break;
+            }
+
+            case DisplayCommandType::Blit: {
+                const BlitPayload* payload = command_payload<BlitPayload>(header);
+                const IntRect destination_rect = header->bounds.intersected(clip_rect);
+                const IntRect source_rect = clipped_blit_source_rect(destination_rect, payload->position, payload->source_rect);
+                target.blit({ destination_rect.x, destination_rect.y }, m_bitmaps[payload->bitmap_index].deref(), source_rect);
+                break;
+            }
+
+            case DisplayCommandType::Composite: {
+                const CompositePayload* payload = command_payload<CompositePayload>(header);
+                const IntRect destination_rect = header->bounds.intersected(clip_rect);
+                const IntRect source_rect = clipped_blit_source_rect(destination_rect, payload->position, payload->source_rect);
+                Graphics::composite(
+                    target,
+                    { destination_rect.x, destination_rect.y },
+                    m_bitmaps[payload->bitmap_index].deref(),
+                    source_rect,
+                    payload->mode,
+                    payload->opacity
+                );
+                break;
+            }
+
+            case DisplayCommandType::FillPath: {
+                const FillPathPayload* payload = command_payload<FillPathPayload>(header);
+                rasterizer.fill_path(target, m_paths[payload->path_index], payload->color, payload->fill_rule, clip_rect);
+                break;
+            }
+
+            case DisplayCommandType::FillPathWithPaint: {
+                const FillPathWithPaintPayload* payload = command_payload<FillPathWithPaintPayload>(header);
+                const Paint& paint = m_paints[payload->paint_index];
+                rasterizer.fill_path(target, m_paths[payload->path_index], paint, payload->fill_rule, clip_rect);
+                break;
+            }
+
+            case DisplayCommandType::PaintRect: {
+                const PaintRectPayload* payload = command_payload<PaintRectPayload>(header);
+                Graphics::paint_rect(target, payload->rect.intersected(clip_rect), m_paints[payload->paint_index]);
+                break;
+            }
+        }
+    }
+}
+
+} // namespace Graphics
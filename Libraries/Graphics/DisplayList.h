@@ -0,0 +1,120 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#pragma once
+
+#include <AT/ByteBuffer.h>
+#include <AT/Hash.h>
+#include <AT/RefPtr.h>
+#include <AT/Span.h>
+#include <AT/Vector.h>
+#include <Graphics/API.h>
+#include <Graphics/Bitmap.h>
+#include <Graphics/Compositing.h>
+#include <Graphics/Paint.h>
+#include <Graphics/Path.h>
+#include <Graphics/PathRasterizer.h>
+#include <Graphics/Region.h>
+
+namespace Graphics {
+
+enum class DisplayCommandType : u8 {
+    // Solid color rectangles, which replace the pixels of the target.
+    FillRects,
+    Blit,
+    Composite,
+    FillPath,
+    FillPathWithPaint,
+    PaintRect,
+};
+
+// Sequence of draw commands that is recorded once and rasterized later, possibly on another thread.
+//
+// The commands are stored one after another in a single buffer, as fixed-layout records whose size depends on their
+// type. The buffer behaves like an arena: recording a command only bumps the end of the buffer, and clearing the
+// list keeps the memory, so recording the next frame doesn't allocate once the buffer is large enough. Resources
+// that can't be stored in the buffer, such as bitmaps, paths and paints, are kept in side tables and referenced by
+// their index.
+//
+// Every command stores the bounds of the pixels it can touch, which lets the replay skip the commands that don't
+// intersect the damaged part of the target without decoding them any further.
+//
+// Consecutive solid color fills are recorded as a single batch: a fill with the same color as the previous one is
+// appended to its command, and it is merged into the previous rectangle when their union is a rectangle too. As the
+// fills of a batch replace the pixels with the same color, their order inside the batch doesn't matter.
+//
+// NOTE: Once recording is done, the list can be handed over to another thread, which replays it while the
+//       recording thread moves on. Replaying never modifies the list, nor does it touch the reference counts of
+//       the bitmaps, which are kept alive by the list. The list must not be recorded into or destroyed while it is
+//       being replayed.
+class DisplayList {
+    AT_MAKE_NONCOPYABLE(DisplayList);
+
+public:
+    GRAPHICS_API DisplayList();
+    GRAPHICS_API ~DisplayList();
+
+    GRAPHICS_API DisplayList(DisplayList&& other) noexcept;
+    GRAPHICS_API DisplayList& operator=(DisplayList&& other) noexcept;
+
+public:
+    NODISCARD ALWAYS_INLINE usize command_count() const { return m_command_count; }
+    NODISCARD ALWAYS_INLINE bool is_empty() const { return (m_command_count == 0); }
+
+    // NOTE: The number of bytes used by the commands, excluding the side tables.
+    NODISCARD ALWAYS_INLINE usize command_byte_count() const { return m_command_byte_count; }
+
+    // NOTE: The union of the bounds of all commands, which is empty if the list is empty.
+    NODISCARD ALWAYS_INLINE const IntRect& bounds() const { return m_bounds; }
+
+    // Hash of the commands and of the resources they reference, which is equal for two lists that draw exactly the
+    // same thing in the same way. Layers compare it to decide whether their cached pixels are still valid.
+    // NOTE: Bitmaps are hashed by identity rather than by content, so they must not be modified while recorded.
+    NODISCARD GRAPHICS_API Hash128 structural_hash() const;
+
+    // Removes all the commands and releases the resources they reference, but keeps the memory of the buffer.
+    GRAPHICS_API void clear();
+
+public:
+    GRAPHICS_API void fill_rect(const IntRect& rect, Color color);
+    GRAPHICS_API void blit(IntPoint position, RefPtr<Bitmap> source, const IntRect& source_rect);
+    GRAPHICS_API void composite(IntPoint position, RefPtr<Bitmap> source, const IntRect& source_rect, BlendMode mode, f32 opacity = 1.0F);
+    GRAPHICS_API void fill_path(const Path& path, Color color, FillRule fill_rule = FillRule::NonZero);
+    GRAPHICS_API void fill_path(const Path& path, const Paint& paint, FillRule fill_rule = FillRule::NonZero);
+    GRAPHICS_API void paint_rect(const IntRect& rect, const Paint& paint);
+
+public:
+    // Rasterizes all the commands into the target.
+    GRAPHICS_API void replay(Bitmap& target, PathRasterizer& rasterizer) const;
+
+    // Rasterizes the commands clipped to each of the rectangles, which shouldn't overlap. The commands whose bounds
+    // don't intersect a rectangle are skipped.
+    GRAPHICS_API void replay(Bitmap& target, Span<const IntRect> clip_rects, PathRasterizer& rasterizer) const;
+    GRAPHICS_API void replay(Bitmap& target, const Region& clip_region, PathRasterizer& rasterizer) const;
+
+private:
+    // Reserves a record for a command at the end of the buffer and returns its offset. The payload of the command
+    // directly follows its header, which is filled in by this function.
+    usize allocate_command(DisplayCommandType type, const IntRect& bounds, usize payload_byte_count);
+
+    // Reserves bytes at the end of the last recorded command, which must be the command that grows.
+    void extend_last_command(usize byte_count);
+
+    void ensure_command_buffer_capacity(usize byte_count);
+    void replay_clipped(Bitmap& target, const IntRect& clip_rect, PathRasterizer& rasterizer) const;
+
+private:
+    ByteBuffer m_command_buffer;
+    usize m_command_byte_count { 0 };
+    usize m_command_count { 0 };
+    usize m_last_command_offset { 0 };
+    IntRect m_bounds;
+
+    Vector<RefPtr<Bitmap>> m_bitmaps;
+    Vector<Path> m_paths;
+    Vector<Paint> m_paints;
+};
+
+} // namespace Graphics
@@ -0,0 +1,899 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#include <AT/Assertions.h>
+#include <AT/BitOperations.h>
+#include <AT/NumericLimits.h>
+#include <Graphics/Font/Font.h>
+
+namespace Graphics {
+
+//
+// Reading the big-endian values of the tables.
+//
+
+NODISCARD ALWAYS_INLINE static constexpr u32 make_table_tag(char a, char b, char c, char d)
+{
+    return (static_cast<u32>(static_cast<u8>(a)) << 24) | (static_cast<u32>(static_cast<u8>(b)) << 16) |
+           (static_cast<u32>(static_cast<u8>(c)) << 8) | static_cast<u32>(static_cast<u8>(d));
+}
+
+static constexpr u32 collection_tag = make_table_tag('t', 't', 'c', 'f');
+static constexpr u32 truetype_outlines_tag = 0x00010000;
+static constexpr u32 apple_truetype_outlines_tag = make_table_tag('t', 'r', 'u', 'e');
+static constexpr u32 cff_outlines_tag = make_table_tag('O', 'T', 'T', 'O');
+static constexpr u32 kern_feature_tag = make_table_tag('k', 'e', 'r', 'n');
+
+// NOTE: Nested composite glyphs are legal, but real fonts never nest them deeply. The limit protects against
+//       malformed fonts where a glyph references itself.
+static constexpr u32 maximum_composite_glyph_depth = 8;
+
+// NOTE: The depth alone doesn't bound the work, as every level of a malformed font can reference the level below
+//       many times. The components and the points of all the levels of a glyph are counted against these limits,
+//       which are far above what the largest glyphs of real fonts need.
+static constexpr u32 maximum_glyph_component_count = 256;
+static constexpr u32 maximum_glyph_point_count = 256 * 1024;
+
+// NOTE: The reads are bounds checked and return zero past the end of the span, so that malformed tables degrade
+//       into missing data instead of out of bounds reads.
+NODISCARD ALWAYS_INLINE static bool has_bytes(ReadonlyByteSpan bytes, usize offset, usize byte_count)
+{
+    return (offset <= bytes.count()) && (byte_count <= bytes.count() - offset);
+}
+
+NODISCARD ALWAYS_INLINE static u8 read_u8(ReadonlyByteSpan bytes, usize offset)
+{
+    return has_bytes(bytes, offset, 1) ? bytes[offset] : 0;
+}
+
+NODISCARD ALWAYS_INLINE static u16 read_u16(ReadonlyByteSpan bytes, usize offset)
+{
+    if (!has_bytes(bytes, offset, 2))
+        return 0;
+    return static_cast<u16>((bytes[offset] << 8) | bytes[offset + 1]);
+}
+
+NODISCARD ALWAYS_INLINE static s16 read_s16(ReadonlyByteSpan bytes, usize offset)
+{
+    return static_cast<s16>(read_u16(bytes, offset));
+}
+
+NODISCARD ALWAYS_INLINE static u32 read_u32(ReadonlyByteSpan bytes, usize offset)
+{
+    return (static_cast<u32>(read_u16(bytes, offset)) << 16) | read_u16(bytes, offset + 2);
+}
+
+// Returns the bytes in the given range, or an empty span if the range is outside of the bytes.
+NODISCARD static ReadonlyByteSpan sub_span(ReadonlyByteSpan bytes, usize offset, usize byte_count)
+{
+    if (!has_bytes(bytes, offset, byte_count))
+        return {};
+    return ReadonlyByteSpan(bytes.elements() + offset, byte_count);
+}
+
+// The bytes from the offset to the end of the span, for the tables whose length is not stored in their header.
+NODISCARD static ReadonlyByteSpan tail_span(ReadonlyByteSpan bytes, usize offset)
+{
+    if (offset >= bytes.count())
+        return {};
+    return ReadonlyByteSpan(bytes.elements() + offset, bytes.count() - offset);
+}
+
+//
+// Layout tables, which are shared by all the lookups of GPOS.
+//
+
+// Returns the index of the glyph in the coverage table, or an empty optional if the glyph isn't covered.
+NODISCARD static Optional<u32> coverage_index(ReadonlyByteSpan coverage, u32 glyph_id)
+{
+    const u16 format = read_u16(coverage, 0);
+    const u32 count = read_u16(coverage, 2);
+
+    if (format == 1) {
+        // NOTE: The glyphs are sorted, so the index is found with a binary search.
+        u32 low = 0;
+        u32 high = count;
+        while (low < high) {
+            const u32 middle = low + (high - low) / 2;
+            const u16 middle_glyph_id = read_u16(coverage, 4 + 2 * middle);
+            if (middle_glyph_id == glyph_id)
+                return middle;
+            if (middle_glyph_id < glyph_id)
+                low = middle + 1;
+            else
+                high = middle;
+        }
+        return {};
+    }
+
+    if (format == 2) {
+        // NOTE: Each range record is the first glyph, the last glyph and the coverage index of the first glyph.
+        u32 low = 0;
+        u32 high = count;
+        while (low < high) {
+            const u32 middle = low + (high - low) / 2;
+            const usize record_offset = 4 + 6 * static_cast<usize>(middle);
+            const u16 first_glyph_id = read_u16(coverage, record_offset);
+            const u16 last_glyph_id = read_u16(coverage, record_offset + 2);
+            if (glyph_id < first_glyph_id)
+                high = middle;
+            else if (glyph_id > last_glyph_id)
+                low = middle + 1;
+            else
+                return read_u16(coverage, record_offset + 4) + (glyph_id - first_glyph_id);
+        }
+        return {};
+    }
+
+    return {};
+}
+
+// Returns the class of the glyph, where glyphs that are not listed belong to class zero.
+NODISCARD static u32 glyph_class(ReadonlyByteSpan class_definition, u32 glyph_id)
+{
+    const u16 format = read_u16(class_definition, 0);
+
+    if (format == 1) {
+        const u32 start_glyph_id = read_u16(class_definition, 2);
+        const u32 glyph_count = read_u16(class_definition, 4);
+        if (glyph_id < start_glyph_id || glyph_id - start_glyph_id >= glyph_count)
+            return 0;
+        return read_u16(class_definition, 6 + 2 * static_cast<usize>(glyph_id - start_glyph_id));
+    }
+
+    if (format == 2) {
+        u32 low = 0;
+        u32 high = read_u16(class_definition, 2);
+        while (low < high) {
+            const u32 middle = low + (high - low) / 2;
+            const usize record_offset = 4 + 6 * static_cast<usize>(middle);
+            const u16 first_glyph_id = read_u16(class_definition, record_offset);
+            const u16 last_glyph_id = read_u16(class_definition, record_offset + 2);
+            if (glyph_id < first_glyph_id)
+                high = middle;
+            else if (glyph_id > last_glyph_id)
+                low = middle + 1;
+            else
+                return read_u16(class_definition, record_offset + 4);
+        }
+        return 0;
+    }
+
+    return 0;
+}
+
+// NOTE: Every field that is present in a value record occupies two bytes, and the fields are stored in the order of
+//       their bits in the value format.
+NODISCARD ALWAYS_INLINE static usize value_record_byte_count(u16 value_format)
+{
+    return 2 * static_cast<usize>(population_count(value_format & 0xFF));
+}
+
+// Reads the horizontal advance adjustment of a value record, which is zero if the record doesn't have one.
+NODISCARD static s16 value_record_x_advance(ReadonlyByteSpan bytes, usize record_offset, u16 value_format)
+{
+    static constexpr u16 x_advance_flag = 0x0004;
+    if (!(value_format & x_advance_flag))
+        return 0;
+    // NOTE: Only the x and y placements can precede the x advance.
+    return read_s16(bytes, record_offset + value_record_byte_count(value_format & 0x0003));
+}
+
+// Looks up the pair in a pair adjustment subtable of either format. Returns an empty optional if the subtable
+// doesn't apply to the pair.
+NODISCARD static Optional<s16> pair_adjustment(ReadonlyByteSpan subtable, u32 left_glyph_id, u32 right_glyph_id)
+{
+    const u16 format = read_u16(subtable, 0);
+    const Optional<u32> left_coverage_index = coverage_index(tail_span(subtable, read_u16(subtable, 2)), left_glyph_id);
+    if (!left_coverage_index.has_value())
+        return {};
+
+    const u16 first_value_format = read_u16(subtable, 4);
+    const u16 second_value_format = read_u16(subtable, 6);
+    const usize value_records_byte_count = value_record_byte_count(first_value_format) + value_record_byte_count(second_value_format);
+
+    if (format == 1) {
+        // NOTE: Each covered left glyph has a set of pair records, sorted by the right glyph.
+        const u32 pair_set_count = read_u16(subtable, 8);
+        if (left_coverage_index.value() >= pair_set_count)
+            return {};
+        const ReadonlyByteSpan pair_set = tail_span(subtable, read_u16(subtable, 10 + 2 * static_cast<usize>(left_coverage_index.value())));
+
+        const usize record_byte_count = 2 + value_records_byte_count;
+        u32 low = 0;
+        u32 high = read_u16(pair_set, 0);
+        while (low < high) {
+            const u32 middle = low + (high - low) / 2;
+            const usize record_offset = 2 + record_byte_count * middle;
+            const u16 middle_glyph_id = read_u16(pair_set, record_offset);
+            if (middle_glyph_id == right_glyph_id)
+                return value_record_x_advance(pair_set, record_offset + 2, first_value_format);
+            if (middle_glyph_id < right_glyph_id)
+                low = middle + 1;
+            else
+                high = middle;
+        }
+        return {};
+    }
+
+    if (format == 2) {
+        // NOTE: The adjustments are stored in a matrix, indexed by the classes of the left and the right glyph.
+        const u32 left_class = glyph_class(tail_span(subtable, read_u16(subtable, 8)), left_glyph_id);
+        const u32 right_class = glyph_class(tail_span(subtable, read_u16(subtable, 10)), right_glyph_id);
+        const u32 left_class_count = read_u16(subtable, 12);
+        const u32 right_class_count = read_u16(subtable, 14);
+        if (left_class >= left_class_count || right_class >= right_class_count)
+            return {};
+
+        const usize record_offset = 16 + value_records_byte_count * (static_cast<usize>(left_class) * right_class_count + right_class);
+        return value_record_x_advance(subtable, record_offset, first_value_format);
+    }
+
+    return {};
+}
+
+//
+// Loading.
+//
+
+Optional<Font> Font::open(StringView filepath, u32 face_index)
+{
+    Optional<MappedFile> mapped_file = MappedFile::open(filepath);
+    if (!mapped_file.has_value())
+        return {};
+
+    Font font;
+    font.m_mapped_file = move(mapped_file.value());
+    if (!font.load(font.m_mapped_file.byte_span(), face_index))
+        return {};
+
+    // NOTE: Glyphs are accessed in no particular order, so read-ahead would mostly load pages that are never used.
+    font.m_mapped_file.advise(MappedFileAccessPattern::Random);
+    return move(font);
+}
+
+Optional<Font> Font::from_bytes(ReadonlyByteSpan bytes, u32 face_index)
+{
+    Font font;
+    if (!font.load(bytes, face_index))
+        return {};
+    return move(font);
+}
+
+Font::Font() = default;
+Font::~Font() = default;
+
+Font::Font(Font&& other) noexcept = default;
+Font& Font::operator=(Font&& other) noexcept = default;
+
+bool Font::load(ReadonlyByteSpan bytes, u32 face_index)
+{
+    m_bytes = bytes;
+
+    usize directory_offset = 0;
+    if (read_u32(bytes, 0) == collection_tag) {
+        const u32 face_count = read_u32(bytes, 8);
+        if (face_index >= face_count)
+            return false;
+        directory_offset = read_u32(bytes, 12 + 4 * static_cast<usize>(face_index));
+    }
+    else if (face_index != 0) {
+        return false;
+    }
+
+    const u32 outlines_tag = read_u32(bytes, directory_offset);
+    if (outlines_tag != truetype_outlines_tag && outlines_tag != apple_truetype_outlines_tag && outlines_tag != cff_outlines_tag)
+        return false;
+
+    const u32 table_count = read_u16(bytes, directory_offset + 4);
+    if (!has_bytes(bytes, directory_offset + 12, 16 * static_cast<usize>(table_count)))
+        return false;
+
+    ReadonlyByteSpan head_table;
+    ReadonlyByteSpan maxp_table;
+    ReadonlyByteSpan hhea_table;
+    for (u32 table_index = 0; table_index < table_count; ++table_index) {
+        const usize record_offset = directory_offset + 12 + 16 * static_cast<usize>(table_index);
+        const u32 tag = read_u32(bytes, record_offset);
+        // NOTE: A table that lies outside of the file is treated as if it was missing.
+        const ReadonlyByteSpan table = sub_span(bytes, read_u32(bytes, record_offset + 8), read_u32(bytes, record_offset + 12));
+
+        switch (tag) {
+            case make_table_tag('h', 'e', 'a', 'd'): head_table = table; break;
+            case make_table_tag('m', 'a', 'x', 'p'): maxp_table = table; break;
+            case make_table_tag('h', 'h', 'e', 'a'): hhea_table = table; break;
+            case make_table_tag('c', 'm', 'a', 'p'): m_cmap_table = table; break;
+            case make_table_tag('h', 'm', 't', 'x'): m_hmtx_table = table; break;
+            case make_table_tag('l', 'o', 'c', 'a'): m_loca_table = table; break;
+            case make_table_tag('g', 'l', 'y', 'f'): m_glyf_table = table; break;
+            case make_table_tag('k', 'e', 'r', 'n'): m_kern_table = table; break;
+            case make_table_tag('G', 'P', 'O', 'S'): m_gpos_table = table; break;
+            default: break;
+        }
+    }
+
+    // NOTE: The header and the glyph count are required by every query, so a font without them is rejected.
+    if (head_table.count() < 54 || maxp_table.count() < 6)
+        return false;
+
+    m_units_per_em = read_u16(head_table, 18);
+    if (m_units_per_em < 16 || m_units_per_em > 16384)
+        return false;
+    m_has_long_glyph_locations = (read_s16(head_table, 50) != 0);
+    m_glyph_count = read_u16(maxp_table, 4);
+
+    if (hhea_table.count() >= 36) {
+        m_ascender = read_s16(hhea_table, 4);
+        m_descender = read_s16(hhea_table, 6);
+        m_line_gap = read_s16(hhea_table, 8);
+        m_horizontal_metric_count = read_u16(hhea_table, 34);
+    }
+
+    // NOTE: The metrics that don't fit in the table are ignored, instead of being checked on every access.
+    if (m_horizontal_metric_count > m_hmtx_table.count() / 4)
+        m_horizontal_metric_count = static_cast<u32>(m_hmtx_table.count() / 4);
+
+    // NOTE: The outlines can only be used if the location of every glyph is known.
+    const usize glyph_location_byte_count = m_has_long_glyph_locations ? 4 : 2;
+    if (m_loca_table.count() < (static_cast<usize>(m_glyph_count) + 1) * glyph_location_byte_count)
+        m_glyf_table = {};
+
+    select_character_map();
+    collect_pair_adjustment_subtables();
+    return true;
+}
+
+void Font::select_character_map()
+{
+    // NOTE: Subtables that map the full Unicode range are preferred over the ones limited to the BMP.
+    u32 best_score = 0;
+    const u32 subtable_count = read_u16(m_cmap_table, 2);
+    for (u32 subtable_index = 0; subtable_index < subtable_count; ++subtable_index) {
+        const usize record_offset = 4 + 8 * static_cast<usize>(subtable_index);
+        const u16 platform_id = read_u16(m_cmap_table, record_offset);
+        const u16 encoding_id = read_u16(m_cmap_table, record_offset + 2);
+        const u32 subtable_offset = read_u32(m_cmap_table, record_offset + 4);
+
+        const bool is_unicode = (platform_id == 0) || (platform_id == 3 && (encoding_id == 1 || encoding_id == 10));
+        if (!is_unicode)
+            continue;
+
+        const u16 format = read_u16(m_cmap_table, subtable_offset);
+        u32 score = 0;
+        ReadonlyByteSpan subtable;
+        if (format == 4) {
+            score = 1;
+            subtable = sub_span(m_cmap_table, subtable_offset, read_u16(m_cmap_table, subtable_offset + 2));
+        }
+        else if (format == 12) {
+            score = 2;
+            subtable = sub_span(m_cmap_table, subtable_offset, read_u32(m_cmap_table, subtable_offset + 4));
+        }
+
+        if (score > best_score && subtable.count() > 0) {
+            best_score = score;
+            m_character_map = subtable;
+        }
+    }
+}
+
+void Font::collect_pair_adjustment_subtables()
+{
+    static constexpr u16 pair_adjustment_lookup_type = 2;
+    static constexpr u16 extension_lookup_type = 9;
+
+    if (m_gpos_table.count() < 10 || read_u16(m_gpos_table, 0) != 1)
+        return;
+
+    const ReadonlyByteSpan feature_list = tail_span(m_gpos_table, read_u16(m_gpos_table, 6));
+    const ReadonlyByteSpan lookup_list = tail_span(m_gpos_table, read_u16(m_gpos_table, 8));
+    const u32 lookup_count = read_u16(lookup_list, 0);
+
+    // NOTE: The lookups of every `kern` feature are applied, regardless of the script and the language they are
+    //       registered for, as the text isn't segmented by script yet.
+    Vector<bool> is_kern_lookup;
+    for (u32 lookup_index = 0; lookup_index < lookup_count; ++lookup_index)
+        is_kern_lookup.add(false);
+
+    const u32 feature_count = read_u16(feature_list, 0);
+    for (u32 feature_index = 0; feature_index < feature_count; ++feature_index) {
+        const usize record_offset = 2 + 6 * static_cast<usize>(feature_index);
+        if (read_u32(feature_list, record_offset) != kern_feature_tag)
+            continue;
+
+        const ReadonlyByteSpan feature = tail_span(feature_list, read_u16(feature_list, record_offset + 4));
+        const u32 feature_lookup_count = read_u16(feature, 2);
+        for (u32 index = 0; index < feature_lookup_count; ++index) {
+            const u16 lookup_index = read_u16(feature, 4 + 2 * static_cast<usize>(index));
+            if (lookup_index < lookup_count)
+                is_kern_lookup[lookup_index] = true;
+        }
+    }
+
+    const usize lookup_list_offset = static_cast<usize>(lookup_list.elements() - m_gpos_table.elements());
+    for (u32 lookup_index = 0; lookup_index < lookup_count; ++lookup_index) {
+        if (!is_kern_lookup[lookup_index])
+            continue;
+
+        const usize lookup_offset = lookup_list_offset + read_u16(lookup_list, 2 + 2 * static_cast<usize>(lookup_index));
+        const u16 lookup_type = read_u16(m_gpos_table, lookup_offset);
+        const u32 subtable_count = read_u16(m_gpos_table, lookup_offset + 4);
+        for (u32 subtable_index = 0; subtable_index < subtable_count; ++subtable_index) {
+            usize subtable_offset = lookup_offset + read_u16(m_gpos_table, lookup_offset + 6 + 2 * static_cast<usize>(subtable_index));
+            u16 subtable_type = lookup_type;
+
+            // NOTE: Extension subtables only wrap a subtable of another type, stored at a 32-bit offset.
+            if (lookup_type == extension_lookup_type) {
+                subtable_type = read_u16(m_gpos_table, subtable_offset + 2);
+                subtable_offset += read_u32(m_gpos_table, subtable_offset + 4);
+            }
+
+            if (subtable_type == pair_adjustment_lookup_type && subtable_offset < m_gpos_table.count())
+                m_pair_adjustment_subtables.add({ static_cast<u32>(subtable_offset), static_cast<u16>(lookup_index) });
+        }
+    }
+}
+
+//
+// Character mapping and metrics.
+//
+
+u32 Font::glyph_id(u32 code_point) const
+{
+    const ReadonlyByteSpan map = m_character_map;
+    const u16 format = read_u16(map, 0);
+    u32 glyph_id = missing_glyph_id;
+
+    if (format == 4) {
+        if (code_point > 0xFFFF)
+            return missing_glyph_id;
+
+        // NOTE: The segments are described by four parallel arrays, and are sorted by their last code point.
+        const usize segment_count = read_u16(map, 6) / 2;
+        const usize end_codes_offset = 14;
+        const usize start_codes_offset = end_codes_offset + 2 * segment_count + 2;
+        const usize deltas_offset = start_codes_offset + 2 * segment_count;
+        const usize range_offsets_offset = deltas_offset + 2 * segment_count;
+
+        usize low = 0;
+        usize high = segment_count;
+        while (low < high) {
+            const usize middle = low + (high - low) / 2;
+            if (read_u16(map, end_codes_offset + 2 * middle) < code_point)
+                low = middle + 1;
+            else
+                high = middle;
+        }
+        if (low == segment_count)
+            return missing_glyph_id;
+
+        const u16 start_code = read_u16(map, start_codes_offset + 2 * low);
+        if (code_point < start_code)
+            return missing_glyph_id;
+
+        const u16 delta = read_u16(map, deltas_offset + 2 * low);
+        const usize range_offset_offset = range_offsets_offset + 2 * low;
+        const u16 range_offset = read_u16(map, range_offset_offset);
+        if (range_offset == 0) {
+            glyph_id = (code_point + delta) & 0xFFFF;
+        }
+        else {
+            // NOTE: The range offset is relative to its own location in the subtable.
+            const u16 mapped_glyph_id = read_u16(map, range_offset_offset + range_offset + 2 * (code_point - start_code));
+            glyph_id = (mapped_glyph_id != 0) ? ((mapped_glyph_id + delta) & 0xFFFF) : missing_glyph_id;
+        }
+    }
+    else if (format == 12) {
+        // NOTE: Each group maps a range of code points to a range of consecutive glyphs.
+        usize low = 0;
+        usize high = read_u32(map, 12);
+        while (low < high) {
+            const usize middle = low + (high - low) / 2;
+            const usize group_offset = 16 + 12 * middle;
+            const u32 start_code_point = read_u32(map, group_offset);
+            const u32 end_code_point = read_u32(map, group_offset + 4);
+            if (code_point < start_code_point) {
+                high = middle;
+            }
+            else if (code_point > end_code_point) {
+                low = middle + 1;
+            }
+            else {
+                glyph_id = read_u32(map, group_offset + 8) + (code_point - start_code_point);
+                break;
+            }
+        }
+    }
+
+    return (glyph_id < m_glyph_count) ? glyph_id : missing_glyph_id;
+}
+
+GlyphMetrics Font::glyph_metrics(u32 glyph_id) const
+{
+    if (glyph_id >= m_glyph_count || m_horizontal_metric_count == 0)
+        return {};
+
+    // NOTE: The glyphs after the last full metric share its advance, and only store their side bearing.
+    if (glyph_id < m_horizontal_metric_count)
+        return { read_u16(m_hmtx_table, 4 * static_cast<usize>(glyph_id)), read_s16(m_hmtx_table, 4 * static_cast<usize>(glyph_id) + 2) };
+
+    const usize long_metrics_byte_count = 4 * static_cast<usize>(m_horizontal_metric_count);
+    const usize side_bearing_offset = long_metrics_byte_count + 2 * static_cast<usize>(glyph_id - m_horizontal_metric_count);
+    return { read_u16(m_hmtx_table, long_metrics_byte_count - 4), read_s16(m_hmtx_table, side_bearing_offset) };
+}
+
+//
+// Kerning.
+//
+
+s16 Font::kerning(u32 left_glyph_id, u32 right_glyph_id) const
+{
+    // NOTE: A font that has kerning in GPOS might keep a smaller `kern` table for older software, which is ignored.
+    const Optional<s16> adjustment = gpos_kerning(left_glyph_id, right_glyph_id);
+    if (adjustment.has_value())
+        return adjustment.value();
+    return kern_table_kerning(left_glyph_id, right_glyph_id);
+}
+
+Optional<s16> Font::gpos_kerning(u32 left_glyph_id, u32 right_glyph_id) const
+{
+    if (m_pair_adjustment_subtables.is_empty())
+        return {};
+
+    // NOTE: Within a lookup only the first subtable that applies to the pair is used, while the adjustments of
+    //       separate lookups are accumulated.
+    s32 total_adjustment = 0;
+    u32 applied_lookup_index = NumericLimits<u32>::max();
+    for (usize subtable_index = 0; subtable_index < m_pair_adjustment_subtables.count(); ++subtable_index) {
+        const PairAdjustmentSubtable& subtable = m_pair_adjustment_subtables[subtable_index];
+        if (subtable.lookup_index == applied_lookup_index)
+            continue;
+
+        const Optional<s16> adjustment = pair_adjustment(tail_span(m_gpos_table, subtable.offset), left_glyph_id, right_glyph_id);
+        if (adjustment.has_value()) {
+            total_adjustment += adjustment.value();
+            applied_lookup_index = subtable.lookup_index;
+        }
+    }
+    return static_cast<s16>(total_adjustment);
+}
+
+s16 Font::kern_table_kerning(u32 left_glyph_id, u32 right_glyph_id) const
+{
+    // NOTE: Only the version of the table used by OpenType is supported, whose subtables start with a 16-bit header.
+    if (read_u16(m_kern_table, 0) != 0)
+        return 0;
+
+    const u32 pair_key = (left_glyph_id << 16) | right_glyph_id;
+    s32 total_adjustment = 0;
+    const u32 subtable_count = read_u16(m_kern_table, 2);
+    usize subtable_offset = 4;
+    for (u32 subtable_index = 0; subtable_index < subtable_count; ++subtable_index) {
+        const u16 subtable_byte_count = read_u16(m_kern_table, subtable_offset + 2);
+        const u16 coverage = read_u16(m_kern_table, subtable_offset + 4);
+        const ReadonlyByteSpan subtable = sub_span(m_kern_table, subtable_offset, subtable_byte_count);
+        subtable_offset += subtable_byte_count;
+
+        // NOTE: Only horizontal kerning in the format of sorted pairs is supported. Subtables that hold minimum
+        //       values or cross-stream adjustments don't describe the advance.
+        const bool is_horizontal = (coverage & 0x0001) != 0;
+        const bool is_minimum_or_cross_stream = (coverage & 0x0006) != 0;
+        if ((coverage >> 8) != 0 || !is_horizontal || is_minimum_or_cross_stream || subtable_byte_count < 14)
+            continue;
+
+        usize low = 0;
+        usize high = read_u16(subtable, 6);
+        while (low < high) {
+            const usize middle = low + (high - low) / 2;
+            const usize pair_offset = 14 + 6 * middle;
+            const u32 middle_key = read_u32(subtable, pair_offset);
+            if (middle_key == pair_key) {
+                total_adjustment += read_s16(subtable, pair_offset + 4);
+                break;
+            }
+            if (middle_key < pair_key)
+                low = middle + 1;
+            else
+                high = middle;
+        }
+    }
+    return static_cast<s16>(total_adjustment);
+}
+
+//
+// Outlines.
+//
+
+ReadonlyByteSpan Font::glyph_data(u32 glyph_id) const
+{
+    if (glyph_id >= m_glyph_count || m_glyf_table.count() == 0)
+        return {};
+
+    usize offset;
+    usize next_offset;
+    if (m_has_long_glyph_locations) {
+        offset = read_u32(m_loca_table, 4 * static_cast<usize>(glyph_id));
+        next_offset = read_u32(m_loca_table, 4 * static_cast<usize>(glyph_id) + 4);
+    }
+    else {
+        // NOTE: The short format stores the offsets divided by two.
+        offset = 2 * static_cast<usize>(read_u16(m_loca_table, 2 * static_cast<usize>(glyph_id)));
+        next_offset = 2 * static_cast<usize>(read_u16(m_loca_table, 2 * static_cast<usize>(glyph_id) + 2));
+    }
+
+    // NOTE: Glyphs without an outline have the same offset as the next glyph.
+    if (next_offset <= offset)
+        return {};
+    return sub_span(m_glyf_table, offset, next_offset - offset);
+}
+
+Optional<GlyphBoundingBox> Font::glyph_bounding_box(u32 glyph_id) const
+{
+    const ReadonlyByteSpan glyph = glyph_data(glyph_id);
+    if (glyph.count() < 10)
+        return {};
+    return GlyphBoundingBox { read_s16(glyph, 2), read_s16(glyph, 4), read_s16(glyph, 6), read_s16(glyph, 8) };
+}
+
+bool Font::append_glyph_outline(u32 glyph_id, Path& path, FloatPoint origin, f32 scale) const
+{
+    // NOTE: The y axis of the font points upwards, while the y axis of the path points downwards.
+    const OutlineTransform transform = { scale, 0.0F, 0.0F, -scale, origin.x, origin.y };
+    OutlineBudget budget = { maximum_glyph_component_count, maximum_glyph_point_count };
+    return append_outline(glyph_id, path, transform, 0, budget);
+}
+
+bool Font::append_outline(u32 glyph_id, Path& path, const OutlineTransform& transform, u32 depth, OutlineBudget& budget) const
+{
+    if (glyph_id >= m_glyph_count)
+        return false;
+
+    const ReadonlyByteSpan glyph = glyph_data(glyph_id);
+    if (glyph.count() == 0)
+        return true;
+    if (glyph.count() < 10)
+        return false;
+
+    if (read_s16(glyph, 0) >= 0)
+        return append_simple_outline(glyph, path, transform, budget);
+    return append_composite_outline(glyph, path, transform, depth, budget);
+}
+
+bool Font::append_simple_outline(ReadonlyByteSpan glyph, Path& path, const OutlineTransform& transform, OutlineBudget& budget)
+{
+    static constexpr u8 on_curve_flag = 0x01;
+    static constexpr u8 x_is_byte_flag = 0x02;
+    static constexpr u8 y_is_byte_flag = 0x04;
+    static constexpr u8 repeat_flag = 0x08;
+    // NOTE: For a coordinate stored as a byte, these flags give its sign. Otherwise, they mean that the coordinate
+    //       is the same as the previous one, and isn't stored at all.
+    static constexpr u8 x_is_same_or_positive_flag = 0x10;
+    static constexpr u8 y_is_same_or_positive_flag = 0x20;
+
+    struct GlyphPoint {
+        FloatPoint position;
+        bool is_on_curve;
+    };
+
+    const usize contour_count = static_cast<usize>(read_s16(glyph, 0));
+    if (contour_count == 0)
+        return true;
+    if (!has_bytes(glyph, 10, 2 * contour_count + 2))
+        return false;
+
+    const usize point_count = static_cast<usize>(read_u16(glyph, 10 + 2 * (contour_count - 1))) + 1;
+    const usize instruction_byte_count = read_u16(glyph, 10 + 2 * contour_count);
+    if (point_count > budget.remaining_point_count)
+        return false;
+    budget.remaining_point_count -= static_cast<u32>(point_count);
+
+    // NOTE: The flags are run-length encoded, so their size is only known once they are decoded. The coordinates
+    //       are stored in two arrays after them, whose sizes depend on the flags as well.
+    Vector<u8> flags = Vector<u8>::from_initial_capacity(point_count);
+    usize offset = 12 + 2 * contour_count + instruction_byte_count;
+    usize x_byte_count = 0;
+    while (flags.count() < point_count) {
+        if (!has_bytes(glyph, offset, 1))
+            return false;
+        const u8 flag = glyph[offset++];
+        usize repeat_count = 1;
+        if (flag & repeat_flag) {
+            if (!has_bytes(glyph, offset, 1))
+                return false;
+            repeat_count += glyph[offset++];
+        }
+
+        for (usize repeat_index = 0; repeat_index < repeat_count && flags.count() < point_count; ++repeat_index) {
+            flags.add(flag);
+            if (flag & x_is_byte_flag)
+                x_byte_count += 1;
+            else if (!(flag & x_is_same_or_positive_flag))
+                x_byte_count += 2;
+        }
+    }
+
+    Vector<GlyphPoint> points = Vector<GlyphPoint>::from_initial_capacity(point_count);
+    usize x_offset = offset;
+    usize y_offset = offset + x_byte_count;
+    s32 x = 0;
+    s32 y = 0;
+    for (usize point_index = 0; point_index < point_count; ++point_index) {
+        const u8 flag = flags[point_index];
+        if (flag & x_is_byte_flag) {
+            const s32 delta = read_u8(glyph, x_offset++);
+            x += (flag & x_is_same_or_positive_flag) ? delta : -delta;
+        }
+        else if (!(flag & x_is_same_or_positive_flag)) {
+            x += read_s16(glyph, x_offset);
+            x_offset += 2;
+        }
+
+        if (flag & y_is_byte_flag) {
+            const s32 delta = read_u8(glyph, y_offset++);
+            y += (flag & y_is_same_or_positive_flag) ? delta : -delta;
+        }
+        else if (!(flag & y_is_same_or_positive_flag)) {
+            y += read_s16(glyph, y_offset);
+            y_offset += 2;
+        }
+
+        const f32 font_x = static_cast<f32>(x);
+        const f32 font_y = static_cast<f32>(y);
+        const FloatPoint position = {
+            transform.xx * font_x + transform.xy * font_y + transform.dx,
+            transform.yx * font_x + transform.yy * font_y + transform.dy,
+        };
+        points.add({ position, (flag & on_curve_flag) != 0 });
+    }
+    if (y_offset > glyph.count())
+        return false;
+
+    usize contour_begin = 0;
+    for (usize contour_index = 0; contour_index < contour_count; ++contour_index) {
+        const usize contour_end = static_cast<usize>(read_u16(glyph, 10 + 2 * contour_index)) + 1;
+        if (contour_end < contour_begin || contour_end > point_count)
+            return false;
+        if (contour_end - contour_begin < 2) {
+            contour_begin = contour_end;
+            continue;
+        }
+
+        // NOTE: Between two consecutive off-curve points there is an implied on-curve point in their middle. The
+        //       contour has to start at an on-curve point, which might be implied as well.
+        const GlyphPoint& first_point = points[contour_begin];
+        const GlyphPoint& last_point = points[contour_end - 1];
+        FloatPoint start_position;
+        usize point_begin = contour_begin;
+        usize point_end = contour_end;
+        if (first_point.is_on_curve) {
+            start_position = first_point.position;
+            point_begin = contour_begin + 1;
+        }
+        else if (last_point.is_on_curve) {
+            start_position = last_point.position;
+            point_end = contour_end - 1;
+        }
+        else {
+            start_position = (first_point.position + last_point.position) * 0.5F;
+        }
+
+        path.move_to(start_position);
+        bool has_control_point = false;
+        FloatPoint control_point;
+        for (usize point_index = point_begin; point_index < point_end; ++point_index) {
+            const GlyphPoint& point = points[point_index];
+            if (point.is_on_curve) {
+                if (has_control_point)
+                    path.quadratic_to(control_point, point.position);
+                else
+                    path.line_to(point.position);
+                has_control_point = false;
+            }
+            else {
+                if (has_control_point)
+                    path.quadratic_to(control_point, (control_point + point.position) * 0.5F);
+                control_point = point.position;
+                has_control_point = true;
+            }
+        }
+
+        if (has_control_point)
+            path.quadratic_to(control_point, start_position);
+        path.close();
+        contour_begin = contour_end;
+    }
+
+    return true;
+}
+
+bool Font::append_composite_outline(
+    ReadonlyByteSpan glyph,
+    Path& path,
+    const OutlineTransform& transform,
+    u32 depth,
+    OutlineBudget& budget
+) const
+{
+    static constexpr u16 arguments_are_words_flag = 0x0001;
+    static constexpr u16 arguments_are_offsets_flag = 0x0002;
+    static constexpr u16 has_scale_flag = 0x0008;
+    static constexpr u16 has_more_components_flag = 0x0020;
+    static constexpr u16 has_x_and_y_scale_flag = 0x0040;
+    static constexpr u16 has_two_by_two_flag = 0x0080;
+
+    if (depth >= maximum_composite_glyph_depth)
+        return false;
+
+    // NOTE: The scales are stored as signed 2.14 fixed-point numbers.
+    const auto read_f2dot14 = [&](usize offset) { return static_cast<f32>(read_s16(glyph, offset)) / 16384.0F; };
+
+    usize offset = 10;
+    u16 flags;
+    do {
+        if (!has_bytes(glyph, offset, 4) || budget.remaining_component_count == 0)
+            return false;
+        --budget.remaining_component_count;
+        flags = read_u16(glyph, offset);
+        const u16 component_glyph_id = read_u16(glyph, offset + 2);
+        offset += 4;
+
+        f32 offset_x = 0.0F;
+        f32 offset_y = 0.0F;
+        if (flags & arguments_are_words_flag) {
+            offset_x = static_cast<f32>(read_s16(glyph, offset));
+            offset_y = static_cast<f32>(read_s16(glyph, offset + 2));
+            offset += 4;
+        }
+        else {
+            offset_x = static_cast<f32>(static_cast<s8>(read_u8(glyph, offset)));
+            offset_y = static_cast<f32>(static_cast<s8>(read_u8(glyph, offset + 1)));
+            offset += 2;
+        }
+
+        // NOTE: Components that are positioned by matching the points of two outlines are placed at the origin, as
+        //       matching points requires the hinted outlines.
+        if (!(flags & arguments_are_offsets_flag)) {
+            offset_x = 0.0F;
+            offset_y = 0.0F;
+        }
+
+        // NOTE: The component transform maps (x, y) to (a * x + c * y + offset_x, b * x + d * y + offset_y).
+        f32 a = 1.0F;
+        f32 b = 0.0F;
+        f32 c = 0.0F;
+        f32 d = 1.0F;
+        if (flags & has_scale_flag) {
+            a = d = read_f2dot14(offset);
+            offset += 2;
+        }
+        else if (flags & has_x_and_y_scale_flag) {
+            a = read_f2dot14(offset);
+            d = read_f2dot14(offset + 2);
+            offset += 4;
+        }
+        else if (flags & has_two_by_two_flag) {
+            a = read_f2dot14(offset);
+            b = read_f2dot14(offset + 2);
+            c = read_f2dot14(offset + 4);
+            d = read_f2dot14(offset + 6);
+            offset += 8;
+        }
+
+        const OutlineTransform component_transform = {
+            transform.xx * a + transform.xy * b,
+            transform.xx * c + transform.xy * d,
+            transform.yx * a + transform.yy * b,
+            transform.yx * c + transform.yy * d,
+            transform.xx * offset_x + transform.xy * offset_y + transform.dx,
+            transform.yx * offset_x + transform.yy * offset_y + transform.dy,
+        };
+        if (!append_outline(component_glyph_id, path, component_transform, depth + 1, budget))
+            return false;
+    } while (flags & has_more_components_flag);
+
+    return true;
+}
+
+} // namespace Graphics
@@ -0,0 +1,169 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#pragma once
+
+#include <AT/MappedFile.h>
+#include <AT/Optional.h>
+#include <AT/Span.h>
+#include <AT/StringView.h>
+#include <AT/Vector.h>
+#include <Graphics/API.h>
+#include <Graphics/Path.h>
+#include <Graphics/Rect.h>
+
+namespace Graphics {
+
+// NOTE: The glyph that is displayed for the code points that the font doesn't support.
+static constexpr u32 missing_glyph_id = 0;
+
+// The horizontal metrics of a glyph, in font units.
+struct GlyphMetrics {
+    u16 advance_width { 0 };
+    s16 left_side_bearing { 0 };
+};
+
+// The bounding box of the outline of a glyph, in font units, where the y axis points upwards.
+struct GlyphBoundingBox {
+    s16 x_min { 0 };
+    s16 y_min { 0 };
+    s16 x_max { 0 };
+    s16 y_max { 0 };
+};
+
+// Face of a TrueType or OpenType font, which reads the tables of the font file directly from memory.
+//
+// Opening a font only validates the table directory and reads the few fixed-size values that every query needs,
+// such as the number of glyphs and the format of the glyph locations. Everything else is decoded from the bytes of
+// the tables when it is requested, without copying the tables or building any per-glyph data, so opening a large
+// CJK font touches a handful of pages regardless of its size. When the font is memory mapped, the pages of a table
+// are only loaded the first time a glyph needs them.
+//
+// The supported tables are `cmap` (formats 4 and 12), `hmtx`, `glyf`/`loca` (simple and composite glyphs) and the
+// pair kerning of either the `kern` feature of `GPOS` or the `kern` table. Fonts with CFF outlines can be opened
+// and measured, but they don't have any outlines.
+//
+// NOTE: Malformed tables never cause out of bounds reads. A query whose data is malformed behaves as if the font
+//       didn't have that data, for example by returning the missing glyph or no kerning.
+class Font {
+    AT_MAKE_NONCOPYABLE(Font);
+
+public:
+    // Maps the file and opens the face with the given index, which is only meaningful for font collections.
+    NODISCARD GRAPHICS_API static Optional<Font> open(StringView filepath, u32 face_index = 0);
+
+    // NOTE: The bytes are used in place, so the memory they are stored in must outlive the font.
+    NODISCARD GRAPHICS_API static Optional<Font> from_bytes(ReadonlyByteSpan bytes, u32 face_index = 0);
+
+public:
+    GRAPHICS_API Font();
+    GRAPHICS_API ~Font();
+
+    GRAPHICS_API Font(Font&& other) noexcept;
+    GRAPHICS_API Font& operator=(Font&& other) noexcept;
+
+public:
+    NODISCARD ALWAYS_INLINE u16 units_per_em() const { return m_units_per_em; }
+    NODISCARD ALWAYS_INLINE u32 glyph_count() const { return m_glyph_count; }
+
+    // NOTE: The distances from the baseline to the top of the tallest and to the bottom of the lowest glyph, in
+    //       font units. The descender is usually negative.
+    NODISCARD ALWAYS_INLINE s16 ascender() const { return m_ascender; }
+    NODISCARD ALWAYS_INLINE s16 descender() const { return m_descender; }
+    NODISCARD ALWAYS_INLINE s16 line_gap() const { return m_line_gap; }
+
+    NODISCARD ALWAYS_INLINE bool has_outlines() const { return (m_glyf_table.count() > 0); }
+
+    // The scale that converts font units into pixels, for the given size of the em square in pixels.
+    NODISCARD ALWAYS_INLINE f32 scale_for_pixel_size(f32 pixel_size) const { return pixel_size / static_cast<f32>(m_units_per_em); }
+
+public:
+    // Returns the glyph that the character map assigns to the code point, or the missing glyph.
+    NODISCARD GRAPHICS_API u32 glyph_id(u32 code_point) const;
+
+    NODISCARD GRAPHICS_API GlyphMetrics glyph_metrics(u32 glyph_id) const;
+
+    // The adjustment of the advance of the left glyph when it is followed by the right glyph, in font units.
+    NODISCARD GRAPHICS_API s16 kerning(u32 left_glyph_id, u32 right_glyph_id) const;
+
+    // Returns an empty optional if the glyph has no outline, as is the case for spaces.
+    NODISCARD GRAPHICS_API Optional<GlyphBoundingBox> glyph_bounding_box(u32 glyph_id) const;
+
+    // Appends the outline of the glyph to the path, scaled from font units to pixels and with the origin of the
+    // glyph at the given point. The y axis of the path points downwards, so the point is on the baseline. Returns
+    // false if the outline is malformed, in which case the path might contain a part of it and should be discarded.
+    GRAPHICS_API bool append_glyph_outline(u32 glyph_id, Path& path, FloatPoint origin, f32 scale) const;
+
+private:
+    // A lookup subtable of `GPOS` that adjusts the advance of pairs of glyphs.
+    struct PairAdjustmentSubtable {
+        u32 offset;
+        u16 lookup_index;
+    };
+
+    // Affine transform from font units to the coordinates of the path, which maps the point (x, y) to
+    // (xx * x + xy * y + dx, yx * x + yy * y + dy).
+    struct OutlineTransform {
+        f32 xx;
+        f32 xy;
+        f32 yx;
+        f32 yy;
+        f32 dx;
+        f32 dy;
+    };
+
+    // The work that is left for appending the outline of a glyph, which is shared by all of its components.
+    struct OutlineBudget {
+        u32 remaining_component_count;
+        u32 remaining_point_count;
+    };
+
+private:
+    NODISCARD bool load(ReadonlyByteSpan bytes, u32 face_index);
+    void select_character_map();
+    void collect_pair_adjustment_subtables();
+
+    NODISCARD ReadonlyByteSpan glyph_data(u32 glyph_id) const;
+    NODISCARD bool append_outline(u32 glyph_id, Path& path, const OutlineTransform& transform, u32 depth, OutlineBudget& budget) const;
+    NODISCARD static bool
+    append_simple_outline(ReadonlyByteSpan glyph, Path& path, const OutlineTransform& transform, OutlineBudget& budget);
+    NODISCARD bool append_composite_outline(
+        ReadonlyByteSpan glyph,
+        Path& path,
+        const OutlineTransform& transform,
+        u32 depth,
+        OutlineBudget& budget
+    ) const;
+
+    NODISCARD Optional<s16> gpos_kerning(u32 left_glyph_id, u32 right_glyph_id) const;
+    NODISCARD s16 kern_table_kerning(u32 left_glyph_id, u32 right_glyph_id) const;
+
+private:
+    MappedFile m_mapped_file;
+    ReadonlyByteSpan m_bytes;
+
+    ReadonlyByteSpan m_cmap_table;
+    ReadonlyByteSpan m_hmtx_table;
+    ReadonlyByteSpan m_loca_table;
+    ReadonlyByteSpan m_glyf_table;
+    ReadonlyByteSpan m_kern_table;
+    ReadonlyByteSpan m_gpos_table;
+
+    // NOTE: The character map subtable that is used to look up code points, which is empty if the font has no
+    //       supported subtable.
+    ReadonlyByteSpan m_character_map;
+
+    Vector<PairAdjustmentSubtable> m_pair_adjustment_subtables;
+
+    u16 m_units_per_em { 0 };
+    u32 m_glyph_count { 0 };
+    u32 m_horizontal_metric_count { 0 };
+    s16 m_ascender { 0 };
+    s16 m_descender { 0 };
+    s16 m_line_gap { 0 };
+    bool m_has_long_glyph_locations { false };
+};
+
+} // namespace Graphics
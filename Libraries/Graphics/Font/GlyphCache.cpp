@@ -0,0 +1,399 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#include <AT/Assertions.h>
+#include <AT/MemoryOperations.h>
+#include <Graphics/Font/GlyphCache.h>
+#include <Graphics/PixelOperations.h>
+
+// NOTE: Headers from the standard library.
+#include <cmath>
+
+namespace Graphics {
+
+static constexpr usize min_slot_count = 256;
+
+//
+// Packing the key of a glyph.
+//
+
+// NOTE: The glyph identifiers of a font are 16-bit, and the pixel size is stored in 1/64 of a pixel, so the largest
+//       pixel size that fits in the key is far larger than any page.
+static constexpr u32 glyph_id_bit_count = 16;
+static constexpr u32 subpixel_position_bit_count = 2;
+static constexpr u32 pixel_size_bit_count = 22;
+static constexpr u32 font_index_bit_count = 16;
+static constexpr f32 pixel_size_unit_count = 64.0F;
+
+static_assert((1 << subpixel_position_bit_count) == GlyphCache::subpixel_position_count);
+static_assert(glyph_id_bit_count + subpixel_position_bit_count + pixel_size_bit_count + font_index_bit_count <= 64);
+
+static constexpr u32 subpixel_position_shift = glyph_id_bit_count;
+static constexpr u32 pixel_size_shift = subpixel_position_shift + subpixel_position_bit_count;
+static constexpr u32 font_index_shift = pixel_size_shift + pixel_size_bit_count;
+
+NODISCARD ALWAYS_INLINE static u64 make_glyph_key(u32 font_index, u32 pixel_size_key, u32 subpixel_position, u32 glyph_id)
+{
+    return (static_cast<u64>(font_index) << font_index_shift) | (static_cast<u64>(pixel_size_key) << pixel_size_shift) |
+           (static_cast<u64>(subpixel_position) << subpixel_position_shift) | glyph_id;
+}
+
+NODISCARD ALWAYS_INLINE static u32 font_index_of_key(u64 key)
+{
+    return static_cast<u32>(key >> font_index_shift);
+}
+
+//
+// Drawing.
+//
+
+GlyphCache::GlyphCache(u32 page_size, u32 max_page_count)
+    : m_page_size(page_size)
+    , m_max_page_count(max_page_count)
+    , m_entry_indices(min_slot_count)
+{
+    VERIFY(page_size > 0 && max_page_count > 0);
+}
+
+GlyphCache::~GlyphCache() = default;
+
+void GlyphCache::draw_glyphs(Bitmap& target, const Font& font, f32 pixel_size, Span<const PositionedGlyph> glyphs, Color color)
+{
+    draw_glyphs(target, font, pixel_size, glyphs, { 0.0F, 0.0F }, color, target.rect());
+}
+
+void GlyphCache::draw_glyphs(
+    Bitmap& target,
+    const Font& font,
+    f32 pixel_size,
+    Span<const PositionedGlyph> glyphs,
+    FloatPoint origin,
+    Color color,
+    const IntRect& clip_rect
+)
+{
+    DrawState state = {};
+    state.target = &target;
+    state.clip_rect = clip_rect.intersected(target.rect());
+    if (glyphs.count() == 0 || color.is_transparent() || state.clip_rect.is_empty() || !(pixel_size > 0.0F))
+        return;
+
+    // NOTE: The kernel only depends on the target, so it is selected once for all the glyphs of the run.
+    state.color = color;
+    state.span_function = select_span_function(target.format(), PaintSource::SolidColor, target.format(), BlendMode::SourceOver, true);
+    state.pixel = color_to_pixel(color, target.format());
+
+    const u32 font_index_value = font_index(font);
+    const f32 scale = font.scale_for_pixel_size(pixel_size);
+    const f32 quantized_pixel_size = std::round(pixel_size * pixel_size_unit_count);
+    const bool is_cacheable = quantized_pixel_size < static_cast<f32>(1 << pixel_size_bit_count);
+    const u32 pixel_size_key = is_cacheable ? static_cast<u32>(quantized_pixel_size) : 0;
+
+    // NOTE: Every page that is touched by this run gets the same stamp, so the run never evicts a page that it uses
+    //       before its pending blits are flushed.
+    ++m_use_stamp;
+    m_pending_blits.clear();
+
+    for (usize glyph_index = 0; glyph_index < glyphs.count(); ++glyph_index) {
+        const PositionedGlyph& glyph = glyphs[glyph_index];
+        const FloatPoint glyph_position = { glyph.position.x + origin.x, glyph.position.y + origin.y };
+
+        // NOTE: The origin is split into whole pixels and a subpixel position, rounding to the nearest quarter.
+        const f32 quantized_x = std::floor(glyph_position.x * static_cast<f32>(subpixel_position_count) + 0.5F);
+        const f32 origin_x = std::floor(quantized_x / static_cast<f32>(subpixel_position_count));
+        const u32 subpixel_position = static_cast<u32>(quantized_x - origin_x * static_cast<f32>(subpixel_position_count));
+        const IntPoint glyph_origin = { static_cast<s32>(origin_x), static_cast<s32>(std::round(glyph_position.y)) };
+
+        u32 entry_index = invalid_index;
+        if (is_cacheable && glyph.glyph_id < font.glyph_count()) {
+            const u64 key = make_glyph_key(font_index_value, pixel_size_key, subpixel_position, glyph.glyph_id);
+            entry_index = find_entry_index(key);
+            if (entry_index != invalid_index) {
+                ++m_statistics.hit_count;
+            }
+            else {
+                ++m_statistics.miss_count;
+                entry_index = rasterize_glyph(key, font, glyph.glyph_id, scale, subpixel_position, state);
+            }
+        }
+
+        if (entry_index == invalid_index) {
+            // NOTE: The glyph is too large to be cached, so it is rasterized directly into the target. The pending
+            //       blits are flushed first, to preserve the order in which the glyphs are composited.
+            flush_pending_blits(state);
+            m_glyph_path.clear();
+            if (font.append_glyph_outline(glyph.glyph_id, m_glyph_path, glyph_position, scale))
+                m_rasterizer.fill_path(target, m_glyph_path, color, FillRule::NonZero, state.clip_rect);
+            continue;
+        }
+
+        const Entry& entry = m_entries[entry_index];
+        if (entry.atlas_rect.is_empty())
+            continue;
+
+        m_pages[entry.page_index].last_use_stamp = m_use_stamp;
+        const IntPoint position = { glyph_origin.x + entry.offset.x, glyph_origin.y + entry.offset.y };
+        m_pending_blits.add({ entry.page_index, entry.atlas_rect, position });
+    }
+
+    flush_pending_blits(state);
+}
+
+void GlyphCache::flush_pending_blits(const DrawState& state)
+{
+    const usize bytes_per_target_pixel = bytes_per_pixel(state.target->format());
+
+    RasterSpan span = {};
+    span.color = state.pixel;
+    span.opacity = 255;
+    for (usize blit_index = 0; blit_index < m_pending_blits.count(); ++blit_index) {
+        const PendingBlit& blit = m_pending_blits[blit_index];
+        const IntRect target_rect = { blit.position.x, blit.position.y, blit.atlas_rect.width, blit.atlas_rect.height };
+        const IntRect clipped_rect = target_rect.intersected(state.clip_rect);
+        if (clipped_rect.is_empty())
+            continue;
+
+        const Bitmap& page_bitmap = *m_pages[blit.page_index].bitmap;
+        const s32 atlas_x = blit.atlas_rect.x + (clipped_rect.x - target_rect.x);
+        const s32 atlas_y = blit.atlas_rect.y + (clipped_rect.y - target_rect.y);
+        span.pixel_count = static_cast<usize>(clipped_rect.width);
+        for (s32 row_index = 0; row_index < clipped_rect.height; ++row_index) {
+            span.destination = state.target->scanline(clipped_rect.y + row_index) + bytes_per_target_pixel * clipped_rect.x;
+            span.coverage = page_bitmap.scanline(atlas_y + row_index) + atlas_x;
+            state.span_function(span);
+        }
+    }
+
+    m_pending_blits.clear();
+}
+
+//
+// Rasterizing glyphs into the atlas.
+//
+
+struct RasterizeGlyphContext {
+    Bitmap* page_bitmap;
+    // NOTE: The translation from the coordinates of the outline to the coordinates of the page.
+    s32 offset_x;
+    s32 offset_y;
+};
+
+u32 GlyphCache::rasterize_glyph(u64 key, const Font& font, u32 glyph_id, f32 scale, u32 subpixel_position, const DrawState& state)
+{
+    // NOTE: The outline is placed with its origin at the subpixel position, and a glyph with a malformed outline is
+    //       cached as an empty glyph, so that it isn't decoded again.
+    m_glyph_path.clear();
+    const FloatPoint outline_origin = { static_cast<f32>(subpixel_position) / static_cast<f32>(subpixel_position_count), 0.0F };
+    if (!font.append_glyph_outline(glyph_id, m_glyph_path, outline_origin, scale))
+        m_glyph_path.clear();
+
+    IntRect bounds;
+    if (!m_glyph_path.is_empty()) {
+        const FloatRect outline_bounds = m_glyph_path.bounding_box();
+        const s32 left = static_cast<s32>(std::floor(outline_bounds.left()));
+        const s32 top = static_cast<s32>(std::floor(outline_bounds.top()));
+        const s32 right = static_cast<s32>(std::ceil(outline_bounds.right()));
+        const s32 bottom = static_cast<s32>(std::ceil(outline_bounds.bottom()));
+        bounds = IntRect::from_edges(left, top, right, bottom);
+    }
+
+    if (bounds.width > static_cast<s32>(m_page_size) || bounds.height > static_cast<s32>(m_page_size))
+        return invalid_index;
+
+    u32 page_index = invalid_index;
+    IntPoint atlas_position;
+    if (!bounds.is_empty()) {
+        if (!allocate_atlas_rect(static_cast<u32>(bounds.width), static_cast<u32>(bounds.height), page_index, atlas_position, state))
+            return invalid_index;
+
+        // NOTE: The rasterizer only writes the covered spans, so the rectangle is cleared first.
+        Bitmap& page_bitmap = *m_pages[page_index].bitmap;
+        const IntRect atlas_rect = { atlas_position.x, atlas_position.y, bounds.width, bounds.height };
+        page_bitmap.fill_rect(atlas_rect, Color());
+
+        RasterizeGlyphContext context = {};
+        context.page_bitmap = &page_bitmap;
+        context.offset_x = atlas_position.x - bounds.x;
+        context.offset_y = atlas_position.y - bounds.y;
+
+        const PathRasterizer::SpanFunction span_function = [](s32 x, s32 y, ReadonlyBytes coverage, u32 pixel_count, void* user_data) {
+            const RasterizeGlyphContext& context = *static_cast<const RasterizeGlyphContext*>(user_data);
+            copy_memory(context.page_bitmap->scanline(y + context.offset_y) + (x + context.offset_x), coverage, pixel_count);
+        };
+        m_rasterizer.rasterize(m_glyph_path, FillRule::NonZero, bounds, span_function, &context);
+    }
+
+    const u32 entry_index = insert_entry(key);
+    Entry& entry = m_entries[entry_index];
+    entry.atlas_rect = { atlas_position.x, atlas_position.y, bounds.width, bounds.height };
+    entry.offset = { bounds.x, bounds.y };
+    entry.page_index = page_index;
+    if (page_index != invalid_index)
+        m_pages[page_index].entry_indices.add(entry_index);
+    return entry_index;
+}
+
+bool GlyphCache::allocate_atlas_rect(u32 width, u32 height, u32& page_index, IntPoint& atlas_position, const DrawState& state)
+{
+    for (u32 index = 0; index < m_pages.count(); ++index) {
+        const Optional<IntPoint> position = m_pages[index].packer.allocate(width, height);
+        if (position.has_value()) {
+            page_index = index;
+            atlas_position = position.value();
+            return true;
+        }
+    }
+
+    if (m_pages.count() < m_max_page_count) {
+        RefPtr<Bitmap> bitmap = Bitmap::create(PixelFormat::A8, m_page_size, m_page_size);
+        if (bitmap.is_valid()) {
+            page_index = static_cast<u32>(m_pages.count());
+            m_pages.add({ move(bitmap), SkylinePacker(m_page_size, m_page_size), {}, m_use_stamp });
+            atlas_position = m_pages[page_index].packer.allocate(width, height).value();
+            return true;
+        }
+    }
+
+    if (m_pages.is_empty())
+        return false;
+
+    // NOTE: The pending blits might read from the evicted page, so they are composited before it is overwritten. After
+    //       that, no page is in use by the current run anymore.
+    flush_pending_blits(state);
+
+    u32 least_recently_used_page_index = 0;
+    for (u32 index = 1; index < m_pages.count(); ++index) {
+        if (m_pages[index].last_use_stamp < m_pages[least_recently_used_page_index].last_use_stamp)
+            least_recently_used_page_index = index;
+    }
+
+    evict_page(least_recently_used_page_index);
+    page_index = least_recently_used_page_index;
+    atlas_position = m_pages[page_index].packer.allocate(width, height).value();
+    return true;
+}
+
+void GlyphCache::evict_page(u32 page_index)
+{
+    Page& page = m_pages[page_index];
+    for (usize index = 0; index < page.entry_indices.count(); ++index)
+        remove_entry(page.entry_indices[index]);
+
+    page.entry_indices.clear();
+    page.packer.reset();
+    ++m_statistics.evicted_page_count;
+}
+
+//
+// Fonts.
+//
+
+u32 GlyphCache::font_index(const Font& font)
+{
+    u32 free_index = invalid_index;
+    for (u32 index = 0; index < m_fonts.count(); ++index) {
+        if (m_fonts[index] == &font)
+            return index;
+        if (m_fonts[index] == nullptr && free_index == invalid_index)
+            free_index = index;
+    }
+
+    if (free_index != invalid_index) {
+        m_fonts[free_index] = &font;
+        return free_index;
+    }
+
+    VERIFY(m_fonts.count() < (1 << font_index_bit_count));
+    m_fonts.add(&font);
+    return static_cast<u32>(m_fonts.count() - 1);
+}
+
+void GlyphCache::remove_font(const Font& font)
+{
+    u32 removed_font_index = invalid_index;
+    for (u32 index = 0; index < m_fonts.count(); ++index) {
+        if (m_fonts[index] == &font)
+            removed_font_index = index;
+    }
+    if (removed_font_index == invalid_index)
+        return;
+
+    for (u32 entry_index = 0; entry_index < m_entries.count(); ++entry_index) {
+        const Entry& entry = m_entries[entry_index];
+        if (!entry.is_used || font_index_of_key(entry.key) != removed_font_index)
+            continue;
+
+        // NOTE: The entry is detached from its page, as its index is reused by the next glyph that is inserted.
+        if (entry.page_index != invalid_index) {
+            Vector<u32>& entry_indices = m_pages[entry.page_index].entry_indices;
+            for (usize index = 0; index < entry_indices.count(); ++index) {
+                if (entry_indices[index] == entry_index) {
+                    entry_indices.remove_unordered(index);
+                    break;
+                }
+            }
+        }
+        remove_entry(entry_index);
+    }
+
+    m_fonts[removed_font_index] = nullptr;
+}
+
+void GlyphCache::clear()
+{
+    for (u32 page_index = 0; page_index < m_pages.count(); ++page_index) {
+        m_pages[page_index].entry_indices.clear();
+        m_pages[page_index].packer.reset();
+    }
+
+    m_fonts.clear();
+    m_entries.clear();
+    m_entry_indices.clear();
+    m_first_free_index = invalid_index;
+}
+
+//
+// Entries of the cached glyphs.
+//
+
+u32 GlyphCache::find_entry_index(u64 key) const
+{
+    const u32* entry_index = m_entry_indices.find(key);
+    return (entry_index != nullptr) ? *entry_index : invalid_index;
+}
+
+u32 GlyphCache::insert_entry(u64 key)
+{
+    u32 entry_index;
+    if (m_first_free_index != invalid_index) {
+        entry_index = m_first_free_index;
+        m_first_free_index = m_entries[entry_index].next_free_index;
+    }
+    else {
+        entry_index = static_cast<u32>(m_entries.count());
+        m_entries.add({});
+    }
+
+    Entry& entry = m_entries[entry_index];
+    entry = {};
+    entry.key = key;
+    entry.is_used = true;
+    m_entry_indices.set(key, entry_index);
+    return entry_index;
+}
+
+void GlyphCache::remove_entry(u32 entry_index)
+{
+    Entry& entry = m_entries[entry_index];
+    const bool was_removed = m_entry_indices.remove(entry.key);
+    VERIFY(was_removed);
+
+    entry.is_used = false;
+    entry.page_index = invalid_index;
+    entry.next_free_index = m_first_free_index;
+    m_first_free_index = entry_index;
+}
+
+} // namespace Graphics
@@ -0,0 +1,173 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#pragma once
+
+#include <AT/IntegerHashMap.h>
+#include <AT/NumericLimits.h>
+#include <AT/RefPtr.h>
+#include <AT/Span.h>
+#include <AT/Vector.h>
+#include <Graphics/API.h>
+#include <Graphics/Bitmap.h>
+#include <Graphics/Font/Font.h>
+#include <Graphics/Path.h>
+#include <Graphics/PathRasterizer.h>
+#include <Graphics/RasterPipeline.h>
+#include <Graphics/SkylinePacker.h>
+
+namespace Graphics {
+
+// A glyph and the position of its origin on the baseline, in the pixels of the target.
+struct PositionedGlyph {
+    u32 glyph_id;
+    FloatPoint position;
+};
+
+struct GlyphCacheStatistics {
+    u64 hit_count { 0 };
+    u64 miss_count { 0 };
+    u64 evicted_page_count { 0 };
+};
+
+// Cache of rasterized glyphs, which turns drawing text into copying the coverage of each glyph from an atlas.
+//
+// A glyph is rasterized once for each combination of font, pixel size and horizontal subpixel offset, and its
+// coverage is stored in an alpha-only atlas page that is shared by all fonts. The pages are packed with a skyline
+// packer, and the cached glyphs are found in an open-addressed hash table keyed by a single integer, which packs all
+// the parts of the key. Drawing a run of glyphs then composites the atlas rectangles of the glyphs over the target
+// with the color, without decoding or rasterizing any outline once the glyphs are cached.
+//
+// The horizontal position of a glyph is rounded to a quarter of a pixel, and each of the quarters is rasterized
+// separately, so that the spacing of the glyphs doesn't accumulate rounding errors. The baseline is rounded to whole
+// pixels, as text is almost always laid out along horizontal lines.
+//
+// When the atlas is full and no more pages can be allocated, the least recently used page is evicted as a whole,
+// together with all the glyphs stored in it. Glyphs that are larger than a page are rasterized directly into the
+// target every time they are drawn.
+//
+// NOTE: Fonts are identified by their address, so a font must not be moved or destroyed while the cache holds its
+//       glyphs. Use GlyphCache::remove_font() before destroying a font that outlives its last draw. The cache keeps
+//       scratch buffers between draws, so it must not be used by multiple threads at the same time.
+class GlyphCache {
+    AT_MAKE_NONCOPYABLE(GlyphCache);
+    AT_MAKE_NONMOVABLE(GlyphCache);
+
+public:
+    static constexpr u32 default_page_size = 512;
+    static constexpr u32 default_max_page_count = 4;
+    static constexpr u32 subpixel_position_count = 4;
+
+public:
+    GRAPHICS_API explicit GlyphCache(u32 page_size = default_page_size, u32 max_page_count = default_max_page_count);
+    GRAPHICS_API ~GlyphCache();
+
+public:
+    NODISCARD ALWAYS_INLINE u32 page_size() const { return m_page_size; }
+    NODISCARD ALWAYS_INLINE u32 max_page_count() const { return m_max_page_count; }
+    NODISCARD ALWAYS_INLINE u32 page_count() const { return static_cast<u32>(m_pages.count()); }
+    NODISCARD ALWAYS_INLINE usize glyph_count() const { return m_entry_indices.count(); }
+
+    // NOTE: The alpha-only bitmap of an atlas page, which is mostly useful for debugging.
+    NODISCARD ALWAYS_INLINE const Bitmap& page_bitmap(u32 page_index) const { return *m_pages[page_index].bitmap; }
+
+    NODISCARD ALWAYS_INLINE const GlyphCacheStatistics& statistics() const { return m_statistics; }
+    ALWAYS_INLINE void reset_statistics() { m_statistics = {}; }
+
+public:
+    // Composites the glyphs over the target with the color. The glyphs that are not cached yet are rasterized into
+    // the atlas first. The origin is added to the position of every glyph, which allows drawing a run that was laid
+    // out once at different places.
+    GRAPHICS_API void draw_glyphs(Bitmap& target, const Font& font, f32 pixel_size, Span<const PositionedGlyph> glyphs, Color color);
+    GRAPHICS_API void draw_glyphs(
+        Bitmap& target,
+        const Font& font,
+        f32 pixel_size,
+        Span<const PositionedGlyph> glyphs,
+        FloatPoint origin,
+        Color color,
+        const IntRect& clip_rect
+    );
+
+    // Removes all the glyphs of the font. Their space in the atlas is only reclaimed when their pages are evicted.
+    GRAPHICS_API void remove_font(const Font& font);
+
+    // Removes all the glyphs, but keeps the memory of the atlas pages.
+    GRAPHICS_API void clear();
+
+private:
+    static constexpr u32 invalid_index = NumericLimits<u32>::max();
+
+    struct Entry {
+        u64 key { 0 };
+        // NOTE: The rectangle is empty for the glyphs that don't cover any pixel, such as spaces.
+        IntRect atlas_rect;
+        // NOTE: The position of the top-left corner of the atlas rectangle, relative to the rounded origin.
+        IntPoint offset;
+        u32 page_index { invalid_index };
+        bool is_used { false };
+        // NOTE: For free entries, this is the index of the next free entry.
+        u32 next_free_index { invalid_index };
+    };
+
+    struct Page {
+        RefPtr<Bitmap> bitmap;
+        SkylinePacker packer;
+        Vector<u32> entry_indices;
+        u64 last_use_stamp { 0 };
+    };
+
+    // NOTE: A glyph whose coverage is waiting to be composited into the target.
+    struct PendingBlit {
+        u32 page_index;
+        IntRect atlas_rect;
+        IntPoint position;
+    };
+
+    struct DrawState {
+        Bitmap* target;
+        IntRect clip_rect;
+        Color color;
+        RasterSpanFunction span_function;
+        // NOTE: The color, premultiplied and in the channel order of the target.
+        u32 pixel;
+    };
+
+private:
+    NODISCARD u32 font_index(const Font& font);
+
+    NODISCARD u32 find_entry_index(u64 key) const;
+    NODISCARD u32 insert_entry(u64 key);
+    void remove_entry(u32 entry_index);
+
+    // Rasterizes the glyph into the atlas and returns its entry, or an invalid index if the glyph is too large.
+    NODISCARD u32 rasterize_glyph(u64 key, const Font& font, u32 glyph_id, f32 scale, u32 subpixel_position, const DrawState& state);
+
+    // Reserves space in the atlas, by evicting the least recently used page if every page is full.
+    NODISCARD bool allocate_atlas_rect(u32 width, u32 height, u32& page_index, IntPoint& atlas_position, const DrawState& state);
+    void evict_page(u32 page_index);
+
+    void flush_pending_blits(const DrawState& state);
+
+private:
+    u32 m_page_size;
+    u32 m_max_page_count;
+    u64 m_use_stamp { 0 };
+    GlyphCacheStatistics m_statistics;
+
+    Vector<Page> m_pages;
+    Vector<const Font*> m_fonts;
+
+    Vector<Entry> m_entries;
+    u32 m_first_free_index { invalid_index };
+    // NOTE: Maps the key of each cached glyph to its index in the entries.
+    IntegerHashMap<u64, u32> m_entry_indices;
+
+    Vector<PendingBlit> m_pending_blits;
+    Path m_glyph_path;
+    PathRasterizer m_rasterizer;
+};
+
+} // namespace Graphics
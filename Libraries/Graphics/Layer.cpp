@@ -0,0 +1,190 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#include <AT/Assertions.h>
+#include <Graphics/Compositing.h>
+#include <Graphics/Layer.h>
+
+namespace Graphics {
+
+// NOTE: The cached bitmaps are premultiplied, so compositing them is the same as rasterizing into the parent.
+static constexpr PixelFormat layer_pixel_format = PixelFormat::RGBA8;
+
+// Makes sure that the bitmap exists and has the given size. The pixels of a reused bitmap are kept.
+static void ensure_bitmap(RefPtr<Bitmap>& bitmap, u32 width, u32 height)
+{
+    if (bitmap.is_valid() && bitmap->width() == width && bitmap->height() == height)
+        return;
+    bitmap = Bitmap::create(layer_pixel_format, width, height);
+    VERIFY(bitmap.is_valid());
+}
+
+RefPtr<Layer> Layer::create(u32 width, u32 height)
+{
+    return adopt_ref(new Layer(width, height));
+}
+
+Layer::Layer(u32 width, u32 height)
+    : m_width(width)
+    , m_height(height)
+{}
+
+Layer::~Layer()
+{
+    for (usize child_index = 0; child_index < m_children.count(); ++child_index)
+        m_children[child_index]->m_parent = nullptr;
+}
+
+void Layer::set_size(u32 width, u32 height)
+{
+    if (width == m_width && height == m_height)
+        return;
+
+    m_width = width;
+    m_height = height;
+    m_content_changed = true;
+    invalidate_surface();
+}
+
+void Layer::set_position(IntPoint position)
+{
+    if (position == m_position)
+        return;
+
+    m_position = position;
+    if (m_parent)
+        m_parent->invalidate_surface();
+}
+
+void Layer::set_opacity(f32 opacity)
+{
+    opacity = (opacity > 0.0F) ? opacity : 0.0F;
+    opacity = (opacity < 1.0F) ? opacity : 1.0F;
+    if (opacity == m_opacity)
+        return;
+
+    m_opacity = opacity;
+    if (m_parent)
+        m_parent->invalidate_surface();
+}
+
+bool Layer::set_content(DisplayList&& content)
+{
+    // NOTE: The hash has to be computed while the previous content is still alive, as the bitmaps are hashed by
+    //       their address, which can only be reused once the previous content releases them.
+    const Hash128 content_hash = content.structural_hash();
+    m_content = move(content);
+    if (!m_content_changed && content_hash == m_content_hash)
+        return false;
+
+    m_content_hash = content_hash;
+    m_content_changed = true;
+    invalidate_surface();
+    return true;
+}
+
+void Layer::add_child(RefPtr<Layer> child)
+{
+    VERIFY(child.is_valid());
+    VERIFY(child.get() != this && child->m_parent == nullptr);
+
+    child->m_parent = this;
+    m_children.add(move(child));
+    invalidate_surface();
+}
+
+void Layer::remove_child(Layer& child)
+{
+    VERIFY(child.m_parent == this);
+
+    usize child_index = 0;
+    while (m_children[child_index].get() != &child)
+        ++child_index;
+
+    // NOTE: The order of the children is the order in which they are composited, so it has to be preserved.
+    for (; child_index + 1 < m_children.count(); ++child_index)
+        m_children[child_index] = move(m_children[child_index + 1]);
+
+    child.m_parent = nullptr;
+    m_children.remove_last();
+    invalidate_surface();
+}
+
+void Layer::invalidate_surface()
+{
+    // NOTE: A layer whose surface is out of date always has all its ancestors out of date as well, so the walk can
+    //       stop at the first one that is already marked.
+    for (Layer* layer = this; layer && !layer->m_surface_changed; layer = layer->m_parent)
+        layer->m_surface_changed = true;
+}
+
+const Bitmap* Layer::surface() const
+{
+    const RefPtr<Bitmap>& bitmap = m_children.has_elements() ? m_surface_bitmap : m_content_bitmap;
+    return bitmap.is_valid() ? bitmap.get() : nullptr;
+}
+
+LayerCompositor::LayerCompositor() = default;
+LayerCompositor::~LayerCompositor() = default;
+
+void LayerCompositor::composite(Bitmap& target, Layer& root)
+{
+    m_rasterized_layer_count = 0;
+    m_recomposited_surface_count = 0;
+    update_layer(root);
+
+    const Bitmap* surface = root.surface();
+    if (surface && root.m_opacity > 0.0F)
+        Graphics::composite(target, root.m_position, *surface, surface->rect(), BlendMode::SourceOver, root.m_opacity);
+}
+
+void LayerCompositor::update_layer(Layer& layer)
+{
+    if (!layer.m_surface_changed)
+        return;
+
+    for (usize child_index = 0; child_index < layer.m_children.count(); ++child_index)
+        update_layer(*layer.m_children[child_index]);
+
+    const bool has_pixels = (layer.m_width > 0) && (layer.m_height > 0);
+    if (layer.m_content_changed) {
+        layer.m_content_changed = false;
+        if (has_pixels && !layer.m_content.is_empty()) {
+            ensure_bitmap(layer.m_content_bitmap, layer.m_width, layer.m_height);
+            layer.m_content_bitmap->clear();
+            layer.m_content.replay(*layer.m_content_bitmap, m_rasterizer);
+            ++m_rasterized_layer_count;
+        }
+        else {
+            layer.m_content_bitmap = nullptr;
+        }
+    }
+
+    if (layer.m_children.has_elements() && has_pixels) {
+        ensure_bitmap(layer.m_surface_bitmap, layer.m_width, layer.m_height);
+        if (layer.m_content_bitmap.is_valid())
+            layer.m_surface_bitmap->blit({ 0, 0 }, *layer.m_content_bitmap, layer.m_content_bitmap->rect());
+        else
+            layer.m_surface_bitmap->clear();
+
+        for (usize child_index = 0; child_index < layer.m_children.count(); ++child_index) {
+            const Layer& child = *layer.m_children[child_index];
+            const Bitmap* child_surface = child.surface();
+            if (!child_surface || !(child.m_opacity > 0.0F))
+                continue;
+
+            const IntRect source_rect = child_surface->rect();
+            Graphics::composite(*layer.m_surface_bitmap, child.m_position, *child_surface, source_rect, BlendMode::SourceOver, child.m_opacity);
+        }
+        ++m_recomposited_surface_count;
+    }
+    else {
+        layer.m_surface_bitmap = nullptr;
+    }
+
+    layer.m_surface_changed = false;
+}
+
+} // namespace Graphics
@@ -0,0 +1,131 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#pragma once
+
+#include <AT/Hash.h>
+#include <AT/RefPtr.h>
+#include <AT/Vector.h>
+#include <Graphics/API.h>
+#include <Graphics/Bitmap.h>
+#include <Graphics/DisplayList.h>
+#include <Graphics/PathRasterizer.h>
+
+namespace Graphics {
+
+// Node of a tree of composited layers, whose rasterized pixels are cached between frames.
+//
+// The content of a layer is a display list, recorded in the coordinates of the layer, and it is rasterized into the
+// content bitmap of the layer only when it changes. Whether it changed is decided by comparing the structural hash
+// of the new display list with the hash of the previous one, so re-recording the same commands every frame doesn't
+// cost a rasterization.
+//
+// A layer that has children also caches its surface, which is its content with all the children composited over
+// it. The position and the opacity of a layer only affect how its surface is composited into its parent, so
+// changing them only composites the cached bitmaps of the parent again, without rasterizing anything. This makes
+// scrolling or fading a layer cost a few blits per frame, regardless of how many commands its content has.
+//
+// NOTE: The children are clipped to the bounds of their parent, and they are composited in the order they were added.
+class Layer : public RefCounted {
+    AT_MAKE_NONCOPYABLE(Layer);
+    AT_MAKE_NONMOVABLE(Layer);
+    friend class LayerCompositor;
+
+public:
+    NODISCARD GRAPHICS_API static RefPtr<Layer> create(u32 width, u32 height);
+
+    GRAPHICS_API virtual ~Layer() override;
+
+public:
+    NODISCARD ALWAYS_INLINE u32 width() const { return m_width; }
+    NODISCARD ALWAYS_INLINE u32 height() const { return m_height; }
+    NODISCARD ALWAYS_INLINE IntPoint position() const { return m_position; }
+    NODISCARD ALWAYS_INLINE f32 opacity() const { return m_opacity; }
+
+    NODISCARD ALWAYS_INLINE Layer* parent() const { return m_parent; }
+    NODISCARD ALWAYS_INLINE const Vector<RefPtr<Layer>>& children() const { return m_children; }
+    NODISCARD ALWAYS_INLINE const DisplayList& content() const { return m_content; }
+
+    // NOTE: True if the content changed since the layer was last rasterized.
+    NODISCARD ALWAYS_INLINE bool needs_rasterization() const { return m_content_changed; }
+
+public:
+    GRAPHICS_API void set_size(u32 width, u32 height);
+
+    // NOTE: The position is relative to the top-left corner of the parent.
+    GRAPHICS_API void set_position(IntPoint position);
+    GRAPHICS_API void set_opacity(f32 opacity);
+
+    // Replaces the content of the layer. Returns true if the new content is different from the previous one, in
+    // which case the layer is rasterized again the next time the tree is composited.
+    GRAPHICS_API bool set_content(DisplayList&& content);
+
+    // NOTE: The child must not have a parent already.
+    GRAPHICS_API void add_child(RefPtr<Layer> child);
+    GRAPHICS_API void remove_child(Layer& child);
+
+private:
+    Layer(u32 width, u32 height);
+
+    // Marks the surface of this layer and of all its ancestors as out of date.
+    void invalidate_surface();
+
+    // NOTE: The bitmap that is composited into the parent, which is null if the layer has nothing to draw.
+    NODISCARD const Bitmap* surface() const;
+
+private:
+    u32 m_width;
+    u32 m_height;
+    IntPoint m_position;
+    f32 m_opacity { 1.0F };
+
+    Layer* m_parent { nullptr };
+    Vector<RefPtr<Layer>> m_children;
+
+    DisplayList m_content;
+    Hash128 m_content_hash {};
+    bool m_content_changed { true };
+    bool m_surface_changed { true };
+
+    RefPtr<Bitmap> m_content_bitmap;
+    // NOTE: Only used by layers that have children. The surface of a layer without children is its content bitmap.
+    RefPtr<Bitmap> m_surface_bitmap;
+};
+
+// Brings the cached bitmaps of a layer tree up to date and composites the tree into a target.
+//
+// Only the layers whose content changed are rasterized, and only the surfaces of the layers that have a changed
+// descendant are composited again. A clean subtree is skipped without visiting its layers.
+//
+// NOTE: The compositor keeps the scratch buffers of its path rasterizer between frames. A compositor must not be
+//       used by multiple threads at the same time.
+class LayerCompositor {
+    AT_MAKE_NONCOPYABLE(LayerCompositor);
+    AT_MAKE_NONMOVABLE(LayerCompositor);
+
+public:
+    GRAPHICS_API LayerCompositor();
+    GRAPHICS_API ~LayerCompositor();
+
+public:
+    // NOTE: The number of layers whose content was rasterized by the last call to `composite`.
+    NODISCARD ALWAYS_INLINE usize rasterized_layer_count() const { return m_rasterized_layer_count; }
+    // NOTE: The number of surfaces that were composited again by the last call to `composite`.
+    NODISCARD ALWAYS_INLINE usize recomposited_surface_count() const { return m_recomposited_surface_count; }
+
+    // Updates the cached bitmaps of the tree and composites the surface of the root layer over the target, at the
+    // position and with the opacity of the root layer.
+    GRAPHICS_API void composite(Bitmap& target, Layer& root);
+
+private:
+    void update_layer(Layer& layer);
+
+private:
+    PathRasterizer m_rasterizer;
+    usize m_rasterized_layer_count { 0 };
+    usize m_recomposited_surface_count { 0 };
+};
+
+} // namespace Graphics
@@ -0,0 +1,517 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#include <AT/Assertions.h>
+#include <AT/Hash.h>
+#include <AT/MemoryOperations.h>
+#include <Graphics/Paint.h>
+#include <Graphics/PixelOperations.h>
+#include <Graphics/RasterPipeline.h>
+
+// NOTE: Headers from the standard library.
+#include <cmath>
+
+namespace Graphics {
+
+static constexpr f32 pi = 3.14159265358979323846F;
+
+// NOTE: The parameters are clamped to this magnitude before they are wrapped, so that they can be converted to 32-bit
+//       integers. Such distant parameters have no fractional part left anyway.
+static constexpr f32 maximum_parameter = 4194304.0F;
+
+//
+// Gradient parameters.
+//
+
+// Approximates the arctangent on [0, 1], with an error below 1e-5 radians, which is far below the resolution of the
+// color table.
+NODISCARD ALWAYS_INLINE static f32 arctangent_polynomial(f32 x)
+{
+    const f32 x_squared = x * x;
+    f32 result = -0.01172120F;
+    result = result * x_squared + 0.05265332F;
+    result = result * x_squared - 0.11643287F;
+    result = result * x_squared + 0.19354346F;
+    result = result * x_squared - 0.33262347F;
+    result = result * x_squared + 0.99997726F;
+    return result * x;
+}
+
+// Approximates `atan2(y, x) / (2 * pi)`, which is in [-0.5, 0.5].
+NODISCARD ALWAYS_INLINE static f32 angle_in_turns(f32 y, f32 x)
+{
+    const f32 absolute_x = std::fabs(x);
+    const f32 absolute_y = std::fabs(y);
+    const f32 larger = (absolute_x > absolute_y) ? absolute_x : absolute_y;
+    const f32 smaller = (absolute_x > absolute_y) ? absolute_y : absolute_x;
+
+    // NOTE: Reduce the angle to the first octant, where the ratio is in [0, 1].
+    f32 angle = arctangent_polynomial(smaller / ((larger > 1e-30F) ? larger : 1e-30F)) * (0.5F / pi);
+    if (absolute_y > absolute_x)
+        angle = 0.25F - angle;
+    if (x < 0.0F)
+        angle = 0.5F - angle;
+    return (y < 0.0F) ? -angle : angle;
+}
+
+// Computes the parameter of a gradient from the value that varies along the span and the two values that are
+// constant for the whole span.
+template<PaintType type>
+NODISCARD ALWAYS_INLINE static f32 gradient_parameter(f32 varying_value, f32 first_constant, f32 second_constant)
+{
+    if constexpr (type == PaintType::LinearGradient)
+        return varying_value;
+    else if constexpr (type == PaintType::RadialGradient)
+        return std::sqrt(varying_value * varying_value + first_constant);
+    else
+        return angle_in_turns(first_constant, varying_value) - second_constant;
+}
+
+template<GradientSpread spread>
+NODISCARD ALWAYS_INLINE static u32 parameter_to_index(f32 parameter)
+{
+    // NOTE: The comparisons are written so that a NaN parameter maps to the lower bound.
+    f32 clamped_parameter = (parameter > -maximum_parameter) ? parameter : -maximum_parameter;
+    clamped_parameter = (clamped_parameter < maximum_parameter) ? clamped_parameter : maximum_parameter;
+
+    if constexpr (spread == GradientSpread::Repeat) {
+        clamped_parameter -= std::floor(clamped_parameter);
+    }
+    else if constexpr (spread == GradientSpread::Reflect) {
+        clamped_parameter -= 2.0F * std::floor(clamped_parameter * 0.5F);
+        clamped_parameter = (clamped_parameter > 1.0F) ? (2.0F - clamped_parameter) : clamped_parameter;
+    }
+
+    const f32 index = clamped_parameter * 255.0F + 0.5F;
+    return (index > 0.0F) ? ((index < 255.0F) ? static_cast<u32>(index) : 255) : 0;
+}
+
+#if AT_SIMD_SSE2
+
+NODISCARD ALWAYS_INLINE static __m128 select_ps(__m128 mask, __m128 if_true, __m128 if_false)
+{
+    return _mm_or_ps(_mm_and_ps(mask, if_true), _mm_andnot_ps(mask, if_false));
+}
+
+// NOTE: Only valid for values whose magnitude is below 2^31.
+NODISCARD ALWAYS_INLINE static __m128 floor_ps(__m128 values)
+{
+    const __m128 truncated = _mm_cvtepi32_ps(_mm_cvttps_epi32(values));
+    return _mm_sub_ps(truncated, _mm_and_ps(_mm_cmpgt_ps(truncated, values), _mm_set1_ps(1.0F)));
+}
+
+NODISCARD ALWAYS_INLINE static __m128 arctangent_polynomial_4(__m128 x)
+{
+    const __m128 x_squared = _mm_mul_ps(x, x);
+    __m128 result = _mm_set1_ps(-0.01172120F);
+    result = _mm_add_ps(_mm_mul_ps(result, x_squared), _mm_set1_ps(0.05265332F));
+    result = _mm_add_ps(_mm_mul_ps(result, x_squared), _mm_set1_ps(-0.11643287F));
+    result = _mm_add_ps(_mm_mul_ps(result, x_squared), _mm_set1_ps(0.19354346F));
+    result = _mm_add_ps(_mm_mul_ps(result, x_squared), _mm_set1_ps(-0.33262347F));
+    result = _mm_add_ps(_mm_mul_ps(result, x_squared), _mm_set1_ps(0.99997726F));
+    return _mm_mul_ps(result, x);
+}
+
+NODISCARD ALWAYS_INLINE static __m128 angle_in_turns_4(__m128 y, __m128 x)
+{
+    const __m128 sign_mask = _mm_set1_ps(-0.0F);
+    const __m128 absolute_x = _mm_andnot_ps(sign_mask, x);
+    const __m128 absolute_y = _mm_andnot_ps(sign_mask, y);
+    const __m128 larger = _mm_max_ps(absolute_x, absolute_y);
+    const __m128 smaller = _mm_min_ps(absolute_x, absolute_y);
+
+    const __m128 ratio = _mm_div_ps(smaller, _mm_max_ps(larger, _mm_set1_ps(1e-30F)));
+    __m128 angle = _mm_mul_ps(arctangent_polynomial_4(ratio), _mm_set1_ps(0.5F / pi));
+    angle = select_ps(_mm_cmpgt_ps(absolute_y, absolute_x), _mm_sub_ps(_mm_set1_ps(0.25F), angle), angle);
+    angle = select_ps(_mm_cmplt_ps(x, _mm_setzero_ps()), _mm_sub_ps(_mm_set1_ps(0.5F), angle), angle);
+    return _mm_xor_ps(angle, _mm_and_ps(_mm_cmplt_ps(y, _mm_setzero_ps()), sign_mask));
+}
+
+template<PaintType type>
+NODISCARD ALWAYS_INLINE static __m128 gradient_parameters_4(__m128 varying_values, __m128 first_constant, __m128 second_constant)
+{
+    if constexpr (type == PaintType::LinearGradient)
+        return varying_values;
+    else if constexpr (type == PaintType::RadialGradient)
+        return _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(varying_values, varying_values), first_constant));
+    else
+        return _mm_sub_ps(angle_in_turns_4(first_constant, varying_values), second_constant);
+}
+
+template<GradientSpread spread>
+NODISCARD ALWAYS_INLINE static __m128i parameters_to_indices_4(__m128 parameters)
+{
+    // NOTE: `_mm_max_ps` returns its second operand when the first one is NaN, which matches the scalar version.
+    __m128 clamped_parameters = _mm_max_ps(parameters, _mm_set1_ps(-maximum_parameter));
+    clamped_parameters = _mm_min_ps(clamped_parameters, _mm_set1_ps(maximum_parameter));
+
+    if constexpr (spread == GradientSpread::Repeat) {
+        clamped_parameters = _mm_sub_ps(clamped_parameters, floor_ps(clamped_parameters));
+    }
+    else if constexpr (spread == GradientSpread::Reflect) {
+        const __m128 periods = floor_ps(_mm_mul_ps(clamped_parameters, _mm_set1_ps(0.5F)));
+        clamped_parameters = _mm_sub_ps(clamped_parameters, _mm_add_ps(periods, periods));
+        const __m128 reflected_parameters = _mm_sub_ps(_mm_set1_ps(2.0F), clamped_parameters);
+        clamped_parameters = select_ps(_mm_cmpgt_ps(clamped_parameters, _mm_set1_ps(1.0F)), reflected_parameters, clamped_parameters);
+    }
+
+    __m128 indices = _mm_add_ps(_mm_mul_ps(clamped_parameters, _mm_set1_ps(255.0F)), _mm_set1_ps(0.5F));
+    indices = _mm_min_ps(_mm_max_ps(indices, _mm_setzero_ps()), _mm_set1_ps(255.0F));
+    return _mm_cvttps_epi32(indices);
+}
+
+#endif // AT_SIMD_SSE2
+
+// Shades the span of a gradient that starts at the given column, where the value that varies along the span is
+// `(x + 0.5) * value_slope + value_offset` for the pixel in column x. The vector loop evaluates four pixels at a time
+// and looks their colors up in the table.
+//
+// NOTE: The value of every pixel is computed from its column, rather than accumulated from the start of the span,
+//       so a pixel gets the same color no matter where the span that covers it starts, and the vector loop and the
+//       scalar tail agree exactly.
+template<PaintType type, GradientSpread spread>
+static void shade_gradient_pixels(
+    WriteonlyBytes destination,
+    s32 first_x,
+    usize pixel_count,
+    const u32* color_table,
+    f32 value_slope,
+    f32 value_offset,
+    f32 first_constant,
+    f32 second_constant
+)
+{
+    usize pixel_index = 0;
+#if AT_SIMD_SSE2
+    const __m128i lane_offsets = _mm_setr_epi32(0, 1, 2, 3);
+    const __m128 value_slopes = _mm_set1_ps(value_slope);
+    const __m128 value_offsets = _mm_set1_ps(value_offset);
+    const __m128 first_constants = _mm_set1_ps(first_constant);
+    const __m128 second_constants = _mm_set1_ps(second_constant);
+
+    u32 indices[4];
+    for (; pixel_index + 4 <= pixel_count; pixel_index += 4) {
+        const __m128i columns = _mm_add_epi32(_mm_set1_epi32(first_x + static_cast<s32>(pixel_index)), lane_offsets);
+        const __m128 pixel_x = _mm_add_ps(_mm_cvtepi32_ps(columns), _mm_set1_ps(0.5F));
+        const __m128 values = _mm_add_ps(_mm_mul_ps(pixel_x, value_slopes), value_offsets);
+        const __m128 parameters = gradient_parameters_4<type>(values, first_constants, second_constants);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(indices), parameters_to_indices_4<spread>(parameters));
+        const __m128i pixels = _mm_setr_epi32(
+            static_cast<int>(color_table[indices[0]]),
+            static_cast<int>(color_table[indices[1]]),
+            static_cast<int>(color_table[indices[2]]),
+            static_cast<int>(color_table[indices[3]])
+        );
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + 4 * pixel_index), pixels);
+    }
+#endif // AT_SIMD_SSE2
+
+    for (; pixel_index < pixel_count; ++pixel_index) {
+        const f32 pixel_x = static_cast<f32>(first_x + static_cast<s32>(pixel_index)) + 0.5F;
+        const f32 value = pixel_x * value_slope + value_offset;
+        const f32 parameter = gradient_parameter<type>(value, first_constant, second_constant);
+        store_pixel(destination + 4 * pixel_index, color_table[parameter_to_index<spread>(parameter)]);
+    }
+}
+
+//
+// Pattern helpers.
+//
+
+NODISCARD static u32 wrap_coordinate(s64 coordinate, u32 size, PatternWrap wrap)
+{
+    if (wrap == PatternWrap::Repeat) {
+        const s64 wrapped_coordinate = coordinate % static_cast<s64>(size);
+        return static_cast<u32>((wrapped_coordinate < 0) ? (wrapped_coordinate + size) : wrapped_coordinate);
+    }
+    return static_cast<u32>((coordinate < 0) ? 0 : ((coordinate >= static_cast<s64>(size)) ? (size - 1) : coordinate));
+}
+
+static void fill_with_pixel(WriteonlyBytes destination, ReadonlyBytes pixel, usize pixel_byte_count, usize pixel_count)
+{
+    if (pixel_byte_count == 1) {
+        set_memory(destination, pixel[0], pixel_count);
+        return;
+    }
+
+    const u32 value = load_pixel(pixel);
+    for (usize pixel_index = 0; pixel_index < pixel_count; ++pixel_index)
+        store_pixel(destination + 4 * pixel_index, value);
+}
+
+//
+// Paint.
+//
+
+Paint Paint::solid_color(Color color)
+{
+    Paint paint;
+    paint.m_color = color;
+    return paint;
+}
+
+Paint Paint::linear_gradient(FloatPoint start, FloatPoint end, Span<const GradientStop> stops, GradientSpread spread)
+{
+    VERIFY(stops.count() > 0);
+
+    // NOTE: A gradient without a direction has the color of its last stop.
+    const FloatPoint direction = end - start;
+    const f32 length_squared = direction.x * direction.x + direction.y * direction.y;
+    if (!(length_squared > 0.0F) || !std::isfinite(length_squared))
+        return solid_color(stops[stops.count() - 1].color);
+
+    Paint paint;
+    paint.m_type = PaintType::LinearGradient;
+    paint.m_spread = spread;
+    paint.m_gradient_x = direction.x / length_squared;
+    paint.m_gradient_y = direction.y / length_squared;
+    paint.m_gradient_offset = -(start.x * direction.x + start.y * direction.y) / length_squared;
+    paint.build_color_table(stops);
+    return paint;
+}
+
+Paint Paint::radial_gradient(FloatPoint center, f32 radius, Span<const GradientStop> stops, GradientSpread spread)
+{
+    VERIFY(stops.count() > 0);
+    if (!(radius > 0.0F) || !std::isfinite(radius))
+        return solid_color(stops[stops.count() - 1].color);
+
+    Paint paint;
+    paint.m_type = PaintType::RadialGradient;
+    paint.m_spread = spread;
+    paint.m_gradient_x = center.x;
+    paint.m_gradient_y = center.y;
+    paint.m_gradient_offset = 1.0F / radius;
+    paint.build_color_table(stops);
+    return paint;
+}
+
+Paint Paint::conic_gradient(FloatPoint center, f32 start_angle, Span<const GradientStop> stops)
+{
+    VERIFY(stops.count() > 0);
+
+    Paint paint;
+    paint.m_type = PaintType::ConicGradient;
+    paint.m_spread = GradientSpread::Repeat;
+    paint.m_gradient_x = center.x;
+    paint.m_gradient_y = center.y;
+    paint.m_gradient_offset = start_angle * (0.5F / pi);
+    paint.build_color_table(stops);
+    return paint;
+}
+
+Paint Paint::pattern(RefPtr<Bitmap> bitmap, IntPoint origin, PatternWrap horizontal_wrap, PatternWrap vertical_wrap)
+{
+    VERIFY(bitmap.is_valid());
+
+    Paint paint;
+    paint.m_type = PaintType::Pattern;
+    paint.m_horizontal_wrap = horizontal_wrap;
+    paint.m_vertical_wrap = vertical_wrap;
+    paint.m_pattern = move(bitmap);
+    paint.m_pattern_origin = origin;
+    return paint;
+}
+
+PixelFormat Paint::pixel_format() const
+{
+    return (m_type == PaintType::Pattern) ? m_pattern->format() : PixelFormat::RGBA8;
+}
+
+u64 Paint::structural_hash() const
+{
+    Hasher hasher;
+    hasher.update_value(m_type);
+    hasher.update_value(m_spread);
+    hasher.update_value(m_horizontal_wrap);
+    hasher.update_value(m_vertical_wrap);
+    hasher.update_value(m_color);
+    hasher.update_value(m_gradient_x);
+    hasher.update_value(m_gradient_y);
+    hasher.update_value(m_gradient_offset);
+    hasher.update(ReadonlyByteSpan(reinterpret_cast<ReadonlyBytes>(m_color_table.elements()), m_color_table.count() * sizeof(u32)));
+    hasher.update_value(m_pattern.is_valid() ? reinterpret_cast<uintptr>(m_pattern.get()) : static_cast<uintptr>(0));
+    hasher.update_value(m_pattern_origin);
+    return hasher.finalize();
+}
+
+void Paint::shade_span(s32 x, s32 y, usize pixel_count, WriteonlyBytes destination) const
+{
+    switch (m_type) {
+        case PaintType::SolidColor: {
+            const u32 pixel = color_to_pixel(m_color, PixelFormat::RGBA8);
+            for (usize pixel_index = 0; pixel_index < pixel_count; ++pixel_index)
+                store_pixel(destination + 4 * pixel_index, pixel);
+            break;
+        }
+        case PaintType::LinearGradient: shade_gradient_span<PaintType::LinearGradient>(x, y, pixel_count, destination); break;
+        case PaintType::RadialGradient: shade_gradient_span<PaintType::RadialGradient>(x, y, pixel_count, destination); break;
+        case PaintType::ConicGradient: shade_gradient_span<PaintType::ConicGradient>(x, y, pixel_count, destination); break;
+        case PaintType::Pattern: shade_pattern_span(x, y, pixel_count, destination); break;
+    }
+}
+
+void Paint::build_color_table(Span<const GradientStop> stops)
+{
+    for (usize stop_index = 1; stop_index < stops.count(); ++stop_index)
+        VERIFY(stops[stop_index - 1].offset <= stops[stop_index].offset);
+
+    m_color_table.clear();
+    usize next_stop_index = 0;
+    for (usize entry_index = 0; entry_index < color_table_size; ++entry_index) {
+        const f32 parameter = static_cast<f32>(entry_index) / static_cast<f32>(color_table_size - 1);
+        // NOTE: The parameters of the entries increase, so the stops that were passed are never needed again.
+        while (next_stop_index < stops.count() && stops[next_stop_index].offset <= parameter)
+            ++next_stop_index;
+
+        const Color previous_color = stops[(next_stop_index > 0) ? (next_stop_index - 1) : 0].color;
+        const Color next_color = stops[(next_stop_index < stops.count()) ? next_stop_index : (stops.count() - 1)].color;
+        // NOTE: Before the first stop and after the last one, both colors are the same.
+        f32 factor = 0.0F;
+        if (next_stop_index > 0 && next_stop_index < stops.count()) {
+            const f32 previous_offset = stops[next_stop_index - 1].offset;
+            factor = (parameter - previous_offset) / (stops[next_stop_index].offset - previous_offset);
+        }
+
+        const f32 previous_alpha = static_cast<f32>(previous_color.a);
+        const f32 next_alpha = static_cast<f32>(next_color.a);
+        const f32 alpha = previous_alpha + (next_alpha - previous_alpha) * factor;
+        const auto interpolate_channel = [&](u8 previous_channel, u8 next_channel) {
+            const f32 previous_value = static_cast<f32>(previous_channel) * previous_alpha / 255.0F;
+            const f32 next_value = static_cast<f32>(next_channel) * next_alpha / 255.0F;
+            return static_cast<u32>(previous_value + (next_value - previous_value) * factor + 0.5F);
+        };
+
+        const u32 red = interpolate_channel(previous_color.r, next_color.r);
+        const u32 green = interpolate_channel(previous_color.g, next_color.g);
+        const u32 blue = interpolate_channel(previous_color.b, next_color.b);
+        m_color_table.add((static_cast<u32>(alpha + 0.5F) << 24) | (blue << 16) | (green << 8) | red);
+    }
+}
+
+template<PaintType type>
+void Paint::shade_gradient_span(s32 x, s32 y, usize pixel_count, WriteonlyBytes destination) const
+{
+    const f32 pixel_y = static_cast<f32>(y) + 0.5F;
+
+    f32 value_slope = 0.0F;
+    f32 value_offset = 0.0F;
+    f32 first_constant = 0.0F;
+    f32 second_constant = 0.0F;
+    if constexpr (type == PaintType::LinearGradient) {
+        value_slope = m_gradient_x;
+        value_offset = pixel_y * m_gradient_y + m_gradient_offset;
+    }
+    else if constexpr (type == PaintType::RadialGradient) {
+        // NOTE: The coordinates are scaled by the inverse of the radius, so the parameter is the length of the offset.
+        value_slope = m_gradient_offset;
+        value_offset = -m_gradient_x * m_gradient_offset;
+        const f32 vertical_offset = (pixel_y - m_gradient_y) * m_gradient_offset;
+        first_constant = vertical_offset * vertical_offset;
+    }
+    else {
+        value_slope = 1.0F;
+        value_offset = -m_gradient_x;
+        first_constant = pixel_y - m_gradient_y;
+        second_constant = m_gradient_offset;
+    }
+
+    const u32* color_table = m_color_table.elements();
+    switch (m_spread) {
+        case GradientSpread::Pad:
+            shade_gradient_pixels<type, GradientSpread::Pad>(
+                destination, x, pixel_count, color_table, value_slope, value_offset, first_constant, second_constant
+            );
+            break;
+        case GradientSpread::Repeat:
+            shade_gradient_pixels<type, GradientSpread::Repeat>(
+                destination, x, pixel_count, color_table, value_slope, value_offset, first_constant, second_constant
+            );
+            break;
+        case GradientSpread::Reflect:
+            shade_gradient_pixels<type, GradientSpread::Reflect>(
+                destination, x, pixel_count, color_table, value_slope, value_offset, first_constant, second_constant
+            );
+            break;
+    }
+}
+
+void Paint::shade_pattern_span(s32 x, s32 y, usize pixel_count, WriteonlyBytes destination) const
+{
+    const Bitmap& bitmap = *m_pattern;
+    const usize pixel_byte_count = bytes_per_pixel(bitmap.format());
+    const u32 width = bitmap.width();
+    ReadonlyBytes row = bitmap.scanline(wrap_coordinate(static_cast<s64>(y) - m_pattern_origin.y, bitmap.height(), m_vertical_wrap));
+
+    // NOTE: The span is copied in runs of consecutive pixels of the row, rather than one pixel at a time.
+    const s64 source_x = static_cast<s64>(x) - m_pattern_origin.x;
+    usize pixel_index = 0;
+    if (m_horizontal_wrap == PatternWrap::Repeat) {
+        usize run_start = wrap_coordinate(source_x, width, PatternWrap::Repeat);
+        while (pixel_index < pixel_count) {
+            const usize run_length = (width - run_start < pixel_count - pixel_index) ? (width - run_start) : (pixel_count - pixel_index);
+            copy_memory(destination + pixel_byte_count * pixel_index, row + pixel_byte_count * run_start, pixel_byte_count * run_length);
+            pixel_index += run_length;
+            run_start = 0;
+        }
+        return;
+    }
+
+    if (source_x < 0) {
+        const usize leading_count = (static_cast<u64>(-source_x) < pixel_count) ? static_cast<usize>(-source_x) : pixel_count;
+        fill_with_pixel(destination, row, pixel_byte_count, leading_count);
+        pixel_index = leading_count;
+    }
+
+    const s64 first_inside_x = source_x + static_cast<s64>(pixel_index);
+    if (pixel_index < pixel_count && first_inside_x < static_cast<s64>(width)) {
+        const usize inside_count = static_cast<usize>(static_cast<s64>(width) - first_inside_x);
+        const usize run_length = (inside_count < pixel_count - pixel_index) ? inside_count : (pixel_count - pixel_index);
+        copy_memory(destination + pixel_byte_count * pixel_index, row + pixel_byte_count * first_inside_x, pixel_byte_count * run_length);
+        pixel_index += run_length;
+    }
+
+    if (pixel_index < pixel_count) {
+        ReadonlyBytes last_pixel = row + pixel_byte_count * (width - 1);
+        fill_with_pixel(destination + pixel_byte_count * pixel_index, last_pixel, pixel_byte_count, pixel_count - pixel_index);
+    }
+}
+
+void paint_rect(Bitmap& target, const IntRect& rect, const Paint& paint)
+{
+    const IntRect clipped_rect = rect.intersected(target.rect());
+    if (clipped_rect.is_empty())
+        return;
+
+    const usize target_pixel_byte_count = bytes_per_pixel(target.format());
+    RasterSpan span = {};
+    span.pixel_count = static_cast<usize>(clipped_rect.width);
+    span.opacity = 255;
+
+    if (paint.is_solid_color()) {
+        if (paint.color().is_transparent())
+            return;
+        const RasterSpanFunction function =
+            select_span_function(target.format(), PaintSource::SolidColor, target.format(), BlendMode::SourceOver, false);
+        span.color = color_to_pixel(paint.color(), target.format());
+        for (s32 y = clipped_rect.top(); y < clipped_rect.bottom(); ++y) {
+            span.destination = target.scanline(y) + target_pixel_byte_count * clipped_rect.x;
+            function(span);
+        }
+        return;
+    }
+
+    const RasterSpanFunction function =
+        select_span_function(target.format(), PaintSource::Bitmap, paint.pixel_format(), BlendMode::SourceOver, false);
+    Vector<u8> shaded_pixels = Vector<u8>::from_template_element(span.pixel_count * bytes_per_pixel(paint.pixel_format()), 0);
+    span.source = shaded_pixels.elements();
+    for (s32 y = clipped_rect.top(); y < clipped_rect.bottom(); ++y) {
+        paint.shade_span(clipped_rect.x, y, span.pixel_count, shaded_pixels.elements());
+        span.destination = target.scanline(y) + target_pixel_byte_count * clipped_rect.x;
+        function(span);
+    }
+}
+
+} // namespace Graphics
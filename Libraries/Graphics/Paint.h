@@ -0,0 +1,138 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#pragma once
+
+#include <AT/RefPtr.h>
+#include <AT/Span.h>
+#include <AT/Vector.h>
+#include <Graphics/API.h>
+#include <Graphics/Bitmap.h>
+#include <Graphics/Color.h>
+#include <Graphics/Rect.h>
+
+namespace Graphics {
+
+enum class PaintType : u8 {
+    SolidColor,
+    LinearGradient,
+    RadialGradient,
+    ConicGradient,
+    Pattern,
+};
+
+// How the parameter of a gradient is mapped to a color when it falls outside of [0, 1].
+enum class GradientSpread : u8 {
+    // The colors of the first and the last stops extend indefinitely.
+    Pad,
+    // The gradient restarts from the first stop.
+    Repeat,
+    // The gradient alternates between running forwards and backwards.
+    Reflect,
+};
+
+// How the coordinates of a pattern are mapped to a pixel of its bitmap when they fall outside of it.
+enum class PatternWrap : u8 {
+    // The pixels on the edges of the bitmap extend indefinitely.
+    Clamp,
+    // The bitmap is tiled.
+    Repeat,
+};
+
+// NOTE: The offsets of the stops must not decrease. The colors are interpolated with premultiplied alpha, so a
+//       stop that fades to transparent never darkens the colors of its neighbour.
+struct GradientStop {
+    f32 offset { 0.0F };
+    Color color;
+};
+
+// Describes the color of every pixel of a fill, which is shaded one horizontal span at a time.
+//
+// The parameter of a gradient is an affine function of the position along a span, or a simple function of one, so
+// it is evaluated for four pixels at a time from the column of each pixel. It isn't stepped incrementally from the
+// start of the span, so the color of a pixel doesn't depend on where the span that covers it starts. The colors are
+// never interpolated per pixel either: the stops are resolved into a table of 256 premultiplied colors when the paint
+// is created, and the parameter is only used as an index into it.
+//
+// NOTE: A default-constructed paint is a fully transparent solid color.
+class Paint {
+public:
+    static constexpr usize color_table_size = 256;
+
+    NODISCARD GRAPHICS_API static Paint solid_color(Color color);
+
+    // The parameter is the projection of the pixel onto the line from the start to the end point, where the start
+    // point maps to zero and the end point to one.
+    NODISCARD GRAPHICS_API static Paint
+    linear_gradient(FloatPoint start, FloatPoint end, Span<const GradientStop> stops, GradientSpread spread = GradientSpread::Pad);
+
+    // The parameter is the distance from the center, divided by the radius.
+    NODISCARD GRAPHICS_API static Paint
+    radial_gradient(FloatPoint center, f32 radius, Span<const GradientStop> stops, GradientSpread spread = GradientSpread::Pad);
+
+    // The parameter is the angle around the center, in turns, measured clockwise from the start angle, which is in
+    // radians relative to the positive x axis. The gradient always repeats once per turn.
+    NODISCARD GRAPHICS_API static Paint conic_gradient(FloatPoint center, f32 start_angle, Span<const GradientStop> stops);
+
+    // The pixel at the origin is the top-left pixel of the bitmap. The bitmap is referenced rather than copied, so
+    // it must not be modified while the paint is in use.
+    NODISCARD GRAPHICS_API static Paint pattern(
+        RefPtr<Bitmap> bitmap,
+        IntPoint origin,
+        PatternWrap horizontal_wrap = PatternWrap::Repeat,
+        PatternWrap vertical_wrap = PatternWrap::Repeat
+    );
+
+public:
+    NODISCARD ALWAYS_INLINE PaintType type() const { return m_type; }
+    NODISCARD ALWAYS_INLINE bool is_solid_color() const { return (m_type == PaintType::SolidColor); }
+
+    // NOTE: Only valid for solid color paints.
+    NODISCARD ALWAYS_INLINE Color color() const { return m_color; }
+
+    // The format of the pixels written by `shade_span`. Gradients and solid colors are shaded as RGBA8, while
+    // patterns keep the format of their bitmap, so that they can be converted while they are composited.
+    NODISCARD GRAPHICS_API PixelFormat pixel_format() const;
+
+    // Hash of all the parameters of the paint, which is equal for two paints that shade exactly the same pixels.
+    // NOTE: The bitmap of a pattern is hashed by identity rather than by content.
+    NODISCARD GRAPHICS_API u64 structural_hash() const;
+
+    // Writes the premultiplied pixels of the paint for the span that starts at pixel (x, y), in the format returned
+    // by `pixel_format`. Pixels are sampled at their centers.
+    GRAPHICS_API void shade_span(s32 x, s32 y, usize pixel_count, WriteonlyBytes destination) const;
+
+private:
+    void build_color_table(Span<const GradientStop> stops);
+
+    template<PaintType type>
+    void shade_gradient_span(s32 x, s32 y, usize pixel_count, WriteonlyBytes destination) const;
+    void shade_pattern_span(s32 x, s32 y, usize pixel_count, WriteonlyBytes destination) const;
+
+private:
+    PaintType m_type { PaintType::SolidColor };
+    GradientSpread m_spread { GradientSpread::Pad };
+    PatternWrap m_horizontal_wrap { PatternWrap::Repeat };
+    PatternWrap m_vertical_wrap { PatternWrap::Repeat };
+    Color m_color;
+
+    // NOTE: For linear gradients, the parameter is `x * m_gradient_x + y * m_gradient_y + m_gradient_offset`. For
+    //       the other gradients, the point is the center and the offset is either the inverse of the radius or the
+    //       start angle, in turns.
+    f32 m_gradient_x { 0.0F };
+    f32 m_gradient_y { 0.0F };
+    f32 m_gradient_offset { 0.0F };
+
+    // NOTE: Entry `i` is the premultiplied color of the parameter `i / 255`, stored as an RGBA8 pixel.
+    Vector<u32> m_color_table;
+
+    RefPtr<Bitmap> m_pattern;
+    IntPoint m_pattern_origin;
+};
+
+// Composites the paint over the pixels of the rectangle, which is clipped to the bounds of the target.
+GRAPHICS_API void paint_rect(Bitmap& target, const IntRect& rect, const Paint& paint);
+
+} // namespace Graphics
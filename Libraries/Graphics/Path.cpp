@@ -0,0 +1,251 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#include <Graphics/Path.h>
+
+// NOTE: Headers from the standard library.
+#include <cmath>
+
+namespace Graphics {
+
+// NOTE: The distance of the control points from the ends of a cubic curve that approximates a quarter of a circle
+//       of radius one, with an error below 0.03%.
+static constexpr f32 quarter_circle_control_distance = 0.5522847498F;
+
+// NOTE: Bounds the work spent on flattening degenerate or enormous curves.
+static constexpr u32 max_curve_line_count = 1024;
+
+NODISCARD ALWAYS_INLINE static f32 length(FloatPoint vector)
+{
+    return std::sqrt(vector.x * vector.x + vector.y * vector.y);
+}
+
+// Computes the number of lines needed to approximate a curve within the tolerance, using Wang's formula. The
+// factor is `n * (n - 1) / 8` for a curve of degree `n`, and the deviation is the largest second difference of
+// the control points.
+NODISCARD static u32 curve_line_count(f32 factor, f32 deviation, f32 tolerance)
+{
+    const f32 line_count = std::ceil(std::sqrt(factor * deviation / tolerance));
+    if (!(line_count >= 1.0F))
+        return 1;
+    if (line_count >= static_cast<f32>(max_curve_line_count))
+        return max_curve_line_count;
+    return static_cast<u32>(line_count);
+}
+
+FloatRect Path::bounding_box() const
+{
+    if (!m_points.has_elements())
+        return {};
+
+    f32 left = m_points[0].x;
+    f32 top = m_points[0].y;
+    f32 right = left;
+    f32 bottom = top;
+    for (usize point_index = 1; point_index < m_points.count(); ++point_index) {
+        const FloatPoint& point = m_points[point_index];
+        left = (point.x < left) ? point.x : left;
+        top = (point.y < top) ? point.y : top;
+        right = (point.x > right) ? point.x : right;
+        bottom = (point.y > bottom) ? point.y : bottom;
+    }
+
+    return { left, top, right - left, bottom - top };
+}
+
+void Path::move_to(FloatPoint point)
+{
+    // NOTE: Consecutive moves don't produce anything, so only the last one is kept.
+    if (m_verbs.has_elements() && m_verbs[m_verbs.count() - 1] == PathVerb::MoveTo) {
+        m_points[m_points.count() - 1] = point;
+    }
+    else {
+        m_verbs.add(PathVerb::MoveTo);
+        m_points.add(point);
+    }
+
+    m_has_open_subpath = true;
+    m_subpath_start = point;
+}
+
+void Path::line_to(FloatPoint point)
+{
+    ensure_subpath_started();
+    m_verbs.add(PathVerb::LineTo);
+    m_points.add(point);
+}
+
+void Path::quadratic_to(FloatPoint control_point, FloatPoint point)
+{
+    ensure_subpath_started();
+    m_verbs.add(PathVerb::QuadraticTo);
+    m_points.add(control_point);
+    m_points.add(point);
+}
+
+void Path::cubic_to(FloatPoint first_control_point, FloatPoint second_control_point, FloatPoint point)
+{
+    ensure_subpath_started();
+    m_verbs.add(PathVerb::CubicTo);
+    m_points.add(first_control_point);
+    m_points.add(second_control_point);
+    m_points.add(point);
+}
+
+void Path::close()
+{
+    if (!m_has_open_subpath)
+        return;
+
+    m_verbs.add(PathVerb::Close);
+    m_has_open_subpath = false;
+}
+
+void Path::add_rect(const FloatRect& rect)
+{
+    move_to({ rect.left(), rect.top() });
+    line_to({ rect.right(), rect.top() });
+    line_to({ rect.right(), rect.bottom() });
+    line_to({ rect.left(), rect.bottom() });
+    close();
+}
+
+void Path::add_rounded_rect(const FloatRect& rect, f32 radius)
+{
+    // NOTE: The corners can't be larger than half of the shortest side.
+    const f32 max_radius = 0.5F * ((rect.width < rect.height) ? rect.width : rect.height);
+    if (radius > max_radius)
+        radius = max_radius;
+    if (!(radius > 0.0F)) {
+        add_rect(rect);
+        return;
+    }
+
+    const f32 control_offset = radius * (1.0F - quarter_circle_control_distance);
+    const f32 left = rect.left();
+    const f32 top = rect.top();
+    const f32 right = rect.right();
+    const f32 bottom = rect.bottom();
+
+    move_to({ left + radius, top });
+    line_to({ right - radius, top });
+    cubic_to({ right - control_offset, top }, { right, top + control_offset }, { right, top + radius });
+    line_to({ right, bottom - radius });
+    cubic_to({ right, bottom - control_offset }, { right - control_offset, bottom }, { right - radius, bottom });
+    line_to({ left + radius, bottom });
+    cubic_to({ left + control_offset, bottom }, { left, bottom - control_offset }, { left, bottom - radius });
+    line_to({ left, top + radius });
+    cubic_to({ left, top + control_offset }, { left + control_offset, top }, { left + radius, top });
+    close();
+}
+
+void Path::add_ellipse(const FloatRect& rect)
+{
+    const f32 radius_x = 0.5F * rect.width;
+    const f32 radius_y = 0.5F * rect.height;
+    const f32 center_x = rect.x + radius_x;
+    const f32 center_y = rect.y + radius_y;
+    const f32 control_x = radius_x * quarter_circle_control_distance;
+    const f32 control_y = radius_y * quarter_circle_control_distance;
+
+    move_to({ center_x + radius_x, center_y });
+    cubic_to({ center_x + radius_x, center_y + control_y }, { center_x + control_x, center_y + radius_y }, { center_x, center_y + radius_y });
+    cubic_to({ center_x - control_x, center_y + radius_y }, { center_x - radius_x, center_y + control_y }, { center_x - radius_x, center_y });
+    cubic_to({ center_x - radius_x, center_y - control_y }, { center_x - control_x, center_y - radius_y }, { center_x, center_y - radius_y });
+    cubic_to({ center_x + control_x, center_y - radius_y }, { center_x + radius_x, center_y - control_y }, { center_x + radius_x, center_y });
+    close();
+}
+
+void Path::clear()
+{
+    m_verbs.clear();
+    m_points.clear();
+    m_has_open_subpath = false;
+    m_subpath_start = {};
+}
+
+void Path::flatten(LineFunction line_function, void* user_data, f32 tolerance) const
+{
+    FloatPoint subpath_start;
+    FloatPoint current_point;
+    usize point_index = 0;
+
+    for (usize verb_index = 0; verb_index < m_verbs.count(); ++verb_index) {
+        switch (m_verbs[verb_index]) {
+            case PathVerb::MoveTo: {
+                if (current_point != subpath_start)
+                    line_function(current_point, subpath_start, user_data);
+                subpath_start = m_points[point_index++];
+                current_point = subpath_start;
+                break;
+            }
+
+            case PathVerb::LineTo: {
+                const FloatPoint point = m_points[point_index++];
+                line_function(current_point, point, user_data);
+                current_point = point;
+                break;
+            }
+
+            case PathVerb::QuadraticTo: {
+                const FloatPoint start_point = current_point;
+                const FloatPoint control_point = m_points[point_index++];
+                const FloatPoint end_point = m_points[point_index++];
+
+                const f32 deviation = length(start_point - control_point * 2.0F + end_point);
+                const u32 line_count = curve_line_count(0.25F, deviation, tolerance);
+                for (u32 line_index = 1; line_index <= line_count; ++line_index) {
+                    const f32 t = static_cast<f32>(line_index) / static_cast<f32>(line_count);
+                    const f32 u = 1.0F - t;
+                    const FloatPoint point = (line_index == line_count) ? end_point : start_point * (u * u) + control_point * (2.0F * u * t) + end_point * (t * t);
+                    line_function(current_point, point, user_data);
+                    current_point = point;
+                }
+                break;
+            }
+
+            case PathVerb::CubicTo: {
+                const FloatPoint start_point = current_point;
+                const FloatPoint first_control_point = m_points[point_index++];
+                const FloatPoint second_control_point = m_points[point_index++];
+                const FloatPoint end_point = m_points[point_index++];
+
+                const f32 first_deviation = length(start_point - first_control_point * 2.0F + second_control_point);
+                const f32 second_deviation = length(first_control_point - second_control_point * 2.0F + end_point);
+                const f32 deviation = (first_deviation > second_deviation) ? first_deviation : second_deviation;
+                const u32 line_count = curve_line_count(0.75F, deviation, tolerance);
+                for (u32 line_index = 1; line_index <= line_count; ++line_index) {
+                    const f32 t = static_cast<f32>(line_index) / static_cast<f32>(line_count);
+                    const f32 u = 1.0F - t;
+                    const FloatPoint point = (line_index == line_count)
+                                                 ? end_point
+                                                 : start_point * (u * u * u) + first_control_point * (3.0F * u * u * t) +
+                                                       second_control_point * (3.0F * u * t * t) + end_point * (t * t * t);
+                    line_function(current_point, point, user_data);
+                    current_point = point;
+                }
+                break;
+            }
+
+            case PathVerb::Close: {
+                if (current_point != subpath_start)
+                    line_function(current_point, subpath_start, user_data);
+                current_point = subpath_start;
+                break;
+            }
+        }
+    }
+
+    if (current_point != subpath_start)
+        line_function(current_point, subpath_start, user_data);
+}
+
+void Path::ensure_subpath_started()
+{
+    if (!m_has_open_subpath)
+        move_to(m_subpath_start);
+}
+
+} // namespace Graphics
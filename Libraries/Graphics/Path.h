@@ -0,0 +1,74 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#pragma once
+
+#include <AT/Vector.h>
+#include <Graphics/API.h>
+#include <Graphics/Rect.h>
+
+namespace Graphics {
+
+enum class PathVerb : u8 {
+    MoveTo,
+    LineTo,
+    QuadraticTo,
+    CubicTo,
+    Close,
+};
+
+// Decides which regions enclosed by a path are inside of it, based on the winding number of the region.
+enum class FillRule : u8 {
+    // A region is inside if its winding number is not zero.
+    NonZero,
+    // A region is inside if its winding number is odd.
+    EvenOdd,
+};
+
+// Sequence of subpaths made of lines and Bézier curves. The verbs and their points are stored in separate arrays,
+// so that iterating over the path never has to decode variable-sized records.
+class Path {
+public:
+    // The maximum distance between a curve and the lines that approximate it, in pixels.
+    static constexpr f32 default_flattening_tolerance = 0.25F;
+
+    using LineFunction = void (*)(FloatPoint from, FloatPoint to, void* user_data);
+
+public:
+    NODISCARD ALWAYS_INLINE const Vector<PathVerb>& verbs() const { return m_verbs; }
+    NODISCARD ALWAYS_INLINE const Vector<FloatPoint>& points() const { return m_points; }
+    NODISCARD ALWAYS_INLINE bool is_empty() const { return !m_verbs.has_elements(); }
+
+    // NOTE: The bounds of the control points, which always contain the curves.
+    NODISCARD GRAPHICS_API FloatRect bounding_box() const;
+
+    GRAPHICS_API void move_to(FloatPoint point);
+    GRAPHICS_API void line_to(FloatPoint point);
+    GRAPHICS_API void quadratic_to(FloatPoint control_point, FloatPoint point);
+    GRAPHICS_API void cubic_to(FloatPoint first_control_point, FloatPoint second_control_point, FloatPoint point);
+    GRAPHICS_API void close();
+
+    GRAPHICS_API void add_rect(const FloatRect& rect);
+    GRAPHICS_API void add_rounded_rect(const FloatRect& rect, f32 radius);
+    GRAPHICS_API void add_ellipse(const FloatRect& rect);
+
+    GRAPHICS_API void clear();
+
+    // Approximates the path with lines and invokes the function for each of them. Every subpath is closed, as
+    // only closed outlines can be filled.
+    GRAPHICS_API void flatten(LineFunction line_function, void* user_data, f32 tolerance = default_flattening_tolerance) const;
+
+private:
+    // NOTE: A path must start with a move, so drawing without one starts the subpath at the origin.
+    void ensure_subpath_started();
+
+private:
+    Vector<PathVerb> m_verbs;
+    Vector<FloatPoint> m_points;
+    bool m_has_open_subpath { false };
+    FloatPoint m_subpath_start;
+};
+
+} // namespace Graphics
@@ -0,0 +1,412 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#include <AT/BitOperations.h>
+#include <AT/NumericLimits.h>
+#include <Graphics/PathRasterizer.h>
+#include <Graphics/PixelOperations.h>
+#include <Graphics/RasterPipeline.h>
+
+// NOTE: Headers from the standard library.
+#include <cmath>
+
+namespace Graphics {
+
+// NOTE: Rows whose final winding is below this threshold are considered to end with no coverage. Rounding errors
+//       make the sum of the contributions of a closed outline only approximately zero.
+static constexpr f32 winding_threshold = 0.5F / 255.0F;
+
+// NOTE: The accumulated areas have 16 fractional bits, which is far more precise than the 8-bit coverage values.
+static constexpr f32 accumulation_scale = 65536.0F;
+
+NODISCARD ALWAYS_INLINE static s32 area_to_fixed_point(f32 area)
+{
+    return static_cast<s32>(std::floor(area * accumulation_scale + 0.5F));
+}
+
+// Returns the integral of the part of a cell that is right of a point, from the left edge of the cell to the point.
+NODISCARD ALWAYS_INLINE static f32 integrate_cell_coverage(f32 offset_in_cell)
+{
+    if (offset_in_cell <= 0.0F)
+        return offset_in_cell;
+    if (offset_in_cell < 1.0F)
+        return offset_in_cell - 0.5F * offset_in_cell * offset_in_cell;
+    return 0.5F;
+}
+
+NODISCARD ALWAYS_INLINE static f32 winding_to_coverage(f32 winding, FillRule fill_rule)
+{
+    const f32 absolute_winding = std::fabs(winding);
+    if (fill_rule == FillRule::NonZero)
+        return (absolute_winding < 1.0F) ? absolute_winding : 1.0F;
+
+    // NOTE: The coverage rises over the odd windings and falls over the even ones, forming a triangle wave.
+    const f32 wrapped_winding = absolute_winding - 2.0F * static_cast<f32>(static_cast<s32>(0.5F * absolute_winding));
+    return 1.0F - std::fabs(wrapped_winding - 1.0F);
+}
+
+NODISCARD ALWAYS_INLINE static u8 coverage_to_byte(f32 coverage)
+{
+    return static_cast<u8>(static_cast<s32>(coverage * 255.0F + 0.5F));
+}
+
+template<typename T>
+ALWAYS_INLINE static void ensure_element_count(Vector<T>& vector, usize element_count, const T& template_element)
+{
+    while (vector.count() < element_count)
+        vector.add(template_element);
+}
+
+PathRasterizer::PathRasterizer() = default;
+PathRasterizer::~PathRasterizer() = default;
+
+void PathRasterizer::rasterize(const Path& path, FillRule fill_rule, const IntRect& clip_rect, SpanFunction span_function, void* user_data)
+{
+    if (clip_rect.is_empty() || path.is_empty())
+        return;
+
+    // NOTE: Each row has room for the cells read by the last vector iteration of the resolve loop.
+    m_clip_rect = clip_rect;
+    m_row_stride = align_up(static_cast<usize>(clip_rect.width), 4) + 4;
+
+    // NOTE: The accumulation buffer is always cleared while it is resolved, so only the new cells are zeroed here.
+    ensure_element_count(m_accumulation, m_row_stride * band_height, static_cast<s32>(0));
+    ensure_element_count(m_coverage, m_row_stride, static_cast<u8>(0));
+    ensure_element_count(m_first_touched_cells, band_height, static_cast<s32>(0));
+    ensure_element_count(m_last_touched_cells, band_height, static_cast<s32>(0));
+
+    m_lines.clear();
+    path.flatten(add_path_line, this);
+    if (!m_lines.has_elements())
+        return;
+
+    // NOTE: Sort the lines by their first band, in the same way as a counting sort.
+    const u32 band_count = (static_cast<u32>(clip_rect.height) + band_height - 1) / band_height;
+    m_band_line_offsets.clear();
+    ensure_element_count(m_band_line_offsets, band_count + 1, 0U);
+    for (usize line_index = 0; line_index < m_lines.count(); ++line_index)
+        ++m_band_line_offsets[m_lines[line_index].first_band + 1];
+    for (u32 band_index = 1; band_index <= band_count; ++band_index)
+        m_band_line_offsets[band_index] += m_band_line_offsets[band_index - 1];
+
+    m_binned_lines.clear();
+    ensure_element_count(m_binned_lines, m_lines.count(), 0U);
+    for (usize line_index = 0; line_index < m_lines.count(); ++line_index) {
+        // NOTE: The offset of the next band is used as the write cursor, and it is restored below.
+        u32& cursor = m_band_line_offsets[m_lines[line_index].first_band + 1];
+        m_binned_lines[cursor - 1] = static_cast<u32>(line_index);
+        --cursor;
+    }
+
+    m_active_lines.clear();
+    for (u32 band_index = 0; band_index < band_count; ++band_index) {
+        // NOTE: After the cursors were decremented, the offset of the next band is the start of this band.
+        const u32 band_line_start = m_band_line_offsets[band_index + 1];
+        const u32 band_line_end = (band_index + 2 <= band_count) ? m_band_line_offsets[band_index + 2] : static_cast<u32>(m_lines.count());
+        for (u32 offset = band_line_start; offset < band_line_end; ++offset)
+            m_active_lines.add(m_binned_lines[offset]);
+
+        if (!m_active_lines.has_elements())
+            continue;
+
+        const u32 band_top = band_index * band_height;
+        const u32 remaining_row_count = static_cast<u32>(clip_rect.height) - band_top;
+        const u32 band_row_count = (remaining_row_count < band_height) ? remaining_row_count : band_height;
+        for (u32 row_index = 0; row_index < band_row_count; ++row_index) {
+            m_first_touched_cells[row_index] = NumericLimits<s32>::max();
+            m_last_touched_cells[row_index] = -1;
+        }
+
+        for (usize active_index = 0; active_index < m_active_lines.count(); ++active_index)
+            accumulate_line(m_lines[m_active_lines[active_index]], band_top, band_row_count);
+        resolve_band(band_top, band_row_count, fill_rule, span_function, user_data);
+
+        for (usize active_index = m_active_lines.count(); active_index > 0; --active_index) {
+            if (m_lines[m_active_lines[active_index - 1]].last_band == band_index)
+                m_active_lines.remove_unordered(active_index - 1);
+        }
+    }
+}
+
+struct FillPathContext {
+    Bitmap* target;
+    RasterSpanFunction span_function;
+    RasterSpan span;
+};
+
+void PathRasterizer::fill_path(Bitmap& target, const Path& path, Color color, FillRule fill_rule)
+{
+    fill_path(target, path, color, fill_rule, target.rect());
+}
+
+void PathRasterizer::fill_path(Bitmap& target, const Path& path, Color color, FillRule fill_rule, const IntRect& clip_rect)
+{
+    if (color.is_transparent())
+        return;
+
+    // NOTE: The kernel only depends on the target, so it is selected once for all spans of the path.
+    FillPathContext context = {};
+    context.target = &target;
+    context.span_function = select_span_function(target.format(), PaintSource::SolidColor, target.format(), BlendMode::SourceOver, true);
+    context.span.color = color_to_pixel(color, target.format());
+    context.span.opacity = 255;
+
+    const SpanFunction span_function = [](s32 x, s32 y, ReadonlyBytes coverage, u32 pixel_count, void* user_data) {
+        FillPathContext& context = *static_cast<FillPathContext*>(user_data);
+        context.span.destination = context.target->scanline(y) + bytes_per_pixel(context.target->format()) * static_cast<usize>(x);
+        context.span.coverage = coverage;
+        context.span.pixel_count = pixel_count;
+        context.span_function(context.span);
+    };
+
+    rasterize(path, fill_rule, clip_rect.intersected(target.rect()), span_function, &context);
+}
+
+struct FillPathWithPaintContext {
+    Bitmap* target;
+    const Paint* paint;
+    RasterSpanFunction span_function;
+    RasterSpan span;
+    ReadWriteBytes shaded_pixels;
+};
+
+void PathRasterizer::fill_path(Bitmap& target, const Path& path, const Paint& paint, FillRule fill_rule)
+{
+    fill_path(target, path, paint, fill_rule, target.rect());
+}
+
+void PathRasterizer::fill_path(Bitmap& target, const Path& path, const Paint& paint, FillRule fill_rule, const IntRect& clip_rect)
+{
+    if (paint.is_solid_color()) {
+        fill_path(target, path, paint.color(), fill_rule, clip_rect);
+        return;
+    }
+
+    const IntRect clipped_rect = clip_rect.intersected(target.rect());
+    if (clipped_rect.is_empty())
+        return;
+
+    // NOTE: The spans never extend past the clip rectangle, so a single row of shaded pixels is enough for all of them.
+    ensure_element_count(m_shaded_pixels, static_cast<usize>(clipped_rect.width) * bytes_per_pixel(paint.pixel_format()), static_cast<u8>(0));
+
+    FillPathWithPaintContext context = {};
+    context.target = &target;
+    context.paint = &paint;
+    context.span_function = select_span_function(target.format(), PaintSource::Bitmap, paint.pixel_format(), BlendMode::SourceOver, true);
+    context.span.opacity = 255;
+    context.shaded_pixels = m_shaded_pixels.elements();
+
+    const SpanFunction span_function = [](s32 x, s32 y, ReadonlyBytes coverage, u32 pixel_count, void* user_data) {
+        FillPathWithPaintContext& context = *static_cast<FillPathWithPaintContext*>(user_data);
+        context.paint->shade_span(x, y, pixel_count, context.shaded_pixels);
+        context.span.destination = context.target->scanline(y) + bytes_per_pixel(context.target->format()) * static_cast<usize>(x);
+        context.span.source = context.shaded_pixels;
+        context.span.coverage = coverage;
+        context.span.pixel_count = pixel_count;
+        context.span_function(context.span);
+    };
+
+    rasterize(path, fill_rule, clipped_rect, span_function, &context);
+}
+
+void PathRasterizer::add_path_line(FloatPoint from, FloatPoint to, void* user_data)
+{
+    PathRasterizer& rasterizer = *static_cast<PathRasterizer*>(user_data);
+    rasterizer.add_line(from, to);
+}
+
+void PathRasterizer::add_line(FloatPoint from, FloatPoint to)
+{
+    // NOTE: Horizontal lines don't contribute any area. The negated comparison also discards non-finite lines.
+    if (!(from.y != to.y) || !std::isfinite(from.x) || !std::isfinite(to.x))
+        return;
+
+    // NOTE: The lines right of the clip rectangle don't affect any pixel inside of it. The lines left of it are
+    //       kept, as they still change the winding number of all the pixels to their right.
+    const f32 clip_left = static_cast<f32>(m_clip_rect.x);
+    const f32 clip_top = static_cast<f32>(m_clip_rect.y);
+    const f32 clip_right = clip_left + static_cast<f32>(m_clip_rect.width);
+    const f32 clip_bottom = clip_top + static_cast<f32>(m_clip_rect.height);
+    if ((from.y <= clip_top && to.y <= clip_top) || (from.y >= clip_bottom && to.y >= clip_bottom))
+        return;
+    if (from.x >= clip_right && to.x >= clip_right)
+        return;
+
+    Line line;
+    if (from.y < to.y) {
+        line = { from.x, from.y, to.x, to.y, 1.0F, 0, 0 };
+    }
+    else {
+        line = { to.x, to.y, from.x, from.y, -1.0F, 0, 0 };
+    }
+
+    const f32 first_row = ((line.top_y > clip_top) ? std::floor(line.top_y) : clip_top) - clip_top;
+    const f32 last_row = ((line.bottom_y < clip_bottom) ? std::ceil(line.bottom_y) : clip_bottom) - clip_top - 1.0F;
+    if (last_row < first_row)
+        return;
+
+    line.first_band = static_cast<u32>(first_row) / band_height;
+    line.last_band = static_cast<u32>(last_row) / band_height;
+    m_lines.add(line);
+}
+
+void PathRasterizer::accumulate_line(const Line& line, u32 band_top, u32 band_row_count)
+{
+    const f32 band_top_y = static_cast<f32>(m_clip_rect.y) + static_cast<f32>(band_top);
+    const f32 start_y = (line.top_y > band_top_y) ? line.top_y : band_top_y;
+    const f32 band_bottom_y = band_top_y + static_cast<f32>(band_row_count);
+    const f32 end_y = (line.bottom_y < band_bottom_y) ? line.bottom_y : band_bottom_y;
+    if (!(start_y < end_y))
+        return;
+
+    const f32 delta_x_per_y = (line.bottom_x - line.top_x) / (line.bottom_y - line.top_y);
+    for (f32 row_y = std::floor(start_y); row_y < end_y; row_y += 1.0F) {
+        const f32 segment_top = (start_y > row_y) ? start_y : row_y;
+        const f32 segment_bottom = (end_y < row_y + 1.0F) ? end_y : row_y + 1.0F;
+
+        // NOTE: The ends of the segment are computed from the line instead of being stepped from the previous row,
+        //       so that they don't depend on the row where the band or the clip rectangle starts.
+        const f32 top_x = (segment_top == line.top_y) ? line.top_x : line.top_x + (segment_top - line.top_y) * delta_x_per_y;
+        const f32 bottom_x = (segment_bottom == line.bottom_y) ? line.bottom_x : line.top_x + (segment_bottom - line.top_y) * delta_x_per_y;
+        const u32 band_row = static_cast<u32>(row_y - band_top_y);
+        accumulate_segment(band_row, top_x, bottom_x, (segment_bottom - segment_top) * line.direction);
+    }
+}
+
+void PathRasterizer::accumulate_segment(u32 band_row, f32 top_x, f32 bottom_x, f32 signed_height)
+{
+    const f32 left_x = (top_x < bottom_x) ? top_x : bottom_x;
+    const f32 right_x = (top_x < bottom_x) ? bottom_x : top_x;
+    const f32 left_floor = std::floor(left_x);
+    const f32 right_ceil = std::ceil(right_x);
+
+    const f32 clip_left = static_cast<f32>(m_clip_rect.x);
+    const f32 clip_right = clip_left + static_cast<f32>(m_clip_rect.width);
+    if (left_floor >= clip_right)
+        return;
+
+    // NOTE: The segment contributes to the winding number of each cell the fraction of the cell that is right of
+    //       it, averaged over its height. The sum of the contributions up to each cell is computed directly and
+    //       rounded, and each cell receives the difference from the previous one, so that the running sum of a row
+    //       is exact and doesn't depend on the cells where it starts. The cells left of the clip rectangle are
+    //       merged into its first cell, and the cells right of the segment are fully right of it.
+    const bool is_in_single_cell = (right_ceil <= left_floor + 1.0F);
+    const f32 middle_x = 0.5F * (left_x + right_x);
+    const f32 inverse_width = is_in_single_cell ? 0.0F : 1.0F / (right_x - left_x);
+    const auto fraction_right_of_segment = [&](f32 cell_x) {
+        if (cell_x >= right_x)
+            return 1.0F;
+        if (is_in_single_cell) {
+            const f32 fraction = cell_x + 1.0F - middle_x;
+            return (fraction < 0.0F) ? 0.0F : ((fraction > 1.0F) ? 1.0F : fraction);
+        }
+        const f32 fraction = (integrate_cell_coverage(right_x - cell_x) - integrate_cell_coverage(left_x - cell_x)) * inverse_width;
+        return (fraction < 0.0F) ? 0.0F : ((fraction > 1.0F) ? 1.0F : fraction);
+    };
+
+    const f32 first_cell_x = (left_floor > clip_left) ? left_floor : clip_left;
+    const f32 last_cell_x = (right_ceil < first_cell_x) ? first_cell_x : ((right_ceil < clip_right - 1.0F) ? right_ceil : clip_right - 1.0F);
+    const s32 first_cell = static_cast<s32>(first_cell_x - clip_left);
+    const s32 last_cell = static_cast<s32>(last_cell_x - clip_left);
+
+    s32* cells = m_accumulation.elements() + band_row * m_row_stride;
+    s32 previous_area = 0;
+    for (s32 cell = first_cell; cell <= last_cell; ++cell) {
+        const s32 area = area_to_fixed_point(signed_height * fraction_right_of_segment(clip_left + static_cast<f32>(cell)));
+        cells[cell] += area - previous_area;
+        previous_area = area;
+    }
+
+    if (first_cell < m_first_touched_cells[band_row])
+        m_first_touched_cells[band_row] = first_cell;
+    if (last_cell > m_last_touched_cells[band_row])
+        m_last_touched_cells[band_row] = last_cell;
+}
+
+void PathRasterizer::resolve_band(u32 band_top, u32 band_row_count, FillRule fill_rule, SpanFunction span_function, void* user_data)
+{
+    const s32 clip_width = m_clip_rect.width;
+    u8* coverage = m_coverage.elements();
+
+    for (u32 band_row = 0; band_row < band_row_count; ++band_row) {
+        const s32 first_cell = m_first_touched_cells[band_row];
+        const s32 last_cell = m_last_touched_cells[band_row];
+        if (first_cell > last_cell)
+            continue;
+
+        s32* cells = m_accumulation.elements() + band_row * m_row_stride;
+        f32 winding = 0.0F;
+        s32 cell = first_cell;
+
+#if AT_SIMD_SSE2
+        __m128i carry = _mm_setzero_si128();
+        const __m128 inverse_scale = _mm_set1_ps(1.0F / accumulation_scale);
+        const __m128 one = _mm_set1_ps(1.0F);
+        const __m128 two = _mm_set1_ps(2.0F);
+        const __m128 half = _mm_set1_ps(0.5F);
+        const __m128 scale = _mm_set1_ps(255.0F);
+        const __m128 absolute_mask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+
+        for (; cell <= last_cell; cell += 4) {
+            __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(cells + cell));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(cells + cell), _mm_setzero_si128());
+
+            // NOTE: Compute the inclusive prefix sum of the four values, then add the sum of all the previous cells.
+            values = _mm_add_epi32(values, _mm_slli_si128(values, 4));
+            values = _mm_add_epi32(values, _mm_slli_si128(values, 8));
+            values = _mm_add_epi32(values, carry);
+            carry = _mm_shuffle_epi32(values, _MM_SHUFFLE(3, 3, 3, 3));
+
+            __m128 cell_coverage = _mm_and_ps(_mm_mul_ps(_mm_cvtepi32_ps(values), inverse_scale), absolute_mask);
+            if (fill_rule == FillRule::NonZero) {
+                cell_coverage = _mm_min_ps(cell_coverage, one);
+            }
+            else {
+                const __m128 wrapped_winding_base = _mm_cvtepi32_ps(_mm_cvttps_epi32(_mm_mul_ps(cell_coverage, half)));
+                const __m128 wrapped_winding = _mm_sub_ps(cell_coverage, _mm_mul_ps(two, wrapped_winding_base));
+                cell_coverage = _mm_sub_ps(one, _mm_and_ps(_mm_sub_ps(wrapped_winding, one), absolute_mask));
+            }
+
+            const __m128i coverage_32 = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(cell_coverage, scale), half));
+            const __m128i coverage_16 = _mm_packs_epi32(coverage_32, coverage_32);
+            const u32 coverage_4 = static_cast<u32>(_mm_cvtsi128_si32(_mm_packus_epi16(coverage_16, coverage_16)));
+            coverage[cell + 0] = static_cast<u8>(coverage_4);
+            coverage[cell + 1] = static_cast<u8>(coverage_4 >> 8);
+            coverage[cell + 2] = static_cast<u8>(coverage_4 >> 16);
+            coverage[cell + 3] = static_cast<u8>(coverage_4 >> 24);
+        }
+        winding = static_cast<f32>(_mm_cvtsi128_si32(carry)) / accumulation_scale;
+#else
+        s32 accumulated_area = 0;
+        for (; cell <= last_cell; ++cell) {
+            accumulated_area += cells[cell];
+            cells[cell] = 0;
+            winding = static_cast<f32>(accumulated_area) / accumulation_scale;
+            coverage[cell] = coverage_to_byte(winding_to_coverage(winding, fill_rule));
+        }
+#endif // AT_SIMD_SSE2
+
+        // NOTE: If the winding doesn't return to zero, the outline continues past the right edge of the clip
+        //       rectangle, so the coverage of the last cell extends to the end of the row.
+        s32 span_end = last_cell + 1;
+        if (std::fabs(winding) >= winding_threshold && span_end < clip_width) {
+            const u8 remaining_coverage = coverage_to_byte(winding_to_coverage(winding, fill_rule));
+            for (s32 remaining_cell = span_end; remaining_cell < clip_width; ++remaining_cell)
+                coverage[remaining_cell] = remaining_coverage;
+            span_end = clip_width;
+        }
+
+        if (span_end > clip_width)
+            span_end = clip_width;
+        if (first_cell >= span_end)
+            continue;
+
+        const s32 x = m_clip_rect.x + first_cell;
+        const s32 y = m_clip_rect.y + static_cast<s32>(band_top + band_row);
+        span_function(x, y, coverage + first_cell, static_cast<u32>(span_end - first_cell), user_data);
+    }
+}
+
+} // namespace Graphics
@@ -0,0 +1,104 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#pragma once
+
+#include <AT/Span.h>
+#include <AT/Vector.h>
+#include <Graphics/API.h>
+#include <Graphics/Bitmap.h>
+#include <Graphics/Paint.h>
+#include <Graphics/Path.h>
+
+namespace Graphics {
+
+// Anti-aliased rasterizer that computes the exact area of each pixel covered by a path.
+//
+// Every line of the flattened path adds its signed area contribution to the cells of an accumulation buffer, in a
+// single pass. The running sum of a row then yields the winding number of each pixel, weighted by its coverage,
+// which is converted to an 8-bit coverage value according to the fill rule. The cost is proportional to the length
+// of the outline plus the number of pixels between the outermost edges of each row, so unlike supersampling, the
+// quality doesn't depend on the number of samples.
+//
+// NOTE: The coverage of a pixel is exact when at most one edge crosses it. Where edges of different windings
+//       cross the same pixel, only the sum of their areas is known, so the coverage of that pixel is approximate.
+//
+// The rows are processed in bands, so that the accumulation buffer stays small and in cache regardless of the
+// size of the path. Only the part of each row between the leftmost and the rightmost touched cell is resolved.
+//
+// The coverage of a pixel doesn't depend on the clip rectangle, so a path can be rasterized in multiple parts, such
+// as the damaged rectangles of a target, without seams between them. The area left of the edges is computed from the
+// coordinates of the target, and accumulated as fixed point numbers, whose sums don't depend on their order.
+//
+// NOTE: The rasterizer keeps its scratch buffers between calls, so that rasterizing doesn't allocate memory once
+//       the buffers are large enough. A rasterizer must not be used by multiple threads at the same time.
+class PathRasterizer {
+    AT_MAKE_NONCOPYABLE(PathRasterizer);
+    AT_MAKE_NONMOVABLE(PathRasterizer);
+
+public:
+    static constexpr u32 band_height = 16;
+
+    // Invoked for each row with a span of coverage values, where the first value is the coverage of pixel (x, y).
+    // Pixels outside of the spans are not covered at all.
+    using SpanFunction = void (*)(s32 x, s32 y, ReadonlyBytes coverage, u32 pixel_count, void* user_data);
+
+public:
+    GRAPHICS_API PathRasterizer();
+    GRAPHICS_API ~PathRasterizer();
+
+    GRAPHICS_API void rasterize(const Path& path, FillRule fill_rule, const IntRect& clip_rect, SpanFunction span_function, void* user_data);
+
+    // Composites the color over the target, with the opacity of each pixel scaled by its coverage.
+    GRAPHICS_API void fill_path(Bitmap& target, const Path& path, Color color, FillRule fill_rule = FillRule::NonZero);
+    GRAPHICS_API void fill_path(Bitmap& target, const Path& path, Color color, FillRule fill_rule, const IntRect& clip_rect);
+
+    // Composites the paint over the target, with the opacity of each pixel scaled by its coverage. The paint is
+    // shaded only for the spans of pixels that are covered.
+    GRAPHICS_API void fill_path(Bitmap& target, const Path& path, const Paint& paint, FillRule fill_rule = FillRule::NonZero);
+    GRAPHICS_API void fill_path(Bitmap& target, const Path& path, const Paint& paint, FillRule fill_rule, const IntRect& clip_rect);
+
+private:
+    // NOTE: The lines are stored in the coordinates of the target, and always point downwards. The bands are
+    //       relative to the clip rectangle.
+    struct Line {
+        f32 top_x;
+        f32 top_y;
+        f32 bottom_x;
+        f32 bottom_y;
+        // NOTE: Plus one if the original line pointed downwards, and minus one otherwise.
+        f32 direction;
+        u32 first_band;
+        u32 last_band;
+    };
+
+private:
+    static void add_path_line(FloatPoint from, FloatPoint to, void* user_data);
+    void add_line(FloatPoint from, FloatPoint to);
+
+    void accumulate_line(const Line& line, u32 band_top, u32 band_row_count);
+    void accumulate_segment(u32 band_row, f32 top_x, f32 bottom_x, f32 signed_height);
+    void resolve_band(u32 band_top, u32 band_row_count, FillRule fill_rule, SpanFunction span_function, void* user_data);
+
+private:
+    IntRect m_clip_rect;
+    usize m_row_stride { 0 };
+
+    Vector<Line> m_lines;
+    Vector<u32> m_band_line_offsets;
+    Vector<u32> m_binned_lines;
+    Vector<u32> m_active_lines;
+
+    Vector<s32> m_accumulation;
+    Vector<u8> m_coverage;
+    // NOTE: The range of cells touched in each row of the band, which is empty when the first exceeds the last.
+    Vector<s32> m_first_touched_cells;
+    Vector<s32> m_last_touched_cells;
+
+    // NOTE: The pixels of the paint for the current span, when filling with a paint other than a solid color.
+    Vector<u8> m_shaded_pixels;
+};
+
+} // namespace Graphics
@@ -0,0 +1,71 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#pragma once
+
+#include <AT/Span.h>
+#include <Graphics/Bitmap.h>
+#include <Graphics/Color.h>
+
+#if AT_SIMD_SSE2
+    #include <emmintrin.h>
+#endif // AT_SIMD_SSE2
+
+//
+// Building blocks shared by the pixel processing loops of the library. The scalar functions operate on a single
+// pixel stored as a little-endian 32-bit integer, while the vector functions operate on pixels whose channels were
+// unpacked to 16-bit lanes, which leaves room for the products of two channels.
+//
+
+namespace Graphics {
+
+NODISCARD ALWAYS_INLINE u32 load_pixel(ReadonlyBytes pixel)
+{
+    return static_cast<u32>(pixel[0]) | (static_cast<u32>(pixel[1]) << 8) | (static_cast<u32>(pixel[2]) << 16) |
+           (static_cast<u32>(pixel[3]) << 24);
+}
+
+ALWAYS_INLINE void store_pixel(WriteonlyBytes pixel, u32 value)
+{
+    pixel[0] = static_cast<u8>(value);
+    pixel[1] = static_cast<u8>(value >> 8);
+    pixel[2] = static_cast<u8>(value >> 16);
+    pixel[3] = static_cast<u8>(value >> 24);
+}
+
+// NOTE: Converts between RGBA8 and BGRA8, which only differ by the order of the first and the third byte.
+NODISCARD ALWAYS_INLINE u32 swap_red_and_blue(u32 pixel)
+{
+    return (pixel & 0xFF00FF00) | ((pixel >> 16) & 0xFF) | ((pixel & 0xFF) << 16);
+}
+
+NODISCARD ALWAYS_INLINE u32 color_to_pixel(Color color, PixelFormat format)
+{
+    const Color premultiplied_color = color.premultiplied();
+    const u32 alpha = static_cast<u32>(premultiplied_color.a) << 24;
+    const u32 green = static_cast<u32>(premultiplied_color.g) << 8;
+    if (format == PixelFormat::BGRA8)
+        return alpha | (static_cast<u32>(premultiplied_color.r) << 16) | green | premultiplied_color.b;
+    return alpha | (static_cast<u32>(premultiplied_color.b) << 16) | green | premultiplied_color.r;
+}
+
+#if AT_SIMD_SSE2
+// Computes `(x * y) / 255` for each 16-bit lane, where the product must not exceed 65025.
+NODISCARD ALWAYS_INLINE __m128i multiply_channels_16(__m128i x, __m128i y)
+{
+    const __m128i product = _mm_add_epi16(_mm_mullo_epi16(x, y), _mm_set1_epi16(128));
+    return _mm_mulhi_epu16(product, _mm_set1_epi16(257));
+}
+
+NODISCARD ALWAYS_INLINE __m128i swap_red_and_blue_4(__m128i pixels)
+{
+    const __m128i alpha_and_green = _mm_and_si128(pixels, _mm_set1_epi32(static_cast<int>(0xFF00FF00)));
+    const __m128i red_and_blue = _mm_and_si128(pixels, _mm_set1_epi32(0x00FF00FF));
+    const __m128i swapped = _mm_or_si128(_mm_srli_epi32(red_and_blue, 16), _mm_slli_epi32(red_and_blue, 16));
+    return _mm_or_si128(alpha_and_green, _mm_and_si128(swapped, _mm_set1_epi32(0x00FF00FF)));
+}
+#endif // AT_SIMD_SSE2
+
+} // namespace Graphics
@@ -0,0 +1,675 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#include <AT/Assertions.h>
+#include <Graphics/PixelOperations.h>
+#include <Graphics/RasterPipeline.h>
+
+namespace Graphics {
+
+//
+// A span function is assembled from three stages: fetching the source pixels, scaling them by the coverage and
+// blending them with the destination. Each stage is a template parameter of the kernel, so every combination is
+// compiled into a loop without branches on the stages, which the compiler is free to schedule as a whole.
+//
+// The stages are written once, in terms of a small set of channel operations. There are two layouts of channels:
+// the color layout holds the four channels of each pixel, while the alpha layout holds only the alpha of each
+// pixel, which is used for alpha-only destinations. Each layout has a vector implementation that processes a block
+// of pixels per iteration and a scalar one that finishes the pixels that don't fill a whole block.
+//
+// Each channel is widened to 16 bits, which leaves room for the products of two channels and for the sums that
+// some blend modes compute before saturating. The results saturate to 255 when they are stored.
+//
+
+// Describes how the source pixels are converted to the layout of the destination.
+enum class SourceFetch : u8 {
+    // The source is a single color, which is loaded once for the whole span.
+    SolidColor,
+    // The source has the same pixel format as the destination.
+    Copy,
+    // The source has the other color channel order.
+    SwapRedAndBlue,
+    // The source is alpha-only and the destination has a color format.
+    ExpandAlpha,
+    // The source has a color format and the destination is alpha-only.
+    ExtractAlpha,
+};
+
+// Portable implementation of the operations of the color layout, which processes a single pixel.
+struct ScalarColorOperations {
+    static constexpr usize pixels_per_block = 1;
+    static constexpr usize bytes_per_pixel = 4;
+
+    struct Channels {
+        u32 values[4];
+    };
+
+    NODISCARD ALWAYS_INLINE static Channels load(ReadonlyBytes pixels) { return { { pixels[0], pixels[1], pixels[2], pixels[3] } }; }
+
+    template<SourceFetch fetch>
+    NODISCARD ALWAYS_INLINE static Channels load_source(ReadonlyBytes pixels)
+    {
+        if constexpr (fetch == SourceFetch::SwapRedAndBlue)
+            return { { pixels[2], pixels[1], pixels[0], pixels[3] } };
+        else if constexpr (fetch == SourceFetch::ExpandAlpha)
+            return { { 0, 0, 0, pixels[0] } };
+        else
+            return load(pixels);
+    }
+
+    NODISCARD ALWAYS_INLINE static Channels load_color(u32 pixel)
+    {
+        return { { pixel & 0xFF, (pixel >> 8) & 0xFF, (pixel >> 16) & 0xFF, pixel >> 24 } };
+    }
+
+    NODISCARD ALWAYS_INLINE static Channels load_coverage(ReadonlyBytes coverage) { return splat(coverage[0]); }
+    NODISCARD ALWAYS_INLINE static Channels splat(u32 value) { return { { value, value, value, value } }; }
+
+    ALWAYS_INLINE static void store(WriteonlyBytes pixels, Channels channels)
+    {
+        for (usize channel_index = 0; channel_index < 4; ++channel_index) {
+            const u32 value = channels.values[channel_index];
+            pixels[channel_index] = static_cast<u8>((value < 255) ? value : 255);
+        }
+    }
+
+    NODISCARD ALWAYS_INLINE static Channels multiply(Channels x, Channels y)
+    {
+        Channels result;
+        for (usize channel_index = 0; channel_index < 4; ++channel_index)
+            result.values[channel_index] = Color::multiply_channels(x.values[channel_index], y.values[channel_index]);
+        return result;
+    }
+
+    NODISCARD ALWAYS_INLINE static Channels add(Channels x, Channels y)
+    {
+        Channels result;
+        for (usize channel_index = 0; channel_index < 4; ++channel_index)
+            result.values[channel_index] = x.values[channel_index] + y.values[channel_index];
+        return result;
+    }
+
+    // NOTE: The second operand must not be larger than the first one.
+    NODISCARD ALWAYS_INLINE static Channels subtract(Channels x, Channels y)
+    {
+        Channels result;
+        for (usize channel_index = 0; channel_index < 4; ++channel_index)
+            result.values[channel_index] = x.values[channel_index] - y.values[channel_index];
+        return result;
+    }
+
+    NODISCARD ALWAYS_INLINE static Channels inverse(Channels x) { return subtract(splat(255), x); }
+    NODISCARD ALWAYS_INLINE static Channels broadcast_alpha(Channels x) { return splat(x.values[3]); }
+
+    template<SourceFetch fetch>
+    NODISCARD ALWAYS_INLINE static bool is_source_transparent(ReadonlyBytes pixels)
+    {
+        if constexpr (fetch == SourceFetch::ExpandAlpha)
+            return pixels[0] == 0;
+        else
+            return load_pixel(pixels) == 0;
+    }
+
+    NODISCARD ALWAYS_INLINE static bool is_opaque(ReadonlyBytes pixels) { return pixels[3] == 255; }
+    NODISCARD ALWAYS_INLINE static bool is_uncovered(ReadonlyBytes coverage) { return coverage[0] == 0; }
+    NODISCARD ALWAYS_INLINE static bool is_fully_covered(ReadonlyBytes coverage) { return coverage[0] == 255; }
+
+    ALWAYS_INLINE static void copy(WriteonlyBytes destination, ReadonlyBytes source) { store_pixel(destination, load_pixel(source)); }
+    ALWAYS_INLINE static void fill(WriteonlyBytes destination, u32 pixel) { store_pixel(destination, pixel); }
+};
+
+// Portable implementation of the operations of the alpha layout, which processes a single pixel.
+struct ScalarAlphaOperations {
+    static constexpr usize pixels_per_block = 1;
+    static constexpr usize bytes_per_pixel = 1;
+
+    struct Channels {
+        u32 alpha;
+    };
+
+    NODISCARD ALWAYS_INLINE static Channels load(ReadonlyBytes pixels) { return { pixels[0] }; }
+
+    template<SourceFetch fetch>
+    NODISCARD ALWAYS_INLINE static Channels load_source(ReadonlyBytes pixels)
+    {
+        return { pixels[(fetch == SourceFetch::ExtractAlpha) ? 3 : 0] };
+    }
+
+    NODISCARD ALWAYS_INLINE static Channels load_color(u32 pixel) { return { pixel >> 24 }; }
+    NODISCARD ALWAYS_INLINE static Channels load_coverage(ReadonlyBytes coverage) { return { coverage[0] }; }
+    NODISCARD ALWAYS_INLINE static Channels splat(u32 value) { return { value }; }
+
+    ALWAYS_INLINE static void store(WriteonlyBytes pixels, Channels channels)
+    {
+        pixels[0] = static_cast<u8>((channels.alpha < 255) ? channels.alpha : 255);
+    }
+
+    NODISCARD ALWAYS_INLINE static Channels multiply(Channels x, Channels y) { return { Color::multiply_channels(x.alpha, y.alpha) }; }
+    NODISCARD ALWAYS_INLINE static Channels add(Channels x, Channels y) { return { x.alpha + y.alpha }; }
+    NODISCARD ALWAYS_INLINE static Channels subtract(Channels x, Channels y) { return { x.alpha - y.alpha }; }
+    NODISCARD ALWAYS_INLINE static Channels inverse(Channels x) { return { 255 - x.alpha }; }
+    NODISCARD ALWAYS_INLINE static Channels broadcast_alpha(Channels x) { return x; }
+
+    template<SourceFetch fetch>
+    NODISCARD ALWAYS_INLINE static bool is_source_transparent(ReadonlyBytes pixels)
+    {
+        return pixels[(fetch == SourceFetch::ExtractAlpha) ? 3 : 0] == 0;
+    }
+
+    NODISCARD ALWAYS_INLINE static bool is_opaque(ReadonlyBytes pixels) { return pixels[0] == 255; }
+    NODISCARD ALWAYS_INLINE static bool is_uncovered(ReadonlyBytes coverage) { return coverage[0] == 0; }
+    NODISCARD ALWAYS_INLINE static bool is_fully_covered(ReadonlyBytes coverage) { return coverage[0] == 255; }
+
+    ALWAYS_INLINE static void copy(WriteonlyBytes destination, ReadonlyBytes source) { destination[0] = source[0]; }
+    ALWAYS_INLINE static void fill(WriteonlyBytes destination, u32 pixel) { destination[0] = static_cast<u8>(pixel >> 24); }
+};
+
+#if AT_SIMD_SSE2
+NODISCARD ALWAYS_INLINE static __m128i load_16_bytes(ReadonlyBytes bytes)
+{
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes));
+}
+
+ALWAYS_INLINE static void store_16_bytes(WriteonlyBytes bytes, __m128i value)
+{
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(bytes), value);
+}
+
+// Returns a bit mask with a bit set for each byte of the register that is equal to the value.
+NODISCARD ALWAYS_INLINE static int equal_bytes_mask(__m128i bytes, u8 value)
+{
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_set1_epi8(static_cast<char>(value))));
+}
+
+// Returns whether the alpha of all pixels in the registers, which hold four 32-bit pixels each, is equal to the value.
+template<usize register_count>
+NODISCARD ALWAYS_INLINE static bool all_alphas_equal(ReadonlyBytes pixels, u8 value)
+{
+    const __m128i alpha_bits = _mm_set1_epi32(static_cast<int>(0xFF000000));
+    const __m128i expected = _mm_set1_epi32(static_cast<int>(static_cast<u32>(value) << 24));
+    __m128i equal = _mm_cmpeq_epi32(_mm_and_si128(load_16_bytes(pixels), alpha_bits), expected);
+    for (usize register_index = 1; register_index < register_count; ++register_index)
+        equal = _mm_and_si128(equal, _mm_cmpeq_epi32(_mm_and_si128(load_16_bytes(pixels + 16 * register_index), alpha_bits), expected));
+    return _mm_movemask_epi8(equal) == 0xFFFF;
+}
+
+// Implementation of the operations of the color layout that processes eight pixels at a time. The channels of
+// every pair of pixels occupy the eight 16-bit lanes of a register.
+struct SSE2ColorOperations {
+    static constexpr usize pixels_per_block = 8;
+    static constexpr usize bytes_per_pixel = 4;
+
+    struct Channels {
+        __m128i pairs[4];
+    };
+
+    NODISCARD ALWAYS_INLINE static Channels load(ReadonlyBytes pixels) { return unpack(load_16_bytes(pixels), load_16_bytes(pixels + 16)); }
+
+    template<SourceFetch fetch>
+    NODISCARD ALWAYS_INLINE static Channels load_source(ReadonlyBytes pixels)
+    {
+        if constexpr (fetch == SourceFetch::SwapRedAndBlue) {
+            return unpack(swap_red_and_blue_4(load_16_bytes(pixels)), swap_red_and_blue_4(load_16_bytes(pixels + 16)));
+        }
+        else if constexpr (fetch == SourceFetch::ExpandAlpha) {
+            // NOTE: Move the alpha of each pixel to the last of its four lanes, leaving the color channels black.
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i alphas = _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(pixels)), zero);
+            const __m128i low = _mm_unpacklo_epi16(zero, alphas);
+            const __m128i high = _mm_unpackhi_epi16(zero, alphas);
+            return { {
+                _mm_unpacklo_epi32(zero, low),
+                _mm_unpackhi_epi32(zero, low),
+                _mm_unpacklo_epi32(zero, high),
+                _mm_unpackhi_epi32(zero, high),
+            } };
+        }
+        else {
+            return load(pixels);
+        }
+    }
+
+    NODISCARD ALWAYS_INLINE static Channels load_color(u32 pixel)
+    {
+        const __m128i pair = _mm_unpacklo_epi8(_mm_set1_epi32(static_cast<int>(pixel)), _mm_setzero_si128());
+        return { { pair, pair, pair, pair } };
+    }
+
+    // Replicates the coverage value of each pixel to its four channels.
+    NODISCARD ALWAYS_INLINE static Channels load_coverage(ReadonlyBytes coverage)
+    {
+        const __m128i bytes = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(coverage));
+        const __m128i byte_pairs = _mm_unpacklo_epi8(bytes, bytes);
+        return unpack(_mm_unpacklo_epi16(byte_pairs, byte_pairs), _mm_unpackhi_epi16(byte_pairs, byte_pairs));
+    }
+
+    NODISCARD ALWAYS_INLINE static Channels splat(u32 value)
+    {
+        const __m128i lanes = _mm_set1_epi16(static_cast<short>(value));
+        return { { lanes, lanes, lanes, lanes } };
+    }
+
+    ALWAYS_INLINE static void store(WriteonlyBytes pixels, Channels channels)
+    {
+        store_16_bytes(pixels, _mm_packus_epi16(channels.pairs[0], channels.pairs[1]));
+        store_16_bytes(pixels + 16, _mm_packus_epi16(channels.pairs[2], channels.pairs[3]));
+    }
+
+    NODISCARD ALWAYS_INLINE static Channels multiply(Channels x, Channels y)
+    {
+        return { {
+            multiply_channels_16(x.pairs[0], y.pairs[0]),
+            multiply_channels_16(x.pairs[1], y.pairs[1]),
+            multiply_channels_16(x.pairs[2], y.pairs[2]),
+            multiply_channels_16(x.pairs[3], y.pairs[3]),
+        } };
+    }
+
+    NODISCARD ALWAYS_INLINE static Channels add(Channels x, Channels y)
+    {
+        return { {
+            _mm_add_epi16(x.pairs[0], y.pairs[0]),
+            _mm_add_epi16(x.pairs[1], y.pairs[1]),
+            _mm_add_epi16(x.pairs[2], y.pairs[2]),
+            _mm_add_epi16(x.pairs[3], y.pairs[3]),
+        } };
+    }
+
+    // NOTE: The second operand must not be larger than the first one.
+    NODISCARD ALWAYS_INLINE static Channels subtract(Channels x, Channels y)
+    {
+        return { {
+            _mm_sub_epi16(x.pairs[0], y.pairs[0]),
+            _mm_sub_epi16(x.pairs[1], y.pairs[1]),
+            _mm_sub_epi16(x.pairs[2], y.pairs[2]),
+            _mm_sub_epi16(x.pairs[3], y.pairs[3]),
+        } };
+    }
+
+    NODISCARD ALWAYS_INLINE static Channels inverse(Channels x) { return subtract(splat(255), x); }
+
+    NODISCARD ALWAYS_INLINE static Channels broadcast_alpha(Channels x)
+    {
+        return { { broadcast_alpha_2(x.pairs[0]), broadcast_alpha_2(x.pairs[1]), broadcast_alpha_2(x.pairs[2]), broadcast_alpha_2(x.pairs[3]) } };
+    }
+
+    template<SourceFetch fetch>
+    NODISCARD ALWAYS_INLINE static bool is_source_transparent(ReadonlyBytes pixels)
+    {
+        if constexpr (fetch == SourceFetch::ExpandAlpha)
+            return (equal_bytes_mask(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(pixels)), 0) & 0xFF) == 0xFF;
+        else
+            return equal_bytes_mask(_mm_or_si128(load_16_bytes(pixels), load_16_bytes(pixels + 16)), 0) == 0xFFFF;
+    }
+
+    NODISCARD ALWAYS_INLINE static bool is_opaque(ReadonlyBytes pixels) { return all_alphas_equal<2>(pixels, 255); }
+
+    NODISCARD ALWAYS_INLINE static bool is_uncovered(ReadonlyBytes coverage)
+    {
+        return (equal_bytes_mask(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(coverage)), 0) & 0xFF) == 0xFF;
+    }
+
+    NODISCARD ALWAYS_INLINE static bool is_fully_covered(ReadonlyBytes coverage)
+    {
+        return (equal_bytes_mask(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(coverage)), 255) & 0xFF) == 0xFF;
+    }
+
+    ALWAYS_INLINE static void copy(WriteonlyBytes destination, ReadonlyBytes source)
+    {
+        store_16_bytes(destination, load_16_bytes(source));
+        store_16_bytes(destination + 16, load_16_bytes(source + 16));
+    }
+
+    ALWAYS_INLINE static void fill(WriteonlyBytes destination, u32 pixel)
+    {
+        const __m128i pattern = _mm_set1_epi32(static_cast<int>(pixel));
+        store_16_bytes(destination, pattern);
+        store_16_bytes(destination + 16, pattern);
+    }
+
+private:
+    NODISCARD ALWAYS_INLINE static Channels unpack(__m128i low, __m128i high)
+    {
+        const __m128i zero = _mm_setzero_si128();
+        return { { _mm_unpacklo_epi8(low, zero), _mm_unpackhi_epi8(low, zero), _mm_unpacklo_epi8(high, zero), _mm_unpackhi_epi8(high, zero) } };
+    }
+
+    NODISCARD ALWAYS_INLINE static __m128i broadcast_alpha_2(__m128i pair)
+    {
+        const __m128i alpha = _mm_shufflelo_epi16(pair, _MM_SHUFFLE(3, 3, 3, 3));
+        return _mm_shufflehi_epi16(alpha, _MM_SHUFFLE(3, 3, 3, 3));
+    }
+};
+
+// Implementation of the operations of the alpha layout that processes sixteen pixels at a time, in two registers
+// of eight 16-bit lanes.
+struct SSE2AlphaOperations {
+    static constexpr usize pixels_per_block = 16;
+    static constexpr usize bytes_per_pixel = 1;
+
+    struct Channels {
+        __m128i halves[2];
+    };
+
+    NODISCARD ALWAYS_INLINE static Channels load(ReadonlyBytes pixels)
+    {
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i bytes = load_16_bytes(pixels);
+        return { { _mm_unpacklo_epi8(bytes, zero), _mm_unpackhi_epi8(bytes, zero) } };
+    }
+
+    template<SourceFetch fetch>
+    NODISCARD ALWAYS_INLINE static Channels load_source(ReadonlyBytes pixels)
+    {
+        if constexpr (fetch == SourceFetch::ExtractAlpha) {
+            // NOTE: The alphas fit in the low byte of each 32-bit lane after the shift, so the signed packing
+            //       never saturates.
+            const __m128i first = _mm_srli_epi32(load_16_bytes(pixels), 24);
+            const __m128i second = _mm_srli_epi32(load_16_bytes(pixels + 16), 24);
+            const __m128i third = _mm_srli_epi32(load_16_bytes(pixels + 32), 24);
+            const __m128i fourth = _mm_srli_epi32(load_16_bytes(pixels + 48), 24);
+            return { { _mm_packs_epi32(first, second), _mm_packs_epi32(third, fourth) } };
+        }
+        else {
+            return load(pixels);
+        }
+    }
+
+    NODISCARD ALWAYS_INLINE static Channels load_color(u32 pixel) { return splat(pixel >> 24); }
+    NODISCARD ALWAYS_INLINE static Channels load_coverage(ReadonlyBytes coverage) { return load(coverage); }
+
+    NODISCARD ALWAYS_INLINE static Channels splat(u32 value)
+    {
+        const __m128i lanes = _mm_set1_epi16(static_cast<short>(value));
+        return { { lanes, lanes } };
+    }
+
+    ALWAYS_INLINE static void store(WriteonlyBytes pixels, Channels channels)
+    {
+        store_16_bytes(pixels, _mm_packus_epi16(channels.halves[0], channels.halves[1]));
+    }
+
+    NODISCARD ALWAYS_INLINE static Channels multiply(Channels x, Channels y)
+    {
+        return { { multiply_channels_16(x.halves[0], y.halves[0]), multiply_channels_16(x.halves[1], y.halves[1]) } };
+    }
+
+    NODISCARD ALWAYS_INLINE static Channels add(Channels x, Channels y)
+    {
+        return { { _mm_add_epi16(x.halves[0], y.halves[0]), _mm_add_epi16(x.halves[1], y.halves[1]) } };
+    }
+
+    // NOTE: The second operand must not be larger than the first one.
+    NODISCARD ALWAYS_INLINE static Channels subtract(Channels x, Channels y)
+    {
+        return { { _mm_sub_epi16(x.halves[0], y.halves[0]), _mm_sub_epi16(x.halves[1], y.halves[1]) } };
+    }
+
+    NODISCARD ALWAYS_INLINE static Channels inverse(Channels x) { return subtract(splat(255), x); }
+    NODISCARD ALWAYS_INLINE static Channels broadcast_alpha(Channels x) { return x; }
+
+    template<SourceFetch fetch>
+    NODISCARD ALWAYS_INLINE static bool is_source_transparent(ReadonlyBytes pixels)
+    {
+        if constexpr (fetch == SourceFetch::ExtractAlpha)
+            return all_alphas_equal<4>(pixels, 0);
+        else
+            return equal_bytes_mask(load_16_bytes(pixels), 0) == 0xFFFF;
+    }
+
+    NODISCARD ALWAYS_INLINE static bool is_opaque(ReadonlyBytes pixels) { return equal_bytes_mask(load_16_bytes(pixels), 255) == 0xFFFF; }
+    NODISCARD ALWAYS_INLINE static bool is_uncovered(ReadonlyBytes coverage) { return equal_bytes_mask(load_16_bytes(coverage), 0) == 0xFFFF; }
+    NODISCARD ALWAYS_INLINE static bool is_fully_covered(ReadonlyBytes coverage) { return equal_bytes_mask(load_16_bytes(coverage), 255) == 0xFFFF; }
+
+    ALWAYS_INLINE static void copy(WriteonlyBytes destination, ReadonlyBytes source) { store_16_bytes(destination, load_16_bytes(source)); }
+    ALWAYS_INLINE static void fill(WriteonlyBytes destination, u32 pixel)
+    {
+        store_16_bytes(destination, _mm_set1_epi8(static_cast<char>(pixel >> 24)));
+    }
+};
+#endif // AT_SIMD_SSE2
+
+struct ColorLayout {
+    using ScalarOperations = ScalarColorOperations;
+#if AT_SIMD_SSE2
+    using VectorOperations = SSE2ColorOperations;
+#endif // AT_SIMD_SSE2
+};
+
+struct AlphaLayout {
+    using ScalarOperations = ScalarAlphaOperations;
+#if AT_SIMD_SSE2
+    using VectorOperations = SSE2AlphaOperations;
+#endif // AT_SIMD_SSE2
+};
+
+template<PixelFormat format>
+struct LayoutOfFormat {
+    using Layout = ColorLayout;
+};
+
+template<>
+struct LayoutOfFormat<PixelFormat::A8> {
+    using Layout = AlphaLayout;
+};
+
+template<SourceFetch fetch>
+static constexpr usize source_bytes_per_pixel(usize destination_bytes_per_pixel)
+{
+    if constexpr (fetch == SourceFetch::ExpandAlpha)
+        return 1;
+    else if constexpr (fetch == SourceFetch::Copy)
+        return destination_bytes_per_pixel;
+    else
+        return 4;
+}
+
+// Blends the source channels, which were already scaled by the coverage, with the destination channels.
+template<typename Operations, BlendMode mode>
+NODISCARD ALWAYS_INLINE static typename Operations::Channels
+blend_channels(typename Operations::Channels destination, typename Operations::Channels source, typename Operations::Channels coverage)
+{
+    using Ops = Operations;
+
+    if constexpr (mode == BlendMode::SourceOver) {
+        return Ops::add(source, Ops::multiply(destination, Ops::inverse(Ops::broadcast_alpha(source))));
+    }
+    else if constexpr (mode == BlendMode::SourceIn) {
+        // NOTE: This is the only mode whose result isn't the destination when the source is transparent, so the
+        //       coverage has to be applied to the destination explicitly.
+        const auto source_in = Ops::multiply(source, Ops::broadcast_alpha(destination));
+        return Ops::add(source_in, Ops::multiply(destination, Ops::inverse(coverage)));
+    }
+    else if constexpr (mode == BlendMode::DestinationOut) {
+        return Ops::multiply(destination, Ops::inverse(Ops::broadcast_alpha(source)));
+    }
+    else if constexpr (mode == BlendMode::Multiply) {
+        const auto product = Ops::multiply(source, destination);
+        const auto source_outside = Ops::multiply(source, Ops::inverse(Ops::broadcast_alpha(destination)));
+        const auto destination_outside = Ops::multiply(destination, Ops::inverse(Ops::broadcast_alpha(source)));
+        return Ops::add(product, Ops::add(source_outside, destination_outside));
+    }
+    else if constexpr (mode == BlendMode::Screen) {
+        return Ops::subtract(Ops::add(source, destination), Ops::multiply(source, destination));
+    }
+    else if constexpr (mode == BlendMode::Additive) {
+        // NOTE: The sum saturates when it is stored.
+        return Ops::add(source, destination);
+    }
+}
+
+// NOTE: Blending a transparent source pixel leaves the destination unchanged in every mode but one.
+template<BlendMode mode>
+static constexpr bool transparent_source_is_noop = (mode != BlendMode::SourceIn);
+
+// Processes as many whole blocks of pixels as possible, starting at the given pixel, and returns the index of the
+// first pixel that was not processed.
+template<typename Operations, SourceFetch fetch, BlendMode mode, bool has_mask>
+static usize render_blocks(const RasterSpan& span, usize pixel_index)
+{
+    using Ops = Operations;
+    using Channels = typename Ops::Channels;
+    constexpr bool is_solid = (fetch == SourceFetch::SolidColor);
+    constexpr usize source_pixel_byte_count = source_bytes_per_pixel<fetch>(Ops::bytes_per_pixel);
+
+    const bool is_fully_opaque = (span.opacity == 255);
+    const bool is_solid_opaque = is_solid && ((span.color >> 24) == 255);
+    const Channels opacity_channels = Ops::splat(span.opacity);
+
+    // NOTE: Without a mask, the contribution of a solid color is the same for the whole span.
+    Channels solid_source = {};
+    if constexpr (is_solid) {
+        solid_source = Ops::load_color(span.color);
+        if (!has_mask && !is_fully_opaque)
+            solid_source = Ops::multiply(solid_source, opacity_channels);
+    }
+
+    for (; pixel_index + Ops::pixels_per_block <= span.pixel_count; pixel_index += Ops::pixels_per_block) {
+        ReadWriteBytes destination_block = span.destination + Ops::bytes_per_pixel * pixel_index;
+        ReadonlyBytes source_block = is_solid ? nullptr : span.source + source_pixel_byte_count * pixel_index;
+
+        bool is_fully_covered = true;
+        if constexpr (has_mask) {
+            if (Ops::is_uncovered(span.coverage + pixel_index))
+                continue;
+            is_fully_covered = Ops::is_fully_covered(span.coverage + pixel_index);
+        }
+
+        // NOTE: The color layouts check every channel of the source pixels, rather than only their alpha, so that
+        //       skipping them doesn't change the result even if they aren't properly premultiplied. Otherwise, the
+        //       result would depend on how the pixels of a span are grouped into blocks.
+        if constexpr (!is_solid && transparent_source_is_noop<mode>) {
+            if (Ops::template is_source_transparent<fetch>(source_block))
+                continue;
+        }
+
+        // NOTE: Opaque pixels that are fully covered replace the destination in source-over mode, which is the most
+        //       common case when drawing the interior of shapes and images.
+        if constexpr (mode == BlendMode::SourceOver && (is_solid || fetch == SourceFetch::Copy)) {
+            if (is_fully_covered && is_fully_opaque) {
+                if constexpr (is_solid) {
+                    if (is_solid_opaque) {
+                        Ops::fill(destination_block, span.color);
+                        continue;
+                    }
+                }
+                else if (Ops::is_opaque(source_block)) {
+                    Ops::copy(destination_block, source_block);
+                    continue;
+                }
+            }
+        }
+
+        Channels coverage_channels = opacity_channels;
+        if constexpr (has_mask) {
+            coverage_channels = Ops::load_coverage(span.coverage + pixel_index);
+            if (!is_fully_opaque)
+                coverage_channels = Ops::multiply(coverage_channels, opacity_channels);
+        }
+
+        Channels source_channels;
+        if constexpr (is_solid) {
+            source_channels = has_mask ? Ops::multiply(solid_source, coverage_channels) : solid_source;
+        }
+        else {
+            source_channels = Ops::template load_source<fetch>(source_block);
+            if (has_mask || !is_fully_opaque)
+                source_channels = Ops::multiply(source_channels, coverage_channels);
+        }
+
+        const Channels destination_channels = Ops::load(destination_block);
+        Ops::store(destination_block, blend_channels<Ops, mode>(destination_channels, source_channels, coverage_channels));
+    }
+
+    return pixel_index;
+}
+
+template<typename Layout, SourceFetch fetch, BlendMode mode, bool has_mask>
+static void render_span(const RasterSpan& span)
+{
+    if (span.opacity == 0)
+        return;
+    if constexpr (fetch == SourceFetch::SolidColor && transparent_source_is_noop<mode>) {
+        if ((span.color >> 24) == 0)
+            return;
+    }
+
+    usize pixel_index = 0;
+#if AT_SIMD_SSE2
+    pixel_index = render_blocks<typename Layout::VectorOperations, fetch, mode, has_mask>(span, pixel_index);
+#endif // AT_SIMD_SSE2
+    render_blocks<typename Layout::ScalarOperations, fetch, mode, has_mask>(span, pixel_index);
+}
+
+//
+// The table of span functions is indexed by the destination format, the paint source, the blend mode and whether
+// there is a mask. The paint source index is zero for solid colors, and one plus the source format for bitmaps.
+//
+
+static constexpr usize pixel_format_count = 3;
+static constexpr usize paint_source_count = 1 + pixel_format_count;
+static constexpr usize blend_mode_count = 6;
+static constexpr usize span_function_count = pixel_format_count * paint_source_count * blend_mode_count * 2;
+
+struct RasterSpanFunctionTable {
+    RasterSpanFunction functions[span_function_count] = {};
+};
+
+NODISCARD static constexpr usize span_function_index(PixelFormat destination_format, usize paint_source_index, BlendMode mode, bool has_mask)
+{
+    const usize format_index = static_cast<usize>(destination_format);
+    return ((format_index * paint_source_count + paint_source_index) * blend_mode_count + static_cast<usize>(mode)) * 2 + (has_mask ? 1 : 0);
+}
+
+template<PixelFormat destination_format, usize paint_source_index>
+NODISCARD static constexpr SourceFetch source_fetch()
+{
+    if constexpr (paint_source_index == 0)
+        return SourceFetch::SolidColor;
+
+    constexpr PixelFormat source_format = static_cast<PixelFormat>(paint_source_index - 1);
+    if constexpr (source_format == destination_format)
+        return SourceFetch::Copy;
+    else if constexpr (destination_format == PixelFormat::A8)
+        return SourceFetch::ExtractAlpha;
+    else if constexpr (source_format == PixelFormat::A8)
+        return SourceFetch::ExpandAlpha;
+    else
+        return SourceFetch::SwapRedAndBlue;
+}
+
+// Instantiates the kernel of every combination, one index at a time, in the same order as `span_function_index`.
+template<usize index>
+static constexpr void add_span_functions(RasterSpanFunctionTable& table)
+{
+    constexpr bool has_mask = (index % 2) != 0;
+    constexpr BlendMode mode = static_cast<BlendMode>((index / 2) % blend_mode_count);
+    constexpr usize paint_source_index = (index / (2 * blend_mode_count)) % paint_source_count;
+    constexpr PixelFormat destination_format = static_cast<PixelFormat>(index / (2 * blend_mode_count * paint_source_count));
+    using Layout = typename LayoutOfFormat<destination_format>::Layout;
+
+    table.functions[index] = render_span<Layout, source_fetch<destination_format, paint_source_index>(), mode, has_mask>;
+    if constexpr (index + 1 < span_function_count)
+        add_span_functions<index + 1>(table);
+}
+
+NODISCARD static constexpr RasterSpanFunctionTable create_span_function_table()
+{
+    RasterSpanFunctionTable table;
+    add_span_functions<0>(table);
+    return table;
+}
+
+static constexpr RasterSpanFunctionTable s_span_function_table = create_span_function_table();
+
+RasterSpanFunction select_span_function(PixelFormat destination_format, PaintSource source, PixelFormat source_format, BlendMode mode, bool has_mask)
+{
+    const usize paint_source_index = (source == PaintSource::SolidColor) ? 0 : 1 + static_cast<usize>(source_format);
+    const usize index = span_function_index(destination_format, paint_source_index, mode, has_mask);
+    VERIFY(index < span_function_count);
+    return s_span_function_table.functions[index];
+}
+
+} // namespace Graphics
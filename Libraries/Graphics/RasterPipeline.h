@@ -0,0 +1,52 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#pragma once
+
+#include <AT/Span.h>
+#include <Graphics/API.h>
+#include <Graphics/Bitmap.h>
+#include <Graphics/Compositing.h>
+
+namespace Graphics {
+
+enum class PaintSource : u8 {
+    // Every pixel of the span has the same premultiplied color.
+    SolidColor,
+    // The pixels are read from a row of a bitmap, or from a span shaded by a `Paint`, which can have any pixel
+    // format.
+    Bitmap,
+};
+
+// The arguments of a span function, which describe a horizontal run of pixels.
+struct RasterSpan {
+    ReadWriteBytes destination;
+    // NOTE: Only used by bitmap sources. The row must have the source format that the function was selected for.
+    ReadonlyBytes source;
+    // NOTE: Only used by solid color sources. The color is premultiplied and stored in the channel order of the
+    //       destination format, as returned by `color_to_pixel`.
+    u32 color;
+    // NOTE: Only used by the functions that were selected with a mask.
+    ReadonlyBytes coverage;
+    usize pixel_count;
+    u8 opacity;
+};
+
+using RasterSpanFunction = void (*)(const RasterSpan& span);
+
+// Returns the function that renders spans for the given combination of destination format, paint source, blend
+// mode and mask. The source format is ignored for solid color sources.
+//
+// Every combination is compiled into its own kernel, where the conversion of the source pixels, the blend mode and
+// the coverage are resolved at compile time, so that the loops over the pixels never branch on them. The functions
+// are stored in a table that is built at compile time, so selecting one costs a single lookup, which should be done
+// once per draw call rather than once per span.
+//
+// An alpha-only destination only receives the alpha of the source pixels, while an alpha-only source is expanded to
+// black with the same alpha when drawn to a color destination.
+NODISCARD GRAPHICS_API RasterSpanFunction
+select_span_function(PixelFormat destination_format, PaintSource source, PixelFormat source_format, BlendMode mode, bool has_mask);
+
+} // namespace Graphics
@@ -0,0 +1,120 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#pragma once
+
+#include <AT/Types.h>
+
+namespace Graphics {
+
+struct IntPoint {
+    s32 x { 0 };
+    s32 y { 0 };
+
+    NODISCARD ALWAYS_INLINE constexpr bool operator==(const IntPoint& other) const { return (x == other.x) && (y == other.y); }
+    NODISCARD ALWAYS_INLINE constexpr bool operator!=(const IntPoint& other) const { return (x != other.x) || (y != other.y); }
+};
+
+struct FloatPoint {
+    f32 x { 0.0F };
+    f32 y { 0.0F };
+
+    NODISCARD ALWAYS_INLINE constexpr FloatPoint operator+(const FloatPoint& other) const { return { x + other.x, y + other.y }; }
+    NODISCARD ALWAYS_INLINE constexpr FloatPoint operator-(const FloatPoint& other) const { return { x - other.x, y - other.y }; }
+    NODISCARD ALWAYS_INLINE constexpr FloatPoint operator*(f32 factor) const { return { x * factor, y * factor }; }
+
+    NODISCARD ALWAYS_INLINE constexpr bool operator==(const FloatPoint& other) const { return (x == other.x) && (y == other.y); }
+    NODISCARD ALWAYS_INLINE constexpr bool operator!=(const FloatPoint& other) const { return (x != other.x) || (y != other.y); }
+};
+
+struct FloatRect {
+    f32 x { 0.0F };
+    f32 y { 0.0F };
+    f32 width { 0.0F };
+    f32 height { 0.0F };
+
+    NODISCARD ALWAYS_INLINE constexpr f32 left() const { return x; }
+    NODISCARD ALWAYS_INLINE constexpr f32 top() const { return y; }
+    NODISCARD ALWAYS_INLINE constexpr f32 right() const { return x + width; }
+    NODISCARD ALWAYS_INLINE constexpr f32 bottom() const { return y + height; }
+
+    NODISCARD ALWAYS_INLINE constexpr bool is_empty() const { return !(width > 0.0F) || !(height > 0.0F); }
+};
+
+// Axis-aligned rectangle in pixel coordinates. The left and top edges are inclusive, while the right and bottom
+// edges are exclusive, so adjacent rectangles never share a pixel.
+struct IntRect {
+    s32 x { 0 };
+    s32 y { 0 };
+    s32 width { 0 };
+    s32 height { 0 };
+
+    NODISCARD ALWAYS_INLINE static constexpr IntRect from_edges(s32 left, s32 top, s32 right, s32 bottom)
+    {
+        return { left, top, right - left, bottom - top };
+    }
+
+    NODISCARD ALWAYS_INLINE constexpr s32 left() const { return x; }
+    NODISCARD ALWAYS_INLINE constexpr s32 top() const { return y; }
+    NODISCARD ALWAYS_INLINE constexpr s32 right() const { return x + width; }
+    NODISCARD ALWAYS_INLINE constexpr s32 bottom() const { return y + height; }
+
+    NODISCARD ALWAYS_INLINE constexpr bool is_empty() const { return (width <= 0) || (height <= 0); }
+    NODISCARD ALWAYS_INLINE constexpr u64 area() const { return is_empty() ? 0 : static_cast<u64>(width) * static_cast<u64>(height); }
+
+    NODISCARD ALWAYS_INLINE constexpr bool contains(IntPoint point) const
+    {
+        return (point.x >= left()) && (point.x < right()) && (point.y >= top()) && (point.y < bottom());
+    }
+
+    NODISCARD ALWAYS_INLINE constexpr bool contains(const IntRect& other) const
+    {
+        return other.is_empty() || ((other.left() >= left()) && (other.right() <= right()) && (other.top() >= top()) && (other.bottom() <= bottom()));
+    }
+
+    NODISCARD ALWAYS_INLINE constexpr bool intersects(const IntRect& other) const
+    {
+        return (left() < other.right()) && (other.left() < right()) && (top() < other.bottom()) && (other.top() < bottom()) && !is_empty() &&
+               !other.is_empty();
+    }
+
+    // NOTE: Returns an empty rectangle if the two rectangles don't intersect.
+    NODISCARD ALWAYS_INLINE constexpr IntRect intersected(const IntRect& other) const
+    {
+        const s32 new_left = (left() > other.left()) ? left() : other.left();
+        const s32 new_top = (top() > other.top()) ? top() : other.top();
+        const s32 new_right = (right() < other.right()) ? right() : other.right();
+        const s32 new_bottom = (bottom() < other.bottom()) ? bottom() : other.bottom();
+        if (new_left >= new_right || new_top >= new_bottom)
+            return {};
+        return from_edges(new_left, new_top, new_right, new_bottom);
+    }
+
+    // Returns the smallest rectangle that contains both rectangles. Empty rectangles are ignored.
+    NODISCARD ALWAYS_INLINE constexpr IntRect united(const IntRect& other) const
+    {
+        if (is_empty())
+            return other;
+        if (other.is_empty())
+            return *this;
+
+        const s32 new_left = (left() < other.left()) ? left() : other.left();
+        const s32 new_top = (top() < other.top()) ? top() : other.top();
+        const s32 new_right = (right() > other.right()) ? right() : other.right();
+        const s32 new_bottom = (bottom() > other.bottom()) ? bottom() : other.bottom();
+        return from_edges(new_left, new_top, new_right, new_bottom);
+    }
+
+    NODISCARD ALWAYS_INLINE constexpr IntRect translated(s32 delta_x, s32 delta_y) const { return { x + delta_x, y + delta_y, width, height }; }
+
+    NODISCARD ALWAYS_INLINE constexpr bool operator==(const IntRect& other) const
+    {
+        return (x == other.x) && (y == other.y) && (width == other.width) && (height == other.height);
+    }
+
+    NODISCARD ALWAYS_INLINE constexpr bool operator!=(const IntRect& other) const { return !(*this == other); }
+};
+
+} // namespace Graphics
@@ -0,0 +1,390 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#include <AT/NumericLimits.h>
+#include <Graphics/Region.h>
+
+namespace Graphics {
+
+enum class RegionOperation : u8 {
+    Union,
+    Intersection,
+    Difference,
+};
+
+// Returns the index of the first rectangle after the band that starts at the given index.
+NODISCARD static usize band_end(const Region::Rects& rects, usize band_begin)
+{
+    usize index = band_begin + 1;
+    while (index < rects.count() && rects[index].y == rects[band_begin].y)
+        ++index;
+    return index;
+}
+
+// Appends the bands produced by an operation to a list of rectangles, keeping it in the canonical form.
+class RegionBuilder {
+public:
+    explicit RegionBuilder(Region::Rects& rects)
+        : m_rects(rects)
+    {}
+
+    void begin_band(s32 top, s32 bottom)
+    {
+        m_band_begin = m_rects.count();
+        m_top = top;
+        m_bottom = bottom;
+    }
+
+    // NOTE: The spans of a band must be added from left to right. A span that touches the previous one extends it.
+    void add_span(s32 left, s32 right)
+    {
+        if (m_rects.count() > m_band_begin) {
+            IntRect& last_rect = m_rects[m_rects.count() - 1];
+            if (last_rect.right() >= left) {
+                if (right > last_rect.right())
+                    last_rect.width = right - last_rect.x;
+                return;
+            }
+        }
+        m_rects.add({ left, m_top, right - left, m_bottom - m_top });
+    }
+
+    void end_band()
+    {
+        const usize span_count = m_rects.count() - m_band_begin;
+        if (span_count == 0)
+            return;
+
+        // NOTE: Merge the band into the previous one, if it continues it with exactly the same spans.
+        if (m_has_previous_band && m_rects[m_band_begin - 1].bottom() == m_top && m_band_begin - m_previous_band_begin == span_count) {
+            bool has_same_spans = true;
+            for (usize span_index = 0; span_index < span_count && has_same_spans; ++span_index) {
+                const IntRect& previous_span = m_rects[m_previous_band_begin + span_index];
+                const IntRect& span = m_rects[m_band_begin + span_index];
+                has_same_spans = (previous_span.x == span.x) && (previous_span.width == span.width);
+            }
+
+            if (has_same_spans) {
+                for (usize span_index = 0; span_index < span_count; ++span_index) {
+                    IntRect& previous_span = m_rects[m_previous_band_begin + span_index];
+                    previous_span.height = m_bottom - previous_span.y;
+                }
+                m_rects.remove_last(span_count);
+                return;
+            }
+        }
+
+        m_has_previous_band = true;
+        m_previous_band_begin = m_band_begin;
+    }
+
+private:
+    Region::Rects& m_rects;
+    usize m_band_begin { 0 };
+    usize m_previous_band_begin { 0 };
+    bool m_has_previous_band { false };
+    s32 m_top { 0 };
+    s32 m_bottom { 0 };
+};
+
+// Combines the sorted spans of one band of each operand.
+template<RegionOperation operation>
+static void combine_spans(const IntRect* first, usize first_count, const IntRect* second, usize second_count, RegionBuilder& builder)
+{
+    usize first_index = 0;
+    usize second_index = 0;
+
+    if constexpr (operation == RegionOperation::Union) {
+        while (first_index < first_count || second_index < second_count) {
+            const bool take_first = (second_index == second_count) || (first_index < first_count && first[first_index].x <= second[second_index].x);
+            const IntRect& span = take_first ? first[first_index++] : second[second_index++];
+            builder.add_span(span.left(), span.right());
+        }
+    }
+    else if constexpr (operation == RegionOperation::Intersection) {
+        while (first_index < first_count && second_index < second_count) {
+            const IntRect& first_span = first[first_index];
+            const IntRect& second_span = second[second_index];
+            const s32 left = (first_span.left() > second_span.left()) ? first_span.left() : second_span.left();
+            const s32 right = (first_span.right() < second_span.right()) ? first_span.right() : second_span.right();
+            if (left < right)
+                builder.add_span(left, right);
+
+            if (first_span.right() < second_span.right())
+                ++first_index;
+            else
+                ++second_index;
+        }
+    }
+    else {
+        for (; first_index < first_count; ++first_index) {
+            s32 left = first[first_index].left();
+            const s32 right = first[first_index].right();
+
+            // NOTE: The spans of the second operand that end before this span can't overlap the next ones either.
+            while (second_index < second_count && second[second_index].right() <= left)
+                ++second_index;
+
+            for (usize index = second_index; index < second_count && second[index].left() < right; ++index) {
+                if (second[index].left() > left)
+                    builder.add_span(left, second[index].left());
+                left = second[index].right();
+            }
+
+            if (left < right)
+                builder.add_span(left, right);
+        }
+    }
+}
+
+// Sweeps both operands from top to bottom. The sweep line stops at every edge of a band, so between two stops both
+// operands are described by at most one band each, whose spans are combined into a band of the result.
+template<RegionOperation operation>
+static void combine_regions(const Region::Rects& first, const Region::Rects& second, Region::Rects& result)
+{
+    if (first.is_empty() && second.is_empty())
+        return;
+
+    RegionBuilder builder(result);
+    usize first_index = 0;
+    usize second_index = 0;
+
+    s32 y = NumericLimits<s32>::max();
+    if (first.has_elements())
+        y = first[0].y;
+    if (second.has_elements() && second[0].y < y)
+        y = second[0].y;
+
+    while (true) {
+        while (first_index < first.count() && first[first_index].bottom() <= y)
+            first_index = band_end(first, first_index);
+        while (second_index < second.count() && second[second_index].bottom() <= y)
+            second_index = band_end(second, second_index);
+
+        const bool has_first = (first_index < first.count());
+        const bool has_second = (second_index < second.count());
+        if constexpr (operation == RegionOperation::Union) {
+            if (!has_first && !has_second)
+                break;
+        }
+        else if constexpr (operation == RegionOperation::Intersection) {
+            if (!has_first || !has_second)
+                break;
+        }
+        else {
+            if (!has_first)
+                break;
+        }
+
+        // NOTE: An operand whose next band starts below the sweep line has no spans until then.
+        s32 next_y = NumericLimits<s32>::max();
+        usize first_end = first_index;
+        usize second_end = second_index;
+        if (has_first) {
+            const IntRect& band = first[first_index];
+            if (band.y <= y) {
+                first_end = band_end(first, first_index);
+                next_y = (band.bottom() < next_y) ? band.bottom() : next_y;
+            }
+            else {
+                next_y = (band.y < next_y) ? band.y : next_y;
+            }
+        }
+        if (has_second) {
+            const IntRect& band = second[second_index];
+            if (band.y <= y) {
+                second_end = band_end(second, second_index);
+                next_y = (band.bottom() < next_y) ? band.bottom() : next_y;
+            }
+            else {
+                next_y = (band.y < next_y) ? band.y : next_y;
+            }
+        }
+
+        builder.begin_band(y, next_y);
+        combine_spans<operation>(
+            first.elements() + first_index,
+            first_end - first_index,
+            second.elements() + second_index,
+            second_end - second_index,
+            builder
+        );
+        builder.end_band();
+        y = next_y;
+    }
+}
+
+Region::Region(const IntRect& rect)
+{
+    if (rect.is_empty())
+        return;
+    m_rects.add(rect);
+    m_bounds = rect;
+}
+
+u64 Region::area() const
+{
+    u64 total_area = 0;
+    for (usize rect_index = 0; rect_index < m_rects.count(); ++rect_index)
+        total_area += m_rects[rect_index].area();
+    return total_area;
+}
+
+bool Region::contains(IntPoint point) const
+{
+    if (!m_bounds.contains(point))
+        return false;
+
+    for (usize rect_index = 0; rect_index < m_rects.count(); ++rect_index) {
+        const IntRect& rect = m_rects[rect_index];
+        if (rect.top() > point.y)
+            break;
+        if (rect.contains(point))
+            return true;
+    }
+    return false;
+}
+
+bool Region::intersects(const IntRect& rect) const
+{
+    if (!m_bounds.intersects(rect))
+        return false;
+
+    for (usize rect_index = 0; rect_index < m_rects.count(); ++rect_index) {
+        if (m_rects[rect_index].top() >= rect.bottom())
+            break;
+        if (m_rects[rect_index].intersects(rect))
+            return true;
+    }
+    return false;
+}
+
+bool Region::is_equal_to(const Region& other) const
+{
+    if (m_rects.count() != other.m_rects.count())
+        return false;
+    for (usize rect_index = 0; rect_index < m_rects.count(); ++rect_index) {
+        if (m_rects[rect_index] != other.m_rects[rect_index])
+            return false;
+    }
+    return true;
+}
+
+void Region::clear()
+{
+    m_rects.clear();
+    m_bounds = {};
+}
+
+void Region::translate(s32 delta_x, s32 delta_y)
+{
+    for (usize rect_index = 0; rect_index < m_rects.count(); ++rect_index)
+        m_rects[rect_index] = m_rects[rect_index].translated(delta_x, delta_y);
+    if (!is_empty())
+        m_bounds = m_bounds.translated(delta_x, delta_y);
+}
+
+void Region::unite(const Region& other)
+{
+    if (other.is_empty())
+        return;
+    if (is_empty() || (other.rect_count() == 1 && other.m_bounds.contains(m_bounds))) {
+        *this = other;
+        return;
+    }
+
+    Rects rects;
+    combine_regions<RegionOperation::Union>(m_rects, other.m_rects, rects);
+    m_rects = move(rects);
+    update_bounds();
+}
+
+void Region::unite(const IntRect& rect)
+{
+    if (rect.is_empty())
+        return;
+    unite(Region(rect));
+}
+
+void Region::intersect(const Region& other)
+{
+    if (is_empty())
+        return;
+    if (!m_bounds.intersects(other.m_bounds)) {
+        clear();
+        return;
+    }
+    if (other.rect_count() == 1 && other.m_bounds.contains(m_bounds))
+        return;
+
+    Rects rects;
+    combine_regions<RegionOperation::Intersection>(m_rects, other.m_rects, rects);
+    m_rects = move(rects);
+    update_bounds();
+}
+
+void Region::intersect(const IntRect& rect)
+{
+    intersect(Region(rect));
+}
+
+void Region::subtract(const Region& other)
+{
+    if (is_empty() || !m_bounds.intersects(other.m_bounds))
+        return;
+
+    Rects rects;
+    combine_regions<RegionOperation::Difference>(m_rects, other.m_rects, rects);
+    m_rects = move(rects);
+    update_bounds();
+}
+
+void Region::subtract(const IntRect& rect)
+{
+    if (rect.is_empty())
+        return;
+    subtract(Region(rect));
+}
+
+Region Region::united(const Region& other) const
+{
+    Region region = *this;
+    region.unite(other);
+    return region;
+}
+
+Region Region::intersected(const Region& other) const
+{
+    Region region = *this;
+    region.intersect(other);
+    return region;
+}
+
+Region Region::subtracted(const Region& other) const
+{
+    Region region = *this;
+    region.subtract(other);
+    return region;
+}
+
+void Region::update_bounds()
+{
+    if (is_empty()) {
+        m_bounds = {};
+        return;
+    }
+
+    // NOTE: The bands are sorted, so only the horizontal extent has to be searched for.
+    s32 left = m_rects[0].left();
+    s32 right = m_rects[0].right();
+    for (usize rect_index = 1; rect_index < m_rects.count(); ++rect_index) {
+        const IntRect& rect = m_rects[rect_index];
+        left = (rect.left() < left) ? rect.left() : left;
+        right = (rect.right() > right) ? rect.right() : right;
+    }
+    m_bounds = IntRect::from_edges(left, m_rects[0].top(), right, m_rects[m_rects.count() - 1].bottom());
+}
+
+} // namespace Graphics
@@ -0,0 +1,72 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#pragma once
+
+#include <AT/InlineVector.h>
+#include <AT/Span.h>
+#include <Graphics/API.h>
+#include <Graphics/Rect.h>
+
+namespace Graphics {
+
+// Set of pixels, stored as a list of non-overlapping rectangles.
+//
+// The rectangles are grouped in horizontal bands, where all the rectangles of a band have the same top and bottom
+// edges. The bands are sorted from top to bottom and the rectangles of each band from left to right. Rectangles
+// that touch horizontally are always merged, and so are consecutive bands that touch and have the same rectangles,
+// so every set of pixels has exactly one representation.
+//
+// This lets the set operations sweep both operands from top to bottom, combining the sorted spans of one band at a
+// time, so their cost is linear in the number of rectangles. Most regions only have a few rectangles, which are
+// stored inline without allocating memory.
+class Region {
+public:
+    static constexpr usize inline_rect_count = 8;
+    using Rects = InlineVector<IntRect, inline_rect_count>;
+
+public:
+    Region() = default;
+    GRAPHICS_API explicit Region(const IntRect& rect);
+
+    NODISCARD ALWAYS_INLINE bool is_empty() const { return m_rects.is_empty(); }
+    NODISCARD ALWAYS_INLINE usize rect_count() const { return m_rects.count(); }
+    NODISCARD ALWAYS_INLINE Span<const IntRect> rects() const { return m_rects.span(); }
+
+    // NOTE: The smallest rectangle that contains the region, which is empty if the region is empty.
+    NODISCARD ALWAYS_INLINE const IntRect& bounds() const { return m_bounds; }
+
+    NODISCARD GRAPHICS_API u64 area() const;
+    NODISCARD GRAPHICS_API bool contains(IntPoint point) const;
+    NODISCARD GRAPHICS_API bool intersects(const IntRect& rect) const;
+
+    NODISCARD ALWAYS_INLINE bool operator==(const Region& other) const { return is_equal_to(other); }
+    NODISCARD ALWAYS_INLINE bool operator!=(const Region& other) const { return !is_equal_to(other); }
+
+public:
+    GRAPHICS_API void clear();
+    GRAPHICS_API void translate(s32 delta_x, s32 delta_y);
+
+    GRAPHICS_API void unite(const Region& other);
+    GRAPHICS_API void unite(const IntRect& rect);
+    GRAPHICS_API void intersect(const Region& other);
+    GRAPHICS_API void intersect(const IntRect& rect);
+    GRAPHICS_API void subtract(const Region& other);
+    GRAPHICS_API void subtract(const IntRect& rect);
+
+    NODISCARD GRAPHICS_API Region united(const Region& other) const;
+    NODISCARD GRAPHICS_API Region intersected(const Region& other) const;
+    NODISCARD GRAPHICS_API Region subtracted(const Region& other) const;
+
+private:
+    NODISCARD GRAPHICS_API bool is_equal_to(const Region& other) const;
+    void update_bounds();
+
+private:
+    Rects m_rects;
+    IntRect m_bounds;
+};
+
+} // namespace Graphics
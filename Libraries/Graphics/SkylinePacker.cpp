@@ -0,0 +1,107 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#include <AT/Assertions.h>
+#include <AT/NumericLimits.h>
+#include <Graphics/SkylinePacker.h>
+
+namespace Graphics {
+
+SkylinePacker::SkylinePacker(u32 width, u32 height)
+    : m_width(width)
+    , m_height(height)
+{
+    VERIFY(width <= static_cast<u32>(NumericLimits<s32>::max()) && height <= static_cast<u32>(NumericLimits<s32>::max()));
+    reset();
+}
+
+void SkylinePacker::append_segment(Vector<Segment>& segments, const Segment& segment)
+{
+    // NOTE: Neighbouring segments at the same height are merged, which keeps the skyline short.
+    if (segments.has_elements() && segments[segments.count() - 1].y == segment.y)
+        segments[segments.count() - 1].width += segment.width;
+    else
+        segments.add(segment);
+}
+
+Optional<IntPoint> SkylinePacker::allocate(u32 width, u32 height)
+{
+    if (width == 0 || height == 0 || width > m_width || height > m_height)
+        return {};
+
+    const s32 rect_width = static_cast<s32>(width);
+    const s32 rect_height = static_cast<s32>(height);
+    const s32 area_right = static_cast<s32>(m_width);
+    const s32 area_bottom = static_cast<s32>(m_height);
+
+    // NOTE: The rectangle is tried at the left edge of every segment, where it rests on the highest of the segments
+    //       below it. Ties are broken by the narrowest segment, which leaves the wider ones for wider rectangles.
+    usize best_segment_index = m_segments.count();
+    s32 best_bottom = NumericLimits<s32>::max();
+    s32 best_segment_width = NumericLimits<s32>::max();
+    s32 best_y = 0;
+    for (usize segment_index = 0; segment_index < m_segments.count(); ++segment_index) {
+        const Segment& segment = m_segments[segment_index];
+        if (segment.x + rect_width > area_right)
+            break;
+
+        s32 y = 0;
+        s32 remaining_width = rect_width;
+        for (usize index = segment_index; remaining_width > 0; ++index) {
+            y = (m_segments[index].y > y) ? m_segments[index].y : y;
+            remaining_width -= m_segments[index].width;
+        }
+
+        const s32 bottom = y + rect_height;
+        if (bottom > area_bottom)
+            continue;
+        if (bottom < best_bottom || (bottom == best_bottom && segment.width < best_segment_width)) {
+            best_segment_index = segment_index;
+            best_bottom = bottom;
+            best_segment_width = segment.width;
+            best_y = y;
+        }
+    }
+
+    if (best_segment_index == m_segments.count())
+        return {};
+
+    // NOTE: The segments covered by the rectangle are replaced by its top edge, and a segment that is only partially
+    //       covered is shortened from the left.
+    const s32 rect_x = m_segments[best_segment_index].x;
+    const s32 rect_right = rect_x + rect_width;
+    m_scratch_segments.clear();
+    for (usize segment_index = 0; segment_index < best_segment_index; ++segment_index)
+        m_scratch_segments.add(m_segments[segment_index]);
+    append_segment(m_scratch_segments, { rect_x, best_bottom, rect_width });
+
+    for (usize segment_index = best_segment_index; segment_index < m_segments.count(); ++segment_index) {
+        Segment segment = m_segments[segment_index];
+        const s32 segment_right = segment.x + segment.width;
+        if (segment_right <= rect_right)
+            continue;
+        if (segment.x < rect_right) {
+            segment.width = segment_right - rect_right;
+            segment.x = rect_right;
+        }
+        append_segment(m_scratch_segments, segment);
+    }
+
+    Vector<Segment> segments = move(m_segments);
+    m_segments = move(m_scratch_segments);
+    m_scratch_segments = move(segments);
+
+    m_allocated_area += static_cast<u64>(width) * height;
+    return IntPoint { rect_x, best_y };
+}
+
+void SkylinePacker::reset()
+{
+    m_segments.clear();
+    m_segments.add({ 0, 0, static_cast<s32>(m_width) });
+    m_allocated_area = 0;
+}
+
+} // namespace Graphics
@@ -0,0 +1,59 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#pragma once
+
+#include <AT/Optional.h>
+#include <AT/Vector.h>
+#include <Graphics/API.h>
+#include <Graphics/Rect.h>
+
+namespace Graphics {
+
+// Packs rectangles into a fixed-size area, such as the page of a texture atlas.
+//
+// The packer only remembers the skyline of the area, which is the top edge of the space that is still free, stored
+// as a list of horizontal segments sorted from left to right. A rectangle is placed on the skyline at the position
+// where its bottom edge ends up the highest, which keeps the wasted space below the skyline small when rectangles of
+// similar heights are packed, as is the case for the glyphs of a font.
+//
+// NOTE: Rectangles can't be freed individually. The space of an area is reclaimed all at once, by resetting it.
+class SkylinePacker {
+public:
+    GRAPHICS_API SkylinePacker(u32 width, u32 height);
+
+public:
+    NODISCARD ALWAYS_INLINE u32 width() const { return m_width; }
+    NODISCARD ALWAYS_INLINE u32 height() const { return m_height; }
+
+    // NOTE: The sum of the areas of the allocated rectangles.
+    NODISCARD ALWAYS_INLINE u64 allocated_area() const { return m_allocated_area; }
+
+    // Returns the top-left corner of the allocated rectangle, or an empty optional if it doesn't fit anymore.
+    NODISCARD GRAPHICS_API Optional<IntPoint> allocate(u32 width, u32 height);
+
+    GRAPHICS_API void reset();
+
+private:
+    struct Segment {
+        s32 x;
+        s32 y;
+        s32 width;
+    };
+
+private:
+    static void append_segment(Vector<Segment>& segments, const Segment& segment);
+
+private:
+    u32 m_width;
+    u32 m_height;
+    u64 m_allocated_area { 0 };
+    Vector<Segment> m_segments;
+    // NOTE: The skyline is rebuilt into this list after each allocation, and then the two lists are swapped, which
+    //       avoids allocating memory once both lists are large enough.
+    Vector<Segment> m_scratch_segments;
+};
+
+} // namespace Graphics
@@ -0,0 +1,348 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#include <AT/UTF8.h>
+#include <Graphics/Text/LineBreak.h>
+
+namespace Graphics {
+
+using enum LineBreakClass;
+
+//
+// Applying the rules of UAX #14.
+//
+
+// NOTE: The letters of scripts that need a dictionary to be broken are treated as letters, except for their
+//       combining marks (LB1).
+NODISCARD ALWAYS_INLINE static LineBreakClass analyzed_line_break_class(u32 code_point)
+{
+    const CodePointProperties& properties = code_point_properties(code_point);
+    if (properties.line_break_class != ComplexContext)
+        return properties.line_break_class;
+
+    const bool is_mark = (properties.general_category == GeneralCategory::NonspacingMark) ||
+                         (properties.general_category == GeneralCategory::SpacingMark);
+    return is_mark ? CombiningMark : Alphabetic;
+}
+
+// Resolves the classes whose behaviour isn't defined by the pair rules (LB1).
+NODISCARD static LineBreakClass resolve_line_break_class(LineBreakClass line_break_class)
+{
+    switch (line_break_class) {
+        case Ambiguous:
+        case Surrogate:
+        case Unknown:
+        case ComplexContext: return Alphabetic;
+        case ConditionalJapaneseStarter: return Nonstarter;
+        default: return line_break_class;
+    }
+}
+
+NODISCARD ALWAYS_INLINE static bool is_mandatory_break_class(LineBreakClass line_break_class)
+{
+    return line_break_class == MandatoryBreak || line_break_class == CarriageReturn || line_break_class == LineFeed ||
+           line_break_class == NextLine;
+}
+
+NODISCARD ALWAYS_INLINE static bool is_alphabetic_or_hebrew(LineBreakClass line_break_class)
+{
+    return line_break_class == Alphabetic || line_break_class == HebrewLetter;
+}
+
+NODISCARD ALWAYS_INLINE static bool is_hangul(LineBreakClass line_break_class)
+{
+    return line_break_class == HangulLJamo || line_break_class == HangulVJamo || line_break_class == HangulTJamo ||
+           line_break_class == HangulLvSyllable || line_break_class == HangulLvtSyllable;
+}
+
+enum class LineBreakDecision : u8 {
+    Prohibited,
+    Allowed,
+    Mandatory,
+};
+
+// Decides whether a line can be broken between two characters, for the rules from LB11 onwards. The class of the
+// character before the break is the class of the last character that is not a space, and `has_spaces` tells whether
+// spaces separate it from the character after the break.
+NODISCARD static bool is_break_allowed(LineBreakClass before, LineBreakClass after, bool has_spaces)
+{
+    // NOTE: These rules apply even when spaces separate the two characters.
+    if (after == WordJoiner)
+        return false;
+    if (after == ClosePunctuation || after == CloseParenthesis || after == Exclamation || after == InfixNumericSeparator ||
+        after == SymbolsAllowingBreakAfter)
+        return false;
+    if (before == OpenPunctuation)
+        return false;
+    if (before == Quotation && after == OpenPunctuation)
+        return false;
+    if ((before == ClosePunctuation || before == CloseParenthesis) && after == Nonstarter)
+        return false;
+    if (before == BreakOpportunityBeforeAndAfter && after == BreakOpportunityBeforeAndAfter)
+        return false;
+    if (has_spaces)
+        return true;
+
+    if (before == WordJoiner || before == NonBreaking)
+        return false;
+    if (after == NonBreaking && before != BreakAfter && before != Hyphen)
+        return false;
+    if (before == Quotation || after == Quotation)
+        return false;
+    if (before == ContingentBreak || after == ContingentBreak)
+        return true;
+    if (after == BreakAfter || after == Hyphen || after == Nonstarter || before == BreakBefore)
+        return false;
+    if (before == SymbolsAllowingBreakAfter && after == HebrewLetter)
+        return false;
+    if (after == Inseparable)
+        return false;
+
+    // NOTE: Letters and numbers, and the prefixes and postfixes of numbers (LB23 to LB25).
+    if (is_alphabetic_or_hebrew(before) && after == Numeric)
+        return false;
+    if (before == Numeric && is_alphabetic_or_hebrew(after))
+        return false;
+    if (before == PrefixNumeric && (after == Ideographic || after == EmojiBase || after == EmojiModifier))
+        return false;
+    if ((before == Ideographic || before == EmojiBase || before == EmojiModifier) && after == PostfixNumeric)
+        return false;
+    if ((before == PrefixNumeric || before == PostfixNumeric) && is_alphabetic_or_hebrew(after))
+        return false;
+    if (is_alphabetic_or_hebrew(before) && (after == PrefixNumeric || after == PostfixNumeric))
+        return false;
+    if ((before == ClosePunctuation || before == CloseParenthesis || before == Numeric) && (after == PostfixNumeric || after == PrefixNumeric))
+        return false;
+    if ((before == PostfixNumeric || before == PrefixNumeric) && (after == OpenPunctuation || after == Numeric))
+        return false;
+    if ((before == Hyphen || before == InfixNumericSeparator || before == Numeric || before == SymbolsAllowingBreakAfter) && after == Numeric)
+        return false;
+
+    // NOTE: Korean syllable blocks (LB26 and LB27).
+    if (before == HangulLJamo &&
+        (after == HangulLJamo || after == HangulVJamo || after == HangulLvSyllable || after == HangulLvtSyllable))
+        return false;
+    if ((before == HangulVJamo || before == HangulLvSyllable) && (after == HangulVJamo || after == HangulTJamo))
+        return false;
+    if ((before == HangulTJamo || before == HangulLvtSyllable) && after == HangulTJamo)
+        return false;
+    if (is_hangul(before) && after == PostfixNumeric)
+        return false;
+    if (before == PrefixNumeric && is_hangul(after))
+        return false;
+
+    if (is_alphabetic_or_hebrew(before) && is_alphabetic_or_hebrew(after))
+        return false;
+    if (before == InfixNumericSeparator && is_alphabetic_or_hebrew(after))
+        return false;
+    if ((is_alphabetic_or_hebrew(before) || before == Numeric) && after == OpenPunctuation)
+        return false;
+    if (before == CloseParenthesis && (is_alphabetic_or_hebrew(after) || after == Numeric))
+        return false;
+    if (before == EmojiBase && after == EmojiModifier)
+        return false;
+
+    return true;
+}
+
+// The state of the analysis between two characters, which only depends on the characters since the last break
+// opportunity.
+class LineBreakState {
+public:
+    // Starts the analysis at the first character of the text (LB2).
+    explicit LineBreakState(LineBreakClass first_class)
+    {
+        const LineBreakClass resolved_class = resolve_line_break_class(first_class);
+        m_previous_is_zero_width_joiner = (resolved_class == ZeroWidthJoiner);
+
+        // NOTE: A combining mark without a base is treated as a letter (LB10), and a leading space as a word joiner,
+        //       as nothing precedes it that a line could end with.
+        if (resolved_class == CombiningMark || resolved_class == ZeroWidthJoiner)
+            m_before = Alphabetic;
+        else if (resolved_class == Space)
+            m_before = WordJoiner;
+        else
+            m_before = resolved_class;
+        m_regional_indicator_count = (m_before == RegionalIndicator) ? 1 : 0;
+    }
+
+    // Decides whether a line can be broken before the character, and advances the state past it.
+    NODISCARD LineBreakDecision advance(LineBreakClass next_class)
+    {
+        LineBreakClass after = resolve_line_break_class(next_class);
+
+        // NOTE: Always break after hard line breaks, but never between a carriage return and a line feed (LB4, LB5).
+        const bool follows_hard_break = (m_before == MandatoryBreak || m_before == LineFeed || m_before == NextLine) ||
+                                        (m_before == CarriageReturn && after != LineFeed);
+        if (follows_hard_break) {
+            *this = LineBreakState(next_class);
+            return LineBreakDecision::Mandatory;
+        }
+
+        // NOTE: Never break before hard line breaks, spaces or zero width spaces (LB6, LB7).
+        if (is_mandatory_break_class(after) || after == ZeroWidthSpace) {
+            set_before(after, false);
+            return LineBreakDecision::Prohibited;
+        }
+        if (after == Space) {
+            m_has_spaces = true;
+            m_previous_is_zero_width_joiner = false;
+            return LineBreakDecision::Prohibited;
+        }
+
+        // NOTE: Break after zero width spaces, even if spaces follow them (LB8).
+        if (m_before == ZeroWidthSpace) {
+            *this = LineBreakState(next_class);
+            return LineBreakDecision::Allowed;
+        }
+
+        // NOTE: Combining marks take the class of their base, and a joiner never allows a break after it (LB8a, LB9).
+        const bool is_combining = (after == CombiningMark || after == ZeroWidthJoiner);
+        if (is_combining && !m_has_spaces && !is_mandatory_break_class(m_before)) {
+            m_previous_is_zero_width_joiner = (after == ZeroWidthJoiner);
+            return LineBreakDecision::Prohibited;
+        }
+        if (m_previous_is_zero_width_joiner && !m_has_spaces) {
+            set_before(is_combining ? Alphabetic : after, after == ZeroWidthJoiner);
+            return LineBreakDecision::Prohibited;
+        }
+        const bool is_zero_width_joiner = (after == ZeroWidthJoiner);
+        if (is_combining)
+            after = Alphabetic;
+
+        bool is_allowed = is_break_allowed(m_before, after, m_has_spaces);
+
+        // NOTE: Never break after a hyphen that follows a Hebrew letter (LB21a), and only break between pairs of
+        //       regional indicators, which form flags (LB30a).
+        if (m_is_hyphen_after_hebrew_letter && !m_has_spaces)
+            is_allowed = false;
+        if (m_before == RegionalIndicator && after == RegionalIndicator && !m_has_spaces)
+            is_allowed = (m_regional_indicator_count % 2) == 0;
+
+        if (is_allowed) {
+            *this = LineBreakState(next_class);
+            return LineBreakDecision::Allowed;
+        }
+
+        m_is_hyphen_after_hebrew_letter = (m_before == HebrewLetter && !m_has_spaces && (after == Hyphen || after == BreakAfter));
+        const bool continues_regional_indicators = (m_before == RegionalIndicator && !m_has_spaces);
+        m_regional_indicator_count = (after == RegionalIndicator) ? (continues_regional_indicators ? m_regional_indicator_count + 1 : 1) : 0;
+        set_before(after, is_zero_width_joiner);
+        return LineBreakDecision::Prohibited;
+    }
+
+private:
+    ALWAYS_INLINE void set_before(LineBreakClass before, bool is_zero_width_joiner)
+    {
+        if (before != RegionalIndicator)
+            m_regional_indicator_count = 0;
+        if (before != Hyphen && before != BreakAfter)
+            m_is_hyphen_after_hebrew_letter = false;
+        m_before = before;
+        m_has_spaces = false;
+        m_previous_is_zero_width_joiner = is_zero_width_joiner;
+    }
+
+private:
+    LineBreakClass m_before;
+    bool m_has_spaces { false };
+    bool m_previous_is_zero_width_joiner { false };
+    bool m_is_hyphen_after_hebrew_letter { false };
+    u32 m_regional_indicator_count { 0 };
+};
+
+// Analyses the text from the offset, which must be the start of the text or a break opportunity, and appends the
+// opportunities that follow it. If the previous opportunities are given, the analysis stops at the first
+// opportunity at or after the offset where it resynchronizes with them, and returns the offset of that opportunity.
+NODISCARD static usize analyze_line_breaks(
+    ReadonlyByteSpan bytes,
+    usize begin_offset,
+    Vector<LineBreakOpportunity>& opportunities,
+    usize resynchronization_offset,
+    const Vector<LineBreakOpportunity>* previous_opportunities,
+    usize& previous_opportunity_index,
+    ssize byte_count_difference
+)
+{
+    if (begin_offset >= bytes.count())
+        return bytes.count();
+
+    usize offset = begin_offset;
+    LineBreakState state(analyzed_line_break_class(decode_utf8_code_point(bytes, offset)));
+    while (offset < bytes.count()) {
+        const usize character_offset = offset;
+        const LineBreakDecision decision = state.advance(analyzed_line_break_class(decode_utf8_code_point(bytes, offset)));
+        if (decision == LineBreakDecision::Prohibited)
+            continue;
+
+        const LineBreakOpportunity opportunity = { static_cast<u32>(character_offset), decision == LineBreakDecision::Mandatory };
+        opportunities.add(opportunity);
+        if (previous_opportunities == nullptr || character_offset < resynchronization_offset)
+            continue;
+
+        // NOTE: After a break, the state only depends on the text that follows it, which is the same as before the
+        //       edit. If the previous text had a break at the same place, all the following breaks are the same.
+        const usize previous_offset = static_cast<usize>(static_cast<ssize>(character_offset) - byte_count_difference);
+        while (previous_opportunity_index < previous_opportunities->count() &&
+               previous_opportunities->at(previous_opportunity_index).byte_offset < previous_offset)
+            ++previous_opportunity_index;
+        if (previous_opportunity_index < previous_opportunities->count() &&
+            previous_opportunities->at(previous_opportunity_index).byte_offset == previous_offset)
+            return character_offset;
+    }
+
+    return bytes.count();
+}
+
+void find_line_break_opportunities(StringView text, Vector<LineBreakOpportunity>& opportunities)
+{
+    opportunities.clear();
+    usize previous_opportunity_index = 0;
+    MAYBE_UNUSED const usize end_offset = analyze_line_breaks(text.byte_span(), 0, opportunities, 0, nullptr, previous_opportunity_index, 0);
+}
+
+void update_line_break_opportunities(
+    StringView text,
+    Vector<LineBreakOpportunity>& opportunities,
+    usize edit_offset,
+    usize removed_byte_count,
+    usize inserted_byte_count
+)
+{
+    // NOTE: The opportunities before the edit are kept, including the last one, where the analysis restarts.
+    usize kept_count = 0;
+    while (kept_count < opportunities.count() && opportunities[kept_count].byte_offset < edit_offset)
+        ++kept_count;
+    const usize restart_offset = (kept_count > 0) ? opportunities[kept_count - 1].byte_offset : 0;
+
+    Vector<LineBreakOpportunity> updated_opportunities = Vector<LineBreakOpportunity>::from_initial_capacity(opportunities.count() + 16);
+    for (usize index = 0; index < kept_count; ++index)
+        updated_opportunities.add(opportunities[index]);
+
+    const ssize byte_count_difference = static_cast<ssize>(inserted_byte_count) - static_cast<ssize>(removed_byte_count);
+    usize previous_opportunity_index = kept_count;
+    const usize resynchronization_offset = analyze_line_breaks(
+        text.byte_span(),
+        restart_offset,
+        updated_opportunities,
+        edit_offset + inserted_byte_count,
+        &opportunities,
+        previous_opportunity_index,
+        byte_count_difference
+    );
+
+    // NOTE: The opportunities after the resynchronization point are only shifted by the size difference.
+    if (resynchronization_offset < text.byte_count()) {
+        for (usize index = previous_opportunity_index + 1; index < opportunities.count(); ++index) {
+            LineBreakOpportunity opportunity = opportunities[index];
+            opportunity.byte_offset = static_cast<u32>(static_cast<ssize>(opportunity.byte_offset) + byte_count_difference);
+            updated_opportunities.add(opportunity);
+        }
+    }
+
+    opportunities = move(updated_opportunities);
+}
+
+} // namespace Graphics
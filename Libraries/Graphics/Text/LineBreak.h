@@ -0,0 +1,54 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#pragma once
+
+#include <AT/StringView.h>
+#include <AT/Vector.h>
+#include <Graphics/API.h>
+#include <Graphics/Text/UnicodeProperties.h>
+
+namespace Graphics {
+
+// A position in the text where a line can end, given as the byte offset of the first character of the next line.
+struct LineBreakOpportunity {
+    u32 byte_offset;
+    // NOTE: Mandatory breaks follow the characters that end a paragraph, such as line feeds.
+    bool is_mandatory;
+
+    NODISCARD ALWAYS_INLINE bool operator==(const LineBreakOpportunity& other) const
+    {
+        return (byte_offset == other.byte_offset) && (is_mandatory == other.is_mandatory);
+    }
+};
+
+// Finds the line break opportunities of UTF-8 text, by applying the rules of UAX #14.
+//
+// The start of the text is never a break opportunity, and the end of the text always is one, so neither of them is
+// reported. The classes that need a dictionary or the context of the language are resolved as the standard suggests
+// by default: complex context letters are treated as alphabetic, their marks as combining marks, and conditional
+// Japanese starters as nonstarters.
+//
+// NOTE: The rules are evaluated from the state after the previous break opportunity, which depends only on the first
+//       character that follows it. This makes the opportunities of an edited text computable incrementally, by
+//       restarting the analysis at the last opportunity before the edit.
+GRAPHICS_API void find_line_break_opportunities(StringView text, Vector<LineBreakOpportunity>& opportunities);
+
+// Updates the opportunities of a text after the bytes `[edit_offset, edit_offset + removed_byte_count)` were replaced
+// by `inserted_byte_count` bytes, where `text` is the text after the edit. The edit must start and end on character
+// boundaries.
+//
+// The analysis restarts at the last opportunity before the edit, and stops at the first opportunity after the edit
+// that is also an opportunity of the previous text. All the opportunities after it are only moved by the difference
+// in size, so the cost depends on the size of the edit rather than on the size of the text.
+GRAPHICS_API void update_line_break_opportunities(
+    StringView text,
+    Vector<LineBreakOpportunity>& opportunities,
+    usize edit_offset,
+    usize removed_byte_count,
+    usize inserted_byte_count
+);
+
+} // namespace Graphics
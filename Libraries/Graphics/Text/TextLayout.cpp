@@ -0,0 +1,397 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#include <AT/Assertions.h>
+#include <AT/UTF8.h>
+#include <Graphics/Text/TextLayout.h>
+
+namespace Graphics {
+
+//
+// Shaped paragraphs.
+//
+
+ShapedParagraph::~ShapedParagraph() = default;
+
+usize ShapedParagraph::memory_byte_count() const
+{
+    return sizeof(ShapedParagraph) + m_glyphs.count() * sizeof(ShapedGlyph) +
+           m_break_opportunities.count() * sizeof(LineBreakOpportunity) + m_segments.count() * sizeof(TextSegment);
+}
+
+void ShapedParagraph::build_segments()
+{
+    m_segments.clear();
+
+    u32 glyph_index = 0;
+    for (usize segment_index = 0; segment_index <= m_break_opportunities.count(); ++segment_index) {
+        // NOTE: The last segment ends at the end of the text, which is always a break opportunity.
+        const bool is_last_segment = (segment_index == m_break_opportunities.count());
+        const u32 byte_end_offset = is_last_segment ? m_byte_count : m_break_opportunities[segment_index].byte_offset;
+
+        TextSegment segment = {};
+        segment.byte_end_offset = byte_end_offset;
+        segment.ends_with_mandatory_break = !is_last_segment && m_break_opportunities[segment_index].is_mandatory;
+        for (; glyph_index < m_glyphs.count() && m_glyphs[glyph_index].byte_offset < byte_end_offset; ++glyph_index) {
+            const ShapedGlyph& glyph = m_glyphs[glyph_index];
+            if (glyph.is_whitespace) {
+                segment.trailing_whitespace_width += glyph.advance;
+            }
+            else {
+                segment.width += segment.trailing_whitespace_width + glyph.advance;
+                segment.trailing_whitespace_width = 0.0F;
+            }
+        }
+        segment.glyph_end_index = glyph_index;
+        m_segments.add(segment);
+    }
+}
+
+//
+// Paragraph layouts.
+//
+
+ParagraphLayout::ParagraphLayout(const Font& font, f32 pixel_size, f32 max_width)
+    : m_font(&font)
+    , m_pixel_size(pixel_size)
+    , m_max_width(max_width)
+{}
+
+ParagraphLayout::~ParagraphLayout() = default;
+
+usize ParagraphLayout::memory_byte_count() const
+{
+    return sizeof(ParagraphLayout) + m_glyphs.count() * sizeof(PositionedGlyph) + m_lines.count() * sizeof(TextLine);
+}
+
+void ParagraphLayout::draw(Bitmap& target, GlyphCache& glyph_cache, FloatPoint origin, Color color) const
+{
+    glyph_cache.draw_glyphs(target, *m_font, m_pixel_size, glyphs(), origin, color, target.rect());
+}
+
+//
+// Laying out paragraphs.
+//
+
+TextLayoutEngine::TextLayoutEngine(usize byte_budget)
+    : m_shaped_paragraphs(byte_budget / 2)
+    , m_layouts(byte_budget / 2)
+    , m_character_cache(Vector<CharacterCacheEntry>::from_template_element(character_cache_size, {}))
+    , m_kerning_cache(Vector<KerningCacheEntry>::from_template_element(kerning_cache_size, {}))
+{}
+
+TextLayoutEngine::~TextLayoutEngine() = default;
+
+RefPtr<ParagraphLayout> TextLayoutEngine::layout_paragraph(StringView text, const Font& font, f32 pixel_size, f32 max_width)
+{
+    const u32 font_index_value = font_index(font);
+    const Core::ResourceKey paragraph_key = shape_key(text, font_index_value, pixel_size);
+    const Core::ResourceKey paragraph_layout_key = layout_key(paragraph_key, max_width);
+
+    RefPtr<ParagraphLayout> layout = m_layouts.find(paragraph_layout_key);
+    if (layout.is_valid())
+        return layout;
+
+    RefPtr<ShapedParagraph> paragraph = m_shaped_paragraphs.find(paragraph_key);
+    if (!paragraph.is_valid()) {
+        paragraph = shape(text, font_index_value, pixel_size, nullptr);
+        m_shaped_paragraphs.insert(paragraph_key, paragraph, paragraph->memory_byte_count());
+    }
+
+    layout = break_lines(*paragraph, font, pixel_size, max_width);
+    m_layouts.insert(paragraph_layout_key, layout, layout->memory_byte_count());
+    return layout;
+}
+
+RefPtr<ParagraphLayout> TextLayoutEngine::layout_edited_paragraph(
+    StringView text,
+    const Font& font,
+    f32 pixel_size,
+    f32 max_width,
+    StringView previous_text,
+    const TextEdit& edit
+)
+{
+    VERIFY(edit.byte_offset + edit.removed_byte_count <= previous_text.byte_count());
+    VERIFY(previous_text.byte_count() - edit.removed_byte_count + edit.inserted_byte_count == text.byte_count());
+
+    const u32 font_index_value = font_index(font);
+    const Core::ResourceKey paragraph_key = shape_key(text, font_index_value, pixel_size);
+    const Core::ResourceKey paragraph_layout_key = layout_key(paragraph_key, max_width);
+
+    RefPtr<ParagraphLayout> layout = m_layouts.find(paragraph_layout_key);
+    if (layout.is_valid())
+        return layout;
+
+    RefPtr<ShapedParagraph> paragraph = m_shaped_paragraphs.find(paragraph_key);
+    if (!paragraph.is_valid()) {
+        // NOTE: The glyphs are mapped again, as that is cheap with the cached characters, but the break opportunities
+        //       are only analysed again around the edit.
+        RefPtr<ShapedParagraph> previous_paragraph = m_shaped_paragraphs.find(shape_key(previous_text, font_index_value, pixel_size));
+        if (previous_paragraph.is_valid()) {
+            Vector<LineBreakOpportunity> break_opportunities = previous_paragraph->break_opportunities();
+            update_line_break_opportunities(text, break_opportunities, edit.byte_offset, edit.removed_byte_count, edit.inserted_byte_count);
+            paragraph = shape(text, font_index_value, pixel_size, &break_opportunities);
+        }
+        else {
+            paragraph = shape(text, font_index_value, pixel_size, nullptr);
+        }
+        m_shaped_paragraphs.insert(paragraph_key, paragraph, paragraph->memory_byte_count());
+    }
+
+    layout = break_lines(*paragraph, font, pixel_size, max_width);
+    m_layouts.insert(paragraph_layout_key, layout, layout->memory_byte_count());
+    return layout;
+}
+
+RefPtr<ShapedParagraph> TextLayoutEngine::shape_paragraph(StringView text, const Font& font, f32 pixel_size)
+{
+    const u32 font_index_value = font_index(font);
+    const Core::ResourceKey paragraph_key = shape_key(text, font_index_value, pixel_size);
+
+    RefPtr<ShapedParagraph> paragraph = m_shaped_paragraphs.find(paragraph_key);
+    if (!paragraph.is_valid()) {
+        paragraph = shape(text, font_index_value, pixel_size, nullptr);
+        m_shaped_paragraphs.insert(paragraph_key, paragraph, paragraph->memory_byte_count());
+    }
+    return paragraph;
+}
+
+void TextLayoutEngine::remove_font(const Font& font)
+{
+    u32 removed_font_index = invalid_index;
+    for (u32 index = 0; index < m_fonts.count(); ++index) {
+        if (m_fonts[index].font == &font)
+            removed_font_index = index;
+    }
+    if (removed_font_index == invalid_index)
+        return;
+
+    const u64 removed_key_prefix = static_cast<u64>(removed_font_index + 1);
+    for (usize index = 0; index < m_character_cache.count(); ++index) {
+        if ((m_character_cache[index].key >> 32) == removed_key_prefix)
+            m_character_cache[index].key = 0;
+    }
+    for (usize index = 0; index < m_kerning_cache.count(); ++index) {
+        if ((m_kerning_cache[index].key >> 32) == removed_key_prefix)
+            m_kerning_cache[index].key = 0;
+    }
+    m_fonts[removed_font_index].font = nullptr;
+
+    // NOTE: The keys of the cached paragraphs can't be traced back to their font, so all of them are discarded.
+    m_shaped_paragraphs.clear();
+    m_layouts.clear();
+}
+
+void TextLayoutEngine::clear()
+{
+    m_shaped_paragraphs.clear();
+    m_layouts.clear();
+    m_fonts.clear();
+    for (usize index = 0; index < m_character_cache.count(); ++index)
+        m_character_cache[index].key = 0;
+    for (usize index = 0; index < m_kerning_cache.count(); ++index)
+        m_kerning_cache[index].key = 0;
+}
+
+Core::ResourceKey TextLayoutEngine::shape_key(StringView text, u32 font_index, f32 pixel_size)
+{
+    Hasher hasher;
+    hasher.update(text);
+    hasher.update_value(font_index);
+    hasher.update_value(pixel_size);
+    return hasher.finalize_128();
+}
+
+Core::ResourceKey TextLayoutEngine::layout_key(const Core::ResourceKey& shape_key, f32 max_width)
+{
+    Hasher hasher;
+    hasher.update_value(shape_key);
+    hasher.update_value(max_width);
+    return hasher.finalize_128();
+}
+
+RefPtr<ShapedParagraph> TextLayoutEngine::shape(
+    StringView text,
+    u32 font_index,
+    f32 pixel_size,
+    const Vector<LineBreakOpportunity>* break_opportunities
+)
+{
+    VERIFY(text.byte_count() <= NumericLimits<u32>::max());
+    RefPtr<ShapedParagraph> paragraph = adopt_ref(new ShapedParagraph());
+    paragraph->m_byte_count = static_cast<u32>(text.byte_count());
+    if (break_opportunities != nullptr)
+        paragraph->m_break_opportunities = *break_opportunities;
+    else
+        find_line_break_opportunities(text, paragraph->m_break_opportunities);
+
+    const f32 scale = m_fonts[font_index].font->scale_for_pixel_size(pixel_size);
+    const ReadonlyByteSpan bytes = text.byte_span();
+    Vector<ShapedGlyph>& glyphs = paragraph->m_glyphs;
+
+    // NOTE: Kerning only applies between glyphs on the same line, so it is not applied across hard line breaks.
+    bool can_kern_with_previous = false;
+    usize offset = 0;
+    while (offset < bytes.count()) {
+        const u32 byte_offset = static_cast<u32>(offset);
+        const u32 code_point = decode_utf8_code_point(bytes, offset);
+        const LineBreakClass character_class = line_break_class(code_point);
+        if (character_class == LineBreakClass::MandatoryBreak || character_class == LineBreakClass::CarriageReturn ||
+            character_class == LineBreakClass::LineFeed || character_class == LineBreakClass::NextLine) {
+            can_kern_with_previous = false;
+            continue;
+        }
+
+        const CachedCharacter character = cached_character(font_index, code_point);
+        if (can_kern_with_previous) {
+            ShapedGlyph& previous_glyph = glyphs[glyphs.count() - 1];
+            const s16 kerning = cached_kerning(font_index, previous_glyph.glyph_id, character.glyph_id);
+            previous_glyph.advance += static_cast<f32>(kerning) * scale;
+        }
+
+        const ShapedGlyph glyph = {
+            character.glyph_id,
+            byte_offset,
+            static_cast<f32>(character.advance_width) * scale,
+            character_class == LineBreakClass::Space,
+        };
+        glyphs.add(glyph);
+        can_kern_with_previous = true;
+    }
+
+    paragraph->build_segments();
+    return paragraph;
+}
+
+RefPtr<ParagraphLayout> TextLayoutEngine::break_lines(const ShapedParagraph& paragraph, const Font& font, f32 pixel_size, f32 max_width)
+{
+    RefPtr<ParagraphLayout> layout = adopt_ref(new ParagraphLayout(font, pixel_size, max_width));
+
+    const f32 scale = font.scale_for_pixel_size(pixel_size);
+    const f32 ascent = static_cast<f32>(font.ascender()) * scale;
+    const f32 line_height = static_cast<f32>(font.ascender() - font.descender() + font.line_gap()) * scale;
+
+    const Vector<ShapedGlyph>& glyphs = paragraph.glyphs();
+    const Vector<TextSegment>& segments = paragraph.segments();
+    layout->m_glyphs = Vector<PositionedGlyph>::from_initial_capacity(glyphs.count());
+
+    u32 line_first_glyph_index = 0;
+    u32 line_byte_offset = 0;
+    f32 line_width = 0.0F;
+    f32 pending_whitespace_width = 0.0F;
+    bool line_has_segments = false;
+
+    const auto commit_line = [&](u32 glyph_end_index, u32 byte_end_offset) {
+        TextLine line = {};
+        line.first_glyph_index = line_first_glyph_index;
+        line.glyph_count = glyph_end_index - line_first_glyph_index;
+        line.byte_offset = line_byte_offset;
+        line.byte_count = byte_end_offset - line_byte_offset;
+        line.width = line_width;
+        line.baseline = static_cast<f32>(layout->m_lines.count()) * line_height + ascent;
+
+        f32 pen_x = 0.0F;
+        for (u32 glyph_index = line.first_glyph_index; glyph_index < glyph_end_index; ++glyph_index) {
+            layout->m_glyphs.add({ glyphs[glyph_index].glyph_id, { pen_x, line.baseline } });
+            pen_x += glyphs[glyph_index].advance;
+        }
+
+        layout->m_lines.add(line);
+        layout->m_width = (line_width > layout->m_width) ? line_width : layout->m_width;
+        line_first_glyph_index = glyph_end_index;
+        line_byte_offset = byte_end_offset;
+        line_width = 0.0F;
+        pending_whitespace_width = 0.0F;
+        line_has_segments = false;
+    };
+
+    u32 segment_glyph_begin_index = 0;
+    u32 segment_byte_begin_offset = 0;
+    for (usize segment_index = 0; segment_index < segments.count(); ++segment_index) {
+        const TextSegment& segment = segments[segment_index];
+
+        // NOTE: The spaces that end the previous segment only count if the segment continues the line. A segment
+        //       that doesn't fit starts a new line, unless it is the first one of its line.
+        const f32 extended_width = line_width + pending_whitespace_width + segment.width;
+        if (line_has_segments && extended_width > max_width)
+            commit_line(segment_glyph_begin_index, segment_byte_begin_offset);
+
+        line_width = line_has_segments ? (line_width + pending_whitespace_width + segment.width) : segment.width;
+        pending_whitespace_width = segment.trailing_whitespace_width;
+        line_has_segments = true;
+
+        segment_glyph_begin_index = segment.glyph_end_index;
+        segment_byte_begin_offset = segment.byte_end_offset;
+        if (segment.ends_with_mandatory_break)
+            commit_line(segment_glyph_begin_index, segment_byte_begin_offset);
+    }
+
+    // NOTE: An empty paragraph still has a line, so that it has the height of one.
+    if (line_has_segments || layout->m_lines.is_empty())
+        commit_line(segment_glyph_begin_index, segment_byte_begin_offset);
+
+    layout->m_height = static_cast<f32>(layout->m_lines.count()) * line_height;
+    return layout;
+}
+
+//
+// Cached characters and kerning.
+//
+
+u32 TextLayoutEngine::font_index(const Font& font)
+{
+    u32 free_index = invalid_index;
+    for (u32 index = 0; index < m_fonts.count(); ++index) {
+        if (m_fonts[index].font == &font)
+            return index;
+        if (m_fonts[index].font == nullptr && free_index == invalid_index)
+            free_index = index;
+    }
+
+    if (free_index == invalid_index) {
+        m_fonts.add({});
+        free_index = static_cast<u32>(m_fonts.count() - 1);
+    }
+
+    // NOTE: The characters of ASCII are looked up when the font is first used, so they never miss.
+    FontEntry& font_entry = m_fonts[free_index];
+    font_entry.font = &font;
+    for (u32 code_point = 0; code_point < ascii_code_point_count; ++code_point) {
+        const u32 glyph_id = font.glyph_id(code_point);
+        font_entry.ascii_characters[code_point] = { glyph_id, font.glyph_metrics(glyph_id).advance_width };
+    }
+    return free_index;
+}
+
+TextLayoutEngine::CachedCharacter TextLayoutEngine::cached_character(u32 font_index, u32 code_point)
+{
+    const FontEntry& font_entry = m_fonts[font_index];
+    if (code_point < ascii_code_point_count)
+        return font_entry.ascii_characters[code_point];
+
+    const u64 key = (static_cast<u64>(font_index + 1) << 32) | code_point;
+    CharacterCacheEntry& entry = m_character_cache[static_cast<usize>(hash_integer(key)) & (character_cache_size - 1)];
+    if (entry.key != key) {
+        const u32 glyph_id = font_entry.font->glyph_id(code_point);
+        entry.key = key;
+        entry.character = { glyph_id, font_entry.font->glyph_metrics(glyph_id).advance_width };
+    }
+    return entry.character;
+}
+
+s16 TextLayoutEngine::cached_kerning(u32 font_index, u32 left_glyph_id, u32 right_glyph_id)
+{
+    // NOTE: The glyph identifiers of a font are 16-bit, so both of them fit in the low half of the key.
+    const u64 key = (static_cast<u64>(font_index + 1) << 32) | ((left_glyph_id & 0xFFFF) << 16) | (right_glyph_id & 0xFFFF);
+    KerningCacheEntry& entry = m_kerning_cache[static_cast<usize>(hash_integer(key)) & (kerning_cache_size - 1)];
+    if (entry.key != key) {
+        entry.key = key;
+        entry.kerning = m_fonts[font_index].font->kerning(left_glyph_id, right_glyph_id);
+    }
+    return entry.kerning;
+}
+
+} // namespace Graphics
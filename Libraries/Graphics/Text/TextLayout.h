@@ -0,0 +1,242 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#pragma once
+
+#include <AT/Hash.h>
+#include <AT/RefPtr.h>
+#include <AT/Span.h>
+#include <AT/StringView.h>
+#include <AT/Vector.h>
+#include <Core/ResourceCache.h>
+#include <Graphics/API.h>
+#include <Graphics/Bitmap.h>
+#include <Graphics/Font/Font.h>
+#include <Graphics/Font/GlyphCache.h>
+#include <Graphics/Text/LineBreak.h>
+
+namespace Graphics {
+
+// A glyph of a shaped paragraph, whose advance is in pixels and already includes the kerning with the next glyph.
+struct ShapedGlyph {
+    u32 glyph_id;
+    // NOTE: The offset of the first byte of the character that the glyph was mapped from.
+    u32 byte_offset;
+    f32 advance;
+    bool is_whitespace;
+};
+
+// The glyphs between two consecutive break opportunities, which can't be split across lines.
+struct TextSegment {
+    u32 glyph_end_index;
+    u32 byte_end_offset;
+    // NOTE: The width of the segment without its trailing spaces, which hang past the end of a line.
+    f32 width;
+    f32 trailing_whitespace_width;
+    bool ends_with_mandatory_break;
+};
+
+// The part of the layout of a paragraph that doesn't depend on the width it is laid out in: the glyphs that the
+// characters map to, and the segments between the line break opportunities of the text.
+//
+// NOTE: The characters that end a line, such as line feeds, don't produce any glyph.
+class ShapedParagraph : public RefCounted {
+    AT_MAKE_NONCOPYABLE(ShapedParagraph);
+    AT_MAKE_NONMOVABLE(ShapedParagraph);
+    friend class TextLayoutEngine;
+
+public:
+    GRAPHICS_API virtual ~ShapedParagraph() override;
+
+public:
+    NODISCARD ALWAYS_INLINE u32 byte_count() const { return m_byte_count; }
+    NODISCARD ALWAYS_INLINE const Vector<ShapedGlyph>& glyphs() const { return m_glyphs; }
+    NODISCARD ALWAYS_INLINE const Vector<LineBreakOpportunity>& break_opportunities() const { return m_break_opportunities; }
+    NODISCARD ALWAYS_INLINE const Vector<TextSegment>& segments() const { return m_segments; }
+
+    // NOTE: The memory used by the paragraph, which is charged against the budget of the layout cache.
+    NODISCARD GRAPHICS_API usize memory_byte_count() const;
+
+private:
+    ShapedParagraph() = default;
+
+    // Splits the glyphs into the segments delimited by the break opportunities.
+    void build_segments();
+
+private:
+    u32 m_byte_count { 0 };
+    Vector<ShapedGlyph> m_glyphs;
+    Vector<LineBreakOpportunity> m_break_opportunities;
+    Vector<TextSegment> m_segments;
+};
+
+struct TextLine {
+    u32 first_glyph_index;
+    u32 glyph_count;
+    u32 byte_offset;
+    u32 byte_count;
+    // NOTE: The width of the line without its trailing spaces.
+    f32 width;
+    // NOTE: The distance from the top of the paragraph to the baseline of the line.
+    f32 baseline;
+};
+
+// A paragraph broken into lines, with the position of every glyph relative to the top-left corner of the paragraph.
+class ParagraphLayout : public RefCounted {
+    AT_MAKE_NONCOPYABLE(ParagraphLayout);
+    AT_MAKE_NONMOVABLE(ParagraphLayout);
+    friend class TextLayoutEngine;
+
+public:
+    GRAPHICS_API virtual ~ParagraphLayout() override;
+
+public:
+    NODISCARD ALWAYS_INLINE const Font& font() const { return *m_font; }
+    NODISCARD ALWAYS_INLINE f32 pixel_size() const { return m_pixel_size; }
+    NODISCARD ALWAYS_INLINE f32 max_width() const { return m_max_width; }
+
+    // NOTE: The width of the widest line, which can exceed the maximum width if a segment doesn't fit in a line.
+    NODISCARD ALWAYS_INLINE f32 width() const { return m_width; }
+    NODISCARD ALWAYS_INLINE f32 height() const { return m_height; }
+
+    NODISCARD ALWAYS_INLINE Span<const PositionedGlyph> glyphs() const { return { m_glyphs.elements(), m_glyphs.count() }; }
+    NODISCARD ALWAYS_INLINE const Vector<TextLine>& lines() const { return m_lines; }
+
+    NODISCARD GRAPHICS_API usize memory_byte_count() const;
+
+public:
+    // Draws the paragraph with its top-left corner at the origin.
+    GRAPHICS_API void draw(Bitmap& target, GlyphCache& glyph_cache, FloatPoint origin, Color color) const;
+
+private:
+    ParagraphLayout(const Font& font, f32 pixel_size, f32 max_width);
+
+private:
+    const Font* m_font;
+    f32 m_pixel_size;
+    f32 m_max_width;
+    f32 m_width { 0.0F };
+    f32 m_height { 0.0F };
+    Vector<PositionedGlyph> m_glyphs;
+    Vector<TextLine> m_lines;
+};
+
+// Replacement of the bytes `[byte_offset, byte_offset + removed_byte_count)` of a text by `inserted_byte_count` bytes.
+struct TextEdit {
+    u32 byte_offset;
+    u32 removed_byte_count;
+    u32 inserted_byte_count;
+};
+
+// Lays out paragraphs of UTF-8 text in a single font, breaking them into lines at the opportunities of UAX #14.
+//
+// Laying out a paragraph has two stages, and the result of each of them is cached. Shaping maps the characters to
+// glyphs and finds the break opportunities, and its result is keyed by the hash of the text, the font and the pixel
+// size. Line breaking then fills the lines greedily with the segments between the opportunities, and its result is
+// keyed by the key of the shaped paragraph and the width. Laying out the same paragraph at the same width again only
+// costs hashing its text, and a new width only repeats the line breaking, which never looks at the characters.
+//
+// The glyphs and the advances of the characters are cached for every font, in a table for ASCII and in a direct-mapped
+// cache for the other characters, as is the kerning of the pairs of glyphs. This keeps the character map and the
+// kerning tables of the font out of the loop that shapes the text.
+//
+// When a paragraph is edited, its break opportunities are updated incrementally from those of the previous text, if
+// that is still cached, instead of analysing the whole text again.
+//
+// NOTE: Fonts are identified by their address, like in GlyphCache. Use TextLayoutEngine::remove_font() before
+//       destroying a font, which also discards the cached layouts of every font.
+class TextLayoutEngine {
+    AT_MAKE_NONCOPYABLE(TextLayoutEngine);
+    AT_MAKE_NONMOVABLE(TextLayoutEngine);
+
+public:
+    static constexpr usize default_byte_budget = 8 * 1024 * 1024;
+
+public:
+    GRAPHICS_API explicit TextLayoutEngine(usize byte_budget = default_byte_budget);
+    GRAPHICS_API ~TextLayoutEngine();
+
+public:
+    NODISCARD ALWAYS_INLINE const Core::ResourceCacheStatistics& shaping_statistics() const { return m_shaped_paragraphs.statistics(); }
+    NODISCARD ALWAYS_INLINE const Core::ResourceCacheStatistics& layout_statistics() const { return m_layouts.statistics(); }
+
+public:
+    // Lays out the paragraph in lines that are at most `max_width` pixels wide. Lines only overflow the width when
+    // a single segment doesn't fit in a line.
+    NODISCARD GRAPHICS_API RefPtr<ParagraphLayout> layout_paragraph(StringView text, const Font& font, f32 pixel_size, f32 max_width);
+
+    // Lays out a paragraph that was obtained by applying the edit to the previous text.
+    NODISCARD GRAPHICS_API RefPtr<ParagraphLayout> layout_edited_paragraph(
+        StringView text,
+        const Font& font,
+        f32 pixel_size,
+        f32 max_width,
+        StringView previous_text,
+        const TextEdit& edit
+    );
+
+    // Returns the shaped paragraph, which is shared by the layouts of the text at every width.
+    NODISCARD GRAPHICS_API RefPtr<ShapedParagraph> shape_paragraph(StringView text, const Font& font, f32 pixel_size);
+
+    GRAPHICS_API void remove_font(const Font& font);
+    GRAPHICS_API void clear();
+
+private:
+    static constexpr u32 invalid_index = NumericLimits<u32>::max();
+    static constexpr usize ascii_code_point_count = 128;
+    static constexpr usize character_cache_size = 4096;
+    static constexpr usize kerning_cache_size = 4096;
+
+    struct CachedCharacter {
+        u32 glyph_id;
+        u16 advance_width;
+    };
+
+    struct FontEntry {
+        const Font* font { nullptr };
+        CachedCharacter ascii_characters[ascii_code_point_count];
+    };
+
+    // NOTE: The key of an entry of the direct-mapped caches packs the index of the font plus one, so that zero
+    //       denotes an empty entry.
+    struct CharacterCacheEntry {
+        u64 key { 0 };
+        CachedCharacter character;
+    };
+
+    struct KerningCacheEntry {
+        u64 key { 0 };
+        s16 kerning;
+    };
+
+private:
+    NODISCARD u32 font_index(const Font& font);
+
+    NODISCARD CachedCharacter cached_character(u32 font_index, u32 code_point);
+    NODISCARD s16 cached_kerning(u32 font_index, u32 left_glyph_id, u32 right_glyph_id);
+
+    NODISCARD static Core::ResourceKey shape_key(StringView text, u32 font_index, f32 pixel_size);
+    NODISCARD static Core::ResourceKey layout_key(const Core::ResourceKey& shape_key, f32 max_width);
+
+    // Shapes the text, and finds its break opportunities unless they are given.
+    NODISCARD RefPtr<ShapedParagraph> shape(
+        StringView text,
+        u32 font_index,
+        f32 pixel_size,
+        const Vector<LineBreakOpportunity>* break_opportunities
+    );
+
+    NODISCARD RefPtr<ParagraphLayout> break_lines(const ShapedParagraph& paragraph, const Font& font, f32 pixel_size, f32 max_width);
+
+private:
+    Core::ResourceCache<ShapedParagraph> m_shaped_paragraphs;
+    Core::ResourceCache<ParagraphLayout> m_layouts;
+
+    Vector<FontEntry> m_fonts;
+    Vector<CharacterCacheEntry> m_character_cache;
+    Vector<KerningCacheEntry> m_kerning_cache;
+};
+
+} // namespace Graphics
@@ -0,0 +1,385 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#include <AT/Assertions.h>
+#include <AT/UTF8.h>
+#include <Graphics/Text/TextSegmentation.h>
+
+namespace Graphics {
+
+NODISCARD ALWAYS_INLINE static bool is_ascii_letter_or_digit(u8 byte)
+{
+    return (byte >= 'a' && byte <= 'z') || (byte >= 'A' && byte <= 'Z') || (byte >= '0' && byte <= '9');
+}
+
+NODISCARD ALWAYS_INLINE static const CodePointProperties& properties_at(ReadonlyByteSpan bytes, usize offset)
+{
+    return code_point_properties(decode_utf8_code_point(bytes, offset));
+}
+
+//
+// Grapheme clusters.
+//
+
+// Applies the rules that only depend on the two characters around the boundary (GB3 to GB9b). The rules that
+// depend on the characters before them (GB11 to GB13) can only prevent a break that these rules allow.
+NODISCARD static bool is_grapheme_break_allowed(GraphemeClusterBreak before, GraphemeClusterBreak after)
+{
+    using enum GraphemeClusterBreak;
+
+    if (before == CarriageReturn && after == LineFeed)
+        return false;
+    if (before == Control || before == CarriageReturn || before == LineFeed)
+        return true;
+    if (after == Control || after == CarriageReturn || after == LineFeed)
+        return true;
+
+    if (before == HangulLJamo &&
+        (after == HangulLJamo || after == HangulVJamo || after == HangulLvSyllable || after == HangulLvtSyllable))
+        return false;
+    if ((before == HangulLvSyllable || before == HangulVJamo) && (after == HangulVJamo || after == HangulTJamo))
+        return false;
+    if ((before == HangulLvtSyllable || before == HangulTJamo) && after == HangulTJamo)
+        return false;
+
+    if (after == Extend || after == ZeroWidthJoiner || after == SpacingMark || before == Prepend)
+        return false;
+    return true;
+}
+
+// The state of the emoji sequences that the rule GB11 joins, which is an extended pictographic character followed by
+// any number of extending characters and a zero width joiner.
+enum class EmojiSequenceState : u8 {
+    None,
+    Pictographic,
+    JoinerAfterPictographic,
+};
+
+bool is_grapheme_boundary(StringView text, usize byte_offset)
+{
+    const ReadonlyByteSpan bytes = text.byte_span();
+    VERIFY(byte_offset <= bytes.count());
+    if (byte_offset == 0 || byte_offset == bytes.count())
+        return true;
+
+    // NOTE: Between two ASCII characters, only a carriage return followed by a line feed isn't a boundary.
+    if (bytes[byte_offset - 1] < 0x80 && bytes[byte_offset] < 0x80)
+        return !(bytes[byte_offset - 1] == '\r' && bytes[byte_offset] == '\n');
+
+    const usize previous_offset = previous_utf8_code_point_offset(bytes, byte_offset);
+    const GraphemeClusterBreak before = properties_at(bytes, previous_offset).grapheme_cluster_break;
+    const CodePointProperties& after = properties_at(bytes, byte_offset);
+    if (!is_grapheme_break_allowed(before, after.grapheme_cluster_break))
+        return false;
+
+    // NOTE: Don't break within emoji sequences that are joined by a zero width joiner (GB11).
+    if (before == GraphemeClusterBreak::ZeroWidthJoiner && after.is_extended_pictographic) {
+        usize offset = previous_offset;
+        while (offset > 0) {
+            offset = previous_utf8_code_point_offset(bytes, offset);
+            const CodePointProperties& properties = properties_at(bytes, offset);
+            if (properties.grapheme_cluster_break != GraphemeClusterBreak::Extend)
+                return !properties.is_extended_pictographic;
+        }
+        return true;
+    }
+
+    // NOTE: Regional indicators form flags in pairs, counting from the start of their run (GB12, GB13).
+    if (before == GraphemeClusterBreak::RegionalIndicator && after.grapheme_cluster_break == GraphemeClusterBreak::RegionalIndicator) {
+        usize regional_indicator_count = 1;
+        usize offset = previous_offset;
+        while (offset > 0) {
+            offset = previous_utf8_code_point_offset(bytes, offset);
+            if (properties_at(bytes, offset).grapheme_cluster_break != GraphemeClusterBreak::RegionalIndicator)
+                break;
+            ++regional_indicator_count;
+        }
+        return (regional_indicator_count % 2) == 0;
+    }
+
+    return true;
+}
+
+usize next_grapheme_boundary(StringView text, usize byte_offset)
+{
+    const ReadonlyByteSpan bytes = text.byte_span();
+    if (byte_offset >= bytes.count())
+        return bytes.count();
+
+    // NOTE: An ASCII character other than a carriage return is a cluster of its own, unless it is followed by a
+    //       character that extends it. No ASCII character does.
+    if (bytes[byte_offset] < 0x80 && bytes[byte_offset] != '\r') {
+        if (byte_offset + 1 == bytes.count() || bytes[byte_offset + 1] < 0x80)
+            return byte_offset + 1;
+    }
+
+    usize offset = byte_offset;
+    const CodePointProperties& first_properties = code_point_properties(decode_utf8_code_point(bytes, offset));
+
+    GraphemeClusterBreak before = first_properties.grapheme_cluster_break;
+    EmojiSequenceState emoji_state = first_properties.is_extended_pictographic ? EmojiSequenceState::Pictographic : EmojiSequenceState::None;
+    usize regional_indicator_count = (before == GraphemeClusterBreak::RegionalIndicator) ? 1 : 0;
+
+    while (offset < bytes.count()) {
+        usize next_offset = offset;
+        const CodePointProperties& after = code_point_properties(decode_utf8_code_point(bytes, next_offset));
+
+        bool is_break = is_grapheme_break_allowed(before, after.grapheme_cluster_break);
+        if (is_break && emoji_state == EmojiSequenceState::JoinerAfterPictographic && after.is_extended_pictographic)
+            is_break = false;
+        if (is_break && before == GraphemeClusterBreak::RegionalIndicator &&
+            after.grapheme_cluster_break == GraphemeClusterBreak::RegionalIndicator)
+            is_break = (regional_indicator_count % 2) == 0;
+        if (is_break)
+            return offset;
+
+        if (after.is_extended_pictographic)
+            emoji_state = EmojiSequenceState::Pictographic;
+        else if (emoji_state == EmojiSequenceState::Pictographic && after.grapheme_cluster_break == GraphemeClusterBreak::Extend)
+            emoji_state = EmojiSequenceState::Pictographic;
+        else if (emoji_state == EmojiSequenceState::Pictographic && after.grapheme_cluster_break == GraphemeClusterBreak::ZeroWidthJoiner)
+            emoji_state = EmojiSequenceState::JoinerAfterPictographic;
+        else
+            emoji_state = EmojiSequenceState::None;
+
+        if (after.grapheme_cluster_break == GraphemeClusterBreak::RegionalIndicator)
+            ++regional_indicator_count;
+        else
+            regional_indicator_count = 0;
+
+        before = after.grapheme_cluster_break;
+        offset = next_offset;
+    }
+
+    return bytes.count();
+}
+
+usize previous_grapheme_boundary(StringView text, usize byte_offset)
+{
+    const ReadonlyByteSpan bytes = text.byte_span();
+    VERIFY(byte_offset <= bytes.count());
+    if (byte_offset == 0)
+        return 0;
+
+    usize offset = previous_utf8_code_point_offset(bytes, byte_offset);
+    while (offset > 0 && !is_grapheme_boundary(text, offset))
+        offset = previous_utf8_code_point_offset(bytes, offset);
+    return offset;
+}
+
+//
+// Words.
+//
+
+// NOTE: The extending and format characters, and the joiners, take the class of the character before them (WB4).
+NODISCARD ALWAYS_INLINE static bool is_ignored_by_word_rules(WordBreak word_break)
+{
+    return word_break == WordBreak::Extend || word_break == WordBreak::Format || word_break == WordBreak::ZeroWidthJoiner;
+}
+
+NODISCARD ALWAYS_INLINE static bool is_newline(WordBreak word_break)
+{
+    return word_break == WordBreak::CarriageReturn || word_break == WordBreak::LineFeed || word_break == WordBreak::Newline;
+}
+
+NODISCARD ALWAYS_INLINE static bool is_word_letter(WordBreak word_break)
+{
+    return word_break == WordBreak::Letter || word_break == WordBreak::HebrewLetter;
+}
+
+NODISCARD ALWAYS_INLINE static bool is_mid_letter(WordBreak word_break)
+{
+    return word_break == WordBreak::MidLetter || word_break == WordBreak::MidNumberLetter || word_break == WordBreak::SingleQuote;
+}
+
+NODISCARD ALWAYS_INLINE static bool is_mid_number(WordBreak word_break)
+{
+    return word_break == WordBreak::MidNumber || word_break == WordBreak::MidNumberLetter || word_break == WordBreak::SingleQuote;
+}
+
+// Returns the class of the character that ends at the offset, skipping the characters that the rules ignore, and
+// moves the offset to its start. The start of the text has no class, which is represented by the other class, as it
+// doesn't match any rule. The same holds for ignored characters that follow the start of the text or a newline, as
+// they have no character to take the class of.
+NODISCARD static WordBreak previous_word_break(ReadonlyByteSpan bytes, usize& offset)
+{
+    usize run_start_offset = offset;
+    while (run_start_offset > 0) {
+        const usize character_offset = previous_utf8_code_point_offset(bytes, run_start_offset);
+        const WordBreak word_break = properties_at(bytes, character_offset).word_break;
+        if (is_ignored_by_word_rules(word_break)) {
+            run_start_offset = character_offset;
+            continue;
+        }
+        if (is_newline(word_break) && run_start_offset != offset)
+            break;
+
+        offset = character_offset;
+        return word_break;
+    }
+
+    offset = run_start_offset;
+    return WordBreak::Other;
+}
+
+// Returns the class of the character that starts at the offset, and moves the offset past it and the ignored
+// characters that follow it. The end of the text is represented by the other class.
+NODISCARD static WordBreak next_word_break(ReadonlyByteSpan bytes, usize& offset)
+{
+    if (offset >= bytes.count())
+        return WordBreak::Other;
+
+    const WordBreak word_break = code_point_properties(decode_utf8_code_point(bytes, offset)).word_break;
+    if (is_newline(word_break))
+        return word_break;
+
+    while (offset < bytes.count()) {
+        usize next_offset = offset;
+        if (!is_ignored_by_word_rules(code_point_properties(decode_utf8_code_point(bytes, next_offset)).word_break))
+            break;
+        offset = next_offset;
+    }
+    return word_break;
+}
+
+bool is_word_boundary(StringView text, usize byte_offset)
+{
+    const ReadonlyByteSpan bytes = text.byte_span();
+    VERIFY(byte_offset <= bytes.count());
+    if (byte_offset == 0 || byte_offset == bytes.count())
+        return true;
+
+    // NOTE: Letters and digits never break from each other, which covers most of the boundaries in a word (WB5 to WB10).
+    if (is_ascii_letter_or_digit(bytes[byte_offset - 1]) && is_ascii_letter_or_digit(bytes[byte_offset]))
+        return false;
+
+    const usize previous_offset = previous_utf8_code_point_offset(bytes, byte_offset);
+    const WordBreak before = properties_at(bytes, previous_offset).word_break;
+    const CodePointProperties& after_properties = properties_at(bytes, byte_offset);
+    const WordBreak after = after_properties.word_break;
+
+    // NOTE: Rules that apply to the characters as they are, before the ignored characters are skipped (WB3 to WB4).
+    if (before == WordBreak::CarriageReturn && after == WordBreak::LineFeed)
+        return false;
+    if (is_newline(before) || is_newline(after))
+        return true;
+    if (before == WordBreak::ZeroWidthJoiner && after_properties.is_extended_pictographic)
+        return false;
+    if (before == WordBreak::WordSegmentSpace && after == WordBreak::WordSegmentSpace)
+        return false;
+    if (is_ignored_by_word_rules(after))
+        return false;
+
+    usize left_offset = byte_offset;
+    const WordBreak left = previous_word_break(bytes, left_offset);
+    usize right_end_offset = byte_offset;
+    const WordBreak right = next_word_break(bytes, right_end_offset);
+
+    // NOTE: The classes of the characters around the pair are only needed by a few rules, so they are found lazily.
+    const auto second_left = [&]() {
+        usize offset = left_offset;
+        return previous_word_break(bytes, offset);
+    };
+    const auto second_right = [&]() {
+        usize offset = right_end_offset;
+        return next_word_break(bytes, offset);
+    };
+
+    if (is_word_letter(left) && is_word_letter(right))
+        return false;
+    if (is_word_letter(left) && is_mid_letter(right) && is_word_letter(second_right()))
+        return false;
+    if (is_mid_letter(left) && is_word_letter(right) && is_word_letter(second_left()))
+        return false;
+    if (left == WordBreak::HebrewLetter && right == WordBreak::SingleQuote)
+        return false;
+    if (left == WordBreak::HebrewLetter && right == WordBreak::DoubleQuote && second_right() == WordBreak::HebrewLetter)
+        return false;
+    if (left == WordBreak::DoubleQuote && right == WordBreak::HebrewLetter && second_left() == WordBreak::HebrewLetter)
+        return false;
+
+    // NOTE: Numbers, and letters next to numbers (WB8 to WB12).
+    const bool left_is_letter_or_number = is_word_letter(left) || left == WordBreak::Numeric;
+    const bool right_is_letter_or_number = is_word_letter(right) || right == WordBreak::Numeric;
+    if (left_is_letter_or_number && right_is_letter_or_number)
+        return false;
+    if (is_mid_number(left) && right == WordBreak::Numeric && second_left() == WordBreak::Numeric)
+        return false;
+    if (left == WordBreak::Numeric && is_mid_number(right) && second_right() == WordBreak::Numeric)
+        return false;
+
+    // NOTE: Katakana, and the connectors of words such as underscores (WB13 to WB13b).
+    if (left == WordBreak::Katakana && right == WordBreak::Katakana)
+        return false;
+    if ((left_is_letter_or_number || left == WordBreak::Katakana || left == WordBreak::ExtendNumberLetter) &&
+        right == WordBreak::ExtendNumberLetter)
+        return false;
+    if (left == WordBreak::ExtendNumberLetter && (right_is_letter_or_number || right == WordBreak::Katakana))
+        return false;
+
+    // NOTE: Regional indicators form flags in pairs, counting from the start of their run (WB15, WB16).
+    if (left == WordBreak::RegionalIndicator && right == WordBreak::RegionalIndicator) {
+        usize regional_indicator_count = 1;
+        usize offset = left_offset;
+        while (previous_word_break(bytes, offset) == WordBreak::RegionalIndicator)
+            ++regional_indicator_count;
+        return (regional_indicator_count % 2) == 0;
+    }
+
+    return true;
+}
+
+usize next_word_boundary(StringView text, usize byte_offset)
+{
+    const ReadonlyByteSpan bytes = text.byte_span();
+    if (byte_offset >= bytes.count())
+        return bytes.count();
+
+    usize offset = byte_offset;
+    do {
+        if (bytes[offset] < 0x80) {
+            ++offset;
+        }
+        else {
+            MAYBE_UNUSED const u32 code_point = decode_utf8_code_point(bytes, offset);
+        }
+    } while (offset < bytes.count() && !is_word_boundary(text, offset));
+    return offset;
+}
+
+usize previous_word_boundary(StringView text, usize byte_offset)
+{
+    const ReadonlyByteSpan bytes = text.byte_span();
+    VERIFY(byte_offset <= bytes.count());
+    if (byte_offset == 0)
+        return 0;
+
+    usize offset = previous_utf8_code_point_offset(bytes, byte_offset);
+    while (offset > 0 && !is_word_boundary(text, offset))
+        offset = previous_utf8_code_point_offset(bytes, offset);
+    return offset;
+}
+
+bool is_word_like(StringView segment)
+{
+    const ReadonlyByteSpan bytes = segment.byte_span();
+    usize offset = 0;
+    while (offset < bytes.count()) {
+        if (bytes[offset] < 0x80) {
+            if (is_ascii_letter_or_digit(bytes[offset]))
+                return true;
+            ++offset;
+            continue;
+        }
+
+        // NOTE: The letters and the numbers are contiguous in the general categories.
+        const GeneralCategory category = code_point_properties(decode_utf8_code_point(bytes, offset)).general_category;
+        if (category <= GeneralCategory::OtherLetter || (category >= GeneralCategory::DecimalNumber && category <= GeneralCategory::OtherNumber))
+            return true;
+    }
+    return false;
+}
+
+} // namespace Graphics
@@ -0,0 +1,105 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#pragma once
+
+#include <AT/StringView.h>
+#include <Graphics/API.h>
+#include <Graphics/Text/UnicodeProperties.h>
+
+namespace Graphics {
+
+//
+// Boundaries of the text segments defined by UAX #29. All the offsets are byte offsets into UTF-8 text, and the
+// start and the end of the text are always boundaries.
+//
+// The boundaries after an offset are found by running the rules forwards from it, which requires the offset to be
+// a boundary. The functions that test or search backwards from an offset look at as much of the text before it as
+// the rules need, so they work from any offset that is the start of a code point.
+//
+
+// Extended grapheme clusters, which are the characters as the user perceives them. The cursor moves and the text is
+// deleted by whole clusters.
+NODISCARD GRAPHICS_API bool is_grapheme_boundary(StringView text, usize byte_offset);
+NODISCARD GRAPHICS_API usize next_grapheme_boundary(StringView text, usize byte_offset);
+NODISCARD GRAPHICS_API usize previous_grapheme_boundary(StringView text, usize byte_offset);
+
+// Words, and the runs of spaces and punctuation between them. Selecting a word by double clicking selects the
+// segment that contains the click.
+NODISCARD GRAPHICS_API bool is_word_boundary(StringView text, usize byte_offset);
+NODISCARD GRAPHICS_API usize next_word_boundary(StringView text, usize byte_offset);
+NODISCARD GRAPHICS_API usize previous_word_boundary(StringView text, usize byte_offset);
+
+// NOTE: True if the segment contains a letter or a number, as opposed to only spaces or punctuation.
+NODISCARD GRAPHICS_API bool is_word_like(StringView segment);
+
+struct GraphemeSegmentation {
+    NODISCARD ALWAYS_INLINE static usize next_boundary(StringView text, usize byte_offset) { return next_grapheme_boundary(text, byte_offset); }
+};
+
+struct WordSegmentation {
+    NODISCARD ALWAYS_INLINE static usize next_boundary(StringView text, usize byte_offset) { return next_word_boundary(text, byte_offset); }
+};
+
+// Iterates over the segments of a text that are delimited by consecutive boundaries of one kind. Dereferencing the
+// iterator yields the iterator itself, so the text and the offset of the segment can be accessed in range-based for
+// loops.
+template<typename Segmentation>
+class TextSegmentIterator {
+public:
+    ALWAYS_INLINE TextSegmentIterator(StringView text, usize byte_offset)
+        : m_text(text)
+        , m_begin_offset(byte_offset)
+        , m_end_offset(Segmentation::next_boundary(text, byte_offset))
+    {}
+
+    NODISCARD ALWAYS_INLINE bool operator==(const TextSegmentIterator& other) const { return (m_begin_offset == other.m_begin_offset); }
+    NODISCARD ALWAYS_INLINE bool operator!=(const TextSegmentIterator& other) const { return (m_begin_offset != other.m_begin_offset); }
+
+    NODISCARD ALWAYS_INLINE const TextSegmentIterator& operator*() const { return *this; }
+
+    ALWAYS_INLINE TextSegmentIterator& operator++()
+    {
+        m_begin_offset = m_end_offset;
+        m_end_offset = Segmentation::next_boundary(m_text, m_begin_offset);
+        return *this;
+    }
+
+    NODISCARD ALWAYS_INLINE usize byte_offset() const { return m_begin_offset; }
+    NODISCARD ALWAYS_INLINE usize byte_count() const { return m_end_offset - m_begin_offset; }
+
+    NODISCARD ALWAYS_INLINE StringView text() const
+    {
+        return StringView::from_utf8(m_text.characters() + m_begin_offset, m_end_offset - m_begin_offset);
+    }
+
+private:
+    StringView m_text;
+    usize m_begin_offset;
+    usize m_end_offset;
+};
+
+template<typename Segmentation>
+class TextSegments {
+public:
+    ALWAYS_INLINE explicit TextSegments(StringView text)
+        : m_text(text)
+    {}
+
+    NODISCARD ALWAYS_INLINE TextSegmentIterator<Segmentation> begin() const { return { m_text, 0 }; }
+    NODISCARD ALWAYS_INLINE TextSegmentIterator<Segmentation> end() const { return { m_text, m_text.byte_count() }; }
+
+private:
+    StringView m_text;
+};
+
+using GraphemeIterator = TextSegmentIterator<GraphemeSegmentation>;
+using WordIterator = TextSegmentIterator<WordSegmentation>;
+
+// NOTE: Usage: `for (const GraphemeIterator& grapheme : GraphemeClusters(text))`.
+using GraphemeClusters = TextSegments<GraphemeSegmentation>;
+using Words = TextSegments<WordSegmentation>;
+
+} // namespace Graphics
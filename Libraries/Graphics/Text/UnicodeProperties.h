@@ -0,0 +1,216 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#pragma once
+
+#include <AT/Types.h>
+#include <Graphics/API.h>
+
+namespace Graphics {
+
+// The values of the General_Category property of Unicode. The abbreviation that the standard uses for each category
+// is given next to it.
+enum class GeneralCategory : u8 {
+    UppercaseLetter, // Lu
+    LowercaseLetter, // Ll
+    TitlecaseLetter, // Lt
+    ModifierLetter, // Lm
+    OtherLetter, // Lo
+    NonspacingMark, // Mn
+    SpacingMark, // Mc
+    EnclosingMark, // Me
+    DecimalNumber, // Nd
+    LetterNumber, // Nl
+    OtherNumber, // No
+    ConnectorPunctuation, // Pc
+    DashPunctuation, // Pd
+    OpenPunctuation, // Ps
+    ClosePunctuation, // Pe
+    InitialPunctuation, // Pi
+    FinalPunctuation, // Pf
+    OtherPunctuation, // Po
+    MathSymbol, // Sm
+    CurrencySymbol, // Sc
+    ModifierSymbol, // Sk
+    OtherSymbol, // So
+    SpaceSeparator, // Zs
+    LineSeparator, // Zl
+    ParagraphSeparator, // Zp
+    Control, // Cc
+    Format, // Cf
+    Surrogate, // Cs
+    PrivateUse, // Co
+    Unassigned, // Cn
+};
+
+// The values of the Line_Break property of Unicode, as defined by UAX #14. The abbreviation that the standard uses
+// for each class is given next to it.
+enum class LineBreakClass : u8 {
+    MandatoryBreak, // BK
+    CarriageReturn, // CR
+    LineFeed, // LF
+    CombiningMark, // CM
+    NextLine, // NL
+    Surrogate, // SG
+    WordJoiner, // WJ
+    ZeroWidthSpace, // ZW
+    NonBreaking, // GL
+    Space, // SP
+    ZeroWidthJoiner, // ZWJ
+    BreakOpportunityBeforeAndAfter, // B2
+    BreakAfter, // BA
+    BreakBefore, // BB
+    Hyphen, // HY
+    ContingentBreak, // CB
+    ClosePunctuation, // CL
+    CloseParenthesis, // CP
+    Exclamation, // EX
+    Inseparable, // IN
+    Nonstarter, // NS
+    OpenPunctuation, // OP
+    Quotation, // QU
+    InfixNumericSeparator, // IS
+    Numeric, // NU
+    PostfixNumeric, // PO
+    PrefixNumeric, // PR
+    SymbolsAllowingBreakAfter, // SY
+    Ambiguous, // AI
+    Alphabetic, // AL
+    ConditionalJapaneseStarter, // CJ
+    EmojiBase, // EB
+    EmojiModifier, // EM
+    HangulLvSyllable, // H2
+    HangulLvtSyllable, // H3
+    HebrewLetter, // HL
+    Ideographic, // ID
+    HangulLJamo, // JL
+    HangulVJamo, // JV
+    HangulTJamo, // JT
+    RegionalIndicator, // RI
+    ComplexContext, // SA
+    Unknown, // XX
+};
+
+
+// The values of the Grapheme_Cluster_Break property of Unicode, as defined by UAX #29.
+enum class GraphemeClusterBreak : u8 {
+    Other,
+    CarriageReturn,
+    LineFeed,
+    Control,
+    Extend,
+    ZeroWidthJoiner,
+    RegionalIndicator,
+    Prepend,
+    SpacingMark,
+    HangulLJamo, // L
+    HangulVJamo, // V
+    HangulTJamo, // T
+    HangulLvSyllable, // LV
+    HangulLvtSyllable, // LVT
+};
+
+// The values of the East_Asian_Width property of Unicode, as defined by UAX #11.
+enum class EastAsianWidth : u8 {
+    Neutral, // N
+    Ambiguous, // A
+    Halfwidth, // H
+    Fullwidth, // F
+    Narrow, // Na
+    Wide, // W
+};
+
+// The values of the Word_Break property of Unicode, as defined by UAX #29.
+enum class WordBreak : u8 {
+    Other,
+    CarriageReturn,
+    LineFeed,
+    Newline,
+    Extend,
+    ZeroWidthJoiner,
+    RegionalIndicator,
+    Format,
+    Katakana,
+    HebrewLetter,
+    Letter, // ALetter
+    SingleQuote,
+    DoubleQuote,
+    MidNumberLetter, // MidNumLet
+    MidLetter,
+    MidNumber, // MidNum
+    Numeric,
+    ExtendNumberLetter, // ExtendNumLet
+    WordSegmentSpace, // WSegSpace
+};
+
+// The properties of a code point that text segmentation and layout need.
+struct CodePointProperties {
+    GeneralCategory general_category;
+    LineBreakClass line_break_class;
+    GraphemeClusterBreak grapheme_cluster_break;
+    EastAsianWidth east_asian_width;
+    WordBreak word_break;
+    bool is_extended_pictographic;
+};
+
+namespace Implementation {
+
+inline constexpr u32 max_code_point = 0x10FFFF;
+inline constexpr u32 unicode_property_block_shift = 8;
+inline constexpr u32 unicode_property_block_size = 1 << unicode_property_block_shift;
+inline constexpr u32 unicode_property_block_count = (max_code_point + 1) >> unicode_property_block_shift;
+
+// NOTE: The tables are generated, see UnicodeData.cpp. The properties of the first entry are those of the code
+//       points that are not assigned, which are also used for the values that are not code points.
+GRAPHICS_API extern const u8 unicode_property_block_indices[unicode_property_block_count];
+GRAPHICS_API extern const u16 unicode_property_indices[];
+GRAPHICS_API extern const CodePointProperties unicode_properties[];
+
+} // namespace Implementation
+
+// Looks up the properties of the code point in a two-stage table, which costs two dependent loads and no branches
+// besides the range check, regardless of where the code point is.
+NODISCARD ALWAYS_INLINE const CodePointProperties& code_point_properties(u32 code_point)
+{
+    if (code_point > Implementation::max_code_point)
+        return Implementation::unicode_properties[0];
+
+    const u32 block_index = Implementation::unicode_property_block_indices[code_point >> Implementation::unicode_property_block_shift];
+    const u32 block_offset = block_index << Implementation::unicode_property_block_shift;
+    const u32 offset_in_block = code_point & (Implementation::unicode_property_block_size - 1);
+    return Implementation::unicode_properties[Implementation::unicode_property_indices[block_offset | offset_in_block]];
+}
+
+NODISCARD ALWAYS_INLINE GeneralCategory general_category(u32 code_point)
+{
+    return code_point_properties(code_point).general_category;
+}
+
+NODISCARD ALWAYS_INLINE LineBreakClass line_break_class(u32 code_point)
+{
+    return code_point_properties(code_point).line_break_class;
+}
+
+NODISCARD ALWAYS_INLINE GraphemeClusterBreak grapheme_cluster_break(u32 code_point)
+{
+    return code_point_properties(code_point).grapheme_cluster_break;
+}
+
+NODISCARD ALWAYS_INLINE EastAsianWidth east_asian_width(u32 code_point)
+{
+    return code_point_properties(code_point).east_asian_width;
+}
+
+NODISCARD ALWAYS_INLINE WordBreak word_break(u32 code_point)
+{
+    return code_point_properties(code_point).word_break;
+}
+
+NODISCARD ALWAYS_INLINE bool is_extended_pictographic(u32 code_point)
+{
+    return code_point_properties(code_point).is_extended_pictographic;
+}
+
+} // namespace Graphics
@@ -0,0 +1,226 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#include <Graphics/TileRasterizer.h>
+
+namespace Graphics {
+
+TileRasterizer::TileRasterizer(Core::ThreadPool* thread_pool)
+    : m_thread_pool(thread_pool)
+{}
+
+TileRasterizer::~TileRasterizer()
+{
+    // NOTE: Destroying the rasterizer in the middle of a frame would leave the target partially rendered.
+    VERIFY(m_target == nullptr);
+}
+
+void TileRasterizer::begin_frame(Bitmap& target)
+{
+    VERIFY(m_target == nullptr);
+    m_target = &target;
+    m_commands.clear();
+    prepare_tiles(target);
+}
+
+void TileRasterizer::end_frame()
+{
+    VERIFY(m_target != nullptr);
+    bin_commands();
+
+    m_next_active_tile.store(0, std::memory_order_relaxed);
+    u32 job_count = 0;
+    if (m_thread_pool != nullptr && m_active_tiles.count() > 1) {
+        // NOTE: The calling thread rasterizes tiles as well, so one job fewer than the number of tiles is enough.
+        job_count = m_thread_pool->worker_count();
+        if (job_count > m_active_tiles.count() - 1)
+            job_count = static_cast<u32>(m_active_tiles.count() - 1);
+    }
+
+    if (job_count > 0) {
+        {
+            std::unique_lock<std::mutex> lock(m_completion_mutex);
+            m_pending_job_count = job_count;
+        }
+        for (u32 job_index = 0; job_index < job_count; ++job_index)
+            m_thread_pool->enqueue(Core::Job::from_function(rasterize_tiles_job, this));
+    }
+
+    rasterize_tiles();
+
+    if (job_count > 0) {
+        std::unique_lock<std::mutex> lock(m_completion_mutex);
+        m_completion_condition.wait(lock, [this] { return (m_pending_job_count == 0); });
+    }
+
+    m_commands.clear();
+    m_target = nullptr;
+}
+
+void TileRasterizer::fill_rect(const IntRect& rect, Color color)
+{
+    RasterCommand command = {};
+    command.type = RasterCommandType::FillRect;
+    command.bounds = rect;
+    command.color = color;
+    add_command(command);
+}
+
+void TileRasterizer::blit(IntPoint position, const Bitmap& source, const IntRect& source_rect)
+{
+    RasterCommand command = {};
+    command.type = RasterCommandType::Blit;
+    command.bounds = source_rect.intersected(source.rect()).translated(position.x - source_rect.x, position.y - source_rect.y);
+    command.position = position;
+    command.source = &source;
+    command.source_rect = source_rect;
+    add_command(command);
+}
+
+void TileRasterizer::blit_with_opacity(IntPoint position, const Bitmap& source, const IntRect& source_rect, f32 opacity)
+{
+    if (!(opacity > 0.0F))
+        return;
+
+    RasterCommand command = {};
+    command.type = RasterCommandType::BlitWithOpacity;
+    command.bounds = source_rect.intersected(source.rect()).translated(position.x - source_rect.x, position.y - source_rect.y);
+    command.position = position;
+    command.source = &source;
+    command.source_rect = source_rect;
+    command.opacity = opacity;
+    add_command(command);
+}
+
+void TileRasterizer::add_command(const RasterCommand& command)
+{
+    VERIFY(m_target != nullptr);
+    // NOTE: The tiles of the target are written concurrently, so they can't also be the source of a command.
+    VERIFY(command.source != m_target);
+
+    RasterCommand clipped_command = command;
+    clipped_command.bounds = command.bounds.intersected(m_target->rect());
+    if (clipped_command.bounds.is_empty())
+        return;
+    m_commands.add(clipped_command);
+}
+
+void TileRasterizer::prepare_tiles(Bitmap& target)
+{
+    const u32 horizontal_tile_count = (target.width() + tile_size - 1) / tile_size;
+    const u32 vertical_tile_count = (target.height() + tile_size - 1) / tile_size;
+
+    // NOTE: Rendering to the same surface in every frame is the common case, in which the views are reused.
+    if (m_tile_views.has_elements() && horizontal_tile_count == m_horizontal_tile_count && vertical_tile_count == m_vertical_tile_count) {
+        const Bitmap& first_view = *m_tile_views[0];
+        if (first_view.pixels() == target.pixels() && first_view.stride() == target.stride() && first_view.format() == target.format()) {
+            const Bitmap& last_view = *m_tile_views[m_tile_views.count() - 1];
+            const bool is_same_size = (last_view.width() == target.width() - (horizontal_tile_count - 1) * tile_size) &&
+                                      (last_view.height() == target.height() - (vertical_tile_count - 1) * tile_size);
+            if (is_same_size)
+                return;
+        }
+    }
+
+    m_horizontal_tile_count = horizontal_tile_count;
+    m_vertical_tile_count = vertical_tile_count;
+    m_tile_views.clear();
+
+    const usize pixel_byte_count = bytes_per_pixel(target.format());
+    for (u32 tile_y = 0; tile_y < vertical_tile_count; ++tile_y) {
+        const u32 y = tile_y * tile_size;
+        const u32 height = (target.height() - y < tile_size) ? (target.height() - y) : tile_size;
+        for (u32 tile_x = 0; tile_x < horizontal_tile_count; ++tile_x) {
+            const u32 x = tile_x * tile_size;
+            const u32 width = (target.width() - x < tile_size) ? (target.width() - x) : tile_size;
+            RefPtr<Bitmap> view = Bitmap::create_wrapper(target.format(), width, height, target.stride(), target.scanline(y) + x * pixel_byte_count);
+            VERIFY(view.is_valid());
+            m_tile_views.add(move(view));
+        }
+    }
+}
+
+void TileRasterizer::bin_commands()
+{
+    const usize tile_count = m_tile_views.count();
+    m_tile_command_offsets.clear();
+    for (usize tile_index = 0; tile_index <= tile_count; ++tile_index)
+        m_tile_command_offsets.add(0);
+
+    // NOTE: Count the commands of each tile, then turn the counts into the end offsets of the bins.
+    for (usize command_index = 0; command_index < m_commands.count(); ++command_index) {
+        const IntRect& bounds = m_commands[command_index].bounds;
+        for (u32 tile_y = bounds.top() / tile_size; tile_y <= (bounds.bottom() - 1) / tile_size; ++tile_y) {
+            for (u32 tile_x = bounds.left() / tile_size; tile_x <= (bounds.right() - 1) / tile_size; ++tile_x)
+                ++m_tile_command_offsets[tile_y * m_horizontal_tile_count + tile_x];
+        }
+    }
+
+    for (usize tile_index = 1; tile_index <= tile_count; ++tile_index)
+        m_tile_command_offsets[tile_index] += m_tile_command_offsets[tile_index - 1];
+
+    const u32 binned_command_count = m_tile_command_offsets[tile_count];
+    m_binned_commands.clear();
+    for (u32 binned_command_index = 0; binned_command_index < binned_command_count; ++binned_command_index)
+        m_binned_commands.add(0);
+
+    // NOTE: Filling each bin from its end while walking the commands backwards keeps them in the recording order.
+    //       Once done, each offset points to the start of its bin, which is the end of the previous one.
+    for (usize command_index = m_commands.count(); command_index > 0; --command_index) {
+        const IntRect& bounds = m_commands[command_index - 1].bounds;
+        for (u32 tile_y = bounds.top() / tile_size; tile_y <= (bounds.bottom() - 1) / tile_size; ++tile_y) {
+            for (u32 tile_x = bounds.left() / tile_size; tile_x <= (bounds.right() - 1) / tile_size; ++tile_x) {
+                u32& offset = m_tile_command_offsets[tile_y * m_horizontal_tile_count + tile_x];
+                m_binned_commands[--offset] = static_cast<u32>(command_index - 1);
+            }
+        }
+    }
+
+    m_active_tiles.clear();
+    for (u32 tile_index = 0; tile_index < tile_count; ++tile_index) {
+        if (m_tile_command_offsets[tile_index + 1] > m_tile_command_offsets[tile_index])
+            m_active_tiles.add(tile_index);
+    }
+}
+
+void TileRasterizer::rasterize_tile(u32 tile_index)
+{
+    Bitmap& view = *m_tile_views[tile_index];
+    const s32 origin_x = static_cast<s32>((tile_index % m_horizontal_tile_count) * tile_size);
+    const s32 origin_y = static_cast<s32>((tile_index / m_horizontal_tile_count) * tile_size);
+
+    for (u32 offset = m_tile_command_offsets[tile_index]; offset < m_tile_command_offsets[tile_index + 1]; ++offset) {
+        const RasterCommand& command = m_commands[m_binned_commands[offset]];
+        const IntPoint position = { command.position.x - origin_x, command.position.y - origin_y };
+
+        switch (command.type) {
+            case RasterCommandType::FillRect: view.fill_rect(command.bounds.translated(-origin_x, -origin_y), command.color); break;
+            case RasterCommandType::Blit: view.blit(position, *command.source, command.source_rect); break;
+            case RasterCommandType::BlitWithOpacity: view.blit_with_opacity(position, *command.source, command.source_rect, command.opacity); break;
+        }
+    }
+}
+
+void TileRasterizer::rasterize_tiles()
+{
+    while (true) {
+        const u32 active_tile_index = m_next_active_tile.fetch_add(1, std::memory_order_relaxed);
+        if (active_tile_index >= m_active_tiles.count())
+            break;
+        rasterize_tile(m_active_tiles[active_tile_index]);
+    }
+}
+
+void TileRasterizer::rasterize_tiles_job(void* user_data)
+{
+    TileRasterizer& rasterizer = *static_cast<TileRasterizer*>(user_data);
+    rasterizer.rasterize_tiles();
+
+    std::unique_lock<std::mutex> lock(rasterizer.m_completion_mutex);
+    if (--rasterizer.m_pending_job_count == 0)
+        rasterizer.m_completion_condition.notify_one();
+}
+
+} // namespace Graphics
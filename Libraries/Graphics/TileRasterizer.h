@@ -0,0 +1,117 @@
+/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#pragma once
+
+#include <AT/RefPtr.h>
+#include <AT/Vector.h>
+#include <Core/ThreadPool.h>
+#include <Graphics/API.h>
+#include <Graphics/Bitmap.h>
+
+// NOTE: Headers from the standard library.
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
+namespace Graphics {
+
+enum class RasterCommandType : u8 {
+    FillRect,
+    Blit,
+    BlitWithOpacity,
+};
+
+struct RasterCommand {
+    RasterCommandType type;
+    // NOTE: The pixels of the target that are touched by the command, already clipped to the target.
+    IntRect bounds;
+
+    Color color;
+    IntPoint position;
+    const Bitmap* source { nullptr };
+    IntRect source_rect;
+    f32 opacity { 1.0F };
+};
+
+// Rasterizer that splits the target into square tiles and renders the tiles in parallel.
+//
+// The draw commands of a frame are only recorded, and each of them is binned into the tiles that its bounds
+// overlap. When the frame ends, every tile that has at least one command is claimed by one of the threads, which
+// applies all of the commands of that tile in order. A tile is small enough to remain in the L1 or L2 cache while
+// this happens, so each cache line of the target is loaded from memory once per frame, regardless of how many
+// commands touch it. As the tiles don't overlap, no synchronization is required between the threads.
+class TileRasterizer {
+    AT_MAKE_NONCOPYABLE(TileRasterizer);
+    AT_MAKE_NONMOVABLE(TileRasterizer);
+
+public:
+    // NOTE: A 64x64 tile of 32-bit pixels occupies 16 KiB, which fits in the L1 data cache of most CPUs.
+    static constexpr u32 tile_size = 64;
+
+    // NOTE: Without a thread pool, all the tiles are rasterized on the thread that ends the frame. The thread pool
+    //       must outlive the rasterizer.
+    GRAPHICS_API explicit TileRasterizer(Core::ThreadPool* thread_pool = nullptr);
+    GRAPHICS_API ~TileRasterizer();
+
+public:
+    NODISCARD ALWAYS_INLINE u32 horizontal_tile_count() const { return m_horizontal_tile_count; }
+    NODISCARD ALWAYS_INLINE u32 vertical_tile_count() const { return m_vertical_tile_count; }
+    NODISCARD ALWAYS_INLINE usize command_count() const { return m_commands.count(); }
+
+    // NOTE: The number of tiles that had at least one command in the last rendered frame.
+    NODISCARD ALWAYS_INLINE usize active_tile_count() const { return m_active_tiles.count(); }
+
+    // Starts recording a new frame. The target must remain alive until the frame ends.
+    GRAPHICS_API void begin_frame(Bitmap& target);
+
+    // Bins the recorded commands and rasterizes all the tiles. Blocks until the whole frame is rendered.
+    GRAPHICS_API void end_frame();
+
+public:
+    // NOTE: The source bitmaps of the commands must remain alive and unmodified until the frame ends.
+    GRAPHICS_API void fill_rect(const IntRect& rect, Color color);
+    GRAPHICS_API void blit(IntPoint position, const Bitmap& source, const IntRect& source_rect);
+    GRAPHICS_API void blit_with_opacity(IntPoint position, const Bitmap& source, const IntRect& source_rect, f32 opacity);
+
+    GRAPHICS_API void add_command(const RasterCommand& command);
+
+private:
+    // Creates the views of the tiles, if the target changed since the previous frame.
+    void prepare_tiles(Bitmap& target);
+
+    // Sorts the commands by tile, keeping the recording order inside each tile, in the same way as a counting sort.
+    void bin_commands();
+
+    void rasterize_tile(u32 tile_index);
+
+    // Rasterizes tiles until none of them is left unclaimed.
+    void rasterize_tiles();
+    static void rasterize_tiles_job(void* user_data);
+
+private:
+    Core::ThreadPool* m_thread_pool;
+    Bitmap* m_target { nullptr };
+    u32 m_horizontal_tile_count { 0 };
+    u32 m_vertical_tile_count { 0 };
+
+    // NOTE: Each view wraps the pixels of one tile of the target, so the commands can be applied to a tile using
+    //       the regular bitmap operations, which clip them to the bounds of the tile.
+    Vector<RefPtr<Bitmap>> m_tile_views;
+
+    Vector<RasterCommand> m_commands;
+
+    // NOTE: The commands of tile `i` are `m_binned_commands[m_tile_command_offsets[i] .. m_tile_command_offsets[i + 1]]`.
+    Vector<u32> m_tile_command_offsets;
+    Vector<u32> m_binned_commands;
+    Vector<u32> m_active_tiles;
+
+    std::atomic<u32> m_next_active_tile { 0 };
+    std::mutex m_completion_mutex;
+    std::condition_variable m_completion_condition;
+    u32 m_pending_job_count { 0 };
+};
+
+} // namespace Graphics
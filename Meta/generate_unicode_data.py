@@ -0,0 +1,361 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2024 Traian Avram. All rights reserved.
+# SPDX-License-Identifier: BSD-3-Clause.
+#
+
+"""
+Generates Libraries/Graphics/Text/UnicodeData.cpp, the two-stage tables of the code point properties that are used
+by line breaking and text segmentation.
+
+The properties are read from the text files of the Unicode Character Database, version 14.0.0, which can be
+downloaded from https://www.unicode.org/Public/14.0.0/ucd/. The directory must contain these files, laid out as in
+the database itself:
+
+    LineBreak.txt
+    EastAsianWidth.txt
+    extracted/DerivedGeneralCategory.txt
+    auxiliary/GraphemeBreakProperty.txt
+    auxiliary/WordBreakProperty.txt
+    emoji/emoji-data.txt
+
+Usage:
+
+    python3 Meta/generate_unicode_data.py --ucd-directory <path to the ucd directory>
+
+When the database isn't available, the same properties can be read from the tables that Perl compiles from it, which
+are part of every Perl installation and must be compiled from the same version of the database:
+
+    python3 Meta/generate_unicode_data.py --perl-unicore-directory /usr/share/perl/5.36.0/unicore
+
+Both sources produce the same file. The generated file is written over the one in the tree, unless another path is
+given with --output.
+"""
+
+import argparse
+import os
+import re
+import sys
+
+UNICODE_VERSION = '14.0.0'
+CODE_POINT_COUNT = 0x110000
+
+# NOTE: The size of the blocks of the first stage must match `unicode_property_block_size` in UnicodeProperties.h.
+BLOCK_SIZE = 256
+
+REPOSITORY_DIRECTORY = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..')
+DEFAULT_OUTPUT_PATH = os.path.join(REPOSITORY_DIRECTORY, 'Libraries', 'Graphics', 'Text', 'UnicodeData.cpp')
+
+#
+# The names of the enumerators in UnicodeProperties.h, keyed by the short names of the property values.
+#
+
+GENERAL_CATEGORIES = {
+    'Lu': 'UppercaseLetter', 'Ll': 'LowercaseLetter', 'Lt': 'TitlecaseLetter', 'Lm': 'ModifierLetter', 'Lo': 'OtherLetter',
+    'Mn': 'NonspacingMark', 'Mc': 'SpacingMark', 'Me': 'EnclosingMark',
+    'Nd': 'DecimalNumber', 'Nl': 'LetterNumber', 'No': 'OtherNumber',
+    'Pc': 'ConnectorPunctuation', 'Pd': 'DashPunctuation', 'Ps': 'OpenPunctuation', 'Pe': 'ClosePunctuation',
+    'Pi': 'InitialPunctuation', 'Pf': 'FinalPunctuation', 'Po': 'OtherPunctuation',
+    'Sm': 'MathSymbol', 'Sc': 'CurrencySymbol', 'Sk': 'ModifierSymbol', 'So': 'OtherSymbol',
+    'Zs': 'SpaceSeparator', 'Zl': 'LineSeparator', 'Zp': 'ParagraphSeparator',
+    'Cc': 'Control', 'Cf': 'Format', 'Cs': 'Surrogate', 'Co': 'PrivateUse', 'Cn': 'Unassigned',
+}
+
+LINE_BREAK_CLASSES = {
+    'BK': 'MandatoryBreak', 'CR': 'CarriageReturn', 'LF': 'LineFeed', 'CM': 'CombiningMark', 'NL': 'NextLine',
+    'SG': 'Surrogate', 'WJ': 'WordJoiner', 'ZW': 'ZeroWidthSpace', 'GL': 'NonBreaking', 'SP': 'Space',
+    'ZWJ': 'ZeroWidthJoiner', 'B2': 'BreakOpportunityBeforeAndAfter', 'BA': 'BreakAfter', 'BB': 'BreakBefore',
+    'HY': 'Hyphen', 'CB': 'ContingentBreak', 'CL': 'ClosePunctuation', 'CP': 'CloseParenthesis', 'EX': 'Exclamation',
+    'IN': 'Inseparable', 'NS': 'Nonstarter', 'OP': 'OpenPunctuation', 'QU': 'Quotation',
+    'IS': 'InfixNumericSeparator', 'NU': 'Numeric', 'PO': 'PostfixNumeric', 'PR': 'PrefixNumeric',
+    'SY': 'SymbolsAllowingBreakAfter', 'AI': 'Ambiguous', 'AL': 'Alphabetic', 'CJ': 'ConditionalJapaneseStarter',
+    'EB': 'EmojiBase', 'EM': 'EmojiModifier', 'H2': 'HangulLvSyllable', 'H3': 'HangulLvtSyllable',
+    'HL': 'HebrewLetter', 'ID': 'Ideographic', 'JL': 'HangulLJamo', 'JV': 'HangulVJamo', 'JT': 'HangulTJamo',
+    'RI': 'RegionalIndicator', 'SA': 'ComplexContext', 'XX': 'Unknown',
+}
+
+GRAPHEME_CLUSTER_BREAKS = {
+    'Other': 'Other', 'CR': 'CarriageReturn', 'LF': 'LineFeed', 'Control': 'Control', 'Extend': 'Extend',
+    'ZWJ': 'ZeroWidthJoiner', 'Regional_Indicator': 'RegionalIndicator', 'Prepend': 'Prepend',
+    'SpacingMark': 'SpacingMark', 'L': 'HangulLJamo', 'V': 'HangulVJamo', 'T': 'HangulTJamo',
+    'LV': 'HangulLvSyllable', 'LVT': 'HangulLvtSyllable',
+}
+
+EAST_ASIAN_WIDTHS = {
+    'N': 'Neutral', 'A': 'Ambiguous', 'H': 'Halfwidth', 'F': 'Fullwidth', 'Na': 'Narrow', 'W': 'Wide',
+}
+
+WORD_BREAKS = {
+    'Other': 'Other', 'CR': 'CarriageReturn', 'LF': 'LineFeed', 'Newline': 'Newline', 'Extend': 'Extend',
+    'ZWJ': 'ZeroWidthJoiner', 'Regional_Indicator': 'RegionalIndicator', 'Format': 'Format', 'Katakana': 'Katakana',
+    'Hebrew_Letter': 'HebrewLetter', 'ALetter': 'Letter', 'Single_Quote': 'SingleQuote',
+    'Double_Quote': 'DoubleQuote', 'MidNumLet': 'MidNumberLetter', 'MidLetter': 'MidLetter', 'MidNum': 'MidNumber',
+    'Numeric': 'Numeric', 'ExtendNumLet': 'ExtendNumberLetter', 'WSegSpace': 'WordSegmentSpace',
+}
+
+# NOTE: The values of the unassigned code points in some ranges of LineBreak.txt and EastAsianWidth.txt, which
+#       version 14.0.0 only documents in the comments at the top of the files, and not as `@missing` lines. They
+#       override the default value of the whole code space.
+LINE_BREAK_DEFAULT_RANGES = [
+    (0x3400, 0x4DBF, 'ID'),
+    (0x4E00, 0x9FFF, 'ID'),
+    (0xF900, 0xFAFF, 'ID'),
+    (0x20000, 0x2FFFD, 'ID'),
+    (0x30000, 0x3FFFD, 'ID'),
+    (0x1F000, 0x1FAFF, 'ID'),
+    (0x1FC00, 0x1FFFD, 'ID'),
+    (0x20A0, 0x20CF, 'PR'),
+]
+
+EAST_ASIAN_WIDTH_DEFAULT_RANGES = [
+    (0x3400, 0x4DBF, 'W'),
+    (0x4E00, 0x9FFF, 'W'),
+    (0xF900, 0xFAFF, 'W'),
+    (0x20000, 0x2FFFD, 'W'),
+    (0x30000, 0x3FFFD, 'W'),
+]
+
+
+def assign_range(values, first, last, value):
+    for code_point in range(first, last + 1):
+        values[code_point] = value
+
+
+#
+# Unicode Character Database.
+#
+
+UCD_LINE_PATTERN = re.compile(r'^([0-9A-F]+)(?:\.\.([0-9A-F]+))?\s*;\s*([^#;]+?)\s*(?:[#;].*)?$')
+UCD_MISSING_PATTERN = re.compile(r'^#\s*@missing:\s*([0-9A-F]+)\.\.([0-9A-F]+)\s*;\s*([^#;]+?)\s*$')
+
+
+def load_ucd_property(path, default_value, default_ranges=()):
+    with open(path, encoding='utf-8') as file:
+        lines = file.read().splitlines()
+
+    # NOTE: The values of the code points that aren't listed are applied first, from the widest range to the
+    #       narrowest one, and then overridden by the listed code points.
+    values = [default_value] * CODE_POINT_COUNT
+    for line in lines:
+        match = UCD_MISSING_PATTERN.match(line)
+        if match:
+            assign_range(values, int(match.group(1), 16), int(match.group(2), 16), match.group(3))
+    for first, last, value in default_ranges:
+        assign_range(values, first, last, value)
+
+    for line in lines:
+        match = UCD_LINE_PATTERN.match(line)
+        if not match:
+            continue
+        first = int(match.group(1), 16)
+        last = int(match.group(2), 16) if match.group(2) else first
+        assign_range(values, first, last, match.group(3))
+    return values
+
+
+def load_ucd_binary_property(path, property_name):
+    values = [False] * CODE_POINT_COUNT
+    with open(path, encoding='utf-8') as file:
+        for line in file:
+            match = UCD_LINE_PATTERN.match(line.rstrip('\n'))
+            if not match or match.group(3) != property_name:
+                continue
+            first = int(match.group(1), 16)
+            last = int(match.group(2), 16) if match.group(2) else first
+            assign_range(values, first, last, True)
+    return values
+
+
+def load_from_ucd(directory):
+    general_categories = load_ucd_property(os.path.join(directory, 'extracted', 'DerivedGeneralCategory.txt'), 'Cn')
+    line_break_classes = load_ucd_property(os.path.join(directory, 'LineBreak.txt'), 'XX', LINE_BREAK_DEFAULT_RANGES)
+    grapheme_cluster_breaks = load_ucd_property(os.path.join(directory, 'auxiliary', 'GraphemeBreakProperty.txt'), 'Other')
+    east_asian_widths = load_ucd_property(os.path.join(directory, 'EastAsianWidth.txt'), 'N', EAST_ASIAN_WIDTH_DEFAULT_RANGES)
+    word_breaks = load_ucd_property(os.path.join(directory, 'auxiliary', 'WordBreakProperty.txt'), 'Other')
+    extended_pictographic = load_ucd_binary_property(os.path.join(directory, 'emoji', 'emoji-data.txt'), 'Extended_Pictographic')
+    return general_categories, line_break_classes, grapheme_cluster_breaks, east_asian_widths, word_breaks, extended_pictographic
+
+
+#
+# Perl tables.
+#
+
+PERL_LINE_PATTERN = re.compile(r'^([0-9A-F]+)\t([0-9A-F]*)\t(\w+)$')
+
+
+def load_perl_property(directory, name, default_value):
+    values = [default_value] * CODE_POINT_COUNT
+    with open(os.path.join(directory, 'To', name + '.pl'), encoding='utf-8') as file:
+        for line in file:
+            match = PERL_LINE_PATTERN.match(line.rstrip('\n'))
+            if not match:
+                continue
+            first = int(match.group(1), 16)
+            last = int(match.group(2), 16) if match.group(2) else first
+            assign_range(values, first, last, match.group(3))
+    return values
+
+
+def load_perl_binary_property(directory, path):
+    # NOTE: The file lists the code points where the property changes its value, starting with true.
+    values = [False] * CODE_POINT_COUNT
+    with open(os.path.join(directory, path), encoding='utf-8') as file:
+        boundaries = [int(line.strip()) for line in file if re.match(r'^\d+$', line.strip())]
+    for index in range(0, len(boundaries), 2):
+        end = boundaries[index + 1] if index + 1 < len(boundaries) else CODE_POINT_COUNT
+        assign_range(values, boundaries[index], end - 1, True)
+    return values
+
+
+def load_from_perl_unicore(directory):
+    with open(os.path.join(directory, 'version'), encoding='utf-8') as file:
+        version = file.read().strip()
+    if version != UNICODE_VERSION:
+        sys.exit(f'The Perl tables were compiled from version {version} of the database, but {UNICODE_VERSION} is required.')
+
+    general_categories = load_perl_property(directory, 'Gc', 'Cn')
+    line_break_classes = load_perl_property(directory, 'Lb', 'XX')
+    grapheme_cluster_breaks = load_perl_property(directory, 'GCB', 'Other')
+    east_asian_widths = load_perl_property(directory, 'Ea', 'N')
+    word_breaks = load_perl_property(directory, 'WB', 'Other')
+    extended_pictographic = load_perl_binary_property(directory, os.path.join('lib', 'ExtPict', 'Y.pl'))
+
+    # NOTE: Perl folds Extended_Pictographic into its tables of the segmentation properties, and tailors the
+    #       horizontal spaces of the word breaks. Both are undone, to get the values of the database.
+    for code_point in range(CODE_POINT_COUNT):
+        if grapheme_cluster_breaks[code_point].startswith('ExtPict'):
+            grapheme_cluster_breaks[code_point] = 'Other'
+        if word_breaks[code_point] in ('ExtPict_XX', 'Perl_Tailored_HSpace'):
+            word_breaks[code_point] = 'Other'
+        elif word_breaks[code_point] == 'ExtPict_LE':
+            word_breaks[code_point] = 'ALetter'
+    for code_point in [0x0020, 0x1680, 0x205F, 0x3000] + list(range(0x2000, 0x2007)) + list(range(0x2008, 0x200B)):
+        word_breaks[code_point] = 'WSegSpace'
+
+    return general_categories, line_break_classes, grapheme_cluster_breaks, east_asian_widths, word_breaks, extended_pictographic
+
+
+#
+# Tables.
+#
+
+def build_tables(properties):
+    enumerator_names = (GENERAL_CATEGORIES, LINE_BREAK_CLASSES, GRAPHEME_CLUSTER_BREAKS, EAST_ASIAN_WIDTHS, WORD_BREAKS)
+    for names, values in zip(enumerator_names, properties):
+        unknown_values = set(values) - set(names)
+        if unknown_values:
+            sys.exit(f'Unknown property values: {sorted(unknown_values)}')
+
+    general_categories, line_break_classes, grapheme_cluster_breaks, east_asian_widths, word_breaks, extended_pictographic = properties
+    code_point_properties = [
+        (
+            GENERAL_CATEGORIES[general_categories[code_point]],
+            LINE_BREAK_CLASSES[line_break_classes[code_point]],
+            GRAPHEME_CLUSTER_BREAKS[grapheme_cluster_breaks[code_point]],
+            EAST_ASIAN_WIDTHS[east_asian_widths[code_point]],
+            WORD_BREAKS[word_breaks[code_point]],
+            extended_pictographic[code_point],
+        )
+        for code_point in range(CODE_POINT_COUNT)
+    ]
+
+    # NOTE: The properties of an unassigned code point are the first entry, so that zero-initialized data means
+    #       "unassigned".
+    records = {code_point_properties[0x50000]: 0}
+    for entry in code_point_properties:
+        records.setdefault(entry, len(records))
+    record_indices = [records[entry] for entry in code_point_properties]
+
+    blocks = {}
+    block_indices = []
+    for block_start in range(0, CODE_POINT_COUNT, BLOCK_SIZE):
+        block = tuple(record_indices[block_start:block_start + BLOCK_SIZE])
+        block_indices.append(blocks.setdefault(block, len(blocks)))
+
+    if len(blocks) > 256 or len(records) > 65536:
+        sys.exit('The tables don\'t fit in the types of their indices.')
+    return block_indices, blocks, records
+
+
+def emit_list(lines, items, width):
+    line = '   '
+    for item in items:
+        item_text = ' ' + item + ','
+        if len(line) + len(item_text) > width:
+            lines.append(line)
+            line = '   '
+        line += item_text
+    lines.append(line)
+
+
+def generate_source(block_indices, blocks, records):
+    lines = [f'''/**
+ * Copyright (c) 2024 Traian Avram. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause.
+ */
+
+#include <Graphics/Text/UnicodeProperties.h>
+
+//
+// The properties of every code point, generated from the Unicode Character Database, version {UNICODE_VERSION}.
+// This file is generated by Meta/generate_unicode_data.py and must not be edited by hand.
+//
+// The properties of a code point are found in two steps. The index of its block of {BLOCK_SIZE} code points selects the
+// block of the data table, and the entry of the code point in that block is the index of its properties. Identical
+// blocks are only stored once, which is what makes the table compact: most of the code space is made of blocks that
+// are entirely unassigned, or entirely made of letters of the same script.
+//
+
+namespace Graphics::Implementation {{
+
+// clang-format off
+const u8 unicode_property_block_indices[unicode_property_block_count] = {{''']
+    emit_list(lines, [str(index) for index in block_indices], 120)
+    lines.append('};')
+    lines.append('')
+
+    lines.append(f'const u16 unicode_property_indices[{len(blocks)} * unicode_property_block_size] = {{')
+    for block, _ in sorted(blocks.items(), key=lambda item: item[1]):
+        emit_list(lines, [str(index) for index in block], 120)
+    lines.append('};')
+    lines.append('')
+
+    lines.append(f'const CodePointProperties unicode_properties[{len(records)}] = {{')
+    for record, _ in sorted(records.items(), key=lambda item: item[1]):
+        general_category, line_break_class, grapheme_cluster_break, east_asian_width, word_break, is_extended_pictographic = record
+        lines.append(
+            f'    {{ GeneralCategory::{general_category}, LineBreakClass::{line_break_class}, '
+            f'GraphemeClusterBreak::{grapheme_cluster_break},'
+        )
+        lines.append(
+            f'      EastAsianWidth::{east_asian_width}, WordBreak::{word_break}, '
+            f'{"true" if is_extended_pictographic else "false"} }},'
+        )
+    lines.append('};')
+    lines.append('// clang-format on')
+    lines.append('')
+    lines.append('} // namespace Graphics::Implementation')
+    return '\n'.join(lines) + '\n'
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Generates the tables of the Unicode code point properties.')
+    source = parser.add_mutually_exclusive_group(required=True)
+    source.add_argument('--ucd-directory', help=f'the directory of the Unicode Character Database {UNICODE_VERSION}')
+    source.add_argument('--perl-unicore-directory', help=f'the unicore directory of Perl, compiled from {UNICODE_VERSION}')
+    parser.add_argument('--output', default=DEFAULT_OUTPUT_PATH, help='the path of the generated source file')
+    arguments = parser.parse_args()
+
+    if arguments.ucd_directory:
+        properties = load_from_ucd(arguments.ucd_directory)
+    else:
+        properties = load_from_perl_unicore(arguments.perl_unicore_directory)
+
+    block_indices, blocks, records = build_tables(properties)
+    with open(arguments.output, 'w', encoding='utf-8', newline='\n') as file:
+        file.write(generate_source(block_indices, blocks, records))
+    print(f'{len(records)} distinct properties, {len(blocks)} distinct blocks.', file=sys.stderr)
+
+
+if __name__ == '__main__':
+    main()